@@ -93,6 +93,19 @@ typedef struct TAOS_FIELD_E {
   int32_t bytes;
 } TAOS_FIELD_E;
 
+// One column of a fetched block, laid out as in the Arrow C data interface: an LSB-first validity bitmap
+// (bit set means not null), length + 1 int32 offsets for BINARY/NCHAR/JSON and a contiguous value buffer.
+// BOOL values are bit-packed, NCHAR values are UTF-8. Buffers stay valid until the next fetch on the result.
+typedef struct TAOS_COLUMN {
+  int8_t         type;
+  int32_t        bytes;
+  int32_t        length;
+  int32_t        nullCount;
+  const uint8_t *validity;
+  const int32_t *offsets;
+  const void    *data;
+} TAOS_COLUMN;
+
 #ifdef WINDOWS
 #define DLL_EXPORT __declspec(dllexport)
 #else
@@ -178,6 +191,7 @@ DLL_EXPORT bool        taos_is_update_query(TAOS_RES *res);
 DLL_EXPORT int         taos_fetch_block(TAOS_RES *res, TAOS_ROW *rows);
 DLL_EXPORT int         taos_fetch_block_s(TAOS_RES *res, int *numOfRows, TAOS_ROW *rows);
 DLL_EXPORT int         taos_fetch_raw_block(TAOS_RES *res, int *numOfRows, void **pData);
+DLL_EXPORT int         taos_fetch_columns(TAOS_RES *res, int *numOfRows, TAOS_COLUMN **columns);
 DLL_EXPORT int        *taos_get_column_data_offset(TAOS_RES *res, int columnIndex);
 DLL_EXPORT int         taos_validate_sql(TAOS *taos, const char *sql);
 DLL_EXPORT void        taos_reset_current_db(TAOS *taos);
@@ -213,6 +213,11 @@ double blockDataGetSerialRowSize(const SSDataBlock* pBlock);
 size_t blockDataGetSerialMetaSize(uint32_t numOfCols);
 
 int32_t blockDataSort(SSDataBlock* pDataBlock, SArray* pOrderInfo);
+
+// Normalized sort keys: the order columns of each row are encoded into a fixed width key, so that two rows can be
+// compared by memcmp. Only the fixed width types are supported, -1 is returned for others.
+int32_t blockDataGetNormalizedKeyWidth(const SSDataBlock* pBlock, const SArray* pOrderInfo);
+void    blockDataEncodeNormalizedKeys(const SSDataBlock* pBlock, const SArray* pOrderInfo, char* pKeys, int32_t stride);
 int32_t blockDataSort_rv(SSDataBlock* pDataBlock, SArray* pOrderInfo, bool nullFirst);
 
 int32_t colInfoDataEnsureCapacity(SColumnInfoData* pColumn, uint32_t numOfRows);
@@ -258,6 +263,12 @@ static FORCE_INLINE int32_t blockGetEncodeSize(const SSDataBlock* pBlock) {
   return blockDataGetSerialMetaSize(taosArrayGetSize(pBlock->pDataBlock)) + blockDataGetSize(pBlock);
 }
 
+// each compressed column keeps its uncompressed length, and the codec may exceed the raw size by a few bytes
+static FORCE_INLINE int32_t blockGetCompressedEncodeSize(const SSDataBlock* pBlock) {
+  int32_t numOfCols = (int32_t)taosArrayGetSize(pBlock->pDataBlock);
+  return blockGetEncodeSize(pBlock) + numOfCols * (sizeof(int32_t) + COMP_OVERFLOW_BYTES);
+}
+
 static FORCE_INLINE int32_t blockCompressColData(SColumnInfoData* pColRes, int32_t numOfRows, char* data,
                                                  int8_t compressed) {
   int32_t colSize = colDataGetLength(pColRes, numOfRows);
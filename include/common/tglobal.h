@@ -39,6 +39,7 @@ extern int32_t tsMaxShellConns;
 extern int32_t tsShellActivityTimer;
 extern int32_t tsCompressMsgSize;
 extern int32_t tsCompressColData;
+extern bool    tsRpcDeflateCompress;
 extern int32_t tsMaxNumOfDistinctResults;
 extern int32_t tsCompatibleModel;
 extern bool    tsPrintAuth;
@@ -89,6 +90,7 @@ extern uint16_t tsTelemPort;
 // query buffer management
 extern int32_t tsQueryBufferSize;  // maximum allowed usage buffer size in MB for each data node during query processing
 extern int64_t tsQueryBufferSizeBytes;  // maximum allowed usage buffer size in byte for each data node
+extern int32_t tsQueryMaxTaskMemory;    // maximum hash table memory in MB for each query task, 0 for no limit
 
 // query client
 extern int32_t tsQueryPolicy;
@@ -97,9 +99,21 @@ extern int32_t tsQuerySmaOptimize;
 extern int32_t tsQueryRsmaTolerance;
 extern bool    tsQueryPlannerTrace;
 extern int32_t tsQueryNodeChunkSize;
+extern int32_t tsQueryScanParallelism;
 extern bool    tsQueryUseNodeAllocator;
 extern bool    tsKeepColumnName;
 
+// stream
+extern int32_t tsStreamDispatchBatchSize;  // maximum size in KB of the output coalesced into one dispatch message
+extern bool    tsStreamDispatchCompress;
+
+// snapshot
+extern bool tsSnapshotRawBlock;
+
+// tsdb
+extern bool tsAdaptiveCodec;
+extern bool tsDictCodec;
+
 // client
 extern int32_t tsMinSlidingTime;
 extern int32_t tsMinIntervalTime;
@@ -137,6 +151,7 @@ extern int32_t tsTransPullupInterval;
 extern int32_t tsMqRebalanceInterval;
 extern int32_t tsTtlUnit;
 extern int32_t tsTtlPushInterval;
+extern int32_t tsSyncPipelineWindow;
 extern int32_t tsGrantHBInterval;
 extern int32_t tsUptimeInterval;
 
@@ -1079,6 +1079,8 @@ typedef struct {
   int64_t compStorage;
   int64_t pointsWritten;
   int64_t numOfSelectReqs;
+  int64_t queryElapsedTime;  // us
+  int64_t memtableUsage;
   int64_t numOfInsertReqs;
   int64_t numOfInsertSuccessReqs;
   int64_t numOfBatchInsertReqs;
@@ -1247,6 +1249,19 @@ typedef struct {
 int32_t tSerializeSAlterVnodeReq(void* buf, int32_t bufLen, SAlterVnodeReq* pReq);
 int32_t tDeserializeSAlterVnodeReq(void* buf, int32_t bufLen, SAlterVnodeReq* pReq);
 
+typedef struct {
+  int32_t  srcVgId;
+  int32_t  dstVgId;
+  int32_t  dstVgVersion;
+  uint32_t srcHashBegin;
+  uint32_t srcHashEnd;
+  uint32_t dstHashBegin;
+  uint32_t dstHashEnd;
+} SAlterVnodeHashRangeReq;
+
+int32_t tSerializeSAlterVnodeHashRangeReq(void* buf, int32_t bufLen, SAlterVnodeHashRangeReq* pReq);
+int32_t tDeserializeSAlterVnodeHashRangeReq(void* buf, int32_t bufLen, SAlterVnodeHashRangeReq* pReq);
+
 typedef struct {
   SMsgHead header;
   char     dbFName[TSDB_DB_FNAME_LEN];
@@ -1529,11 +1544,28 @@ int32_t tDeserializeSKillTransReq(void* buf, int32_t bufLen, SKillTransReq* pReq
 
 typedef struct {
   int32_t useless;  // useless
+  int8_t  dryRun;
+  int32_t maxMoves;
 } SBalanceVgroupReq;
 
 int32_t tSerializeSBalanceVgroupReq(void* buf, int32_t bufLen, SBalanceVgroupReq* pReq);
 int32_t tDeserializeSBalanceVgroupReq(void* buf, int32_t bufLen, SBalanceVgroupReq* pReq);
 
+typedef struct {
+  int32_t vgId;
+  int32_t srcId;
+  int32_t dstId;
+  double  cost;
+} SBalanceVgroupMove;
+
+typedef struct {
+  SArray* pMoves;  // SArray<SBalanceVgroupMove>
+} SBalanceVgroupRsp;
+
+int32_t tSerializeSBalanceVgroupRsp(void* buf, int32_t bufLen, SBalanceVgroupRsp* pRsp);
+int32_t tDeserializeSBalanceVgroupRsp(void* buf, int32_t bufLen, SBalanceVgroupRsp* pRsp);
+void    tFreeSBalanceVgroupRsp(SBalanceVgroupRsp* pRsp);
+
 typedef struct {
   int32_t vgId1;
   int32_t vgId2;
@@ -209,73 +209,73 @@
 #define TK_TRANSACTION          191
 #define TK_BALANCE              192
 #define TK_VGROUP               193
-#define TK_MERGE                194
-#define TK_REDISTRIBUTE         195
-#define TK_SPLIT                196
-#define TK_DELETE               197
-#define TK_INSERT               198
-#define TK_NULL                 199
-#define TK_NK_QUESTION          200
-#define TK_NK_ARROW             201
-#define TK_ROWTS                202
-#define TK_TBNAME               203
-#define TK_QSTART               204
-#define TK_QEND                 205
-#define TK_QDURATION            206
-#define TK_WSTART               207
-#define TK_WEND                 208
-#define TK_WDURATION            209
-#define TK_IROWTS               210
-#define TK_QTAGS                211
-#define TK_CAST                 212
-#define TK_NOW                  213
-#define TK_TODAY                214
-#define TK_TIMEZONE             215
-#define TK_CLIENT_VERSION       216
-#define TK_SERVER_VERSION       217
-#define TK_SERVER_STATUS        218
-#define TK_CURRENT_USER         219
-#define TK_COUNT                220
-#define TK_LAST_ROW             221
-#define TK_CASE                 222
-#define TK_END                  223
-#define TK_WHEN                 224
-#define TK_THEN                 225
-#define TK_ELSE                 226
-#define TK_BETWEEN              227
-#define TK_IS                   228
-#define TK_NK_LT                229
-#define TK_NK_GT                230
-#define TK_NK_LE                231
-#define TK_NK_GE                232
-#define TK_NK_NE                233
-#define TK_MATCH                234
-#define TK_NMATCH               235
-#define TK_CONTAINS             236
-#define TK_IN                   237
-#define TK_JOIN                 238
-#define TK_INNER                239
-#define TK_SELECT               240
-#define TK_DISTINCT             241
-#define TK_WHERE                242
-#define TK_PARTITION            243
-#define TK_BY                   244
-#define TK_SESSION              245
-#define TK_STATE_WINDOW         246
-#define TK_SLIDING              247
-#define TK_FILL                 248
-#define TK_VALUE                249
-#define TK_NONE                 250
-#define TK_PREV                 251
-#define TK_LINEAR               252
-#define TK_NEXT                 253
-#define TK_HAVING               254
-#define TK_RANGE                255
-#define TK_EVERY                256
-#define TK_ORDER                257
-#define TK_SLIMIT               258
-#define TK_SOFFSET              259
-#define TK_LIMIT                260
+#define TK_LIMIT                194
+#define TK_MERGE                195
+#define TK_REDISTRIBUTE         196
+#define TK_SPLIT                197
+#define TK_DELETE               198
+#define TK_INSERT               199
+#define TK_NULL                 200
+#define TK_NK_QUESTION          201
+#define TK_NK_ARROW             202
+#define TK_ROWTS                203
+#define TK_TBNAME               204
+#define TK_QSTART               205
+#define TK_QEND                 206
+#define TK_QDURATION            207
+#define TK_WSTART               208
+#define TK_WEND                 209
+#define TK_WDURATION            210
+#define TK_IROWTS               211
+#define TK_QTAGS                212
+#define TK_CAST                 213
+#define TK_NOW                  214
+#define TK_TODAY                215
+#define TK_TIMEZONE             216
+#define TK_CLIENT_VERSION       217
+#define TK_SERVER_VERSION       218
+#define TK_SERVER_STATUS        219
+#define TK_CURRENT_USER         220
+#define TK_COUNT                221
+#define TK_LAST_ROW             222
+#define TK_CASE                 223
+#define TK_END                  224
+#define TK_WHEN                 225
+#define TK_THEN                 226
+#define TK_ELSE                 227
+#define TK_BETWEEN              228
+#define TK_IS                   229
+#define TK_NK_LT                230
+#define TK_NK_GT                231
+#define TK_NK_LE                232
+#define TK_NK_GE                233
+#define TK_NK_NE                234
+#define TK_MATCH                235
+#define TK_NMATCH               236
+#define TK_CONTAINS             237
+#define TK_IN                   238
+#define TK_JOIN                 239
+#define TK_INNER                240
+#define TK_SELECT               241
+#define TK_DISTINCT             242
+#define TK_WHERE                243
+#define TK_PARTITION            244
+#define TK_BY                   245
+#define TK_SESSION              246
+#define TK_STATE_WINDOW         247
+#define TK_SLIDING              248
+#define TK_FILL                 249
+#define TK_VALUE                250
+#define TK_NONE                 251
+#define TK_PREV                 252
+#define TK_LINEAR               253
+#define TK_NEXT                 254
+#define TK_HAVING               255
+#define TK_RANGE                256
+#define TK_EVERY                257
+#define TK_ORDER                258
+#define TK_SLIMIT               259
+#define TK_SOFFSET              260
 #define TK_OFFSET               261
 #define TK_ASC                  262
 #define TK_NULLS                263
@@ -421,6 +421,8 @@ typedef SGrantStmt SRevokeStmt;
 
 typedef struct SBalanceVgroupStmt {
   ENodeType type;
+  bool      dryRun;
+  int32_t   maxMoves;
 } SBalanceVgroupStmt;
 
 typedef struct SMergeVgroupStmt {
@@ -100,6 +100,8 @@ typedef struct SScanLogicNode {
   bool          hasNormalCols;  // neither tag column nor primary key tag column
   bool          sortPrimaryKey;
   bool          igLastNull;
+  int32_t       numOfSlices;  // tables of a vnode are split into slices which are scanned in parallel
+  int32_t       sliceIdx;
 } SScanLogicNode;
 
 typedef struct SJoinLogicNode {
@@ -310,6 +312,8 @@ typedef struct SScanPhysiNode {
   uint64_t   suid;
   int8_t     tableType;
   SName      tableName;
+  int32_t    numOfSlices;
+  int32_t    sliceIdx;
 } SScanPhysiNode;
 
 typedef SScanPhysiNode STagScanPhysiNode;
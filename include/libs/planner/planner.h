@@ -40,6 +40,7 @@ typedef struct SPlanContext {
   const char* pUser;
   bool        sysInfo;
   int64_t     allocatorId;
+  int32_t     scanParallelism;  // slices of each vnode scanned in parallel for a super table, 0 or 1 for none
 } SPlanContext;
 
 // Create the physical plan for the query, according to the AST.
@@ -38,6 +38,8 @@ extern bool gRaftDetailLog;
 #define SYNC_ADD_QUORUM_COUNT        3
 
 #define SYNC_MAX_BATCH_SIZE 1
+#define SYNC_MAX_PIPELINE_WINDOW     64
+#define SYNC_PIPELINE_TIMEOUT_MS     (1000 * 5)
 #define SYNC_INDEX_BEGIN    0
 #define SYNC_INDEX_INVALID  -1
 #define SYNC_TERM_INVALID   0xFFFFFFFFFFFFFFFF
@@ -200,6 +202,7 @@ typedef struct SSyncInfo {
   ESyncStrategy snapshotStrategy;
   SyncGroupId   vgId;
   int32_t       batchSize;
+  int32_t       pipelineWindow;  // max batches in flight per peer, <= 1 means wait for each reply
   SSyncCfg      syncCfg;
   char          path[TSDB_FILENAME_LEN];
   SWal*         pWal;
@@ -72,6 +72,14 @@ typedef struct SRpcMsg {
 typedef void (*RpcCfp)(void *parent, SRpcMsg *, SEpSet *epset);
 typedef bool (*RpcRfp)(int32_t code, tmsg_t msgType);
 typedef bool (*RpcTfp)(int32_t code, tmsg_t msgType);
+typedef int8_t (*RpcCcfp)(tmsg_t msgType);
+
+// codecs used to compress msgs larger than compressSize
+typedef enum {
+  RPC_COMP_LZ4 = 0,       // default
+  RPC_COMP_LZ4_FAST = 1,  // lz4 with acceleration, same wire format as lz4, for latency sensitive msgs
+  RPC_COMP_DEFLATE = 2,   // zlib deflate, better ratio for bulk msgs
+} ERpcCompType;
 
 typedef struct SRpcInit {
   char     localFqdn[TSDB_FQDN_LEN];
@@ -97,6 +105,9 @@ typedef struct SRpcInit {
   // set up timeout for particular msg
   RpcTfp tfp;
 
+  // choose compression codec for particular msg, lz4 is used if not set
+  RpcCcfp ccfp;
+
   void *parent;
 } SRpcInit;
 
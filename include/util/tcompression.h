@@ -123,6 +123,30 @@ int32_t tsCompressBigint(void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32
 int32_t tsDecompressBigint(void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, uint8_t cmprAlg, void *pBuf,
                            int32_t nBuf);
 
+/*************************************************************************
+ *                  ADAPTIVE COMPRESSION
+ *************************************************************************/
+// codec of a column chosen by sampling: lower 4 bits the encoding, CODEC_LZ4 a second lz4 stage
+#define CODEC_NONE    0  // not chosen, the block cmprAlg applies
+#define CODEC_DEFAULT 1  // default codec of the type: simple8b, delta-of-delta, xor or bool packing
+#define CODEC_RAW     2
+#define CODEC_FOR     3  // frame-of-reference bit-packing
+#define CODEC_RLE     4
+#define CODEC_DELTA   5  // delta with frame-of-reference bit-packing
+#define CODEC_CHIMP   6  // Chimp128 for float and double
+#define CODEC_LZ4     0x10
+
+#define CODEC_BASE(c) ((c)&0x0F)
+
+int32_t tsCompressCodec(int8_t type, int8_t codec, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                        void *pBuf, int32_t nBuf);
+int32_t tsDecompressCodec(int8_t type, int8_t codec, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                          void *pBuf, int32_t nBuf);
+int8_t  tsChooseCodec(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, void *pBuf,
+                      int32_t nBuf);
+int32_t tsCompressAdaptive(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, void *pBuf,
+                           int32_t nBuf, int8_t *pCodec);
+
 /*************************************************************************
  *                  STREAM COMPRESSION
  *************************************************************************/
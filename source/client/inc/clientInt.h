@@ -59,6 +59,8 @@ enum {
 #define SHOW_VARIABLES_RESULT_FIELD1_LEN (TSDB_CONFIG_OPTION_LEN + VARSTR_HEADER_SIZE)
 #define SHOW_VARIABLES_RESULT_FIELD2_LEN (TSDB_CONFIG_VALUE_LEN + VARSTR_HEADER_SIZE)
 
+#define BALANCE_VGROUP_RESULT_COLS 4
+
 #define TD_RES_QUERY(res)        (*(int8_t*)res == RES_TYPE__QUERY)
 #define TD_RES_TMQ(res)          (*(int8_t*)res == RES_TYPE__TMQ)
 #define TD_RES_TMQ_META(res)     (*(int8_t*)res == RES_TYPE__TMQ_META)
@@ -179,8 +181,11 @@ typedef struct SReqResultInfo {
   bool           completed;
   int32_t        precision;
   bool           convertUcs4;
+  bool           ucs4Converted;  // the nchar values pointed by pCol are converted from ucs4 already
   int32_t        payloadLen;
   char*          convertJson;
+  TAOS_COLUMN*   columns;     // arrow style view of the current block, built by taos_fetch_columns
+  char**         columnBuf;
 } SReqResultInfo;
 
 typedef struct SRequestSendRecvBody {
@@ -267,6 +272,7 @@ void    setResPrecision(SReqResultInfo* pResInfo, int32_t precision);
 int32_t setQueryResultFromRsp(SReqResultInfo* pResultInfo, const SRetrieveTableRsp* pRsp, bool convertUcs4,
                               bool freeAfterUse);
 void    setResSchemaInfo(SReqResultInfo* pResInfo, const SSchema* pSchema, int32_t numOfCols);
+int32_t setResultColumns(SReqResultInfo* pResultInfo);
 void    doFreeReqResultInfo(SReqResultInfo* pResInfo);
 int32_t transferTableNameList(const char* tbList, int32_t acctId, char* dbName, SArray** pReq);
 void    syncCatalogFn(SMetaData* pResult, void* param, int32_t code);
@@ -289,6 +295,13 @@ static FORCE_INLINE SReqResultInfo* tmqGetNextResInfo(TAOS_RES* res, bool conver
     SRetrieveTableRsp* pRetrieve = (SRetrieveTableRsp*)taosArrayGetP(msg->rsp.blockData, msg->resIter);
     if (msg->rsp.withSchema) {
       SSchemaWrapper* pSW = (SSchemaWrapper*)taosArrayGetP(msg->rsp.blockSchema, msg->resIter);
+      if (msg->resInfo.columnBuf != NULL) {
+        for (int32_t i = 0; i < msg->resInfo.numOfCols; ++i) {
+          taosMemoryFreeClear(msg->resInfo.columnBuf[i]);
+        }
+        taosMemoryFreeClear(msg->resInfo.columnBuf);
+      }
+      taosMemoryFreeClear(msg->resInfo.columns);
       setResSchemaInfo(&msg->resInfo, pSW->pSchema, pSW->nCols);
       taosMemoryFreeClear(msg->resInfo.row);
       taosMemoryFreeClear(msg->resInfo.pCol);
@@ -316,6 +316,7 @@ void doFreeReqResultInfo(SReqResultInfo *pResInfo) {
   taosMemoryFreeClear(pResInfo->fields);
   taosMemoryFreeClear(pResInfo->userFields);
   taosMemoryFreeClear(pResInfo->convertJson);
+  taosMemoryFreeClear(pResInfo->columns);
 
   if (pResInfo->convertBuf != NULL) {
     for (int32_t i = 0; i < pResInfo->numOfCols; ++i) {
@@ -323,6 +324,13 @@ void doFreeReqResultInfo(SReqResultInfo *pResInfo) {
     }
     taosMemoryFreeClear(pResInfo->convertBuf);
   }
+
+  if (pResInfo->columnBuf != NULL) {
+    for (int32_t i = 0; i < pResInfo->numOfCols; ++i) {
+      taosMemoryFreeClear(pResInfo->columnBuf[i]);
+    }
+    taosMemoryFreeClear(pResInfo->columnBuf);
+  }
 }
 
 SRequestObj *acquireRequest(int64_t rid) { return (SRequestObj *)taosAcquireRef(clientReqRefPool, rid); }
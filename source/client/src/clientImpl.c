@@ -435,7 +435,8 @@ int32_t getPlan(SRequestObj* pRequest, SQuery* pQuery, SQueryPlan** pPlan, SArra
                       .pMsg = pRequest->msgBuf,
                       .msgLen = ERROR_MSG_BUF_DEFAULT_SIZE,
                       .pUser = pRequest->pTscObj->user,
-                      .sysInfo = pRequest->pTscObj->sysInfo};
+                      .sysInfo = pRequest->pTscObj->sysInfo,
+                      .scanParallelism = tsQueryScanParallelism};
 
   return qCreateQueryPlan(&cxt, pPlan, pNodeList);
 }
@@ -1051,7 +1052,8 @@ static int32_t asyncExecSchQuery(SRequestObj* pRequest, SQuery* pQuery, SMetaDat
                           .msgLen = ERROR_MSG_BUF_DEFAULT_SIZE,
                           .pUser = pRequest->pTscObj->user,
                           .sysInfo = pRequest->pTscObj->sysInfo,
-                          .allocatorId = pRequest->allocatorRefId};
+                          .allocatorId = pRequest->allocatorRefId,
+                          .scanParallelism = tsQueryScanParallelism};
 
       SAppInstInfo* pAppInfo = getAppInfo(pRequest);
       SQueryPlan*   pDag = NULL;
@@ -1933,6 +1935,7 @@ int32_t setResultDataPtr(SReqResultInfo* pResultInfo, TAOS_FIELD* pFields, int32
     pStart += colLength[i];
   }
 
+  pResultInfo->ucs4Converted = convertUcs4;
   if (convertUcs4) {
     code = doConvertUCS4(pResultInfo, numOfRows, numOfCols, colLength);
   }
@@ -1940,6 +1943,134 @@ int32_t setResultDataPtr(SReqResultInfo* pResultInfo, TAOS_FIELD* pFields, int32
   return code;
 }
 
+// the null bitmap of a result block is MSB first with the bit set for NULL, while the arrow validity bitmap is LSB
+// first with the bit set for a valid value.
+static FORCE_INLINE uint8_t toValidityByte(uint8_t nullBits) {
+  uint8_t v = ~nullBits;
+  v = ((v & 0xF0) >> 4) | ((v & 0x0F) << 4);
+  v = ((v & 0xCC) >> 2) | ((v & 0x33) << 2);
+  v = ((v & 0xAA) >> 1) | ((v & 0x55) << 1);
+  return v;
+}
+
+// The columns are built from the block as it is received, pCol points into the response and only json values are
+// rendered as text before. Fixed length values are exposed in place, var length values are copied once without their
+// length header, and nchar values are converted from UCS-4 to UTF-8 while they are copied, which never makes them
+// longer. A block already converted for the row api, when the rows are fetched before the columns, is copied as it is.
+int32_t setResultColumns(SReqResultInfo* pResultInfo) {
+  int32_t numOfRows = pResultInfo->numOfRows;
+  int32_t numOfCols = pResultInfo->numOfCols;
+
+  if (pResultInfo->columns == NULL) {
+    pResultInfo->columns = taosMemoryCalloc(numOfCols, sizeof(TAOS_COLUMN));
+    if (pResultInfo->columns == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  if (pResultInfo->columnBuf == NULL) {
+    pResultInfo->columnBuf = taosMemoryCalloc(numOfCols, POINTER_BYTES);
+    if (pResultInfo->columnBuf == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  int32_t bitmapLen = ALIGN8(BitmapLen(numOfRows));
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    TAOS_COLUMN*   pColumn = &pResultInfo->columns[i];
+    SResultColumn* pCol = &pResultInfo->pCol[i];
+
+    int32_t type = pResultInfo->fields[i].type;
+    bool    isVar = IS_VAR_DATA_TYPE(type);
+    bool    allNull = IS_VAR_NULL_TYPE(type, pResultInfo->fields[i].bytes);
+
+    int32_t offsetLen = 0;
+    int32_t dataLen = 0;
+    if (isVar) {
+      offsetLen = ALIGN8((numOfRows + 1) * sizeof(int32_t));
+      for (int32_t j = 0; j < numOfRows && !allNull; ++j) {
+        if (pCol->offset[j] != -1) {
+          dataLen += varDataLen(pCol->pData + pCol->offset[j]);
+        }
+      }
+    } else if (type == TSDB_DATA_TYPE_BOOL) {
+      dataLen = bitmapLen;
+    }
+
+    char* pBuf = taosMemoryRealloc(pResultInfo->columnBuf[i], bitmapLen + offsetLen + dataLen);
+    if (pBuf == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    pResultInfo->columnBuf[i] = pBuf;
+
+    uint8_t* validity = (uint8_t*)pBuf;
+    int32_t  nullCount = 0;
+
+    if (isVar) {
+      int32_t* offsets = (int32_t*)(pBuf + bitmapLen);
+      char*    pData = pBuf + bitmapLen + offsetLen;
+
+      memset(validity, 0, bitmapLen);
+      offsets[0] = 0;
+      for (int32_t j = 0; j < numOfRows; ++j) {
+        if (allNull || pCol->offset[j] == -1) {
+          offsets[j + 1] = offsets[j];
+          nullCount += 1;
+          continue;
+        }
+
+        char*   pStart = pCol->pData + pCol->offset[j];
+        int32_t len = varDataLen(pStart);
+        if (type == TSDB_DATA_TYPE_NCHAR && !pResultInfo->ucs4Converted) {
+          len = taosUcs4ToMbs((TdUcs4*)varDataVal(pStart), len, pData + offsets[j]);
+          if (len < 0) {
+            tscError("charset:%s to %s. convert failed.", DEFAULT_UNICODE_ENCODEC, tsCharset);
+            return TSDB_CODE_TSC_INVALID_VALUE;
+          }
+        } else {
+          memcpy(pData + offsets[j], varDataVal(pStart), len);
+        }
+
+        offsets[j + 1] = offsets[j] + len;
+        validity[j >> 3] |= (1u << (j & 7u));
+      }
+
+      pColumn->offsets = offsets;
+      pColumn->data = pData;
+    } else {
+      for (int32_t j = 0; j < BitmapLen(numOfRows); ++j) {
+        validity[j] = toValidityByte(pCol->nullbitmap[j]);
+      }
+
+      for (int32_t j = 0; j < numOfRows; ++j) {
+        nullCount += colDataIsNull_f(pCol->nullbitmap, j) ? 1 : 0;
+      }
+
+      pColumn->offsets = NULL;
+      if (type == TSDB_DATA_TYPE_BOOL) {
+        uint8_t* pData = (uint8_t*)pBuf + bitmapLen;
+        memset(pData, 0, bitmapLen);
+        for (int32_t j = 0; j < numOfRows; ++j) {
+          if (pCol->pData[j]) {
+            pData[j >> 3] |= (1u << (j & 7u));
+          }
+        }
+        pColumn->data = pData;
+      } else {
+        pColumn->data = pCol->pData;
+      }
+    }
+
+    pColumn->type = type;
+    pColumn->bytes = pResultInfo->userFields[i].bytes;
+    pColumn->length = numOfRows;
+    pColumn->nullCount = nullCount;
+    pColumn->validity = validity;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 char* getDbOfConnection(STscObj* pObj) {
   char* p = NULL;
   taosThreadMutexLock(&pObj->mutex);
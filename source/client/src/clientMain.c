@@ -616,6 +616,60 @@ int taos_fetch_raw_block(TAOS_RES *res, int *numOfRows, void **pData) {
   return 0;
 }
 
+int taos_fetch_columns(TAOS_RES *res, int *numOfRows, TAOS_COLUMN **columns) {
+  if (res == NULL || TD_RES_TMQ_META(res)) {
+    return 0;
+  }
+
+  (*columns) = NULL;
+  (*numOfRows) = 0;
+
+  SReqResultInfo *pResultInfo = NULL;
+  if (TD_RES_QUERY(res)) {
+    SRequestObj *pRequest = (SRequestObj *)res;
+    if (pRequest->type == TSDB_SQL_RETRIEVE_EMPTY_RESULT || pRequest->type == TSDB_SQL_INSERT ||
+        pRequest->code != TSDB_CODE_SUCCESS || taos_num_fields(res) == 0) {
+      return 0;
+    }
+
+    // the block is not converted to UTF-8 here, nchar values are converted once when they are copied into the columns
+#if SYNC_ON_TOP_OF_ASYNC
+    doAsyncFetchRows(pRequest, false, false);
+#else
+    doFetchRows(pRequest, false, false);
+#endif
+
+    if (pRequest->code != TSDB_CODE_SUCCESS) {
+      return pRequest->code;
+    }
+
+    pResultInfo = &pRequest->body.resInfo;
+  } else if (TD_RES_TMQ(res) || TD_RES_TMQ_METADATA(res)) {
+    pResultInfo = tmqGetNextResInfo(res, false);
+    if (pResultInfo == NULL) {
+      return 0;
+    }
+  } else {
+    ASSERT(0);
+    return -1;
+  }
+
+  if (pResultInfo->numOfRows == 0) {
+    return 0;
+  }
+
+  int32_t code = setResultColumns(pResultInfo);
+  if (code != TSDB_CODE_SUCCESS) {
+    terrno = code;
+    return code;
+  }
+
+  pResultInfo->current = pResultInfo->numOfRows;
+  (*columns) = pResultInfo->columns;
+  (*numOfRows) = pResultInfo->numOfRows;
+  return 0;
+}
+
 int *taos_get_column_data_offset(TAOS_RES *res, int columnIndex) {
   if (res == NULL || TD_RES_TMQ_META(res)) {
     return 0;
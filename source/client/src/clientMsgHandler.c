@@ -448,6 +448,101 @@ int32_t processShowVariablesRsp(void* param, SDataBuf* pMsg, int32_t code) {
   return code;
 }
 
+static int32_t buildBalanceVgroupBlock(SArray* pMoves, SSDataBlock** block) {
+  SSDataBlock* pBlock = taosMemoryCalloc(1, sizeof(SSDataBlock));
+  if (NULL == pBlock) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  pBlock->pDataBlock = taosArrayInit(BALANCE_VGROUP_RESULT_COLS, sizeof(SColumnInfoData));
+
+  SColumnInfoData infoData = {0};
+  infoData.info.type = TSDB_DATA_TYPE_INT;
+  infoData.info.bytes = tDataTypes[TSDB_DATA_TYPE_INT].bytes;
+  taosArrayPush(pBlock->pDataBlock, &infoData);
+  taosArrayPush(pBlock->pDataBlock, &infoData);
+  taosArrayPush(pBlock->pDataBlock, &infoData);
+
+  infoData.info.type = TSDB_DATA_TYPE_DOUBLE;
+  infoData.info.bytes = tDataTypes[TSDB_DATA_TYPE_DOUBLE].bytes;
+  taosArrayPush(pBlock->pDataBlock, &infoData);
+
+  int32_t numOfMoves = taosArrayGetSize(pMoves);
+  blockDataEnsureCapacity(pBlock, numOfMoves);
+
+  for (int32_t i = 0, c = 0; i < numOfMoves; ++i, c = 0) {
+    SBalanceVgroupMove* pMove = taosArrayGet(pMoves, i);
+    colDataAppend(taosArrayGet(pBlock->pDataBlock, c++), i, (const char*)&pMove->vgId, false);
+    colDataAppend(taosArrayGet(pBlock->pDataBlock, c++), i, (const char*)&pMove->srcId, false);
+    colDataAppend(taosArrayGet(pBlock->pDataBlock, c++), i, (const char*)&pMove->dstId, false);
+    colDataAppend(taosArrayGet(pBlock->pDataBlock, c++), i, (const char*)&pMove->cost, false);
+  }
+
+  pBlock->info.rows = numOfMoves;
+
+  *block = pBlock;
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t buildBalanceVgroupRsp(SArray* pMoves, SRetrieveTableRsp** pRsp) {
+  SSDataBlock* pBlock = NULL;
+  int32_t      code = buildBalanceVgroupBlock(pMoves, &pBlock);
+  if (code) {
+    return code;
+  }
+
+  size_t rspSize = sizeof(SRetrieveTableRsp) + blockGetEncodeSize(pBlock);
+  *pRsp = taosMemoryCalloc(1, rspSize);
+  if (NULL == *pRsp) {
+    blockDataDestroy(pBlock);
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  (*pRsp)->completed = 1;
+  (*pRsp)->numOfRows = htonl(pBlock->info.rows);
+  (*pRsp)->numOfCols = htonl(BALANCE_VGROUP_RESULT_COLS);
+
+  int32_t len = 0;
+  blockEncode(pBlock, (*pRsp)->data, &len, BALANCE_VGROUP_RESULT_COLS, false);
+  ASSERT(len == rspSize - sizeof(SRetrieveTableRsp));
+
+  blockDataDestroy(pBlock);
+  return TSDB_CODE_SUCCESS;
+}
+
+int32_t processBalanceVgroupRsp(void* param, SDataBuf* pMsg, int32_t code) {
+  SRequestObj* pRequest = param;
+  // only a dry run carries the plan, a real balance is answered like any other ddl
+  if (code != TSDB_CODE_SUCCESS || NULL == pMsg->pData || 0 == pMsg->len) {
+    return genericRspCallback(param, pMsg, code);
+  }
+
+  SBalanceVgroupRsp  rsp = {0};
+  SRetrieveTableRsp* pRes = NULL;
+  code = tDeserializeSBalanceVgroupRsp(pMsg->pData, pMsg->len, &rsp);
+  if (TSDB_CODE_SUCCESS == code) {
+    code = buildBalanceVgroupRsp(rsp.pMoves, &pRes);
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = setQueryResultFromRsp(&pRequest->body.resInfo, pRes, false, true);
+  }
+  if (TSDB_CODE_SUCCESS != code) {
+    setErrno(pRequest, code);
+  }
+
+  tFreeSBalanceVgroupRsp(&rsp);
+  taosMemoryFree(pMsg->pData);
+  taosMemoryFree(pMsg->pEpSet);
+
+  if (pRequest->body.queryFp != NULL) {
+    pRequest->body.queryFp(pRequest->body.param, pRequest, code);
+  } else {
+    tsem_post(&pRequest->body.rspSem);
+  }
+  return code;
+}
+
 __async_send_cb_fn_t getMsgRspHandle(int32_t msgType) {
   switch (msgType) {
     case TDMT_MND_CONNECT:
@@ -464,6 +559,8 @@ __async_send_cb_fn_t getMsgRspHandle(int32_t msgType) {
       return processAlterStbRsp;
     case TDMT_MND_SHOW_VARIABLES:
       return processShowVariablesRsp;
+    case TDMT_MND_BALANCE_VGROUP:
+      return processBalanceVgroupRsp;
     default:
       return genericRspCallback;
   }
@@ -2,6 +2,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "cJSON.h"
 #include "catalog.h"
@@ -64,6 +67,19 @@
     }                                        \
   }
 
+// the bytes that may end or escape a token, the line is only checked byte by byte at these positions
+typedef struct {
+  int32_t num;
+  char    chars[5];
+} SSmlTokenSet;
+
+static const SSmlTokenSet smlMeasureToken = {5, {COMMA, SPACE, EQUAL, QUOTE, SLASH}};
+static const SSmlTokenSet smlSpaceToken = {1, {SPACE}};
+static const SSmlTokenSet smlColsToken = {2, {SPACE, QUOTE}};
+static const SSmlTokenSet smlKeyToken = {2, {COMMA, EQUAL}};
+static const SSmlTokenSet smlValueToken = {3, {COMMA, EQUAL, QUOTE}};
+static const SSmlTokenSet smlSlashToken = {1, {SLASH}};
+
 #define IS_INVALID_COL_LEN(len)   ((len) <= 0 || (len) >= TSDB_COL_NAME_LEN)
 #define IS_INVALID_TABLE_LEN(len) ((len) <= 0 || (len) >= TSDB_TABLE_NAME_LEN)
 
@@ -179,6 +195,11 @@ typedef struct {
   SSmlMsgBuf   msgBuf;
   SHashObj    *dumplicateKey;  // for dumplicate key
   SArray      *colsContainer;  // for cols parse, if dataFormat == false
+
+  // the super table of the previous line, consecutive lines mostly belong to the same measurement
+  const char     *lastMeasure;
+  int32_t         lastMeasureLen;
+  SSmlSTableMeta *lastSTableMeta;
 } SSmlHandle;
 //=================================================================================================
 
@@ -917,6 +938,41 @@ static int32_t smlParseValue(SSmlKv *pVal, SSmlMsgBuf *msg) {
   return TSDB_CODE_TSC_INVALID_VALUE;
 }
 
+/*
+ * Skip to the first byte of the token set in [sql, sqlEnd), or sqlEnd if there is none. The bytes are compared 32 at
+ * a time with SSE2, so the parsers below only look at the candidates.
+ */
+static FORCE_INLINE const char *smlFindToken(const char *sql, const char *sqlEnd, const SSmlTokenSet *pSet) {
+#ifdef __SSE2__
+  while (sqlEnd - sql >= 32) {
+    __m128i lo = _mm_loadu_si128((const __m128i *)sql);
+    __m128i hi = _mm_loadu_si128((const __m128i *)(sql + 16));
+    __m128i mlo = _mm_setzero_si128();
+    __m128i mhi = _mm_setzero_si128();
+    for (int32_t i = 0; i < pSet->num; ++i) {
+      __m128i c = _mm_set1_epi8(pSet->chars[i]);
+      mlo = _mm_or_si128(mlo, _mm_cmpeq_epi8(lo, c));
+      mhi = _mm_or_si128(mhi, _mm_cmpeq_epi8(hi, c));
+    }
+
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(mlo) | ((uint32_t)_mm_movemask_epi8(mhi) << 16);
+    if (mask != 0) {
+      return sql + __builtin_ctz(mask);
+    }
+    sql += 32;
+  }
+#endif
+
+  for (; sql < sqlEnd; ++sql) {
+    for (int32_t i = 0; i < pSet->num; ++i) {
+      if (*sql == pSet->chars[i]) {
+        return sql;
+      }
+    }
+  }
+  return sqlEnd;
+}
+
 static int32_t smlParseInfluxString(const char *sql, const char *sqlEnd, SSmlLineInfo *elements, SSmlMsgBuf *msg) {
   if (!sql) return TSDB_CODE_SML_INVALID_DATA;
   JUMP_SPACE(sql, sqlEnd)
@@ -925,6 +981,10 @@ static int32_t smlParseInfluxString(const char *sql, const char *sqlEnd, SSmlLin
 
   // parse measure
   while (sql < sqlEnd) {
+    sql = smlFindToken(sql, sqlEnd, &smlMeasureToken);
+    if (sql == sqlEnd) {
+      break;
+    }
     if ((sql != elements->measure) && IS_SLASH_LETTER(sql)) {
       MOVE_FORWARD_ONE(sql, sqlEnd - sql);
       sqlEnd--;
@@ -952,6 +1012,10 @@ static int32_t smlParseInfluxString(const char *sql, const char *sqlEnd, SSmlLin
     if (*sql == COMMA) sql++;
     elements->tags = sql;
     while (sql < sqlEnd) {
+      sql = smlFindToken(sql, sqlEnd, &smlSpaceToken);
+      if (sql == sqlEnd) {
+        break;
+      }
       if (IS_SPACE(sql)) {
         break;
       }
@@ -966,6 +1030,10 @@ static int32_t smlParseInfluxString(const char *sql, const char *sqlEnd, SSmlLin
   elements->cols = sql;
   bool isInQuote = false;
   while (sql < sqlEnd) {
+    sql = smlFindToken(sql, sqlEnd, &smlColsToken);
+    if (sql == sqlEnd) {
+      break;
+    }
     if (IS_QUOTE(sql)) {
       isInQuote = !isInQuote;
     }
@@ -1162,6 +1230,10 @@ static int32_t smlParseCols(const char *data, int32_t len, SArray *cols, char *c
 
     while (sql < data + len) {
       // parse key
+      sql = smlFindToken(sql, data + len, &smlKeyToken);
+      if (sql == data + len) {
+        break;
+      }
       if (IS_COMMA(sql)) {
         smlBuildInvalidDataMsg(msg, "invalid data", sql);
         return TSDB_CODE_SML_INVALID_DATA;
@@ -1189,6 +1261,10 @@ static int32_t smlParseCols(const char *data, int32_t len, SArray *cols, char *c
     bool        isInQuote = false;
     while (sql < data + len) {
       // parse value
+      sql = smlFindToken(sql, data + len, &smlValueToken);
+      if (sql == data + len) {
+        break;
+      }
       if (!isTag && IS_QUOTE(sql)) {
         isInQuote = !isInQuote;
         sql++;
@@ -1214,8 +1290,13 @@ static int32_t smlParseCols(const char *data, int32_t len, SArray *cols, char *c
       smlBuildInvalidDataMsg(msg, "invalid value", value);
       return TSDB_CODE_SML_INVALID_DATA;
     }
-    PROCESS_SLASH(key, keyLen)
-    PROCESS_SLASH(value, valueLen)
+    // most keys and values have no escape at all
+    if (smlFindToken(key, key + keyLen, &smlSlashToken) != key + keyLen) {
+      PROCESS_SLASH(key, keyLen)
+    }
+    if (smlFindToken(value, value + valueLen, &smlSlashToken) != value + valueLen) {
+      PROCESS_SLASH(value, valueLen)
+    }
 
     // handle child table name
     if (childTableName && childTableNameLen != 0 && strncmp(key, tsSmlChildTableName, keyLen) == 0) {
@@ -1253,9 +1334,22 @@ static int32_t smlUpdateMeta(SHashObj *metaHash, SArray *metaArray, SArray *cols
   for (int i = 0; i < taosArrayGetSize(cols); ++i) {
     SSmlKv *kv = (SSmlKv *)taosArrayGetP(cols, i);
 
-    int16_t *index = (int16_t *)taosHashGet(metaHash, kv->key, kv->keyLen);
-    if (index) {
-      SSmlKv **value = (SSmlKv **)taosArrayGet(metaArray, *index);
+    // the keys of a measurement mostly come in the same order, so try the same position before the hash lookup
+    SSmlKv **value = NULL;
+    if (i < taosArrayGetSize(metaArray)) {
+      SSmlKv **p = (SSmlKv **)taosArrayGet(metaArray, i);
+      if ((*p)->keyLen == kv->keyLen && memcmp((*p)->key, kv->key, kv->keyLen) == 0) {
+        value = p;
+      }
+    }
+    if (value == NULL) {
+      int16_t *index = (int16_t *)taosHashGet(metaHash, kv->key, kv->keyLen);
+      if (index) {
+        value = (SSmlKv **)taosArrayGet(metaArray, *index);
+      }
+    }
+
+    if (value) {
       if (kv->type != (*value)->type) {
         smlBuildInvalidDataMsg(msg, "the type is not the same like before", kv->key);
         return TSDB_CODE_SML_NOT_SAME_TYPE;
@@ -2167,7 +2261,13 @@ static int32_t smlParseInfluxLine(SSmlHandle *info, const char *sql, const int l
     }
   }
 
-  SSmlSTableMeta **tableMeta = (SSmlSTableMeta **)taosHashGet(info->superTables, elements.measure, elements.measureLen);
+  SSmlSTableMeta **tableMeta = NULL;
+  if (info->lastSTableMeta != NULL && info->lastMeasureLen == elements.measureLen &&
+      memcmp(info->lastMeasure, elements.measure, elements.measureLen) == 0) {
+    tableMeta = &info->lastSTableMeta;
+  } else {
+    tableMeta = (SSmlSTableMeta **)taosHashGet(info->superTables, elements.measure, elements.measureLen);
+  }
   if (tableMeta) {  // update meta
     ret = smlUpdateMeta((*tableMeta)->colHash, (*tableMeta)->cols, cols, &info->msgBuf);
     if (!hasTable && ret == TSDB_CODE_SUCCESS) {
@@ -2182,8 +2282,15 @@ static int32_t smlParseInfluxLine(SSmlHandle *info, const char *sql, const int l
     smlInsertMeta(meta->tagHash, meta->tags, (*oneTable)->tags);
     smlInsertMeta(meta->colHash, meta->cols, cols);
     taosHashPut(info->superTables, elements.measure, elements.measureLen, &meta, POINTER_BYTES);
+    info->lastSTableMeta = meta;
   }
 
+  if (tableMeta) {
+    info->lastSTableMeta = *tableMeta;
+  }
+  info->lastMeasure = elements.measure;
+  info->lastMeasureLen = elements.measureLen;
+
   if (!info->dataFormat) {
     taosArrayClear(info->colsContainer);
   }
@@ -2408,11 +2515,13 @@ static int32_t smlParseLine(SSmlHandle *info, char *lines[], char* rawLine, char
       len = strlen(tmp);
     }else if(rawLine){
       tmp = rawLine;
-      while(rawLine < rawLineEnd){
-        if(*(rawLine++) == '\n'){
-          break;
-        }
-        len++;
+      char *pEol = (char *)memchr(rawLine, '\n', rawLineEnd - rawLine);
+      if (pEol == NULL) {
+        len = rawLineEnd - rawLine;
+        rawLine = rawLineEnd;
+      } else {
+        len = pEol - rawLine;
+        rawLine = pEol + 1;
       }
       if(info->protocol == TSDB_SML_LINE_PROTOCOL && tmp[0] == '#'){ // this line is comment
         continue;
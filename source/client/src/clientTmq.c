@@ -58,6 +58,7 @@ struct tmq_conf_t {
   int8_t  withTbName;
   int8_t  snapEnable;
   int32_t snapBatchSize;
+  int32_t prefetchNum;
 
   bool hbBgEnable;
 
@@ -80,6 +81,7 @@ struct tmq_t {
   int8_t  autoCommit;
   int32_t autoCommitInterval;
   int32_t resetOffsetCfg;
+  int32_t prefetchNum;  // max poll rsps buffered per vgroup
   int64_t consumerId;
 
   bool hbBgEnable;
@@ -120,6 +122,9 @@ enum {
   TMQ_VG_STATUS__WAIT,
 };
 
+#define TMQ_DEFAULT_PREFETCH_NUM 4
+#define TMQ_MAX_PREFETCH_NUM     64
+
 enum {
   TMQ_CONSUMER_STATUS__INIT = 0,
   TMQ_CONSUMER_STATUS__READY,
@@ -141,8 +146,9 @@ typedef struct {
   STqOffsetVal currentOffset;
   // connection info
   int32_t vgId;
-  int32_t vgStatus;
+  int32_t vgStatus;  // whether a poll req is in flight
   int32_t vgSkipCnt;
+  int32_t bufferedCnt;  // poll rsps received but not consumed yet
   SEpSet  epSet;
 } SMqClientVg;
 
@@ -189,6 +195,7 @@ typedef struct {
   SMqClientVg*    pVg;
   SMqClientTopic* pTopic;
   int32_t         vgId;
+  int64_t         timeout;
   tsem_t          rspSem;
 } SMqPollCbParam;
 
@@ -220,6 +227,7 @@ tmq_conf_t* tmq_conf_new() {
   conf->autoCommit = true;
   conf->autoCommitInterval = 5000;
   conf->resetOffset = TMQ_CONF__RESET_OFFSET__EARLIEAST;
+  conf->prefetchNum = TMQ_DEFAULT_PREFETCH_NUM;
   conf->hbBgEnable = true;
   return conf;
 }
@@ -288,6 +296,15 @@ tmq_conf_res_t tmq_conf_set(tmq_conf_t* conf, const char* key, const char* value
     }
   }
 
+  if (strcmp(key, "msg.prefetch.num") == 0) {
+    int32_t prefetchNum = atoi(value);
+    if (prefetchNum < 1 || prefetchNum > TMQ_MAX_PREFETCH_NUM) {
+      return TMQ_CONF_INVALID;
+    }
+    conf->prefetchNum = prefetchNum;
+    return TMQ_CONF_OK;
+  }
+
   if (strcmp(key, "experimental.snapshot.enable") == 0) {
     if (strcmp(value, "true") == 0) {
       conf->snapEnable = true;
@@ -928,6 +945,7 @@ tmq_t* tmq_consumer_new(tmq_conf_t* conf, char* errstr, int32_t errstrLen) {
   pTmq->commitCb = conf->commitCb;
   pTmq->commitCbUserParam = conf->commitCbUserParam;
   pTmq->resetOffsetCfg = conf->resetOffset;
+  pTmq->prefetchNum = conf->prefetchNum;
 
   pTmq->hbBgEnable = conf->hbBgEnable;
 
@@ -1088,10 +1106,14 @@ void tmq_conf_set_auto_commit_cb(tmq_conf_t* conf, tmq_commit_cb* cb, void* para
   conf->commitCbUserParam = param;
 }
 
+static int32_t tmqPollVg(tmq_t* tmq, SMqClientTopic* pTopic, SMqClientVg* pVg, const STqOffsetVal* pOffset,
+                         int64_t timeout);
+
 int32_t tmqPollCb(void* param, SDataBuf* pMsg, int32_t code) {
   SMqPollCbParam* pParam = (SMqPollCbParam*)param;
   SMqClientVg*    pVg = pParam->pVg;
   SMqClientTopic* pTopic = pParam->pTopic;
+  int64_t         timeout = pParam->timeout;
 
   tmq_t* tmq = taosAcquireRef(tmqMgmt.rsetId, pParam->refId);
   if (tmq == NULL) {
@@ -1159,6 +1181,9 @@ int32_t tmqPollCb(void* param, SDataBuf* pMsg, int32_t code) {
   pRspWrapper->vgHandle = pVg;
   pRspWrapper->topicHandle = pTopic;
 
+  STqOffsetVal rspOffset = {0};
+  int32_t      blockNum = 0;
+
   if (rspType == TMQ_MSG_TYPE__POLL_RSP) {
     SDecoder decoder;
     tDecoderInit(&decoder, POINTER_SHIFT(pMsg->pData, sizeof(SMqRspHead)), pMsg->len - sizeof(SMqRspHead));
@@ -1169,6 +1194,8 @@ int32_t tmqPollCb(void* param, SDataBuf* pMsg, int32_t code) {
     tscDebug("consumer:%" PRId64 ", recv poll: vgId:%d, req offset %" PRId64 ", rsp offset %" PRId64 " type %d",
              tmq->consumerId, pVg->vgId, pRspWrapper->dataRsp.reqOffset.version, pRspWrapper->dataRsp.rspOffset.version,
              rspType);
+    rspOffset = pRspWrapper->dataRsp.rspOffset;
+    blockNum = pRspWrapper->dataRsp.blockNum;
 
   } else if (rspType == TMQ_MSG_TYPE__POLL_META_RSP) {
     SDecoder decoder;
@@ -1182,6 +1209,8 @@ int32_t tmqPollCb(void* param, SDataBuf* pMsg, int32_t code) {
     tDecodeSTaosxRsp(&decoder, &pRspWrapper->taosxRsp);
     tDecoderClear(&decoder);
     memcpy(&pRspWrapper->taosxRsp, pMsg->pData, sizeof(SMqRspHead));
+    rspOffset = pRspWrapper->taosxRsp.rspOffset;
+    blockNum = pRspWrapper->taosxRsp.blockNum;
   } else {
     ASSERT(0);
   }
@@ -1189,9 +1218,23 @@ int32_t tmqPollCb(void* param, SDataBuf* pMsg, int32_t code) {
   taosMemoryFree(pMsg->pData);
   taosMemoryFree(pMsg->pEpSet);
 
+  // while the app consumes the buffered rsps, keep the next poll of the vgroup in flight. The rsp is counted on the
+  // vgroup of the current epoch, a newer epoch replaces the vgroups and their counts.
+  pRspWrapper->epoch = tmqEpoch;
+  int32_t bufferedCnt = atomic_add_fetch_32(&pVg->bufferedCnt, 1);
+  bool    prefetch = (msgEpoch == tmqEpoch && blockNum > 0 && bufferedCnt < tmq->prefetchNum);
+
   taosWriteQitem(tmq->mqueue, pRspWrapper);
   tsem_post(&tmq->rspSem);
 
+  if (prefetch) {
+    if (tmqPollVg(tmq, pTopic, pVg, &rspOffset, timeout) < 0) {
+      atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
+    }
+  } else if (msgEpoch == tmqEpoch) {
+    atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
+  }
+
   return 0;
 CREATE_MSG_FAIL:
   if (epoch == tmq->epoch) {
@@ -1432,7 +1475,8 @@ int32_t tmqAskEp(tmq_t* tmq, bool async) {
   return code;
 }
 
-SMqPollReq* tmqBuildConsumeReqImpl(tmq_t* tmq, int64_t timeout, SMqClientTopic* pTopic, SMqClientVg* pVg) {
+SMqPollReq* tmqBuildConsumeReqImpl(tmq_t* tmq, int64_t timeout, SMqClientTopic* pTopic, SMqClientVg* pVg,
+                                   const STqOffsetVal* pOffset) {
   SMqPollReq* pReq = taosMemoryCalloc(1, sizeof(SMqPollReq));
   if (pReq == NULL) {
     return NULL;
@@ -1451,7 +1495,7 @@ SMqPollReq* tmqBuildConsumeReqImpl(tmq_t* tmq, int64_t timeout, SMqClientTopic*
   pReq->consumerId = tmq->consumerId;
   pReq->epoch = tmq->epoch;
   /*pReq->currentOffset = reqOffset;*/
-  pReq->reqOffset = pVg->currentOffset;
+  pReq->reqOffset = *pOffset;
   pReq->reqId = generateRequestId();
 
   pReq->useSnapshot = tmq->useSnapshot;
@@ -1508,6 +1552,55 @@ SMqTaosxRspObj* tmqBuildTaosxRspFromWrapper(SMqPollRspWrapper* pWrapper) {
   return pRspObj;
 }
 
+static int32_t tmqPollVg(tmq_t* tmq, SMqClientTopic* pTopic, SMqClientVg* pVg, const STqOffsetVal* pOffset,
+                         int64_t timeout) {
+  SMqPollReq* pReq = tmqBuildConsumeReqImpl(tmq, timeout, pTopic, pVg, pOffset);
+  if (pReq == NULL) {
+    return -1;
+  }
+  SMqPollCbParam* pParam = taosMemoryMalloc(sizeof(SMqPollCbParam));
+  if (pParam == NULL) {
+    taosMemoryFree(pReq);
+    return -1;
+  }
+  pParam->refId = tmq->refId;
+  pParam->epoch = tmq->epoch;
+
+  pParam->pVg = pVg;
+  pParam->pTopic = pTopic;
+  pParam->vgId = pVg->vgId;
+  pParam->timeout = timeout;
+
+  SMsgSendInfo* sendInfo = taosMemoryCalloc(1, sizeof(SMsgSendInfo));
+  if (sendInfo == NULL) {
+    taosMemoryFree(pReq);
+    taosMemoryFree(pParam);
+    return -1;
+  }
+
+  sendInfo->msgInfo = (SDataBuf){
+      .pData = pReq,
+      .len = sizeof(SMqPollReq),
+      .handle = NULL,
+  };
+  sendInfo->requestId = pReq->reqId;
+  sendInfo->requestObjRefId = 0;
+  sendInfo->param = pParam;
+  sendInfo->fp = tmqPollCb;
+  sendInfo->msgType = TDMT_VND_CONSUME;
+
+  int64_t transporterId = 0;
+
+  char offsetFormatBuf[80];
+  tFormatOffset(offsetFormatBuf, 80, pOffset);
+  tscDebug("consumer:%" PRId64 ", send poll to %s vgId:%d, epoch %d, req offset:%s, reqId:%" PRIu64,
+           tmq->consumerId, pTopic->topicName, pVg->vgId, tmq->epoch, offsetFormatBuf, pReq->reqId);
+  asyncSendMsgToServer(tmq->pTscObj->pAppInfo->pTransporter, &pVg->epSet, &transporterId, sendInfo);
+  pVg->pollCnt++;
+  tmq->pollCnt++;
+  return 0;
+}
+
 int32_t tmqPollImpl(tmq_t* tmq, int64_t timeout) {
   /*tscDebug("call poll");*/
   for (int i = 0; i < taosArrayGetSize(tmq->clientTopics); i++) {
@@ -1530,57 +1623,18 @@ int32_t tmqPollImpl(tmq_t* tmq, int64_t timeout) {
 #endif
       }
       atomic_store_32(&pVg->vgSkipCnt, 0);
-      SMqPollReq* pReq = tmqBuildConsumeReqImpl(tmq, timeout, pTopic, pVg);
-      if (pReq == NULL) {
-        atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
-        tsem_post(&tmq->rspSem);
-        return -1;
-      }
-      SMqPollCbParam* pParam = taosMemoryMalloc(sizeof(SMqPollCbParam));
-      if (pParam == NULL) {
-        taosMemoryFree(pReq);
+
+      // the rsps not consumed yet carry the offset to poll from, wait until they are consumed
+      if (atomic_load_32(&pVg->bufferedCnt) > 0) {
         atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
-        tsem_post(&tmq->rspSem);
-        return -1;
+        continue;
       }
-      pParam->refId = tmq->refId;
-      pParam->epoch = tmq->epoch;
 
-      pParam->pVg = pVg;
-      pParam->pTopic = pTopic;
-      pParam->vgId = pVg->vgId;
-
-      SMsgSendInfo* sendInfo = taosMemoryCalloc(1, sizeof(SMsgSendInfo));
-      if (sendInfo == NULL) {
-        taosMemoryFree(pReq);
-        taosMemoryFree(pParam);
+      if (tmqPollVg(tmq, pTopic, pVg, &pVg->currentOffset, timeout) < 0) {
         atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
         tsem_post(&tmq->rspSem);
         return -1;
       }
-
-      sendInfo->msgInfo = (SDataBuf){
-          .pData = pReq,
-          .len = sizeof(SMqPollReq),
-          .handle = NULL,
-      };
-      sendInfo->requestId = pReq->reqId;
-      sendInfo->requestObjRefId = 0;
-      sendInfo->param = pParam;
-      sendInfo->fp = tmqPollCb;
-      sendInfo->msgType = TDMT_VND_CONSUME;
-
-      int64_t transporterId = 0;
-      /*printf("send poll\n");*/
-
-      char offsetFormatBuf[80];
-      tFormatOffset(offsetFormatBuf, 80, &pVg->currentOffset);
-      tscDebug("consumer:%" PRId64 ", send poll to %s vgId:%d, epoch %d, req offset:%s, reqId:%" PRIu64,
-               tmq->consumerId, pTopic->topicName, pVg->vgId, tmq->epoch, offsetFormatBuf, pReq->reqId);
-      /*printf("send vgId:%d %" PRId64 "\n", pVg->vgId, pVg->currentOffset);*/
-      asyncSendMsgToServer(tmq->pTscObj->pAppInfo->pTransporter, &pVg->epSet, &transporterId, sendInfo);
-      pVg->pollCnt++;
-      tmq->pollCnt++;
     }
   }
   return 0;
@@ -1604,6 +1658,13 @@ int32_t tmqHandleNoPollRsp(tmq_t* tmq, SMqRspWrapper* rspWrapper, bool* pReset)
   return 0;
 }
 
+// the rsp is consumed or discarded, uncount it from its vgroup unless the vgroups have been replaced since it was counted
+static void tmqReleaseBufferedRsp(tmq_t* tmq, SMqPollRspWrapper* pollRspWrapper) {
+  if (pollRspWrapper->epoch == atomic_load_32(&tmq->epoch)) {
+    atomic_sub_fetch_32(&pollRspWrapper->vgHandle->bufferedCnt, 1);
+  }
+}
+
 void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
   while (1) {
     SMqRspWrapper* rspWrapper = NULL;
@@ -1628,7 +1689,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
         /*printf("vgId:%d, offset %" PRId64 " up to %" PRId64 "\n", pVg->vgId, pVg->currentOffset,
          * rspMsg->msg.rspOffset);*/
         pVg->currentOffset = pollRspWrapper->dataRsp.rspOffset;
-        atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         if (pollRspWrapper->dataRsp.blockNum == 0) {
           taosFreeQitem(pollRspWrapper);
           rspWrapper = NULL;
@@ -1641,6 +1702,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
       } else {
         tscDebug("msg discard since epoch mismatch: msg epoch %d, consumer epoch %d\n",
                  pollRspWrapper->dataRsp.head.epoch, consumerEpoch);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         taosFreeQitem(pollRspWrapper);
       }
     } else if (rspWrapper->tmqRspType == TMQ_MSG_TYPE__POLL_META_RSP) {
@@ -1651,7 +1713,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
         /*printf("vgId:%d, offset %" PRId64 " up to %" PRId64 "\n", pVg->vgId, pVg->currentOffset,
          * rspMsg->msg.rspOffset);*/
         pVg->currentOffset = pollRspWrapper->metaRsp.rspOffset;
-        atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         // build rsp
         SMqMetaRspObj* pRsp = tmqBuildMetaRspFromWrapper(pollRspWrapper);
         taosFreeQitem(pollRspWrapper);
@@ -1659,6 +1721,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
       } else {
         tscDebug("msg discard since epoch mismatch: msg epoch %d, consumer epoch %d\n",
                  pollRspWrapper->metaRsp.head.epoch, consumerEpoch);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         taosFreeQitem(pollRspWrapper);
       }
     } else if (rspWrapper->tmqRspType == TMQ_MSG_TYPE__TAOSX_RSP) {
@@ -1670,7 +1733,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
         /*printf("vgId:%d, offset %" PRId64 " up to %" PRId64 "\n", pVg->vgId, pVg->currentOffset,
          * rspMsg->msg.rspOffset);*/
         pVg->currentOffset = pollRspWrapper->taosxRsp.rspOffset;
-        atomic_store_32(&pVg->vgStatus, TMQ_VG_STATUS__IDLE);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         if (pollRspWrapper->taosxRsp.blockNum == 0) {
           taosFreeQitem(pollRspWrapper);
           rspWrapper = NULL;
@@ -1689,6 +1752,7 @@ void* tmqHandleAllRsp(tmq_t* tmq, int64_t timeout, bool pollIfReset) {
       } else {
         tscDebug("msg discard since epoch mismatch: msg epoch %d, consumer epoch %d\n",
                  pollRspWrapper->taosxRsp.head.epoch, consumerEpoch);
+        tmqReleaseBufferedRsp(tmq, pollRspWrapper);
         taosFreeQitem(pollRspWrapper);
       }
     } else {
@@ -132,9 +132,35 @@ TEST(testCase, smlParseInfluxString_Test) {
   memset(&elements, 0, sizeof(SSmlLineInfo));
   ret = smlParseInfluxString(sql, sql + strlen(sql), &elements, &msgBuf);
   ASSERT_NE(ret, 0);
+
+  // case 9 the separators and escapes are beyond the first 32 bytes
+  tmp = "measurement_with_a_long_name\\,\\ 01,host=server_with_a_long_name_01 "
+        "usage_idle=98.5,msg=\"with a space, and a comma\" 1626006833639000000";
+  memcpy(sql, tmp, strlen(tmp) + 1);
+  memset(&elements, 0, sizeof(SSmlLineInfo));
+  ret = smlParseInfluxString(sql, sql + strlen(sql), &elements, &msgBuf);
+  ASSERT_EQ(ret, 0);
+  ASSERT_EQ(elements.measureLen, strlen("measurement_with_a_long_name, 01"));
+  ASSERT_EQ(strncmp(elements.measure, "measurement_with_a_long_name, 01", elements.measureLen), 0);
+  ASSERT_EQ(elements.tagsLen, strlen("host=server_with_a_long_name_01"));
+  ASSERT_EQ(elements.colsLen, strlen("usage_idle=98.5,msg=\"with a space, and a comma\""));
+  ASSERT_EQ(elements.timestampLen, strlen("1626006833639000000"));
   taosMemoryFree(sql);
 }
 
+TEST(testCase, smlFindToken_Test) {
+  char buf[128] = {0};
+  memset(buf, 'a', 100);
+  ASSERT_EQ(smlFindToken(buf, buf + 100, &smlMeasureToken), buf + 100);
+
+  for (int32_t i = 0; i < 100; ++i) {
+    buf[i] = ',';
+    ASSERT_EQ(smlFindToken(buf, buf + 100, &smlKeyToken), buf + i);
+    ASSERT_EQ(smlFindToken(buf, buf + 100, &smlSpaceToken), buf + 100);
+    buf[i] = 'a';
+  }
+}
+
 TEST(testCase, smlParseCols_Error_Test) {
   const char *data[] = {"c=\"89sd",  // binary, nchar
                         "c=j\"89sd\"",
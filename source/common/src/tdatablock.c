@@ -887,6 +887,191 @@ static int32_t* createTupleIndex(size_t rows) {
 
 static void destroyTupleIndex(int32_t* index) { taosMemoryFreeClear(index); }
 
+#define NORMALIZED_KEY_MAX_WIDTH 32
+
+int32_t blockDataGetNormalizedKeyWidth(const SSDataBlock* pBlock, const SArray* pOrderInfo) {
+  if (pBlock->pBlockAgg != NULL) {
+    return -1;
+  }
+
+  int32_t width = 0;
+  for (int32_t i = 0; i < taosArrayGetSize(pOrderInfo); ++i) {
+    SBlockOrderInfo* pOrder = taosArrayGet(pOrderInfo, i);
+    SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, pOrder->slotId);
+
+    int32_t type = pCol->info.type;
+    if (!IS_MATHABLE_TYPE(type)) {
+      return -1;
+    }
+
+    // one byte for the null flag
+    width += pCol->info.bytes + 1;
+  }
+
+  return (width <= NORMALIZED_KEY_MAX_WIDTH) ? width : -1;
+}
+
+// map the value to an unsigned integer with the same order, and store it in big endian
+static void encodeNormalizedValue(char* pKey, const char* pData, int32_t type, int32_t bytes, bool desc) {
+  uint64_t v = 0;
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+      v = (*(int8_t*)pData) ? 1 : 0;
+      break;
+    case TSDB_DATA_TYPE_TINYINT:
+      v = (uint8_t)(*(int8_t*)pData) ^ 0x80u;
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      v = (uint16_t)(*(int16_t*)pData) ^ 0x8000u;
+      break;
+    case TSDB_DATA_TYPE_INT:
+      v = (uint32_t)(*(int32_t*)pData) ^ 0x80000000u;
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      v = (uint64_t)(*(int64_t*)pData) ^ 0x8000000000000000ull;
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      v = *(uint8_t*)pData;
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      v = *(uint16_t*)pData;
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      v = *(uint32_t*)pData;
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      v = *(uint64_t*)pData;
+      break;
+    // the same as compareFloatVal and compareDoubleVal: all NaNs are equal and less than any other value, and
+    // -0 equals +0
+    case TSDB_DATA_TYPE_FLOAT: {
+      float f = GET_FLOAT_VAL(pData);
+      if (isnan(f)) {
+        v = 0;
+        break;
+      }
+
+      uint32_t u = 0;
+      if (f != 0) {
+        memcpy(&u, &f, sizeof(u));
+      }
+      v = (u & 0x80000000u) ? (uint32_t)~u : (u | 0x80000000u);
+      break;
+    }
+    case TSDB_DATA_TYPE_DOUBLE: {
+      double d = GET_DOUBLE_VAL(pData);
+      if (isnan(d)) {
+        v = 0;
+        break;
+      }
+
+      uint64_t u = 0;
+      if (d != 0) {
+        memcpy(&u, &d, sizeof(u));
+      }
+      v = (u & 0x8000000000000000ull) ? ~u : (u | 0x8000000000000000ull);
+      break;
+    }
+    default:
+      ASSERT(0);
+  }
+
+  if (desc) {
+    v = ~v;
+  }
+
+  for (int32_t i = bytes - 1; i >= 0; --i) {
+    pKey[i] = (char)(v & 0xFF);
+    v >>= 8;
+  }
+}
+
+void blockDataEncodeNormalizedKeys(const SSDataBlock* pBlock, const SArray* pOrderInfo, char* pKeys, int32_t stride) {
+  int32_t rows = pBlock->info.rows;
+  int32_t offset = 0;
+
+  for (int32_t i = 0; i < taosArrayGetSize(pOrderInfo); ++i) {
+    SBlockOrderInfo* pOrder = taosArrayGet(pOrderInfo, i);
+    SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, pOrder->slotId);
+
+    int32_t type = pCol->info.type;
+    int32_t bytes = pCol->info.bytes;
+    bool    desc = (pOrder->order == TSDB_ORDER_DESC);
+
+    // the null flag keeps the null values before or after all others, regardless of the order
+    char nullFlag = pOrder->nullFirst ? 0 : 1;
+    for (int32_t j = 0; j < rows; ++j) {
+      char* pKey = pKeys + (int64_t)j * stride + offset;
+      if (colDataIsNull(pCol, rows, j, NULL)) {
+        pKey[0] = nullFlag;
+        memset(pKey + 1, 0, bytes);
+      } else {
+        pKey[0] = 1 - nullFlag;
+        encodeNormalizedValue(pKey + 1, colDataGetData(pCol, j), type, bytes, desc);
+      }
+    }
+
+    offset += bytes + 1;
+  }
+}
+
+// LSD radix sort on the normalized keys, the row index is kept after the key of each entry.
+static int32_t* createSortedTupleIndex(const SSDataBlock* pDataBlock, const SArray* pOrderInfo, int32_t keyWidth) {
+  int32_t rows = pDataBlock->info.rows;
+  int32_t stride = keyWidth + sizeof(int32_t);
+
+  int32_t* index = taosMemoryMalloc(rows * sizeof(int32_t));
+  char*    pEntries = taosMemoryMalloc((int64_t)rows * stride);
+  char*    pTmp = taosMemoryMalloc((int64_t)rows * stride);
+  if (index == NULL || pEntries == NULL || pTmp == NULL) {
+    taosMemoryFree(index);
+    taosMemoryFree(pEntries);
+    taosMemoryFree(pTmp);
+    return NULL;
+  }
+
+  blockDataEncodeNormalizedKeys(pDataBlock, pOrderInfo, pEntries, stride);
+  for (int32_t i = 0; i < rows; ++i) {
+    memcpy(pEntries + (int64_t)i * stride + keyWidth, &i, sizeof(int32_t));
+  }
+
+  int32_t count[256];
+  for (int32_t b = keyWidth - 1; b >= 0; --b) {
+    memset(count, 0, sizeof(count));
+    for (int32_t i = 0; i < rows; ++i) {
+      count[(uint8_t)pEntries[(int64_t)i * stride + b]] += 1;
+    }
+
+    // all keys have the same byte in this position, e.g., the null flags or the high bytes of small values.
+    if (count[(uint8_t)pEntries[b]] == rows) {
+      continue;
+    }
+
+    int32_t pos = 0;
+    for (int32_t k = 0; k < 256; ++k) {
+      int32_t c = count[k];
+      count[k] = pos;
+      pos += c;
+    }
+
+    for (int32_t i = 0; i < rows; ++i) {
+      char* p = pEntries + (int64_t)i * stride;
+      memcpy(pTmp + (int64_t)(count[(uint8_t)p[b]]++) * stride, p, stride);
+    }
+
+    TSWAP(pEntries, pTmp);
+  }
+
+  for (int32_t i = 0; i < rows; ++i) {
+    memcpy(&index[i], pEntries + (int64_t)i * stride + keyWidth, sizeof(int32_t));
+  }
+
+  taosMemoryFree(pEntries);
+  taosMemoryFree(pTmp);
+  return index;
+}
+
 int32_t blockDataSort(SSDataBlock* pDataBlock, SArray* pOrderInfo) {
   ASSERT(pDataBlock != NULL && pOrderInfo != NULL);
   if (pDataBlock->info.rows <= 1) {
@@ -935,23 +1120,36 @@ int32_t blockDataSort(SSDataBlock* pDataBlock, SArray* pOrderInfo) {
     }
   }
 
-  int32_t* index = createTupleIndex(rows);
-  if (index == NULL) {
-    terrno = TSDB_CODE_OUT_OF_MEMORY;
-    return terrno;
-  }
+  int64_t  p0 = taosGetTimestampUs();
+  int32_t* index = NULL;
 
-  int64_t p0 = taosGetTimestampUs();
+  int32_t keyWidth = blockDataGetNormalizedKeyWidth(pDataBlock, pOrderInfo);
+  if (keyWidth > 0) {
+    index = createSortedTupleIndex(pDataBlock, pOrderInfo, keyWidth);
+    if (index == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return terrno;
+    }
+  } else {
+    index = createTupleIndex(rows);
+    if (index == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return terrno;
+    }
 
-  SSDataBlockSortHelper helper = {.pDataBlock = pDataBlock, .orderInfo = pOrderInfo};
-  for (int32_t i = 0; i < taosArrayGetSize(helper.orderInfo); ++i) {
-    struct SBlockOrderInfo* pInfo = taosArrayGet(helper.orderInfo, i);
-    pInfo->pColData = taosArrayGet(pDataBlock->pDataBlock, pInfo->slotId);
-  }
+    SSDataBlockSortHelper helper = {.pDataBlock = pDataBlock, .orderInfo = pOrderInfo};
+    for (int32_t i = 0; i < taosArrayGetSize(helper.orderInfo); ++i) {
+      struct SBlockOrderInfo* pInfo = taosArrayGet(helper.orderInfo, i);
+      pInfo->pColData = taosArrayGet(pDataBlock->pDataBlock, pInfo->slotId);
+    }
 
-  terrno = 0;
-  taosqsort(index, rows, sizeof(int32_t), &helper, dataBlockCompar);
-  if (terrno) return terrno;
+    terrno = 0;
+    taosqsort(index, rows, sizeof(int32_t), &helper, dataBlockCompar);
+    if (terrno) {
+      destroyTupleIndex(index);
+      return terrno;
+    }
+  }
 
   int64_t p1 = taosGetTimestampUs();
 
@@ -2158,6 +2356,15 @@ char* buildCtbNameByGroupId(const char* stbName, uint64_t groupId) {
   return rname.childTableName;
 }
 
+// the bits of the flag segment in the encoded block
+#define BLOCK_ENCODE_COLUMN_INFO (1u << 31)
+#define BLOCK_ENCODE_COMPRESSED  (1u << 0)
+
+/*
+ * If needCompress is set, the data of each column is compressed with the codec of its type, and stored after the
+ * length of the uncompressed data. Columns that do not shrink are stored as they are. The buffer must be sized by
+ * blockGetCompressedEncodeSize in this case.
+ */
 void blockEncode(const SSDataBlock* pBlock, char* data, int32_t* dataLen, int32_t numOfCols, int8_t needCompress) {
   // todo extract method
   int32_t* version = (int32_t*)data;
@@ -2178,8 +2385,11 @@ void blockEncode(const SSDataBlock* pBlock, char* data, int32_t* dataLen, int32_
 
   // flag segment.
   // the inital bit is for column info
-  int32_t* flagSegment = (int32_t*)data;
-  *flagSegment = (1 << 31);
+  uint32_t* flagSegment = (uint32_t*)data;
+  *flagSegment = BLOCK_ENCODE_COLUMN_INFO;
+  if (needCompress) {
+    *flagSegment |= BLOCK_ENCODE_COMPRESSED;
+  }
 
   data += sizeof(int32_t);
 
@@ -2219,8 +2429,22 @@ void blockEncode(const SSDataBlock* pBlock, char* data, int32_t* dataLen, int32_
     (*dataLen) += metaSize;
 
     if (needCompress) {
-      colSizes[col] = blockCompressColData(pColRes, numOfRows, data, needCompress);
-      data += colSizes[col];
+      int32_t rawLen = colDataGetLength(pColRes, numOfRows);
+      *(int32_t*)data = rawLen;
+      data += sizeof(int32_t);
+
+      // keep the raw data if the column is not compressible, the decoder tells it by the equal length
+      int32_t compLen = -1;
+      if (rawLen > 0 && tDataTypes[pColRes->info.type].compFunc != NULL) {
+        compLen = blockCompressColData(pColRes, numOfRows, data, needCompress);
+      }
+      if (compLen < 0 || compLen >= rawLen) {
+        memmove(data, pColRes->pData, rawLen);
+        compLen = rawLen;
+      }
+      data += compLen;
+
+      colSizes[col] = sizeof(int32_t) + compLen;
       (*dataLen) += colSizes[col];
     } else {
       colSizes[col] = colDataGetLength(pColRes, numOfRows);
@@ -2258,8 +2482,9 @@ const char* blockDecode(SSDataBlock* pBlock, const char* pData) {
   pStart += sizeof(int32_t);
 
   // has column info segment
-  int32_t flagSeg = *(int32_t*)pStart;
-  int32_t hasColumnInfo = (flagSeg >> 31);
+  uint32_t flagSeg = *(uint32_t*)pStart;
+  int32_t  hasColumnInfo = ((flagSeg & BLOCK_ENCODE_COLUMN_INFO) != 0);
+  bool     compressed = ((flagSeg & BLOCK_ENCODE_COMPRESSED) != 0);
   pStart += sizeof(int32_t);
 
   // group id sizeof(uint64_t)
@@ -2297,25 +2522,46 @@ const char* blockDecode(SSDataBlock* pBlock, const char* pData) {
     if (IS_VAR_DATA_TYPE(pColInfoData->info.type)) {
       memcpy(pColInfoData->varmeta.offset, pStart, sizeof(int32_t) * numOfRows);
       pStart += sizeof(int32_t) * numOfRows;
+    } else {
+      memcpy(pColInfoData->nullbitmap, pStart, BitmapLen(numOfRows));
+      pStart += BitmapLen(numOfRows);
+    }
+
+    const char* pColData = pStart;
+    int32_t     rawLen = colLen[i];
+    if (compressed) {
+      rawLen = *(int32_t*)pStart;
+      pColData += sizeof(int32_t);
+    }
 
-      if (colLen[i] > 0 && pColInfoData->varmeta.allocLen < colLen[i]) {
-        char* tmp = taosMemoryRealloc(pColInfoData->pData, colLen[i]);
+    if (IS_VAR_DATA_TYPE(pColInfoData->info.type)) {
+      if (rawLen > 0 && pColInfoData->varmeta.allocLen < rawLen) {
+        char* tmp = taosMemoryRealloc(pColInfoData->pData, rawLen);
         if (tmp == NULL) {
           return NULL;
         }
 
         pColInfoData->pData = tmp;
-        pColInfoData->varmeta.allocLen = colLen[i];
+        pColInfoData->varmeta.allocLen = rawLen;
       }
 
-      pColInfoData->varmeta.length = colLen[i];
-    } else {
-      memcpy(pColInfoData->nullbitmap, pStart, BitmapLen(numOfRows));
-      pStart += BitmapLen(numOfRows);
+      pColInfoData->varmeta.length = rawLen;
     }
 
-    if (colLen[i] > 0) {
-      memcpy(pColInfoData->pData, pStart, colLen[i]);
+    if (rawLen > 0) {
+      int32_t compLen = colLen[i] - (int32_t)sizeof(int32_t);
+      if (compressed && compLen != rawLen) {
+        int32_t len = (*(tDataTypes[pColInfoData->info.type].decompFunc))((void*)pColData, compLen, numOfRows,
+                                                                           pColInfoData->pData, rawLen, ONE_STAGE_COMP,
+                                                                           NULL, 0);
+        if (len != rawLen) {
+          uError("failed to decompress column %d of data block, rawLen:%d, len:%d", i, rawLen, len);
+          terrno = TSDB_CODE_FILE_CORRUPTED;
+          return NULL;
+        }
+      } else {
+        memcpy(pColInfoData->pData, pColData, rawLen);
+      }
     }
 
     // TODO
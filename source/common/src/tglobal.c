@@ -94,6 +94,7 @@ int32_t tsQuerySmaOptimize = 0;
 int32_t tsQueryRsmaTolerance = 1000;  // the tolerance time (ms) to judge from which level to query rsma data.
 bool    tsQueryPlannerTrace = false;
 int32_t tsQueryNodeChunkSize = 32 * 1024;
+int32_t tsQueryScanParallelism = 1;
 bool    tsQueryUseNodeAllocator = true;
 bool    tsKeepColumnName = false;
 
@@ -114,6 +115,10 @@ int32_t tsCompressMsgSize = -1;
  */
 int32_t tsCompressColData = -1;
 
+// the dnode compresses snapshot messages with deflate instead of lz4. The nodes of older versions can not decode them,
+// enable it after all of them are upgraded
+bool tsRpcDeflateCompress = false;
+
 // count/hyperloglog function always return values in case of all NULL data or Empty data set.
 int32_t tsCountAlwaysReturnValue = 1;
 
@@ -136,12 +141,37 @@ int32_t tsMaxMemUsedByInsert = 1024;
 int32_t tsQueryBufferSize = -1;
 int64_t tsQueryBufferSizeBytes = -1;
 
+// the maximum memory that the hash tables of blocking operators in one query task may use, in MB.
+// 0 no limit, by default, since only the group by operator spills to disk
+// positive value, group by spills its groups to disk and the partition and interval operators fail the query beyond it
+int32_t tsQueryMaxTaskMemory = 0;
+
 int32_t  tsDiskCfgNum = 0;
 SDiskCfg tsDiskCfg[TFS_MAX_DISKS] = {0};
 
 // stream scheduler
 bool tsSchedStreamToSnode = true;
 
+// stream dispatch
+// the output already queued is coalesced into one dispatch message per downstream task up to this size, in KB.
+// 0 dispatches each output separately
+int32_t tsStreamDispatchBatchSize = 1024;
+// the compressed blocks can not be decoded by the nodes of older versions, enable it after all of them are upgraded
+bool    tsStreamDispatchCompress = false;
+
+// snapshot
+// data blocks entirely in the snapshot version range are shipped compressed as they are on disk.
+// the nodes of older versions can not apply such blocks, enable it after all of them are upgraded
+bool tsSnapshotRawBlock = false;
+
+// tsdb
+// the writer samples each column of a data block and picks the codec that fits it best.
+// older versions cannot read such blocks, enable after all nodes are upgraded
+bool tsAdaptiveCodec = false;
+// the var-length columns with few distinct values in a data block are stored as a dictionary plus codes.
+// the nodes of older versions can not read such blocks, enable it after all of them are upgraded
+bool tsDictCodec = false;
+
 /*
  * minimum scale for whole system, millisecond by default
  * for TSDB_TIME_PRECISION_MILLI: 60000L
@@ -170,6 +200,7 @@ int32_t tsTtlUnit = 86400;
 int32_t tsTtlPushInterval = 86400;
 int32_t tsGrantHBInterval = 60;
 int32_t tsUptimeInterval = 300;     // seconds
+int32_t tsSyncPipelineWindow = 8;   // batches in flight per replica when a follower catches up
 char    tsUdfdResFuncs[1024] = "";  // udfd resident funcs that teardown when udfd exits
 
 #ifndef _STORAGE
@@ -291,10 +322,12 @@ static int32_t taosAddClientCfg(SConfig *pCfg) {
   if (cfgAddInt32(pCfg, "shellActivityTimer", tsShellActivityTimer, 1, 120, 1) != 0) return -1;
   if (cfgAddInt32(pCfg, "compressMsgSize", tsCompressMsgSize, -1, 100000000, 1) != 0) return -1;
   if (cfgAddInt32(pCfg, "compressColData", tsCompressColData, -1, 100000000, 1) != 0) return -1;
+  if (cfgAddBool(pCfg, "rpcDeflateCompress", tsRpcDeflateCompress, 0) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryPolicy", tsQueryPolicy, 1, 4, 1) != 0) return -1;
   if (cfgAddInt32(pCfg, "querySmaOptimize", tsQuerySmaOptimize, 0, 1, 1) != 0) return -1;
   if (cfgAddBool(pCfg, "queryPlannerTrace", tsQueryPlannerTrace, true) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryNodeChunkSize", tsQueryNodeChunkSize, 1024, 128 * 1024, true) != 0) return -1;
+  if (cfgAddInt32(pCfg, "queryScanParallelism", tsQueryScanParallelism, 1, 64, true) != 0) return -1;
   if (cfgAddBool(pCfg, "queryUseNodeAllocator", tsQueryUseNodeAllocator, true) != 0) return -1;
   if (cfgAddBool(pCfg, "keepColumnName", tsKeepColumnName, true) != 0) return -1;
   if (cfgAddString(pCfg, "smlChildTableName", "", 1) != 0) return -1;
@@ -349,6 +382,12 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
   if (cfgAddInt32(pCfg, "maxNumOfDistinctRes", tsMaxNumOfDistinctResults, 10 * 10000, 10000 * 10000, 0) != 0) return -1;
   if (cfgAddInt32(pCfg, "countAlwaysReturnValue", tsCountAlwaysReturnValue, 0, 1, 0) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryBufferSize", tsQueryBufferSize, -1, 500000000000, 0) != 0) return -1;
+  if (cfgAddInt32(pCfg, "queryMaxTaskMemory", tsQueryMaxTaskMemory, 0, INT32_MAX, 0) != 0) return -1;
+  if (cfgAddInt32(pCfg, "streamDispatchBatchSize", tsStreamDispatchBatchSize, 0, 1024 * 1024, 0) != 0) return -1;
+  if (cfgAddBool(pCfg, "streamDispatchCompress", tsStreamDispatchCompress, 0) != 0) return -1;
+  if (cfgAddBool(pCfg, "snapshotRawBlock", tsSnapshotRawBlock, 0) != 0) return -1;
+  if (cfgAddBool(pCfg, "adaptiveCodec", tsAdaptiveCodec, 0) != 0) return -1;
+  if (cfgAddBool(pCfg, "dictCodec", tsDictCodec, 0) != 0) return -1;
   if (cfgAddBool(pCfg, "printAuth", tsPrintAuth, 0) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryRspPolicy", tsQueryRspPolicy, 0, 1, 0) != 0) return -1;
 
@@ -432,6 +471,7 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
   if (cfgAddInt32(pCfg, "ttlUnit", tsTtlUnit, 1, 86400 * 365, 1) != 0) return -1;
   if (cfgAddInt32(pCfg, "ttlPushInterval", tsTtlPushInterval, 1, 100000, 1) != 0) return -1;
   if (cfgAddInt32(pCfg, "uptimeInterval", tsUptimeInterval, 1, 100000, 1) != 0) return -1;
+  if (cfgAddInt32(pCfg, "syncPipelineWindow", tsSyncPipelineWindow, 1, 64, 0) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryRsmaTolerance", tsQueryRsmaTolerance, 0, 900000, 0) != 0) return -1;
 
   if (cfgAddBool(pCfg, "udf", tsStartUdfd, 0) != 0) return -1;
@@ -663,6 +703,7 @@ static int32_t taosSetClientCfg(SConfig *pCfg) {
   tsQuerySmaOptimize = cfgGetItem(pCfg, "querySmaOptimize")->i32;
   tsQueryPlannerTrace = cfgGetItem(pCfg, "queryPlannerTrace")->bval;
   tsQueryNodeChunkSize = cfgGetItem(pCfg, "queryNodeChunkSize")->i32;
+  tsQueryScanParallelism = cfgGetItem(pCfg, "queryScanParallelism")->i32;
   tsQueryUseNodeAllocator = cfgGetItem(pCfg, "queryUseNodeAllocator")->bval;
   tsKeepColumnName = cfgGetItem(pCfg, "keepColumnName")->bval;
   return 0;
@@ -696,6 +737,13 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   tsMaxNumOfDistinctResults = cfgGetItem(pCfg, "maxNumOfDistinctRes")->i32;
   tsCountAlwaysReturnValue = cfgGetItem(pCfg, "countAlwaysReturnValue")->i32;
   tsQueryBufferSize = cfgGetItem(pCfg, "queryBufferSize")->i32;
+  tsQueryMaxTaskMemory = cfgGetItem(pCfg, "queryMaxTaskMemory")->i32;
+  tsStreamDispatchBatchSize = cfgGetItem(pCfg, "streamDispatchBatchSize")->i32;
+  tsStreamDispatchCompress = cfgGetItem(pCfg, "streamDispatchCompress")->bval;
+  tsRpcDeflateCompress = cfgGetItem(pCfg, "rpcDeflateCompress")->bval;
+  tsSnapshotRawBlock = cfgGetItem(pCfg, "snapshotRawBlock")->bval;
+  tsAdaptiveCodec = cfgGetItem(pCfg, "adaptiveCodec")->bval;
+  tsDictCodec = cfgGetItem(pCfg, "dictCodec")->bval;
   tsPrintAuth = cfgGetItem(pCfg, "printAuth")->bval;
 
 #if !defined(WINDOWS) && !defined(DARWIN)
@@ -739,6 +787,7 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   tsTtlUnit = cfgGetItem(pCfg, "ttlUnit")->i32;
   tsTtlPushInterval = cfgGetItem(pCfg, "ttlPushInterval")->i32;
   tsUptimeInterval = cfgGetItem(pCfg, "uptimeInterval")->i32;
+  tsSyncPipelineWindow = cfgGetItem(pCfg, "syncPipelineWindow")->i32;
   tsQueryRsmaTolerance = cfgGetItem(pCfg, "queryRsmaTolerance")->i32;
 
   tsStartUdfd = cfgGetItem(pCfg, "udf")->bval;
@@ -774,6 +823,8 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
     case 'a': {
       if (strcasecmp("asyncLog", name) == 0) {
         tsAsyncLog = cfgGetItem(pCfg, "asyncLog")->bval;
+      } else if (strcasecmp("adaptiveCodec", name) == 0) {
+        tsAdaptiveCodec = cfgGetItem(pCfg, "adaptiveCodec")->bval;
       }
       break;
     }
@@ -797,6 +848,8 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
     case 'd': {
       if (strcasecmp("dDebugFlag", name) == 0) {
         dDebugFlag = cfgGetItem(pCfg, "dDebugFlag")->i32;
+      } else if (strcasecmp("dictCodec", name) == 0) {
+        tsDictCodec = cfgGetItem(pCfg, "dictCodec")->bval;
       }
       break;
     }
@@ -999,6 +1052,8 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
         if (tsQueryBufferSize >= 0) {
           tsQueryBufferSizeBytes = tsQueryBufferSize * 1048576UL;
         }
+      } else if (strcasecmp("queryMaxTaskMemory", name) == 0) {
+        tsQueryMaxTaskMemory = cfgGetItem(pCfg, "queryMaxTaskMemory")->i32;
       } else if (strcasecmp("qnodeShmSize", name) == 0) {
         tsQnodeShmSize = cfgGetItem(pCfg, "qnodeShmSize")->i32;
       } else if (strcasecmp("qDebugFlag", name) == 0) {
@@ -1007,6 +1062,8 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
         tsQueryPlannerTrace = cfgGetItem(pCfg, "queryPlannerTrace")->bval;
       } else if (strcasecmp("queryNodeChunkSize", name) == 0) {
         tsQueryNodeChunkSize = cfgGetItem(pCfg, "queryNodeChunkSize")->i32;
+      } else if (strcasecmp("queryScanParallelism", name) == 0) {
+        tsQueryScanParallelism = cfgGetItem(pCfg, "queryScanParallelism")->i32;
       } else if (strcasecmp("queryUseNodeAllocator", name) == 0) {
         tsQueryUseNodeAllocator = cfgGetItem(pCfg, "queryUseNodeAllocator")->bval;
       } else if (strcasecmp("queryRsmaTolerance", name) == 0) {
@@ -1019,6 +1076,8 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
         tsRpcQueueMemoryAllowed = cfgGetItem(pCfg, "rpcQueueMemoryAllowed")->i64;
       } else if (strcasecmp("rpcDebugFlag", name) == 0) {
         rpcDebugFlag = cfgGetItem(pCfg, "rpcDebugFlag")->i32;
+      } else if (strcasecmp("rpcDeflateCompress", name) == 0) {
+        tsRpcDeflateCompress = cfgGetItem(pCfg, "rpcDeflateCompress")->bval;
       }
       break;
     }
@@ -1060,6 +1119,12 @@ int32_t taosSetCfg(SConfig *pCfg, char *name) {
         sDebugFlag = cfgGetItem(pCfg, "sDebugFlag")->i32;
       } else if (strcasecmp("smaDebugFlag", name) == 0) {
         smaDebugFlag = cfgGetItem(pCfg, "smaDebugFlag")->i32;
+      } else if (strcasecmp("streamDispatchBatchSize", name) == 0) {
+        tsStreamDispatchBatchSize = cfgGetItem(pCfg, "streamDispatchBatchSize")->i32;
+      } else if (strcasecmp("streamDispatchCompress", name) == 0) {
+        tsStreamDispatchCompress = cfgGetItem(pCfg, "streamDispatchCompress")->bval;
+      } else if (strcasecmp("snapshotRawBlock", name) == 0) {
+        tsSnapshotRawBlock = cfgGetItem(pCfg, "snapshotRawBlock")->bval;
       }
       break;
     }
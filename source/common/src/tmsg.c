@@ -1018,6 +1018,14 @@ int32_t tSerializeSStatusReq(void *buf, int32_t bufLen, SStatusReq *pReq) {
   if (tEncodeI64(&encoder, pReq->qload.timeInQueryQueue) < 0) return -1;
   if (tEncodeI64(&encoder, pReq->qload.timeInFetchQueue) < 0) return -1;
 
+  // vnode load stats appended after the original fields, in the order of pVloads
+  for (int32_t i = 0; i < vlen; ++i) {
+    SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
+    if (tEncodeI64(&encoder, pload->numOfSelectReqs) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->queryElapsedTime) < 0) return -1;
+    if (tEncodeI64(&encoder, pload->memtableUsage) < 0) return -1;
+  }
+
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -1091,6 +1099,15 @@ int32_t tDeserializeSStatusReq(void *buf, int32_t bufLen, SStatusReq *pReq) {
   if (tDecodeI64(&decoder, &pReq->qload.timeInQueryQueue) < 0) return -1;
   if (tDecodeI64(&decoder, &pReq->qload.timeInFetchQueue) < 0) return -1;
 
+  if (!tDecodeIsEnd(&decoder)) {
+    for (int32_t i = 0; i < vlen; ++i) {
+      SVnodeLoad *pload = taosArrayGet(pReq->pVloads, i);
+      if (tDecodeI64(&decoder, &pload->numOfSelectReqs) < 0) return -1;
+      if (tDecodeI64(&decoder, &pload->queryElapsedTime) < 0) return -1;
+      if (tDecodeI64(&decoder, &pload->memtableUsage) < 0) return -1;
+    }
+  }
+
   tEndDecode(&decoder);
   tDecoderClear(&decoder);
   return 0;
@@ -4079,6 +4096,8 @@ int32_t tSerializeSBalanceVgroupReq(void *buf, int32_t bufLen, SBalanceVgroupReq
 
   if (tStartEncode(&encoder) < 0) return -1;
   if (tEncodeI32(&encoder, pReq->useless) < 0) return -1;
+  if (tEncodeI8(&encoder, pReq->dryRun) < 0) return -1;
+  if (tEncodeI32(&encoder, pReq->maxMoves) < 0) return -1;
   tEndEncode(&encoder);
 
   int32_t tlen = encoder.pos;
@@ -4092,12 +4111,69 @@ int32_t tDeserializeSBalanceVgroupReq(void *buf, int32_t bufLen, SBalanceVgroupR
 
   if (tStartDecode(&decoder) < 0) return -1;
   if (tDecodeI32(&decoder, &pReq->useless) < 0) return -1;
+  if (!tDecodeIsEnd(&decoder)) {
+    if (tDecodeI8(&decoder, &pReq->dryRun) < 0) return -1;
+    if (tDecodeI32(&decoder, &pReq->maxMoves) < 0) return -1;
+  }
+  tEndDecode(&decoder);
+
+  tDecoderClear(&decoder);
+  return 0;
+}
+
+int32_t tSerializeSBalanceVgroupRsp(void *buf, int32_t bufLen, SBalanceVgroupRsp *pRsp) {
+  SEncoder encoder = {0};
+  tEncoderInit(&encoder, buf, bufLen);
+
+  if (tStartEncode(&encoder) < 0) return -1;
+  int32_t numOfMoves = taosArrayGetSize(pRsp->pMoves);
+  if (tEncodeI32(&encoder, numOfMoves) < 0) return -1;
+  for (int32_t i = 0; i < numOfMoves; ++i) {
+    SBalanceVgroupMove *pMove = taosArrayGet(pRsp->pMoves, i);
+    if (tEncodeI32(&encoder, pMove->vgId) < 0) return -1;
+    if (tEncodeI32(&encoder, pMove->srcId) < 0) return -1;
+    if (tEncodeI32(&encoder, pMove->dstId) < 0) return -1;
+    if (tEncodeDouble(&encoder, pMove->cost) < 0) return -1;
+  }
+  tEndEncode(&encoder);
+
+  int32_t tlen = encoder.pos;
+  tEncoderClear(&encoder);
+  return tlen;
+}
+
+int32_t tDeserializeSBalanceVgroupRsp(void *buf, int32_t bufLen, SBalanceVgroupRsp *pRsp) {
+  SDecoder decoder = {0};
+  tDecoderInit(&decoder, buf, bufLen);
+
+  if (tStartDecode(&decoder) < 0) return -1;
+  int32_t numOfMoves = 0;
+  if (tDecodeI32(&decoder, &numOfMoves) < 0) return -1;
+  pRsp->pMoves = taosArrayInit(numOfMoves > 0 ? numOfMoves : 1, sizeof(SBalanceVgroupMove));
+  if (pRsp->pMoves == NULL) return -1;
+  for (int32_t i = 0; i < numOfMoves; ++i) {
+    SBalanceVgroupMove move = {0};
+    if (tDecodeI32(&decoder, &move.vgId) < 0) return -1;
+    if (tDecodeI32(&decoder, &move.srcId) < 0) return -1;
+    if (tDecodeI32(&decoder, &move.dstId) < 0) return -1;
+    if (tDecodeDouble(&decoder, &move.cost) < 0) return -1;
+    if (taosArrayPush(pRsp->pMoves, &move) == NULL) return -1;
+  }
   tEndDecode(&decoder);
 
   tDecoderClear(&decoder);
   return 0;
 }
 
+void tFreeSBalanceVgroupRsp(SBalanceVgroupRsp *pRsp) {
+  if (NULL == pRsp) {
+    return;
+  }
+
+  taosArrayDestroy(pRsp->pMoves);
+  pRsp->pMoves = NULL;
+}
+
 int32_t tSerializeSMergeVgroupReq(void *buf, int32_t bufLen, SMergeVgroupReq *pReq) {
   SEncoder encoder = {0};
   tEncoderInit(&encoder, buf, bufLen);
@@ -4181,6 +4257,43 @@ int32_t tDeserializeSSplitVgroupReq(void *buf, int32_t bufLen, SSplitVgroupReq *
   return 0;
 }
 
+int32_t tSerializeSAlterVnodeHashRangeReq(void *buf, int32_t bufLen, SAlterVnodeHashRangeReq *pReq) {
+  SEncoder encoder = {0};
+  tEncoderInit(&encoder, buf, bufLen);
+
+  if (tStartEncode(&encoder) < 0) return -1;
+  if (tEncodeI32(&encoder, pReq->srcVgId) < 0) return -1;
+  if (tEncodeI32(&encoder, pReq->dstVgId) < 0) return -1;
+  if (tEncodeI32(&encoder, pReq->dstVgVersion) < 0) return -1;
+  if (tEncodeU32(&encoder, pReq->srcHashBegin) < 0) return -1;
+  if (tEncodeU32(&encoder, pReq->srcHashEnd) < 0) return -1;
+  if (tEncodeU32(&encoder, pReq->dstHashBegin) < 0) return -1;
+  if (tEncodeU32(&encoder, pReq->dstHashEnd) < 0) return -1;
+  tEndEncode(&encoder);
+
+  int32_t tlen = encoder.pos;
+  tEncoderClear(&encoder);
+  return tlen;
+}
+
+int32_t tDeserializeSAlterVnodeHashRangeReq(void *buf, int32_t bufLen, SAlterVnodeHashRangeReq *pReq) {
+  SDecoder decoder = {0};
+  tDecoderInit(&decoder, buf, bufLen);
+
+  if (tStartDecode(&decoder) < 0) return -1;
+  if (tDecodeI32(&decoder, &pReq->srcVgId) < 0) return -1;
+  if (tDecodeI32(&decoder, &pReq->dstVgId) < 0) return -1;
+  if (tDecodeI32(&decoder, &pReq->dstVgVersion) < 0) return -1;
+  if (tDecodeU32(&decoder, &pReq->srcHashBegin) < 0) return -1;
+  if (tDecodeU32(&decoder, &pReq->srcHashEnd) < 0) return -1;
+  if (tDecodeU32(&decoder, &pReq->dstHashBegin) < 0) return -1;
+  if (tDecodeU32(&decoder, &pReq->dstHashEnd) < 0) return -1;
+  tEndDecode(&decoder);
+
+  tDecoderClear(&decoder);
+  return 0;
+}
+
 int32_t tSerializeSDCreateMnodeReq(void *buf, int32_t bufLen, SDCreateMnodeReq *pReq) {
   SEncoder encoder = {0};
   tEncoderInit(&encoder, buf, bufLen);
@@ -10,6 +10,7 @@
 
 #include "taos.h"
 #include "tcommon.h"
+#include "tcompare.h"
 #include "tdatablock.h"
 #include "tdef.h"
 #include "tvariant.h"
@@ -154,6 +155,183 @@ TEST(testCase, Datablock_test) {
   taosArrayDestroy(pOrderInfo);
 }
 
+TEST(testCase, normalized_key_sort_test) {
+  SSDataBlock* b = createDataBlock();
+
+  SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_INT, 4, 1);
+  blockDataAppendColInfo(b, &infoData);
+
+  SColumnInfoData infoData1 = createColumnInfoData(TSDB_DATA_TYPE_DOUBLE, 8, 2);
+  blockDataAppendColInfo(b, &infoData1);
+
+  int32_t numOfRows = 1000;
+  blockDataEnsureCapacity(b, numOfRows);
+
+  SColumnInfoData* p0 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 0);
+  SColumnInfoData* p1 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 1);
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int32_t k = (i * 7919) % 41 - 20;
+    double  v = ((i * 104729) % 1000 - 500) / 3.0;
+    colDataAppend(p0, i, (const char*)&k, (i % 97) == 0);
+    colDataAppend(p1, i, (const char*)&v, false);
+  }
+  b->info.rows = numOfRows;
+
+  SArray*         pOrderInfo = taosArrayInit(2, sizeof(SBlockOrderInfo));
+  SBlockOrderInfo order = {true, TSDB_ORDER_ASC, 0, NULL};
+  taosArrayPush(pOrderInfo, &order);
+  SBlockOrderInfo order1 = {false, TSDB_ORDER_DESC, 1, NULL};
+  taosArrayPush(pOrderInfo, &order1);
+
+  ASSERT_EQ(blockDataGetNormalizedKeyWidth(b, pOrderInfo), 14);
+  ASSERT_EQ(blockDataSort(b, pOrderInfo), 0);
+
+  p0 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 0);
+  p1 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 1);
+  for (int32_t i = 1; i < numOfRows; ++i) {
+    bool prevNull = colDataIsNull(p0, numOfRows, i - 1, NULL);
+    bool curNull = colDataIsNull(p0, numOfRows, i, NULL);
+    ASSERT_FALSE(!prevNull && curNull);
+    if (prevNull != curNull) {
+      continue;
+    }
+
+    int32_t k0 = prevNull ? 0 : *(int32_t*)colDataGetData(p0, i - 1);
+    int32_t k1 = curNull ? 0 : *(int32_t*)colDataGetData(p0, i);
+    ASSERT_LE(k0, k1);
+    if (k0 == k1) {
+      ASSERT_GE(*(double*)colDataGetData(p1, i - 1), *(double*)colDataGetData(p1, i));
+    }
+  }
+
+  blockDataDestroy(b);
+  taosArrayDestroy(pOrderInfo);
+}
+
+TEST(testCase, normalized_key_float_sort_test) {
+  double nan = NAN;
+  double values[] = {2.5, -0.0, nan, -INFINITY, 0.0, -nan, -1.5, INFINITY, 1e-3, -DBL_MAX};
+
+  int32_t orders[] = {TSDB_ORDER_ASC, TSDB_ORDER_DESC};
+  for (int32_t o = 0; o < tListLen(orders); ++o) {
+    SSDataBlock* b = createDataBlock();
+
+    SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_DOUBLE, 8, 1);
+    blockDataAppendColInfo(b, &infoData);
+    SColumnInfoData infoData1 = createColumnInfoData(TSDB_DATA_TYPE_FLOAT, 4, 2);
+    blockDataAppendColInfo(b, &infoData1);
+    SColumnInfoData infoData2 = createColumnInfoData(TSDB_DATA_TYPE_INT, 4, 3);
+    blockDataAppendColInfo(b, &infoData2);
+
+    int32_t numOfRows = 500;
+    blockDataEnsureCapacity(b, numOfRows);
+
+    SColumnInfoData* p0 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 0);
+    SColumnInfoData* p1 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 1);
+    SColumnInfoData* p2 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 2);
+    for (int32_t i = 0; i < numOfRows; ++i) {
+      double d = values[(i * 7) % tListLen(values)];
+      float  f = (float)values[(i * 3) % tListLen(values)];
+      colDataAppend(p0, i, (const char*)&d, false);
+      colDataAppend(p1, i, (const char*)&f, false);
+      colDataAppend(p2, i, (const char*)&i, false);
+    }
+    b->info.rows = numOfRows;
+
+    // the NaNs and the zeros of different signs are equal, so their order is decided by the next order columns
+    SArray*         pOrderInfo = taosArrayInit(3, sizeof(SBlockOrderInfo));
+    SBlockOrderInfo order = {true, orders[o], 0, NULL};
+    taosArrayPush(pOrderInfo, &order);
+    SBlockOrderInfo order1 = {true, orders[o], 1, NULL};
+    taosArrayPush(pOrderInfo, &order1);
+    SBlockOrderInfo order2 = {true, TSDB_ORDER_ASC, 2, NULL};
+    taosArrayPush(pOrderInfo, &order2);
+
+    ASSERT_EQ(blockDataGetNormalizedKeyWidth(b, pOrderInfo), 19);
+    ASSERT_EQ(blockDataSort(b, pOrderInfo), 0);
+
+    __compar_fn_t fn0 = getKeyComparFunc(TSDB_DATA_TYPE_DOUBLE, orders[o]);
+    __compar_fn_t fn1 = getKeyComparFunc(TSDB_DATA_TYPE_FLOAT, orders[o]);
+    for (int32_t i = 1; i < numOfRows; ++i) {
+      int32_t ret = fn0(colDataGetData(p0, i - 1), colDataGetData(p0, i));
+      ASSERT_LE(ret, 0) << "row " << i;
+      if (ret == 0) {
+        ret = fn1(colDataGetData(p1, i - 1), colDataGetData(p1, i));
+        ASSERT_LE(ret, 0) << "row " << i;
+      }
+      if (ret == 0) {
+        ASSERT_LT(*(int32_t*)colDataGetData(p2, i - 1), *(int32_t*)colDataGetData(p2, i)) << "row " << i;
+      }
+    }
+
+    blockDataDestroy(b);
+    taosArrayDestroy(pOrderInfo);
+  }
+}
+
+TEST(testCase, compressed_block_encode_test) {
+  SSDataBlock* b = createDataBlock();
+
+  SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_TIMESTAMP, 8, 1);
+  blockDataAppendColInfo(b, &infoData);
+  SColumnInfoData infoData1 = createColumnInfoData(TSDB_DATA_TYPE_BOOL, 1, 2);
+  blockDataAppendColInfo(b, &infoData1);
+  SColumnInfoData infoData2 = createColumnInfoData(TSDB_DATA_TYPE_BINARY, 40, 3);
+  blockDataAppendColInfo(b, &infoData2);
+
+  int32_t numOfRows = 4096;
+  blockDataEnsureCapacity(b, numOfRows);
+
+  char buf[64] = {0};
+  char varbuf[64] = {0};
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int64_t ts = 1600000000000 + i * 1000;
+    int8_t  v = i & 0x01;
+    sprintf(buf, "device_%d", i % 16);
+    STR_TO_VARSTR(varbuf, buf);
+
+    colDataAppend((SColumnInfoData*)taosArrayGet(b->pDataBlock, 0), i, (const char*)&ts, false);
+    colDataAppend((SColumnInfoData*)taosArrayGet(b->pDataBlock, 1), i, (const char*)&v, (i % 7) == 0);
+    colDataAppend((SColumnInfoData*)taosArrayGet(b->pDataBlock, 2), i, varbuf, (i % 5) == 0);
+  }
+  b->info.rows = numOfRows;
+
+  int32_t numOfCols = taosArrayGetSize(b->pDataBlock);
+  char*   pRaw = (char*)taosMemoryCalloc(1, blockGetEncodeSize(b));
+  char*   pComp = (char*)taosMemoryCalloc(1, blockGetCompressedEncodeSize(b));
+  int32_t rawLen = 0;
+  int32_t compLen = 0;
+  blockEncode(b, pRaw, &rawLen, numOfCols, 0);
+  blockEncode(b, pComp, &compLen, numOfCols, ONE_STAGE_COMP);
+  ASSERT_LT(compLen, rawLen);
+
+  SSDataBlock* pDecoded = (SSDataBlock*)taosMemoryCalloc(1, sizeof(SSDataBlock));
+  ASSERT_NE(blockDecode(pDecoded, pComp), nullptr);
+  ASSERT_EQ(pDecoded->info.rows, numOfRows);
+
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    for (int32_t j = 0; j < numOfCols; ++j) {
+      SColumnInfoData* pSrc = (SColumnInfoData*)taosArrayGet(b->pDataBlock, j);
+      SColumnInfoData* pDst = (SColumnInfoData*)taosArrayGet(pDecoded->pDataBlock, j);
+      bool             isNull = colDataIsNull_s(pSrc, i);
+      ASSERT_EQ(colDataIsNull_s(pDst, i), isNull);
+      if (isNull) {
+        continue;
+      }
+
+      char*   p0 = colDataGetData(pSrc, i);
+      char*   p1 = colDataGetData(pDst, i);
+      int32_t len = IS_VAR_DATA_TYPE(pSrc->info.type) ? varDataTLen(p0) : pSrc->info.bytes;
+      ASSERT_EQ(memcmp(p0, p1, len), 0);
+    }
+  }
+
+  taosMemoryFree(pRaw);
+  taosMemoryFree(pComp);
+  blockDataDestroy(pDecoded);
+  blockDataDestroy(b);
+}
+
 #if 0
 TEST(testCase, non_var_dataBlock_split_test) {
   SSDataBlock* b = static_cast<SSDataBlock*>(taosMemoryCalloc(1, sizeof(SSDataBlock)));
@@ -260,4 +438,78 @@ TEST(testCase, var_dataBlock_split_test) {
   }
 }
 
+TEST(testCase, status_req_vload_test) {
+  SStatusReq req = {0};
+  req.dnodeId = 2;
+  req.pVloads = taosArrayInit(2, sizeof(SVnodeLoad));
+  for (int32_t i = 0; i < 2; ++i) {
+    SVnodeLoad load = {0};
+    load.vgId = i + 2;
+    load.numOfTables = 10 * (i + 1);
+    load.numOfSelectReqs = 100 * (i + 1);
+    load.queryElapsedTime = 1000 * (i + 1);
+    load.memtableUsage = 10000 * (i + 1);
+    taosArrayPush(req.pVloads, &load);
+  }
+
+  int32_t contLen = tSerializeSStatusReq(NULL, 0, &req);
+  ASSERT_GT(contLen, 0);
+  void* pBuf = taosMemoryMalloc(contLen);
+  ASSERT_EQ(tSerializeSStatusReq(pBuf, contLen, &req), contLen);
+
+  SStatusReq rsp = {0};
+  ASSERT_EQ(tDeserializeSStatusReq(pBuf, contLen, &rsp), 0);
+  ASSERT_EQ(rsp.dnodeId, 2);
+  ASSERT_EQ(taosArrayGetSize(rsp.pVloads), 2);
+  for (int32_t i = 0; i < 2; ++i) {
+    SVnodeLoad* pLoad = (SVnodeLoad*)taosArrayGet(rsp.pVloads, i);
+    ASSERT_EQ(pLoad->vgId, i + 2);
+    ASSERT_EQ(pLoad->numOfTables, 10 * (i + 1));
+    ASSERT_EQ(pLoad->numOfSelectReqs, 100 * (i + 1));
+    ASSERT_EQ(pLoad->queryElapsedTime, 1000 * (i + 1));
+    ASSERT_EQ(pLoad->memtableUsage, 10000 * (i + 1));
+  }
+
+  tFreeSStatusReq(&rsp);
+  tFreeSStatusReq(&req);
+  taosMemoryFree(pBuf);
+}
+
+TEST(testCase, balance_vgroup_rsp_test) {
+  SBalanceVgroupRsp rsp = {0};
+  rsp.pMoves = taosArrayInit(2, sizeof(SBalanceVgroupMove));
+  SBalanceVgroupMove move1 = {.vgId = 2, .srcId = 1, .dstId = 3, .cost = 0.75};
+  SBalanceVgroupMove move2 = {.vgId = 5, .srcId = 2, .dstId = 3, .cost = 0.5};
+  taosArrayPush(rsp.pMoves, &move1);
+  taosArrayPush(rsp.pMoves, &move2);
+
+  int32_t contLen = tSerializeSBalanceVgroupRsp(NULL, 0, &rsp);
+  ASSERT_GT(contLen, 0);
+  void* pBuf = taosMemoryMalloc(contLen);
+  ASSERT_EQ(tSerializeSBalanceVgroupRsp(pBuf, contLen, &rsp), contLen);
+
+  SBalanceVgroupRsp res = {0};
+  ASSERT_EQ(tDeserializeSBalanceVgroupRsp(pBuf, contLen, &res), 0);
+  ASSERT_EQ(taosArrayGetSize(res.pMoves), 2);
+  SBalanceVgroupMove* pMove = (SBalanceVgroupMove*)taosArrayGet(res.pMoves, 1);
+  ASSERT_EQ(pMove->vgId, 5);
+  ASSERT_EQ(pMove->srcId, 2);
+  ASSERT_EQ(pMove->dstId, 3);
+  ASSERT_EQ(pMove->cost, 0.5);
+  tFreeSBalanceVgroupRsp(&res);
+  taosMemoryFree(pBuf);
+
+  // an empty plan still decodes into an empty array
+  SBalanceVgroupRsp empty = {0};
+  contLen = tSerializeSBalanceVgroupRsp(NULL, 0, &empty);
+  pBuf = taosMemoryMalloc(contLen);
+  tSerializeSBalanceVgroupRsp(pBuf, contLen, &empty);
+  ASSERT_EQ(tDeserializeSBalanceVgroupRsp(pBuf, contLen, &res), 0);
+  ASSERT_NE(res.pMoves, nullptr);
+  ASSERT_EQ(taosArrayGetSize(res.pMoves), 0);
+  tFreeSBalanceVgroupRsp(&res);
+  taosMemoryFree(pBuf);
+  tFreeSBalanceVgroupRsp(&rsp);
+}
+
 #pragma GCC diagnostic pop
\ No newline at end of file
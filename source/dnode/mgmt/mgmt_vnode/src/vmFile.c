@@ -144,7 +144,7 @@ _OVER:
   return code;
 }
 
-int32_t vmWriteVnodeListToFile(SVnodeMgmt *pMgmt) {
+static int32_t vmWriteVnodeListToFileImp(SVnodeMgmt *pMgmt) {
   int32_t code = 0;
   char    file[PATH_MAX] = {0};
   char    realfile[PATH_MAX] = {0};
@@ -215,4 +215,12 @@ _OVER:
 
   dDebug("successed to write %s, numOfVnodes:%d", realfile, numOfVnodes);
   return taosRenameFile(file, realfile);
+}
+
+int32_t vmWriteVnodeListToFile(SVnodeMgmt *pMgmt) {
+  // the vnode-mgmt and vnode-split workers may both rewrite vnodes.json
+  taosThreadMutexLock(&pMgmt->fileLock);
+  int32_t code = vmWriteVnodeListToFileImp(pMgmt);
+  taosThreadMutexUnlock(&pMgmt->fileLock);
+  return code;
 }
\ No newline at end of file
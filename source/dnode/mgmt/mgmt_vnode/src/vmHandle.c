@@ -343,6 +343,107 @@ int32_t vmProcessDropVnodeReq(SVnodeMgmt *pMgmt, SRpcMsg *pMsg) {
   return 0;
 }
 
+int32_t vmProcessAlterHashRangeReq(SVnodeMgmt *pMgmt, SRpcMsg *pMsg) {
+  SAlterVnodeHashRangeReq req = {0};
+  SWrapperCfg             wrapperCfg = {0};
+  SVnode                 *pImpl = NULL;
+  int32_t                 code = -1;
+  char                    path[TSDB_FILENAME_LEN] = {0};
+
+  if (tDeserializeSAlterVnodeHashRangeReq((char *)pMsg->pCont + sizeof(SMsgHead), pMsg->contLen - sizeof(SMsgHead),
+                                          &req) != 0) {
+    terrno = TSDB_CODE_INVALID_MSG;
+    return -1;
+  }
+
+  dInfo("vgId:%d, start to split vnode into vgId:%d, src hash begin:%u end:%u, dst hash begin:%u end:%u", req.srcVgId,
+        req.dstVgId, req.srcHashBegin, req.srcHashEnd, req.dstHashBegin, req.dstHashEnd);
+
+  SVnodeObj *pDst = vmAcquireVnode(pMgmt, req.dstVgId);
+  if (pDst != NULL) {
+    dInfo("vgId:%d, already split into vgId:%d", req.srcVgId, req.dstVgId);
+    vmReleaseVnode(pMgmt, pDst);
+    return 0;
+  }
+
+  SVnodeObj *pSrc = vmAcquireVnode(pMgmt, req.srcVgId);
+  if (pSrc == NULL) {
+    dError("vgId:%d, failed to split since %s", req.srcVgId, terrstr());
+    terrno = TSDB_CODE_NODE_NOT_DEPLOYED;
+    return -1;
+  }
+
+  snprintf(path, TSDB_FILENAME_LEN, "vnode%svnode%d", TD_DIRSEP, req.dstVgId);
+
+  // a cut over split only needs the new vnode to be registered again
+  if (!vnodeSplitIsDone(pSrc->pImpl, &req)) {
+    vnodeDestroy(path, pMgmt->pTfs);
+
+    if (vnodeSplitCreate(pSrc->pImpl, path, pMgmt->pTfs, &req) < 0) {
+      dError("vgId:%d, failed to create vnode since %s", req.dstVgId, terrstr());
+      code = terrno;
+      goto _OVER;
+    }
+
+    pImpl = vnodeOpen(path, pMgmt->pTfs, pMgmt->msgCb);
+    if (pImpl == NULL) {
+      dError("vgId:%d, failed to open vnode since %s", req.dstVgId, terrstr());
+      code = terrno;
+      vnodeDestroy(path, pMgmt->pTfs);
+      goto _OVER;
+    }
+
+    code = vnodeSplit(pSrc->pImpl, pImpl, pMsg);
+    vnodeClose(pImpl);
+    pImpl = NULL;
+    if (code != 0) {
+      dError("vgId:%d, failed to split into vgId:%d since %s", req.srcVgId, req.dstVgId, terrstr());
+      code = terrno;
+      vnodeDestroy(path, pMgmt->pTfs);
+      goto _OVER;
+    }
+  }
+
+  pImpl = vnodeOpen(path, pMgmt->pTfs, pMgmt->msgCb);
+  if (pImpl == NULL) {
+    dError("vgId:%d, failed to open vnode since %s", req.dstVgId, terrstr());
+    code = terrno;
+    goto _OVER;
+  }
+
+  wrapperCfg.vgId = req.dstVgId;
+  wrapperCfg.vgVersion = req.dstVgVersion;
+  wrapperCfg.dropped = 0;
+  snprintf(wrapperCfg.path, sizeof(wrapperCfg.path), "%s%svnode%d", pMgmt->path, TD_DIRSEP, req.dstVgId);
+
+  code = vmOpenVnode(pMgmt, &wrapperCfg, pImpl);
+  if (code != 0) {
+    dError("vgId:%d, failed to open vnode since %s", req.dstVgId, terrstr());
+    code = terrno;
+    vnodeClose(pImpl);
+    goto _OVER;
+  }
+
+  code = vnodeStart(pImpl);
+  if (code != 0) {
+    dError("vgId:%d, failed to start sync since %s", req.dstVgId, terrstr());
+    goto _OVER;
+  }
+
+  code = vmWriteVnodeListToFile(pMgmt);
+  if (code != 0) {
+    code = terrno;
+    goto _OVER;
+  }
+
+  dInfo("vgId:%d, vnode is split into vgId:%d", req.srcVgId, req.dstVgId);
+
+_OVER:
+  vmReleaseVnode(pMgmt, pSrc);
+  terrno = code;
+  return code;
+}
+
 SArray *vmGetMsgHandles() {
   int32_t code = -1;
   SArray *pArray = taosArrayInit(32, sizeof(SMgmtHandle));
@@ -402,11 +503,11 @@ SArray *vmGetMsgHandles() {
   if (dmSetMgmtHandle(pArray, TDMT_VND_ALTER_REPLICA, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_VND_ALTER_CONFIG, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_VND_ALTER_CONFIRM, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
-  if (dmSetMgmtHandle(pArray, TDMT_VND_ALTER_HASHRANGE, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_VND_COMPACT, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_VND_TRIM, vmPutMsgToWriteQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_DND_CREATE_VNODE, vmPutMsgToMgmtQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_DND_DROP_VNODE, vmPutMsgToMgmtQueue, 0) == NULL) goto _OVER;
+  if (dmSetMgmtHandle(pArray, TDMT_VND_ALTER_HASHRANGE, vmPutMsgToSplitQueue, 0) == NULL) goto _OVER;
 
   if (dmSetMgmtHandle(pArray, TDMT_SYNC_TIMEOUT, vmPutMsgToSyncQueue, 0) == NULL) goto _OVER;
   if (dmSetMgmtHandle(pArray, TDMT_SYNC_PING, vmPutMsgToSyncQueue, 0) == NULL) goto _OVER;
@@ -265,6 +265,16 @@ static bool rpcRfp(int32_t code, tmsg_t msgType) {
   }
 }
 
+static int8_t rpcCcfp(tmsg_t msgType) {
+  if (msgType == TDMT_SYNC_SNAPSHOT_SEND && tsRpcDeflateCompress) {
+    return RPC_COMP_DEFLATE;
+  }
+  if (msgType == TDMT_SCH_FETCH_RSP || msgType == TDMT_SCH_MERGE_FETCH_RSP || msgType == TDMT_VND_SUBMIT) {
+    return RPC_COMP_LZ4_FAST;
+  }
+  return RPC_COMP_LZ4;
+}
+
 int32_t dmInitClient(SDnode *pDnode) {
   SDnodeTrans *pTrans = &pDnode->trans;
 
@@ -277,6 +287,7 @@ int32_t dmInitClient(SDnode *pDnode) {
   rpcInit.idleTime = tsShellActivityTimer * 1000;
   rpcInit.parent = pDnode;
   rpcInit.rfp = rpcRfp;
+  rpcInit.ccfp = rpcCcfp;
   rpcInit.compressSize = tsCompressMsgSize;
 
   pTrans->clientRpc = rpcOpen(&rpcInit);
@@ -311,6 +322,7 @@ int32_t dmInitServer(SDnode *pDnode) {
   rpcInit.connType = TAOS_CONN_SERVER;
   rpcInit.idleTime = tsShellActivityTimer * 1000;
   rpcInit.parent = pDnode;
+  rpcInit.ccfp = rpcCcfp;
 
   pTrans->serverRpc = rpcOpen(&rpcInit);
   if (pTrans->serverRpc == NULL) {
@@ -342,6 +342,12 @@ typedef struct {
   int64_t   totalStorage;
   int64_t   compStorage;
   int64_t   pointsWritten;
+  int64_t   numOfSelectReqs;
+  int64_t   queryElapsedTime;
+  int64_t   memtableUsage;
+  int64_t   loadTime;
+  double    writeRate;  // rows per second
+  double    queryRate;  // query time in us per second
   int8_t    compact;
   int8_t    isTsma;
   int8_t    replica;
@@ -27,6 +27,8 @@
 #define TSDB_DNODE_VER_NUMBER   1
 #define TSDB_DNODE_RESERVE_SIZE 64
 
+#define MND_VGROUP_LOAD_ALPHA 0.3
+
 static const char *offlineReason[] = {
     "",
     "status msg timeout",
@@ -316,6 +318,21 @@ static int32_t mndCheckClusterCfgPara(SMnode *pMnode, SDnodeObj *pDnode, const S
   return 0;
 }
 
+static void mndUpdateVgroupLoadRate(SVgObj *pVgroup, SVnodeLoad *pVload, int64_t curMs) {
+  int64_t interval = curMs - pVgroup->loadTime;
+  if (pVgroup->loadTime <= 0 || interval <= 0) return;
+
+  // counters restart from zero once the leader changes, skip that round
+  int64_t rows = pVload->pointsWritten - pVgroup->pointsWritten;
+  int64_t queryTime = pVload->queryElapsedTime - pVgroup->queryElapsedTime;
+  if (rows < 0 || queryTime < 0) return;
+
+  double writeRate = rows * 1000.0 / interval;
+  double queryRate = queryTime * 1000.0 / interval;
+  pVgroup->writeRate = pVgroup->writeRate * (1 - MND_VGROUP_LOAD_ALPHA) + writeRate * MND_VGROUP_LOAD_ALPHA;
+  pVgroup->queryRate = pVgroup->queryRate * (1 - MND_VGROUP_LOAD_ALPHA) + queryRate * MND_VGROUP_LOAD_ALPHA;
+}
+
 static int32_t mndProcessStatusReq(SRpcMsg *pReq) {
   SMnode    *pMnode = pReq->info.node;
   SStatusReq statusReq = {0};
@@ -345,18 +362,24 @@ static int32_t mndProcessStatusReq(SRpcMsg *pReq) {
     }
   }
 
+  int64_t curMs = taosGetTimestampMs();
   for (int32_t v = 0; v < taosArrayGetSize(statusReq.pVloads); ++v) {
     SVnodeLoad *pVload = taosArrayGet(statusReq.pVloads, v);
 
     SVgObj *pVgroup = mndAcquireVgroup(pMnode, pVload->vgId);
     if (pVgroup != NULL) {
       if (pVload->syncState == TAOS_SYNC_STATE_LEADER) {
+        mndUpdateVgroupLoadRate(pVgroup, pVload, curMs);
         pVgroup->cacheUsage = pVload->cacheUsage;
         pVgroup->numOfTables = pVload->numOfTables;
         pVgroup->numOfTimeSeries = pVload->numOfTimeSeries;
         pVgroup->totalStorage = pVload->totalStorage;
         pVgroup->compStorage = pVload->compStorage;
         pVgroup->pointsWritten = pVload->pointsWritten;
+        pVgroup->numOfSelectReqs = pVload->numOfSelectReqs;
+        pVgroup->queryElapsedTime = pVload->queryElapsedTime;
+        pVgroup->memtableUsage = pVload->memtableUsage;
+        pVgroup->loadTime = curMs;
       }
       bool roleChanged = false;
       for (int32_t vg = 0; vg < pVgroup->replica; ++vg) {
@@ -394,7 +417,6 @@ static int32_t mndProcessStatusReq(SRpcMsg *pReq) {
   }
 
   int64_t dnodeVer = sdbGetTableVer(pMnode->pSdb, SDB_DNODE) + sdbGetTableVer(pMnode->pSdb, SDB_MNODE);
-  int64_t curMs = taosGetTimestampMs();
   bool    online = mndIsDnodeOnline(pDnode, curMs);
   bool    dnodeChanged = (statusReq.dnodeVer == 0) || (statusReq.dnodeVer != dnodeVer);
   bool    reboot = (pDnode->rebootTime != statusReq.rebootTime);
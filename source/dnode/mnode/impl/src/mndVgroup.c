@@ -26,6 +26,14 @@
 #define VGROUP_VER_NUMBER   1
 #define VGROUP_RESERVE_SIZE 64
 
+#define BALANCE_WEIGHT_VNODE  0.10
+#define BALANCE_WEIGHT_WRITE  0.35
+#define BALANCE_WEIGHT_QUERY  0.25
+#define BALANCE_WEIGHT_DISK   0.20
+#define BALANCE_WEIGHT_MEMORY 0.10
+#define BALANCE_MAX_MOVES     4
+#define BALANCE_MIN_GAIN      0.05
+
 static SSdbRow *mndVgroupActionDecode(SSdbRaw *pRaw);
 static int32_t  mndVgroupActionInsert(SSdb *pSdb, SVgObj *pVgroup);
 static int32_t  mndVgroupActionDelete(SSdb *pSdb, SVgObj *pVgroup);
@@ -60,7 +68,7 @@ int32_t mndInitVgroup(SMnode *pMnode) {
   mndSetMsgHandle(pMnode, TDMT_VND_COMPACT_RSP, mndTransProcessRsp);
 
   mndSetMsgHandle(pMnode, TDMT_MND_REDISTRIBUTE_VGROUP, mndProcessRedistributeVgroupMsg);
-  mndSetMsgHandle(pMnode, TDMT_MND_MERGE_VGROUP, mndProcessSplitVgroupMsg);
+  mndSetMsgHandle(pMnode, TDMT_MND_SPLIT_VGROUP, mndProcessSplitVgroupMsg);
   mndSetMsgHandle(pMnode, TDMT_MND_BALANCE_VGROUP, mndProcessBalanceVgroupMsg);
 
   mndAddShowRetrieveHandle(pMnode, TSDB_MGMT_TABLE_VGROUP, mndRetrieveVgroups);
@@ -1631,15 +1639,118 @@ int32_t mndBuildAlterVgroupAction(SMnode *pMnode, STrans *pTrans, SDbObj *pOldDb
   return 0;
 }
 
-static int32_t mndAddAdjustVnodeHashRangeAction(SMnode *pMnode, STrans *pTrans, SDbObj *pDb, SVgObj *pVgroup) {
+static int32_t mndAddAdjustVnodeHashRangeAction(SMnode *pMnode, STrans *pTrans, SDbObj *pDb, SVgObj *pSrcVgroup,
+                                                SVgObj *pDstVgroup) {
+  STransAction action = {0};
+
+  SDnodeObj *pDnode = mndAcquireDnode(pMnode, pSrcVgroup->vnodeGid[0].dnodeId);
+  if (pDnode == NULL) return -1;
+  action.epSet = mndGetDnodeEpset(pDnode);
+  mndReleaseDnode(pMnode, pDnode);
+
+  SAlterVnodeHashRangeReq req = {
+      .srcVgId = pSrcVgroup->vgId,
+      .dstVgId = pDstVgroup->vgId,
+      .dstVgVersion = pDstVgroup->version,
+      .srcHashBegin = pSrcVgroup->hashBegin,
+      .srcHashEnd = pSrcVgroup->hashEnd,
+      .dstHashBegin = pDstVgroup->hashBegin,
+      .dstHashEnd = pDstVgroup->hashEnd,
+  };
+
+  int32_t contLen = tSerializeSAlterVnodeHashRangeReq(NULL, 0, &req);
+  if (contLen < 0) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+  contLen += sizeof(SMsgHead);
+
+  SMsgHead *pHead = taosMemoryMalloc(contLen);
+  if (pHead == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  pHead->contLen = htonl(contLen);
+  pHead->vgId = htonl(pSrcVgroup->vgId);
+  tSerializeSAlterVnodeHashRangeReq((char *)pHead + sizeof(SMsgHead), contLen - sizeof(SMsgHead), &req);
+
+  action.pCont = pHead;
+  action.contLen = contLen;
+  action.msgType = TDMT_VND_ALTER_HASHRANGE;
+
+  if (mndTransAppendRedoAction(pTrans, &action) != 0) {
+    taosMemoryFree(pHead);
+    return -1;
+  }
+
+  return 0;
+}
+
+static int32_t mndAddRestoreVgroupReplicaAction(SMnode *pMnode, STrans *pTrans, SDbObj *pDb, SVgObj *pVgroup,
+                                                SArray *pArray) {
+  while (pVgroup->replica < pDb->cfg.replications) {
+    if (mndAddVnodeToVgroup(pMnode, pVgroup, pArray) != 0) return -1;
+    SVnodeGid *pVgid = &pVgroup->vnodeGid[pVgroup->replica - 1];
+    if (mndAddCreateVnodeAction(pMnode, pTrans, pDb, pVgroup, pVgid, true) != 0) return -1;
+    if (mndAddAlterVnodeAction(pMnode, pTrans, pDb, pVgroup, TDMT_VND_ALTER_REPLICA) != 0) return -1;
+    if (mndAddAlterVnodeConfirmAction(pMnode, pTrans, pDb, pVgroup) != 0) return -1;
+  }
+  return 0;
+}
+
+static int32_t mndSetSplitVgroupLogs(SMnode *pMnode, STrans *pTrans, SDbObj *pDb, SVgObj *pVg1, SVgObj *pVg2) {
+  SSdbRaw *pRaw = mndVgroupActionEncode(pVg2);
+  if (pRaw == NULL) return -1;
+  if (mndTransAppendRedolog(pTrans, pRaw) != 0) {
+    sdbFreeRaw(pRaw);
+    return -1;
+  }
+  (void)sdbSetRawStatus(pRaw, SDB_STATUS_CREATING);
+
+  pRaw = mndVgroupActionEncode(pVg1);
+  if (pRaw == NULL) return -1;
+  if (mndTransAppendCommitlog(pTrans, pRaw) != 0) {
+    sdbFreeRaw(pRaw);
+    return -1;
+  }
+  (void)sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+
+  pRaw = mndVgroupActionEncode(pVg2);
+  if (pRaw == NULL) return -1;
+  if (mndTransAppendCommitlog(pTrans, pRaw) != 0) {
+    sdbFreeRaw(pRaw);
+    return -1;
+  }
+  (void)sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+
+  SDbObj dbObj = {0};
+  memcpy(&dbObj, pDb, sizeof(SDbObj));
+  dbObj.cfg.numOfVgroups++;
+  dbObj.vgVersion++;
+  dbObj.updateTime = taosGetTimestampMs();
+
+  pRaw = mndDbActionEncode(&dbObj);
+  if (pRaw == NULL) return -1;
+  if (mndTransAppendCommitlog(pTrans, pRaw) != 0) {
+    sdbFreeRaw(pRaw);
+    return -1;
+  }
+  (void)sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+
   return 0;
 }
 
 static int32_t mndSplitVgroup(SMnode *pMnode, SRpcMsg *pReq, SDbObj *pDb, SVgObj *pVgroup) {
-  int32_t  code = -1;
-  SSdbRaw *pRaw = NULL;
-  STrans  *pTrans = NULL;
-  SArray  *pArray = mndBuildDnodesArray(pMnode, 0);
+  int32_t code = -1;
+  STrans *pTrans = NULL;
+  SArray *pArray = mndBuildDnodesArray(pMnode, 0);
+  if (pArray == NULL) goto _OVER;
+
+  if (pVgroup->hashEnd - pVgroup->hashBegin < 1) {
+    terrno = TSDB_CODE_MND_VGROUP_UN_CHANGED;
+    goto _OVER;
+  }
 
   pTrans = mndTransCreate(pMnode, TRN_POLICY_RETRY, TRN_CONFLICT_GLOBAL, pReq, "split-vgroup");
   if (pTrans == NULL) goto _OVER;
@@ -1654,68 +1765,85 @@ static int32_t mndSplitVgroup(SMnode *pMnode, SRpcMsg *pReq, SDbObj *pDb, SVgObj
     mInfo("vgId:%d, vnode:%d dnode:%d", newVg1.vgId, i, newVg1.vnodeGid[i].dnodeId);
   }
 
-  if (newVg1.replica == 1) {
-    if (mndAddVnodeToVgroup(pMnode, &newVg1, pArray) != 0) goto _OVER;
-    if (mndAddCreateVnodeAction(pMnode, pTrans, pDb, &newVg1, &newVg1.vnodeGid[1], true) != 0) goto _OVER;
-    if (mndAddAlterVnodeAction(pMnode, pTrans, pDb, &newVg1, TDMT_VND_ALTER_REPLICA) != 0) goto _OVER;
-    if (mndAddAlterVnodeConfirmAction(pMnode, pTrans, pDb, &newVg1) != 0) goto _OVER;
-  } else if (newVg1.replica == 3) {
-    SVnodeGid del1 = {0};
-    if (mndRemoveVnodeFromVgroup(pMnode, &newVg1, pArray, &del1) != 0) goto _OVER;
-    if (mndAddSetVnodeStandByAction(pMnode, pTrans, pDb, pVgroup, &del1, true) != 0) goto _OVER;
+  // the split is performed by a single vnode, so shrink the vgroup to one replica first
+  while (newVg1.replica > 1) {
+    SVnodeGid del = {0};
+    if (mndRemoveVnodeFromVgroup(pMnode, &newVg1, pArray, &del) != 0) goto _OVER;
+    if (mndAddSetVnodeStandByAction(pMnode, pTrans, pDb, pVgroup, &del, true) != 0) goto _OVER;
     if (mndAddAlterVnodeAction(pMnode, pTrans, pDb, &newVg1, TDMT_VND_ALTER_REPLICA) != 0) goto _OVER;
-    if (mndAddDropVnodeAction(pMnode, pTrans, pDb, &newVg1, &del1, true) != 0) goto _OVER;
+    if (mndAddDropVnodeAction(pMnode, pTrans, pDb, &newVg1, &del, true) != 0) goto _OVER;
     if (mndAddAlterVnodeConfirmAction(pMnode, pTrans, pDb, &newVg1) != 0) goto _OVER;
-  } else {
-    goto _OVER;
   }
 
   SVgObj newVg2 = {0};
-  memcpy(&newVg1, &newVg2, sizeof(SVgObj));
-  newVg1.replica = 1;
-  newVg1.hashEnd = (newVg1.hashBegin + newVg1.hashEnd) / 2;
-  memset(&newVg1.vnodeGid[1], 0, sizeof(SVnodeGid));
+  memcpy(&newVg2, &newVg1, sizeof(SVgObj));
+  newVg2.vgId = sdbGetMaxId(pMnode->pSdb, SDB_VGROUP);
+  newVg2.createdTime = taosGetTimestampMs();
+  newVg2.updateTime = newVg2.createdTime;
+  newVg2.version = 1;
+  newVg2.hashBegin = newVg1.hashBegin + (newVg1.hashEnd - newVg1.hashBegin) / 2 + 1;
+  newVg2.hashEnd = newVg1.hashEnd;
 
-  newVg2.replica = 1;
-  newVg2.hashBegin = newVg1.hashEnd + 1;
-  memcpy(&newVg2.vnodeGid[0], &newVg2.vnodeGid[1], sizeof(SVnodeGid));
-  memset(&newVg1.vnodeGid[1], 0, sizeof(SVnodeGid));
+  newVg1.hashEnd = newVg2.hashBegin - 1;
+  newVg1.updateTime = newVg2.createdTime;
+  newVg1.version++;
 
-  if (mndAddAlterVnodeAction(pMnode, pTrans, pDb, &newVg1, TDMT_VND_ALTER_HASHRANGE) != 0) goto _OVER;
-  if (mndAddAlterVnodeAction(pMnode, pTrans, pDb, &newVg2, TDMT_VND_ALTER_HASHRANGE) != 0) goto _OVER;
+  mInfo("vgId:%d, will be split into vgId:%d, hashBegin:%u hashEnd:%u and vgId:%d, hashBegin:%u hashEnd:%u",
+        pVgroup->vgId, newVg1.vgId, newVg1.hashBegin, newVg1.hashEnd, newVg2.vgId, newVg2.hashBegin, newVg2.hashEnd);
+
+  if (mndAddAdjustVnodeHashRangeAction(pMnode, pTrans, pDb, &newVg1, &newVg2) != 0) goto _OVER;
 
   // adjust vgroup
-  if (mndBuildAlterVgroupAction(pMnode, pTrans, pDb, pDb, &newVg1, pArray) != 0) goto _OVER;
-  if (mndBuildAlterVgroupAction(pMnode, pTrans, pDb, pDb, &newVg2, pArray) != 0) goto _OVER;
+  if (mndAddRestoreVgroupReplicaAction(pMnode, pTrans, pDb, &newVg1, pArray) != 0) goto _OVER;
+  if (mndAddRestoreVgroupReplicaAction(pMnode, pTrans, pDb, &newVg2, pArray) != 0) goto _OVER;
+
+  if (mndSetSplitVgroupLogs(pMnode, pTrans, pDb, &newVg1, &newVg2) != 0) goto _OVER;
+  if (mndTransPrepare(pMnode, pTrans) != 0) goto _OVER;
+
+  code = 0;
 
 _OVER:
+  taosArrayDestroy(pArray);
   mndTransDrop(pTrans);
-  sdbFreeRaw(pRaw);
   return code;
 }
 
 static int32_t mndProcessSplitVgroupMsg(SRpcMsg *pReq) {
-  SMnode *pMnode = pReq->info.node;
-  int32_t code = -1;
-  int32_t vgId = 2;
-  SVgObj *pVgroup = NULL;
-  SDbObj *pDb = NULL;
+  SMnode         *pMnode = pReq->info.node;
+  int32_t         code = -1;
+  SVgObj         *pVgroup = NULL;
+  SDbObj         *pDb = NULL;
+  SSplitVgroupReq req = {0};
+
+  if (tDeserializeSSplitVgroupReq(pReq->pCont, pReq->contLen, &req) != 0) {
+    terrno = TSDB_CODE_INVALID_MSG;
+    goto _OVER;
+  }
 
-  mInfo("vgId:%d, start to split", vgId);
+  mInfo("vgId:%d, start to split", req.vgId);
   if (mndCheckOperPrivilege(pMnode, pReq->info.conn.user, MND_OPER_SPLIT_VGROUP) != 0) {
     goto _OVER;
   }
 
-  pVgroup = mndAcquireVgroup(pMnode, vgId);
+  pVgroup = mndAcquireVgroup(pMnode, req.vgId);
   if (pVgroup == NULL) goto _OVER;
 
   pDb = mndAcquireDb(pMnode, pVgroup->dbName);
   if (pDb == NULL) goto _OVER;
 
+  if (pVgroup->isTsma || pDb->cfg.numOfRetensions > 0) {
+    terrno = TSDB_CODE_OPS_NOT_SUPPORT;
+    goto _OVER;
+  }
+
   code = mndSplitVgroup(pMnode, pReq, pDb, pVgroup);
   if (code == 0) code = TSDB_CODE_ACTION_IN_PROGRESS;
 
 _OVER:
+  if (code != 0 && code != TSDB_CODE_ACTION_IN_PROGRESS) {
+    mError("vgId:%d, failed to split since %s", req.vgId, terrstr());
+  }
+
   mndReleaseVgroup(pMnode, pVgroup);
   mndReleaseDb(pMnode, pDb);
   return code;
@@ -1758,117 +1886,252 @@ static int32_t mndSetBalanceVgroupInfoToTrans(SMnode *pMnode, STrans *pTrans, SD
   return 0;
 }
 
-static int32_t mndBalanceVgroupBetweenDnode(SMnode *pMnode, STrans *pTrans, SDnodeObj *pSrc, SDnodeObj *pDst,
-                                            SHashObj *pBalancedVgroups) {
-  void   *pIter = NULL;
-  int32_t code = -1;
+typedef struct {
+  int32_t   vgId;
+  int8_t    moved;
+  int8_t    replica;
+  SVnodeGid vnodeGid[TSDB_MAX_REPLICA];
+  double    write;
+  double    query;
+  double    disk;
+  double    memory;
+  double    cost;
+} SBalanceVgroupCost;
+
+static double mndNormBalanceLoad(double val, double max) { return max > 0 ? val / max : 0; }
+
+static SArray *mndBuildBalanceVgroupCosts(SMnode *pMnode) {
   SSdb   *pSdb = pMnode->pSdb;
+  void   *pIter = NULL;
+  double  maxWrite = 0, maxQuery = 0, maxDisk = 0, maxMemory = 0;
+  SArray *pCosts = taosArrayInit(16, sizeof(SBalanceVgroupCost));
+  if (pCosts == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
 
   while (1) {
     SVgObj *pVgroup = NULL;
     pIter = sdbFetch(pSdb, SDB_VGROUP, pIter, (void **)&pVgroup);
     if (pIter == NULL) break;
-    if (taosHashGet(pBalancedVgroups, &pVgroup->vgId, sizeof(int32_t)) != NULL) {
-      sdbRelease(pSdb, pVgroup);
-      continue;
+
+    SBalanceVgroupCost cost = {.vgId = pVgroup->vgId, .replica = pVgroup->replica};
+    memcpy(cost.vnodeGid, pVgroup->vnodeGid, sizeof(cost.vnodeGid));
+    cost.write = pVgroup->writeRate;
+    cost.query = pVgroup->queryRate;
+    cost.disk = (double)pVgroup->compStorage;
+    cost.memory = (double)(pVgroup->memtableUsage + pVgroup->cacheUsage);
+    sdbRelease(pSdb, pVgroup);
+
+    maxWrite = TMAX(maxWrite, cost.write);
+    maxQuery = TMAX(maxQuery, cost.query);
+    maxDisk = TMAX(maxDisk, cost.disk);
+    maxMemory = TMAX(maxMemory, cost.memory);
+    if (taosArrayPush(pCosts, &cost) == NULL) {
+      sdbCancelFetch(pSdb, pIter);
+      taosArrayDestroy(pCosts);
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return NULL;
     }
+  }
 
-    bool existInSrc = false;
-    bool existInDst = false;
-    for (int32_t i = 0; i < pVgroup->replica; ++i) {
-      SVnodeGid *pGid = &pVgroup->vnodeGid[i];
-      if (pGid->dnodeId == pSrc->id) existInSrc = true;
-      if (pGid->dnodeId == pDst->id) existInDst = true;
+  // each metric is normalized by the busiest vgroup, so an idle cluster degrades to balancing by vnode count
+  for (int32_t i = 0; i < taosArrayGetSize(pCosts); ++i) {
+    SBalanceVgroupCost *pCost = taosArrayGet(pCosts, i);
+    pCost->cost = BALANCE_WEIGHT_VNODE + BALANCE_WEIGHT_WRITE * mndNormBalanceLoad(pCost->write, maxWrite) +
+                  BALANCE_WEIGHT_QUERY * mndNormBalanceLoad(pCost->query, maxQuery) +
+                  BALANCE_WEIGHT_DISK * mndNormBalanceLoad(pCost->disk, maxDisk) +
+                  BALANCE_WEIGHT_MEMORY * mndNormBalanceLoad(pCost->memory, maxMemory);
+    mDebug("vgId:%d, balance cost:%f, write:%f query:%f disk:%f memory:%f", pCost->vgId, pCost->cost, pCost->write,
+           pCost->query, pCost->disk, pCost->memory);
+  }
+
+  return pCosts;
+}
+
+static int32_t mndGetBalanceDnodeIndex(SArray *pArray, int32_t dnodeId) {
+  for (int32_t i = 0; i < taosArrayGetSize(pArray); ++i) {
+    SDnodeObj *pDnode = taosArrayGet(pArray, i);
+    if (pDnode->id == dnodeId) return i;
+  }
+  return -1;
+}
+
+static bool mndBalanceVgroupInDnode(SBalanceVgroupCost *pCost, int32_t dnodeId) {
+  for (int32_t i = 0; i < pCost->replica; ++i) {
+    if (pCost->vnodeGid[i].dnodeId == dnodeId) return true;
+  }
+  return false;
+}
+
+static int32_t mndPlanBalanceVgroup(SArray *pArray, SArray *pCosts, int32_t maxMoves, SArray *pMoves) {
+  int32_t numOfDnodes = taosArrayGetSize(pArray);
+  double *loads = taosMemoryCalloc(numOfDnodes, sizeof(double));
+  if (loads == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  for (int32_t i = 0; i < taosArrayGetSize(pCosts); ++i) {
+    SBalanceVgroupCost *pCost = taosArrayGet(pCosts, i);
+    for (int32_t r = 0; r < pCost->replica; ++r) {
+      int32_t d = mndGetBalanceDnodeIndex(pArray, pCost->vnodeGid[r].dnodeId);
+      if (d >= 0) loads[d] += pCost->cost;
+    }
+  }
+
+  for (int32_t d = 0; d < numOfDnodes; ++d) {
+    SDnodeObj *pDnode = taosArrayGet(pArray, d);
+    loads[d] /= pDnode->numOfSupportVnodes;
+    mInfo("dnode:%d, vnodes:%d support:%d, load:%f", pDnode->id, pDnode->numOfVnodes, pDnode->numOfSupportVnodes,
+          loads[d]);
+  }
+
+  while (taosArrayGetSize(pMoves) < maxMoves) {
+    int32_t src = 0, dst = 0;
+    for (int32_t d = 1; d < numOfDnodes; ++d) {
+      if (loads[d] > loads[src]) src = d;
+      if (loads[d] < loads[dst]) dst = d;
     }
+    if (src == dst) break;
 
-    if (!existInSrc || existInDst) {
-      sdbRelease(pSdb, pVgroup);
-      continue;
+    SDnodeObj *pSrc = taosArrayGet(pArray, src);
+    SDnodeObj *pDst = taosArrayGet(pArray, dst);
+    if (pDst->numOfVnodes >= pDst->numOfSupportVnodes) break;
+
+    // pick the vgroup which makes the busier side of the pair as light as possible
+    SBalanceVgroupCost *pBest = NULL;
+    double              bestGain = 0;
+    for (int32_t i = 0; i < taosArrayGetSize(pCosts); ++i) {
+      SBalanceVgroupCost *pCost = taosArrayGet(pCosts, i);
+      if (pCost->moved || !mndBalanceVgroupInDnode(pCost, pSrc->id) || mndBalanceVgroupInDnode(pCost, pDst->id)) {
+        continue;
+      }
+
+      double srcLoad = loads[src] - pCost->cost / pSrc->numOfSupportVnodes;
+      double dstLoad = loads[dst] + pCost->cost / pDst->numOfSupportVnodes;
+      double gain = loads[src] - TMAX(srcLoad, dstLoad);
+      if (gain > bestGain) {
+        bestGain = gain;
+        pBest = pCost;
+      }
     }
 
-    SDbObj *pDb = mndAcquireDb(pMnode, pVgroup->dbName);
-    code = mndSetBalanceVgroupInfoToTrans(pMnode, pTrans, pDb, pVgroup, pSrc, pDst);
-    if (code == 0) {
-      code = taosHashPut(pBalancedVgroups, &pVgroup->vgId, sizeof(int32_t), &pVgroup->vgId, sizeof(int32_t));
+    // every move copies a whole vnode, so ignore the ones that hardly change anything
+    if (pBest == NULL || bestGain < loads[src] * BALANCE_MIN_GAIN) break;
+
+    SBalanceVgroupMove move = {.vgId = pBest->vgId, .srcId = pSrc->id, .dstId = pDst->id, .cost = pBest->cost};
+    if (taosArrayPush(pMoves, &move) == NULL) {
+      taosMemoryFree(loads);
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return -1;
     }
-    mndReleaseDb(pMnode, pDb);
-    sdbRelease(pSdb, pVgroup);
-    sdbCancelFetch(pSdb, pIter);
-    break;
+
+    loads[src] -= pBest->cost / pSrc->numOfSupportVnodes;
+    loads[dst] += pBest->cost / pDst->numOfSupportVnodes;
+    pSrc->numOfVnodes--;
+    pDst->numOfVnodes++;
+    pBest->moved = 1;
   }
 
+  taosMemoryFree(loads);
+  return 0;
+}
+
+static int32_t mndBalanceVgroupBetweenDnode(SMnode *pMnode, STrans *pTrans, SDnodeObj *pSrc, SDnodeObj *pDst,
+                                            int32_t vgId) {
+  int32_t code = -1;
+  SVgObj *pVgroup = mndAcquireVgroup(pMnode, vgId);
+  if (pVgroup == NULL) return -1;
+
+  SDbObj *pDb = mndAcquireDb(pMnode, pVgroup->dbName);
+  if (pDb != NULL) {
+    code = mndSetBalanceVgroupInfoToTrans(pMnode, pTrans, pDb, pVgroup, pSrc, pDst);
+  }
+
+  mndReleaseDb(pMnode, pDb);
+  mndReleaseVgroup(pMnode, pVgroup);
   return code;
 }
 
-static int32_t mndBalanceVgroup(SMnode *pMnode, SRpcMsg *pReq, SArray *pArray) {
-  int32_t   code = -1;
-  int32_t   numOfVgroups = 0;
-  STrans   *pTrans = NULL;
-  SHashObj *pBalancedVgroups = NULL;
+static int32_t mndSetBalanceVgroupRsp(SRpcMsg *pReq, SArray *pMoves) {
+  SBalanceVgroupRsp rsp = {.pMoves = pMoves};
+  int32_t           rspLen = tSerializeSBalanceVgroupRsp(NULL, 0, &rsp);
+  void             *pRsp = rpcMallocCont(rspLen);
+  if (pRsp == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
 
-  pBalancedVgroups = taosHashInit(16, taosGetDefaultHashFunction(TSDB_DATA_TYPE_INT), false, HASH_NO_LOCK);
-  if (pBalancedVgroups == NULL) goto _OVER;
+  tSerializeSBalanceVgroupRsp(pRsp, rspLen, &rsp);
+  pReq->info.rspLen = rspLen;
+  pReq->info.rsp = pRsp;
+  return 0;
+}
 
-  pTrans = mndTransCreate(pMnode, TRN_POLICY_RETRY, TRN_CONFLICT_GLOBAL, pReq, "balance-vgroup");
-  if (pTrans == NULL) goto _OVER;
-  mndTransSetSerial(pTrans);
-  mInfo("trans:%d, used to balance vgroup", pTrans->id);
+static int32_t mndBalanceVgroup(SMnode *pMnode, SRpcMsg *pReq, SArray *pArray, SBalanceVgroupReq *pBalance) {
+  int32_t code = -1;
+  STrans *pTrans = NULL;
+  SArray *pCosts = NULL;
+  SArray *pMoves = NULL;
+  int32_t maxMoves = pBalance->maxMoves > 0 ? pBalance->maxMoves : BALANCE_MAX_MOVES;
 
-  while (1) {
-    taosArraySort(pArray, (__compar_fn_t)mndCompareDnodeVnodes);
-    for (int32_t i = 0; i < taosArrayGetSize(pArray); ++i) {
-      SDnodeObj *pDnode = taosArrayGet(pArray, i);
-      mInfo("dnode:%d, equivalent vnodes:%d support:%d, score:%f", pDnode->id, pDnode->numOfVnodes,
-            pDnode->numOfSupportVnodes, (float)pDnode->numOfVnodes / pDnode->numOfSupportVnodes);
-    }
-
-    SDnodeObj *pSrc = taosArrayGet(pArray, taosArrayGetSize(pArray) - 1);
-    SDnodeObj *pDst = taosArrayGet(pArray, 0);
-
-    float srcScore = (float)(pSrc->numOfVnodes - 1) / pSrc->numOfSupportVnodes;
-    float dstScore = (float)(pDst->numOfVnodes + 1) / pDst->numOfSupportVnodes;
-    mInfo("trans:%d, after balance, src dnode:%d score:%f, dst dnode:%d score:%f", pTrans->id, pSrc->id, srcScore,
-          pDst->id, dstScore);
-
-    if (srcScore > dstScore - 0.000001) {
-      code = mndBalanceVgroupBetweenDnode(pMnode, pTrans, pSrc, pDst, pBalancedVgroups);
-      if (code == 0) {
-        pSrc->numOfVnodes--;
-        pDst->numOfVnodes++;
-        numOfVgroups++;
-        continue;
-      } else {
-        mInfo("trans:%d, no vgroup need to balance from dnode:%d to dnode:%d", pTrans->id, pSrc->id, pDst->id);
-        break;
-      }
-    } else {
-      mInfo("trans:%d, no vgroup need to balance any more", pTrans->id);
-      break;
-    }
+  pCosts = mndBuildBalanceVgroupCosts(pMnode);
+  if (pCosts == NULL) goto _OVER;
+
+  pMoves = taosArrayInit(maxMoves, sizeof(SBalanceVgroupMove));
+  if (pMoves == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    goto _OVER;
   }
 
-  if (numOfVgroups <= 0) {
+  if (mndPlanBalanceVgroup(pArray, pCosts, maxMoves, pMoves) != 0) goto _OVER;
+
+  int32_t numOfMoves = taosArrayGetSize(pMoves);
+  for (int32_t i = 0; i < numOfMoves; ++i) {
+    SBalanceVgroupMove *pMove = taosArrayGet(pMoves, i);
+    mInfo("balance plan %d/%d, vgId:%d will be moved from dnode:%d to dnode:%d, cost:%f%s", i + 1, numOfMoves,
+          pMove->vgId, pMove->srcId, pMove->dstId, pMove->cost, pBalance->dryRun ? ", dry run" : "");
+  }
+
+  if (pBalance->dryRun) {
+    code = mndSetBalanceVgroupRsp(pReq, pMoves);
+    goto _OVER;
+  }
+
+  if (numOfMoves <= 0) {
     mInfo("no need to balance vgroup");
     code = 0;
-  } else {
-    mInfo("start to balance vgroup, numOfVgroups:%d", numOfVgroups);
-    if (mndTransPrepare(pMnode, pTrans) != 0) goto _OVER;
-    code = TSDB_CODE_ACTION_IN_PROGRESS;
+    goto _OVER;
+  }
+
+  pTrans = mndTransCreate(pMnode, TRN_POLICY_RETRY, TRN_CONFLICT_GLOBAL, pReq, "balance-vgroup");
+  if (pTrans == NULL) goto _OVER;
+  mndTransSetSerial(pTrans);
+  mInfo("trans:%d, used to balance vgroup, numOfVgroups:%d", pTrans->id, numOfMoves);
+
+  for (int32_t i = 0; i < numOfMoves; ++i) {
+    SBalanceVgroupMove *pMove = taosArrayGet(pMoves, i);
+    SDnodeObj          *pSrc = taosArrayGet(pArray, mndGetBalanceDnodeIndex(pArray, pMove->srcId));
+    SDnodeObj          *pDst = taosArrayGet(pArray, mndGetBalanceDnodeIndex(pArray, pMove->dstId));
+    if (mndBalanceVgroupBetweenDnode(pMnode, pTrans, pSrc, pDst, pMove->vgId) != 0) goto _OVER;
   }
 
+  if (mndTransPrepare(pMnode, pTrans) != 0) goto _OVER;
+  code = TSDB_CODE_ACTION_IN_PROGRESS;
+
 _OVER:
+  taosArrayDestroy(pCosts);
+  taosArrayDestroy(pMoves);
   mndTransDrop(pTrans);
   return code;
 }
 
 static int32_t mndProcessBalanceVgroupMsg(SRpcMsg *pReq) {
-#if 1
-  return TSDB_CODE_OPS_NOT_SUPPORT;
-#else
   SMnode *pMnode = pReq->info.node;
   int32_t code = -1;
   SArray *pArray = NULL;
-  void *pIter = NULL;
+  void   *pIter = NULL;
   int64_t curMs = taosGetTimestampMs();
 
   SBalanceVgroupReq req = {0};
@@ -1877,7 +2140,7 @@ static int32_t mndProcessBalanceVgroupMsg(SRpcMsg *pReq) {
     goto _OVER;
   }
 
-  mInfo("start to balance vgroup");
+  mInfo("start to balance vgroup, dryRun:%d maxMoves:%d", req.dryRun, req.maxMoves);
   if (mndCheckOperPrivilege(pMnode, pReq->info.conn.user, MND_OPER_BALANCE_VGROUP) != 0) {
     goto _OVER;
   }
@@ -1887,6 +2150,7 @@ static int32_t mndProcessBalanceVgroupMsg(SRpcMsg *pReq) {
     pIter = sdbFetch(pMnode->pSdb, SDB_DNODE, pIter, (void **)&pDnode);
     if (pIter == NULL) break;
     if (!mndIsDnodeOnline(pDnode, curMs)) {
+      sdbCancelFetch(pMnode->pSdb, pIter);
       terrno = TSDB_CODE_MND_HAS_OFFLINE_DNODE;
       mError("failed to balance vgroup since %s, dnode:%d", terrstr(), pDnode->id);
       sdbRelease(pMnode->pSdb, pDnode);
@@ -1901,9 +2165,9 @@ static int32_t mndProcessBalanceVgroupMsg(SRpcMsg *pReq) {
 
   if (taosArrayGetSize(pArray) < 2) {
     mInfo("no need to balance vgroup since dnode num less than 2");
-    code = 0;
+    code = req.dryRun ? mndSetBalanceVgroupRsp(pReq, NULL) : 0;
   } else {
-    code = mndBalanceVgroup(pMnode, pReq, pArray);
+    code = mndBalanceVgroup(pMnode, pReq, pArray, &req);
   }
 
 _OVER:
@@ -1913,7 +2177,6 @@ _OVER:
 
   taosArrayDestroy(pArray);
   return code;
-#endif
 }
 
 bool mndVgroupInDb(SVgObj *pVgroup, int64_t dbUid) { return !pVgroup->isTsma && pVgroup->dbUid == dbUid; }
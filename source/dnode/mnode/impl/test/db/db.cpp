@@ -239,3 +239,38 @@ TEST_F(MndTestDb, 03_Create_Use_Restart_Use_Db) {
     EXPECT_EQ(dropdbRsp.uid, d2_uid);
   }
 }
+
+TEST_F(MndTestDb, 04_Balance_Vgroup) {
+  {
+    SBalanceVgroupReq balanceReq = {0};
+    balanceReq.dryRun = 1;
+    balanceReq.maxMoves = 2;
+
+    int32_t contLen = tSerializeSBalanceVgroupReq(NULL, 0, &balanceReq);
+    void*   pReq = rpcMallocCont(contLen);
+    tSerializeSBalanceVgroupReq(pReq, contLen, &balanceReq);
+
+    // a single dnode leaves nothing to move, the dry run still answers with an empty plan
+    SRpcMsg* pRsp = test.SendReq(TDMT_MND_BALANCE_VGROUP, pReq, contLen);
+    ASSERT_NE(pRsp, nullptr);
+    ASSERT_EQ(pRsp->code, 0);
+    ASSERT_GT(pRsp->contLen, 0);
+
+    SBalanceVgroupRsp balanceRsp = {0};
+    ASSERT_EQ(tDeserializeSBalanceVgroupRsp(pRsp->pCont, pRsp->contLen, &balanceRsp), 0);
+    EXPECT_EQ(taosArrayGetSize(balanceRsp.pMoves), 0);
+    tFreeSBalanceVgroupRsp(&balanceRsp);
+  }
+
+  {
+    SBalanceVgroupReq balanceReq = {0};
+
+    int32_t contLen = tSerializeSBalanceVgroupReq(NULL, 0, &balanceReq);
+    void*   pReq = rpcMallocCont(contLen);
+    tSerializeSBalanceVgroupReq(pReq, contLen, &balanceReq);
+
+    SRpcMsg* pRsp = test.SendReq(TDMT_MND_BALANCE_VGROUP, pReq, contLen);
+    ASSERT_NE(pRsp, nullptr);
+    ASSERT_EQ(pRsp->code, 0);
+  }
+}
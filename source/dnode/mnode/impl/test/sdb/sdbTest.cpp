@@ -934,4 +934,266 @@ TEST_F(MndTestSdb, 01_Read_Str) {
   sdbCleanup(pSdb);
   ASSERT_EQ(mnode.insertTimes, 9);
   ASSERT_EQ(mnode.deleteTimes, 9);
-}
\ No newline at end of file
+}
+TEST_F(MndTestSdb, 02_Write_Delta) {
+  SStrObj *pObj = NULL;
+  SMnode   mnode = {0};
+  SSdb    *pSdb = NULL;
+  SSdbOpt  opt = {0};
+  SStrObj  strObj = {0};
+  SSdbRaw *pRaw = NULL;
+  int64_t  index = 0, term = 0, config = 0;
+  char     deltafile[PATH_MAX] = {0};
+
+  opt.pMnode = &mnode;
+  opt.path = TD_TMP_DIR_PATH "mnode_test_sdb_delta";
+  snprintf(deltafile, sizeof(deltafile), "%s%sdata%ssdb.delta", opt.path, TD_DIRSEP, TD_DIRSEP);
+  taosRemoveDir(opt.path);
+
+  SSdbTable strTable1;
+  memset(&strTable1, 0, sizeof(SSdbTable));
+  strTable1.sdbType = SDB_USER;
+  strTable1.keyType = SDB_KEY_BINARY;
+  strTable1.deployFp = (SdbDeployFp)strDefault;
+  strTable1.encodeFp = (SdbEncodeFp)strEncode;
+  strTable1.decodeFp = (SdbDecodeFp)strDecode;
+  strTable1.insertFp = (SdbInsertFp)strInsert;
+  strTable1.updateFp = (SdbUpdateFp)strUpdate;
+  strTable1.deleteFp = (SdbDeleteFp)strDelete;
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbDeploy(pSdb), 0);
+
+  // the first write is a full image
+  sdbSetApplyInfo(pSdb, 1, 1, 1);
+  ASSERT_EQ(sdbWriteFile(pSdb, 0), 0);
+  ASSERT_FALSE(taosCheckExistFile(deltafile));
+
+  // update k1000, insert k3000, drop k2000, create and drop k4000
+  strSetDefault(&strObj, 1);
+  strObj.v32 = 1001;
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+
+  strSetDefault(&strObj, 3);
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+
+  strSetDefault(&strObj, 2);
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_DROPPED);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+
+  strSetDefault(&strObj, 4);
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_CREATING);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_DROPPED);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+
+  // later writes only append the changed rows
+  sdbSetApplyInfo(pSdb, 2, 1, 1);
+  ASSERT_EQ(sdbWriteFile(pSdb, 0), 0);
+  ASSERT_TRUE(taosCheckExistFile(deltafile));
+  sdbCleanup(pSdb);
+
+  // recover from the image and the delta
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbReadFile(pSdb), 0);
+
+  sdbGetCommitInfo(pSdb, &index, &term, &config);
+  ASSERT_EQ(index, 2);
+  ASSERT_EQ(sdbGetSize(pSdb, SDB_USER), 2);
+
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k1000");
+  ASSERT_NE(pObj, nullptr);
+  ASSERT_EQ(pObj->v32, 1001);
+  sdbRelease(pSdb, pObj);
+
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k3000");
+  ASSERT_NE(pObj, nullptr);
+  sdbRelease(pSdb, pObj);
+
+  ASSERT_EQ(sdbAcquire(pSdb, SDB_USER, "k2000"), nullptr);
+  ASSERT_EQ(sdbAcquire(pSdb, SDB_USER, "k4000"), nullptr);
+
+  // the delta is compacted into the image before it is shipped
+  {
+    SSdbIter *pReader = NULL;
+    SSdbIter *pWritter = NULL;
+    void     *pBuf = NULL;
+    int32_t   len = 0;
+
+    ASSERT_EQ(sdbStartRead(pSdb, &pReader, &index, NULL, NULL), 0);
+    ASSERT_EQ(index, 2);
+    ASSERT_FALSE(taosCheckExistFile(deltafile));
+    ASSERT_EQ(sdbStartWrite(pSdb, &pWritter), 0);
+    while (sdbDoRead(pSdb, pReader, &pBuf, &len) == 0) {
+      if (pBuf == NULL || len == 0) break;
+      sdbDoWrite(pSdb, pWritter, pBuf, len);
+      taosMemoryFree(pBuf);
+    }
+    sdbStopRead(pSdb, pReader);
+    ASSERT_EQ(sdbStopWrite(pSdb, pWritter, true, 2, 1, 1), 0);
+  }
+
+  ASSERT_FALSE(taosCheckExistFile(deltafile));
+  ASSERT_EQ(sdbGetSize(pSdb, SDB_USER), 2);
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k1000");
+  ASSERT_NE(pObj, nullptr);
+  ASSERT_EQ(pObj->v32, 1001);
+  sdbRelease(pSdb, pObj);
+
+  sdbCleanup(pSdb);
+}
+
+TEST_F(MndTestSdb, 03_Read_Delta) {
+  SStrObj *pObj = NULL;
+  SMnode   mnode = {0};
+  SSdb    *pSdb = NULL;
+  SSdbOpt  opt = {0};
+  SStrObj  strObj = {0};
+  SSdbRaw *pRaw = NULL;
+  int64_t  index = 0, term = 0, config = 0;
+  int64_t  seg1Len = 0, fileLen = 0;
+  char     deltafile[PATH_MAX] = {0};
+  char     buf[16384] = {0};
+
+  opt.pMnode = &mnode;
+  opt.path = TD_TMP_DIR_PATH "mnode_test_sdb_delta_read";
+  snprintf(deltafile, sizeof(deltafile), "%s%sdata%ssdb.delta", opt.path, TD_DIRSEP, TD_DIRSEP);
+  taosRemoveDir(opt.path);
+
+  SSdbTable strTable1;
+  memset(&strTable1, 0, sizeof(SSdbTable));
+  strTable1.sdbType = SDB_USER;
+  strTable1.keyType = SDB_KEY_BINARY;
+  strTable1.deployFp = (SdbDeployFp)strDefault;
+  strTable1.encodeFp = (SdbEncodeFp)strEncode;
+  strTable1.decodeFp = (SdbDecodeFp)strDecode;
+  strTable1.insertFp = (SdbInsertFp)strInsert;
+  strTable1.updateFp = (SdbUpdateFp)strUpdate;
+  strTable1.deleteFp = (SdbDeleteFp)strDelete;
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbDeploy(pSdb), 0);
+  sdbSetApplyInfo(pSdb, 1, 1, 1);
+  ASSERT_EQ(sdbWriteFile(pSdb, 0), 0);
+
+  // two segments: k3000 inserted at index 2, k1000 updated at index 3
+  strSetDefault(&strObj, 3);
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+  sdbSetApplyInfo(pSdb, 2, 1, 1);
+  ASSERT_EQ(sdbWriteFile(pSdb, 0), 0);
+  ASSERT_EQ(taosStatFile(deltafile, &seg1Len, NULL), 0);
+
+  strSetDefault(&strObj, 1);
+  strObj.v32 = 1001;
+  pRaw = strEncode(&strObj);
+  sdbSetRawStatus(pRaw, SDB_STATUS_READY);
+  ASSERT_EQ(sdbWrite(pSdb, pRaw), 0);
+  sdbSetApplyInfo(pSdb, 3, 1, 1);
+  ASSERT_EQ(sdbWriteFile(pSdb, 0), 0);
+  ASSERT_EQ(taosStatFile(deltafile, &fileLen, NULL), 0);
+  ASSERT_GT(fileLen, seg1Len);
+  ASSERT_LE(fileLen, (int64_t)sizeof(buf));
+  sdbCleanup(pSdb);
+
+  TdFilePtr pFile = taosOpenFile(deltafile, TD_FILE_READ);
+  ASSERT_NE(pFile, nullptr);
+  ASSERT_EQ(taosReadFile(pFile, buf, fileLen), fileLen);
+  taosCloseFile(&pFile);
+
+  // a checksum error in the first segment can not be a torn write, the open fails
+  buf[seg1Len - 1] ^= 0xFF;
+  pFile = taosOpenFile(deltafile, TD_FILE_WRITE | TD_FILE_TRUNC);
+  ASSERT_NE(pFile, nullptr);
+  ASSERT_EQ(taosWriteFile(pFile, buf, fileLen), fileLen);
+  taosCloseFile(&pFile);
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_NE(sdbReadFile(pSdb), 0);
+  ASSERT_EQ(taosStatFile(deltafile, &index, NULL), 0);
+  ASSERT_EQ(index, fileLen);
+  sdbCleanup(pSdb);
+
+  // a checksum error in the last segment is a torn write, the segment is dropped
+  buf[seg1Len - 1] ^= 0xFF;
+  buf[fileLen - 1] ^= 0xFF;
+  pFile = taosOpenFile(deltafile, TD_FILE_WRITE | TD_FILE_TRUNC);
+  ASSERT_NE(pFile, nullptr);
+  ASSERT_EQ(taosWriteFile(pFile, buf, fileLen), fileLen);
+  taosCloseFile(&pFile);
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbReadFile(pSdb), 0);
+  sdbGetCommitInfo(pSdb, &index, &term, &config);
+  ASSERT_EQ(index, 2);
+  ASSERT_EQ(taosStatFile(deltafile, &index, NULL), 0);
+  ASSERT_EQ(index, seg1Len);
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k3000");
+  ASSERT_NE(pObj, nullptr);
+  sdbRelease(pSdb, pObj);
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k1000");
+  ASSERT_NE(pObj, nullptr);
+  ASSERT_NE(pObj->v32, 1001);
+  sdbRelease(pSdb, pObj);
+  sdbCleanup(pSdb);
+
+  // the last segment cut short is dropped as well
+  buf[fileLen - 1] ^= 0xFF;
+  pFile = taosOpenFile(deltafile, TD_FILE_WRITE | TD_FILE_TRUNC);
+  ASSERT_NE(pFile, nullptr);
+  ASSERT_EQ(taosWriteFile(pFile, buf, fileLen - 10), fileLen - 10);
+  taosCloseFile(&pFile);
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbReadFile(pSdb), 0);
+  sdbGetCommitInfo(pSdb, &index, &term, &config);
+  ASSERT_EQ(index, 2);
+  ASSERT_EQ(taosStatFile(deltafile, &index, NULL), 0);
+  ASSERT_EQ(index, seg1Len);
+  sdbCleanup(pSdb);
+
+  // both segments intact
+  pFile = taosOpenFile(deltafile, TD_FILE_WRITE | TD_FILE_TRUNC);
+  ASSERT_NE(pFile, nullptr);
+  ASSERT_EQ(taosWriteFile(pFile, buf, fileLen), fileLen);
+  taosCloseFile(&pFile);
+
+  pSdb = sdbInit(&opt);
+  mnode.pSdb = pSdb;
+  ASSERT_NE(pSdb, nullptr);
+  ASSERT_EQ(sdbSetTable(pSdb, strTable1), 0);
+  ASSERT_EQ(sdbReadFile(pSdb), 0);
+  sdbGetCommitInfo(pSdb, &index, &term, &config);
+  ASSERT_EQ(index, 3);
+  pObj = (SStrObj *)sdbAcquire(pSdb, SDB_USER, "k1000");
+  ASSERT_NE(pObj, nullptr);
+  ASSERT_EQ(pObj->v32, 1001);
+  sdbRelease(pSdb, pObj);
+  sdbCleanup(pSdb);
+}
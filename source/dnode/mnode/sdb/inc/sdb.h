@@ -39,6 +39,9 @@ extern "C" {
 
 #define SDB_WRITE_DELTA 20
 
+// sdb.delta is compacted into a new sdb.data once it is larger than sdb.data and this size
+#define SDB_DELTA_COMPACT_SIZE (4 * 1024 * 1024)
+
 #define SDB_GET_VAL(pData, dataPos, val, pos, func, type) \
   {                                                       \
     if (func(pRaw, dataPos, val) != 0) {                  \
@@ -188,6 +191,10 @@ typedef struct SSdb {
   SdbDeployFp    deployFps[SDB_MAX];
   SdbEncodeFp    encodeFps[SDB_MAX];
   SdbDecodeFp    decodeFps[SDB_MAX];
+  SHashObj      *dirtyObjs[SDB_MAX];  // keys changed since the last write, with the raw of the dropped rows
+  int64_t        imageSize;           // size of sdb.data
+  int64_t        deltaSize;           // size of sdb.delta, the changes appended since sdb.data was written
+  bool           fullWrite;           // the next write rewrites sdb.data instead of appending to sdb.delta
   TdThreadMutex  filelock;
 } SSdb;
 
@@ -21,6 +21,18 @@
 #define SDB_TABLE_SIZE   24
 #define SDB_RESERVE_SIZE 512
 #define SDB_FILE_VER     1
+#define SDB_DELTA_TYPE   ((int8_t)0x7F)  // raw type of the mark starting a segment in sdb.delta
+
+// sdb.delta holds the rows changed since sdb.data was written, one segment per write. A segment is a mark raw with this
+// head followed by bodyLen bytes of row raws, and is applied as a whole or not at all.
+typedef struct {
+  int64_t index;
+  int64_t term;
+  int64_t config;
+  int64_t bodyLen;
+  int64_t maxId[SDB_TABLE_SIZE];
+  int64_t tableVer[SDB_TABLE_SIZE];
+} SSdbDeltaHead;
 
 static int32_t sdbDeployData(SSdb *pSdb) {
   mInfo("start to deploy sdb");
@@ -40,6 +52,15 @@ static int32_t sdbDeployData(SSdb *pSdb) {
   return 0;
 }
 
+static void sdbClearDirty(SSdb *pSdb) {
+  for (ESdbType i = 0; i < SDB_MAX; ++i) {
+    if (pSdb->dirtyObjs[i] == NULL) continue;
+    sdbWriteLock(pSdb, i);
+    taosHashClear(pSdb->dirtyObjs[i]);
+    sdbUnLock(pSdb, i);
+  }
+}
+
 static void sdbResetData(SSdb *pSdb) {
   mInfo("start to reset sdb");
 
@@ -73,6 +94,10 @@ static void sdbResetData(SSdb *pSdb) {
   pSdb->commitIndex = -1;
   pSdb->commitTerm = -1;
   pSdb->commitConfig = -1;
+  pSdb->imageSize = 0;
+  pSdb->deltaSize = 0;
+  pSdb->fullWrite = true;
+  sdbClearDirty(pSdb);
   mInfo("sdb reset success");
 }
 
@@ -221,11 +246,234 @@ static int32_t sdbWriteFileHead(SSdb *pSdb, TdFilePtr pFile) {
   return 0;
 }
 
+// read a raw and its checksum, returns the bytes read, 0 at the end of the file and -1 if the raw is not complete
+static int32_t sdbReadRaw(TdFilePtr pFile, const char *file, SSdbRaw *pRaw) {
+  int32_t readLen = sizeof(SSdbRaw);
+  int64_t ret = taosReadFile(pFile, pRaw, readLen);
+  if (ret == 0) return 0;
+
+  if (ret < 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    goto _err;
+  }
+
+  if (ret != readLen || pRaw->dataLen < 0 || pRaw->dataLen > TSDB_MAX_MSG_SIZE) {
+    terrno = TSDB_CODE_FILE_CORRUPTED;
+    goto _err;
+  }
+
+  readLen = pRaw->dataLen + sizeof(int32_t);
+  ret = taosReadFile(pFile, pRaw->pData, readLen);
+  if (ret < 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    goto _err;
+  }
+
+  if (ret != readLen) {
+    terrno = TSDB_CODE_FILE_CORRUPTED;
+    goto _err;
+  }
+
+  int32_t totalLen = sizeof(SSdbRaw) + pRaw->dataLen + sizeof(int32_t);
+  if ((!taosCheckChecksumWhole((const uint8_t *)pRaw, totalLen)) != 0) {
+    terrno = TSDB_CODE_CHECKSUM_ERROR;
+    goto _err;
+  }
+
+  return totalLen;
+
+_err:
+  mError("failed to read sdb file:%s since %s", file, terrstr());
+  return -1;
+}
+
+// load the raws of a delta segment, NULL if the segment is not complete or fails its checksums
+static char *sdbReadDeltaBody(TdFilePtr pFile, const char *file, int64_t bodyLen) {
+  if (bodyLen < 0 || bodyLen > INT32_MAX) {
+    terrno = TSDB_CODE_FILE_CORRUPTED;
+    mError("failed to read sdb file:%s since %s, segment len:%" PRId64, file, terrstr(), bodyLen);
+    return NULL;
+  }
+
+  char *pBody = taosMemoryMalloc(bodyLen + 1);
+  if (pBody == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    mError("failed to read sdb file:%s since %s", file, terrstr());
+    return NULL;
+  }
+
+  int64_t ret = taosReadFile(pFile, pBody, bodyLen);
+  if (ret != bodyLen) {
+    terrno = ret < 0 ? TAOS_SYSTEM_ERROR(errno) : TSDB_CODE_FILE_CORRUPTED;
+    goto _err;
+  }
+
+  for (int64_t pos = 0; pos < bodyLen;) {
+    SSdbRaw raw = {0};
+    if (pos + (int64_t)sizeof(SSdbRaw) > bodyLen) {
+      terrno = TSDB_CODE_FILE_CORRUPTED;
+      goto _err;
+    }
+
+    memcpy(&raw, pBody + pos, sizeof(SSdbRaw));
+    int64_t totalLen = sizeof(SSdbRaw) + (int64_t)raw.dataLen + sizeof(int32_t);
+    if (raw.dataLen < 0 || raw.dataLen > TSDB_MAX_MSG_SIZE || pos + totalLen > bodyLen) {
+      terrno = TSDB_CODE_FILE_CORRUPTED;
+      goto _err;
+    }
+
+    if ((!taosCheckChecksumWhole((const uint8_t *)pBody + pos, totalLen)) != 0) {
+      terrno = TSDB_CODE_CHECKSUM_ERROR;
+      goto _err;
+    }
+    pos += totalLen;
+  }
+
+  return pBody;
+
+_err:
+  mError("failed to read sdb file:%s since %s", file, terrstr());
+  taosMemoryFree(pBody);
+  return NULL;
+}
+
+static int32_t sdbApplyDelta(SSdb *pSdb, SSdbDeltaHead *pHead, const char *pBody, SSdbRaw *pRaw, int64_t *tableVer) {
+  for (int64_t pos = 0; pos < pHead->bodyLen;) {
+    memcpy(pRaw, pBody + pos, sizeof(SSdbRaw));
+    int32_t totalLen = sizeof(SSdbRaw) + pRaw->dataLen + sizeof(int32_t);
+    memcpy(pRaw, pBody + pos, totalLen);
+    pos += totalLen;
+
+    int32_t code = sdbWriteWithoutFree(pSdb, pRaw);
+    if (code == TSDB_CODE_SDB_OBJ_NOT_THERE && pRaw->status == SDB_STATUS_DROPPED) {
+      // the row was created and dropped between two writes
+      code = 0;
+    }
+    if (code != 0) {
+      terrno = code;
+      return -1;
+    }
+  }
+
+  pSdb->applyIndex = pHead->index;
+  pSdb->applyTerm = pHead->term;
+  pSdb->applyConfig = pHead->config;
+  for (int32_t i = 0; i < SDB_MAX; ++i) {
+    pSdb->maxId[i] = pHead->maxId[i];
+    tableVer[i] = pHead->tableVer[i];
+  }
+
+  return 0;
+}
+
+// replay the raws of sdb.data until the end of the file or the first raw not completely written
+static int32_t sdbReadDataRaws(SSdb *pSdb, TdFilePtr pFile, const char *file, SSdbRaw *pRaw) {
+  while (1) {
+    int32_t totalLen = sdbReadRaw(pFile, file, pRaw);
+    if (totalLen <= 0) break;
+
+    if (sdbWriteWithoutFree(pSdb, pRaw) != 0) {
+      mError("failed to read sdb file:%s since %s", file, terrstr());
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+// replay the segments of sdb.delta, pValidLen is moved past each segment read. Only the last segment may be broken,
+// by a crash while it was appended, and it is left out. A broken segment followed by others fails the read, as the
+// rows after it can not be replayed without it
+static int32_t sdbReadDeltaSegments(SSdb *pSdb, TdFilePtr pFile, const char *file, int64_t fileLen, SSdbRaw *pRaw,
+                                    int64_t *tableVer, int64_t *pValidLen) {
+  int64_t markLen = sizeof(SSdbRaw) + sizeof(SSdbDeltaHead) + sizeof(int32_t);
+
+  while (*pValidLen < fileLen) {
+    SSdbDeltaHead head = {0};
+    char         *pBody = NULL;
+    int64_t       segLen = markLen;
+
+    int32_t totalLen = sdbReadRaw(pFile, file, pRaw);
+    if (totalLen > 0 && (pRaw->type != SDB_DELTA_TYPE || pRaw->dataLen != sizeof(SSdbDeltaHead))) {
+      terrno = TSDB_CODE_FILE_CORRUPTED;
+      mError("failed to read sdb file:%s since %s, segment type:%d len:%d", file, terrstr(), pRaw->type,
+             pRaw->dataLen);
+    } else if (totalLen > 0) {
+      memcpy(&head, pRaw->pData, sizeof(SSdbDeltaHead));
+      segLen += head.bodyLen;
+      pBody = sdbReadDeltaBody(pFile, file, head.bodyLen);
+    }
+
+    if (pBody == NULL) {
+      if (*pValidLen + segLen < fileLen) {
+        if (totalLen == 0) terrno = TSDB_CODE_FILE_CORRUPTED;
+        mError("failed to read sdb file:%s since %s, broken segment at:%" PRId64 " len:%" PRId64 " file len:%" PRId64,
+               file, terrstr(), *pValidLen, segLen, fileLen);
+        return -1;
+      }
+      break;
+    }
+
+    // segments already contained in sdb.data are left by a crash between the write of sdb.data and the removal of
+    // sdb.delta
+    if (head.index <= pSdb->applyIndex) {
+      mInfo("skip sdb segment in file:%s, index:%" PRId64 " not after apply index:%" PRId64, file, head.index,
+            pSdb->applyIndex);
+    } else if (sdbApplyDelta(pSdb, &head, pBody, pRaw, tableVer) != 0) {
+      mError("failed to read sdb file:%s since %s", file, terrstr());
+      taosMemoryFree(pBody);
+      return -1;
+    }
+
+    taosMemoryFree(pBody);
+    *pValidLen += segLen;
+  }
+
+  return 0;
+}
+
+static int32_t sdbReadDeltaFile(SSdb *pSdb, SSdbRaw *pRaw, int64_t *tableVer) {
+  char file[PATH_MAX] = {0};
+  snprintf(file, sizeof(file), "%s%ssdb.delta", pSdb->currDir, TD_DIRSEP);
+
+  TdFilePtr pFile = taosOpenFile(file, TD_FILE_READ | TD_FILE_WRITE);
+  if (pFile == NULL) {
+    mDebug("no sdb delta file:%s", file);
+    return 0;
+  }
+
+  mInfo("start to read sdb delta file:%s", file);
+
+  int64_t validLen = 0;
+  int64_t fileLen = 0;
+  if (taosFStatFile(pFile, &fileLen, NULL) != 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    mError("failed to stat sdb delta file:%s since %s", file, terrstr());
+    taosCloseFile(&pFile);
+    return -1;
+  }
+
+  if (sdbReadDeltaSegments(pSdb, pFile, file, fileLen, pRaw, tableVer, &validLen) != 0) {
+    taosCloseFile(&pFile);
+    return -1;
+  }
+
+  if (fileLen > validLen) {
+    // drop the segment broken by a crash, otherwise the next segments appended are not reachable
+    mWarn("truncate sdb delta file:%s from %" PRId64 " to %" PRId64, file, fileLen, validLen);
+    if (taosFtruncateFile(pFile, validLen) != 0) {
+      mError("failed to truncate sdb delta file:%s since %s", file, tstrerror(TAOS_SYSTEM_ERROR(errno)));
+      pSdb->fullWrite = true;
+    }
+  }
+
+  pSdb->deltaSize = validLen;
+  taosCloseFile(&pFile);
+  return 0;
+}
+
 static int32_t sdbReadFileImp(SSdb *pSdb) {
-  int64_t offset = 0;
   int32_t code = 0;
-  int32_t readLen = 0;
-  int64_t ret = 0;
   char    file[PATH_MAX] = {0};
 
   snprintf(file, sizeof(file), "%s%ssdb.data", pSdb->currDir, TD_DIRSEP);
@@ -243,6 +491,7 @@ static int32_t sdbReadFileImp(SSdb *pSdb) {
     taosMemoryFree(pRaw);
     terrno = TAOS_SYSTEM_ERROR(errno);
     mDebug("failed to read sdb file:%s since %s", file, terrstr());
+    pSdb->fullWrite = true;
     return 0;
   }
 
@@ -256,49 +505,18 @@ static int32_t sdbReadFileImp(SSdb *pSdb) {
   int64_t tableVer[SDB_MAX] = {0};
   memcpy(tableVer, pSdb->tableVer, sizeof(tableVer));
 
-  while (1) {
-    readLen = sizeof(SSdbRaw);
-    ret = taosReadFile(pFile, pRaw, readLen);
-    if (ret == 0) break;
-
-    if (ret < 0) {
-      code = TAOS_SYSTEM_ERROR(errno);
-      mError("failed to read sdb file:%s since %s", file, tstrerror(code));
-      break;
-    }
-
-    if (ret != readLen) {
-      code = TSDB_CODE_FILE_CORRUPTED;
-      mError("failed to read sdb file:%s since %s", file, tstrerror(code));
-      break;
-    }
-
-    readLen = pRaw->dataLen + sizeof(int32_t);
-    ret = taosReadFile(pFile, pRaw->pData, readLen);
-    if (ret < 0) {
-      code = TAOS_SYSTEM_ERROR(errno);
-      mError("failed to read sdb file:%s since %s", file, tstrerror(code));
-      break;
-    }
-
-    if (ret != readLen) {
-      code = TSDB_CODE_FILE_CORRUPTED;
-      mError("failed to read sdb file:%s since %s", file, tstrerror(code));
-      break;
-    }
-
-    int32_t totalLen = sizeof(SSdbRaw) + pRaw->dataLen + sizeof(int32_t);
-    if ((!taosCheckChecksumWhole((const uint8_t *)pRaw, totalLen)) != 0) {
-      code = TSDB_CODE_CHECKSUM_ERROR;
-      mError("failed to read sdb file:%s since %s", file, tstrerror(code));
-      break;
-    }
+  pSdb->fullWrite = false;
+  code = sdbReadDataRaws(pSdb, pFile, file, pRaw);
+  if (code != 0) {
+    code = terrno;
+    goto _OVER;
+  }
+  taosFStatFile(pFile, &pSdb->imageSize, NULL);
 
-    code = sdbWriteWithoutFree(pSdb, pRaw);
-    if (code != 0) {
-      mError("failed to read sdb file:%s since %s", file, terrstr());
-      goto _OVER;
-    }
+  code = sdbReadDeltaFile(pSdb, pRaw, tableVer);
+  if (code != 0) {
+    code = terrno;
+    goto _OVER;
   }
 
   code = 0;
@@ -306,8 +524,8 @@ static int32_t sdbReadFileImp(SSdb *pSdb) {
   pSdb->commitTerm = pSdb->applyTerm;
   pSdb->commitConfig = pSdb->applyConfig;
   memcpy(pSdb->tableVer, tableVer, sizeof(tableVer));
-  mInfo("read sdb file:%s success, commit index:%" PRId64 " term:%" PRId64 " config:%" PRId64, file, pSdb->commitIndex,
-        pSdb->commitTerm, pSdb->commitConfig);
+  mInfo("read sdb file:%s success, commit index:%" PRId64 " term:%" PRId64 " config:%" PRId64 ", delta size:%" PRId64,
+        file, pSdb->commitIndex, pSdb->commitTerm, pSdb->commitConfig, pSdb->deltaSize);
 
 _OVER:
   taosCloseFile(&pFile);
@@ -325,6 +543,9 @@ int32_t sdbReadFile(SSdb *pSdb) {
   if (code != 0) {
     mError("failed to read sdb file since %s", terrstr());
     sdbResetData(pSdb);
+  } else {
+    // the rows replayed are already on disk
+    sdbClearDirty(pSdb);
   }
 
   taosThreadMutexUnlock(&pSdb->filelock);
@@ -409,6 +630,9 @@ static int32_t sdbWriteFileImp(SSdb *pSdb) {
       sdbFreeRaw(pRaw);
       ppRow = taosHashIterate(hash, ppRow);
     }
+    if (code == 0 && pSdb->dirtyObjs[i] != NULL) {
+      taosHashClear(pSdb->dirtyObjs[i]);
+    }
     sdbUnLock(pSdb, i);
   }
 
@@ -430,6 +654,17 @@ static int32_t sdbWriteFileImp(SSdb *pSdb) {
     }
   }
 
+  if (code == 0) {
+    // segments left by a failed removal are skipped on read since their index is not after sdb.data
+    char deltafile[PATH_MAX] = {0};
+    snprintf(deltafile, sizeof(deltafile), "%s%ssdb.delta", pSdb->currDir, TD_DIRSEP);
+    (void)taosRemoveFile(deltafile);
+    pSdb->deltaSize = 0;
+    pSdb->imageSize = 0;
+    taosStatFile(curfile, &pSdb->imageSize, NULL);
+    pSdb->fullWrite = false;
+  }
+
   if (code != 0) {
     mError("failed to write sdb file:%s since %s", curfile, tstrerror(code));
   } else {
@@ -444,22 +679,160 @@ static int32_t sdbWriteFileImp(SSdb *pSdb) {
   return code;
 }
 
-int32_t sdbWriteFile(SSdb *pSdb, int32_t delta) {
+static int32_t sdbAppendDeltaRaw(char **ppBuf, int64_t *pCap, int64_t *pLen, SSdbRaw *pRaw) {
+  int64_t rawLen = sizeof(SSdbRaw) + pRaw->dataLen;
+  int64_t need = *pLen + rawLen + sizeof(int32_t);
+  if (need > *pCap) {
+    int64_t cap = TMAX(need, *pCap * 2);
+    char   *pBuf = taosMemoryRealloc(*ppBuf, cap);
+    if (pBuf == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+    *ppBuf = pBuf;
+    *pCap = cap;
+  }
+
+  memcpy(*ppBuf + *pLen, pRaw, rawLen);
+  int32_t cksum = taosCalcChecksum(0, (const uint8_t *)pRaw, rawLen);
+  memcpy(*ppBuf + *pLen + rawLen, &cksum, sizeof(int32_t));
+  *pLen = need;
+  return 0;
+}
+
+// append the rows changed since the last write to sdb.delta as one segment
+static int32_t sdbWriteDeltaImp(SSdb *pSdb) {
   int32_t code = 0;
-  if (pSdb->applyIndex == pSdb->commitIndex) {
-    return 0;
+  int32_t nRows = 0;
+  int32_t markLen = sizeof(SSdbRaw) + sizeof(SSdbDeltaHead) + sizeof(int32_t);
+  int64_t cap = markLen + 4096;
+  int64_t len = markLen;
+  char    file[PATH_MAX] = {0};
+  snprintf(file, sizeof(file), "%s%ssdb.delta", pSdb->currDir, TD_DIRSEP);
+
+  mInfo("start to write sdb delta, apply index:%" PRId64 " term:%" PRId64 " config:%" PRId64 ", commit index:%" PRId64
+        " term:%" PRId64 " config:%" PRId64 ", file:%s",
+        pSdb->applyIndex, pSdb->applyTerm, pSdb->applyConfig, pSdb->commitIndex, pSdb->commitTerm, pSdb->commitConfig,
+        file);
+
+  // taken before the rows are walked, like the head of sdb.data, so the segment never claims an index whose rows it
+  // lacks. Rows changed after this point may be written too, they are applied again by the WAL replay
+  SSdbDeltaHead head = {0};
+  head.index = pSdb->applyIndex;
+  head.term = pSdb->applyTerm;
+  head.config = pSdb->applyConfig;
+  for (int32_t i = 0; i < SDB_MAX; ++i) {
+    head.maxId[i] = pSdb->maxId[i];
+    head.tableVer[i] = pSdb->tableVer[i];
   }
 
-  if (pSdb->applyIndex - pSdb->commitIndex < delta) {
-    return 0;
+  char *pBuf = taosMemoryMalloc(cap);
+  if (pBuf == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _OVER;
   }
 
-  taosThreadMutexLock(&pSdb->filelock);
+  for (int32_t i = SDB_MAX - 1; i >= 0; --i) {
+    SdbEncodeFp encodeFp = pSdb->encodeFps[i];
+    SHashObj   *dirty = pSdb->dirtyObjs[i];
+    if (encodeFp == NULL || dirty == NULL) continue;
+
+    sdbWriteLock(pSdb, i);
+
+    SSdbRaw **ppDropRaw = taosHashIterate(dirty, NULL);
+    while (ppDropRaw != NULL) {
+      size_t    keyLen = 0;
+      void     *pKey = taosHashGetKey(ppDropRaw, &keyLen);
+      SSdbRow **ppRow = taosHashGet(pSdb->hashObjs[i], pKey, keyLen);
+
+      if (ppRow != NULL && *ppRow != NULL) {
+        // rows not written to sdb.data are dropped from it, as the row may have been there before
+        SSdbRow *pRow = *ppRow;
+        SSdbRaw *pRaw = (*encodeFp)(pRow->pObj);
+        if (pRaw != NULL) {
+          sdbPrintOper(pSdb, pRow, "write-delta");
+          bool write = (pRow->status == SDB_STATUS_READY || pRow->status == SDB_STATUS_DROPPING);
+          pRaw->status = write ? pRow->status : SDB_STATUS_DROPPED;
+          code = sdbAppendDeltaRaw(&pBuf, &cap, &len, pRaw);
+          sdbFreeRaw(pRaw);
+        } else {
+          code = TSDB_CODE_SDB_APP_ERROR;
+        }
+      } else if (*ppDropRaw != NULL) {
+        code = sdbAppendDeltaRaw(&pBuf, &cap, &len, *ppDropRaw);
+      }
+
+      if (code != 0) {
+        taosHashCancelIterate(dirty, ppDropRaw);
+        break;
+      }
+
+      nRows++;
+      ppDropRaw = taosHashIterate(dirty, ppDropRaw);
+    }
+
+    // a failed segment is not retried, the rows are rewritten by the full write that follows
+    taosHashClear(dirty);
+    sdbUnLock(pSdb, i);
+    if (code != 0) goto _OVER;
+  }
+
+  head.bodyLen = len - markLen;
+
+  SSdbRaw *pMark = (SSdbRaw *)pBuf;
+  memset(pMark, 0, sizeof(SSdbRaw));
+  pMark->type = SDB_DELTA_TYPE;
+  pMark->sver = SDB_FILE_VER;
+  pMark->dataLen = sizeof(SSdbDeltaHead);
+  memcpy(pMark->pData, &head, sizeof(SSdbDeltaHead));
+  int32_t cksum = taosCalcChecksum(0, (const uint8_t *)pMark, sizeof(SSdbRaw) + sizeof(SSdbDeltaHead));
+  memcpy(pBuf + markLen - sizeof(int32_t), &cksum, sizeof(int32_t));
+
+  TdFilePtr pFile = taosOpenFile(file, TD_FILE_CREATE | TD_FILE_WRITE | TD_FILE_APPEND);
+  if (pFile == NULL) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    goto _OVER;
+  }
+
+  if (taosWriteFile(pFile, pBuf, len) != len || taosFsyncFile(pFile) != 0) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    (void)taosFtruncateFile(pFile, pSdb->deltaSize);
+  }
+  taosCloseFile(&pFile);
+
+_OVER:
+  taosMemoryFree(pBuf);
+  if (code != 0) {
+    pSdb->fullWrite = true;
+    mError("failed to write sdb delta file:%s since %s", file, tstrerror(code));
+  } else {
+    pSdb->deltaSize += len;
+    pSdb->commitIndex = head.index;
+    pSdb->commitTerm = head.term;
+    pSdb->commitConfig = head.config;
+    mInfo("write sdb delta success, %d rows, commit index:%" PRId64 " term:%" PRId64 " config:%" PRId64
+          ", delta size:%" PRId64 " image size:%" PRId64,
+          nRows, pSdb->commitIndex, pSdb->commitTerm, pSdb->commitConfig, pSdb->deltaSize, pSdb->imageSize);
+  }
+
+  terrno = code;
+  return code;
+}
+
+static bool sdbNeedFullWrite(SSdb *pSdb) {
+  if (pSdb->fullWrite) return true;
+  return pSdb->deltaSize >= TMAX(pSdb->imageSize, SDB_DELTA_COMPACT_SIZE);
+}
+
+// called with the file lock held
+static int32_t sdbWriteFileLocked(SSdb *pSdb, bool full) {
+  int32_t code = 0;
   if (pSdb->pWal != NULL) {
     code = walBeginSnapshot(pSdb->pWal, pSdb->applyIndex);
   }
   if (code == 0) {
-    code = sdbWriteFileImp(pSdb);
+    if (full || sdbNeedFullWrite(pSdb)) {
+      code = sdbWriteFileImp(pSdb);
+    } else {
+      code = sdbWriteDeltaImp(pSdb);
+    }
   }
   if (code == 0) {
     if (pSdb->pWal != NULL) {
@@ -469,6 +842,21 @@ int32_t sdbWriteFile(SSdb *pSdb, int32_t delta) {
   if (code != 0) {
     mError("failed to write sdb file since %s", terrstr());
   }
+  return code;
+}
+
+int32_t sdbWriteFile(SSdb *pSdb, int32_t delta) {
+  int32_t code = 0;
+  if (pSdb->applyIndex == pSdb->commitIndex) {
+    return 0;
+  }
+
+  if (pSdb->applyIndex - pSdb->commitIndex < delta) {
+    return 0;
+  }
+
+  taosThreadMutexLock(&pSdb->filelock);
+  code = sdbWriteFileLocked(pSdb, false);
   taosThreadMutexUnlock(&pSdb->filelock);
   return code;
 }
@@ -530,6 +918,14 @@ int32_t sdbStartRead(SSdb *pSdb, SSdbIter **ppIter, int64_t *index, int64_t *ter
   snprintf(datafile, sizeof(datafile), "%s%ssdb.data", pSdb->currDir, TD_DIRSEP);
 
   taosThreadMutexLock(&pSdb->filelock);
+  // the snapshot is sdb.data alone, so the receiver needs no knowledge of sdb.delta. Fold the delta into it first
+  if (pSdb->deltaSize > 0 && sdbWriteFileLocked(pSdb, true) != 0) {
+    taosThreadMutexUnlock(&pSdb->filelock);
+    mError("failed to compact sdb file before snapshot since %s", terrstr());
+    sdbCloseIter(pIter);
+    return -1;
+  }
+
   int64_t commitIndex = pSdb->commitIndex;
   int64_t commitTerm = pSdb->commitTerm;
   int64_t commitConfig = pSdb->commitConfig;
@@ -635,6 +1031,11 @@ int32_t sdbStopWrite(SSdb *pSdb, SSdbIter *pIter, bool isApply, int64_t index, i
     return -1;
   }
 
+  // the local segments are older than the received sdb.data
+  char deltafile[PATH_MAX] = {0};
+  snprintf(deltafile, sizeof(deltafile), "%s%ssdb.delta", pSdb->currDir, TD_DIRSEP);
+  (void)taosRemoveFile(deltafile);
+
   if (sdbReadFile(pSdb) != 0) {
     mError("sdbiter:%p, failed to read from %s since %s", pIter, datafile, terrstr());
     sdbCloseIter(pIter);
@@ -130,6 +130,25 @@ static int32_t sdbGetkeySize(SSdb *pSdb, ESdbType type, const void *pKey) {
   return keySize;
 }
 
+static void sdbSetDirty(SSdb *pSdb, int32_t type, const void *pKey, int32_t keySize, SSdbRaw *pDropRaw) {
+  SHashObj *dirty = pSdb->dirtyObjs[type];
+  if (dirty == NULL) return;
+
+  // a dropped row is gone from the hash when the delta is written, so keep its raw
+  SSdbRaw *pRaw = NULL;
+  if (pDropRaw != NULL) {
+    int32_t size = sizeof(SSdbRaw) + pDropRaw->dataLen;
+    pRaw = taosMemoryMalloc(size);
+    if (pRaw != NULL) memcpy(pRaw, pDropRaw, size);
+  }
+
+  if ((pDropRaw != NULL && pRaw == NULL) || taosHashPut(dirty, pKey, keySize, &pRaw, sizeof(void *)) != 0) {
+    sdbFreeRaw(pRaw);
+    pSdb->fullWrite = true;
+    mWarn("failed to mark %s row dirty, the next write is a full one", sdbTableName(type));
+  }
+}
+
 static int32_t sdbInsertRow(SSdb *pSdb, SHashObj *hash, SSdbRaw *pRaw, SSdbRow *pRow, int32_t keySize) {
   int32_t type = pRow->type;
   sdbWriteLock(pSdb, type);
@@ -167,6 +186,7 @@ static int32_t sdbInsertRow(SSdb *pSdb, SHashObj *hash, SSdbRaw *pRaw, SSdbRow *
     }
   }
 
+  sdbSetDirty(pSdb, type, pRow->pObj, keySize, NULL);
   sdbUnLock(pSdb, type);
 
   if (pSdb->keyTypes[pRow->type] == SDB_KEY_INT32) {
@@ -193,6 +213,7 @@ static int32_t sdbUpdateRow(SSdb *pSdb, SHashObj *hash, SSdbRaw *pRaw, SSdbRow *
   SSdbRow *pOldRow = *ppOldRow;
   pOldRow->status = pRaw->status;
   sdbPrintOper(pSdb, pOldRow, "update");
+  sdbSetDirty(pSdb, type, pOldRow->pObj, keySize, NULL);
   sdbUnLock(pSdb, type);
 
   int32_t     code = 0;
@@ -224,6 +245,7 @@ static int32_t sdbDeleteRow(SSdb *pSdb, SHashObj *hash, SSdbRaw *pRaw, SSdbRow *
 
   atomic_add_fetch_32(&pOldRow->refCount, 1);
   sdbPrintOper(pSdb, pOldRow, "delete");
+  sdbSetDirty(pSdb, type, pOldRow->pObj, keySize, pRaw);
 
   taosHashRemove(hash, pOldRow->pObj, keySize);
   pSdb->tableVer[pOldRow->type]++;
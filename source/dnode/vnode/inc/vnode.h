@@ -87,6 +87,11 @@ int32_t vnodeProcessFetchMsg(SVnode *pVnode, SRpcMsg *pMsg, SQueueInfo *pInfo);
 void    vnodeProposeWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs);
 void    vnodeApplyWriteMsg(SQueueInfo *pInfo, STaosQall *qall, int32_t numOfMsgs);
 
+// vnodeSplit.c
+int32_t vnodeSplitCreate(SVnode *pVnode, const char *path, STfs *pTfs, SAlterVnodeHashRangeReq *pReq);
+bool    vnodeSplitIsDone(SVnode *pVnode, SAlterVnodeHashRangeReq *pReq);
+int32_t vnodeSplit(SVnode *pVnode, SVnode *pNew, SRpcMsg *pMsg);
+
 // meta
 typedef struct SMeta       SMeta;  // todo: remove
 typedef struct SMetaReader SMetaReader;
@@ -66,11 +66,16 @@ int32_t metaCacheOpen(SMeta* pMeta);
 void    metaCacheClose(SMeta* pMeta);
 int32_t metaCacheUpsert(SMeta* pMeta, SMetaInfo* pInfo);
 int32_t metaCacheDrop(SMeta* pMeta, int64_t uid);
+int32_t metaCacheGet(SMeta* pMeta, int64_t uid, SMetaInfo* pInfo);
 
 int32_t metaStatsCacheUpsert(SMeta* pMeta, SMetaStbStats* pInfo);
 int32_t metaStatsCacheDrop(SMeta* pMeta, int64_t uid);
 int32_t metaStatsCacheGet(SMeta* pMeta, int64_t uid, SMetaStbStats* pInfo);
 
+int32_t metaSchemaCacheGet(SMeta* pMeta, int64_t uid, int32_t sver, SSchemaWrapper** ppSW, STSchema** ppTSchema);
+int32_t metaSchemaCachePut(SMeta* pMeta, int64_t uid, const SSchemaWrapper* pSW);
+void    metaSchemaCacheDrop(SMeta* pMeta, int64_t uid, int32_t sver);
+
 struct SMeta {
   TdThreadRwlock lock;
 
@@ -148,6 +148,18 @@ static STqMgmt tqMgmt = {0};
 int32_t tEncodeSTqHandle(SEncoder* pEncoder, const STqHandle* pHandle);
 int32_t tDecodeSTqHandle(SDecoder* pDecoder, STqHandle* pHandle);
 
+// budget of one poll rsp, the wal is scanned on until one of them is used up
+#define TQ_POLL_BATCH_ROWS  4096
+#define TQ_POLL_BATCH_BYTES (1024 * 1024)
+#define TQ_POLL_BATCH_MS    10
+
+typedef struct {
+  int64_t startMs;
+  int32_t blockNum;  // blocks of the rsp already counted
+  int32_t rows;
+  int64_t bytes;
+} STqPollBatch;
+
 // tqRead
 int32_t tqScanTaosx(STQ* pTq, const STqHandle* pHandle, STaosxRsp* pRsp, SMqMetaRsp* pMetaRsp, STqOffsetVal* offset);
 int32_t tqScanData(STQ* pTq, const STqHandle* pHandle, SMqDataRsp* pRsp, STqOffsetVal* pOffset);
@@ -156,6 +168,8 @@ int64_t tqFetchLog(STQ* pTq, STqHandle* pHandle, int64_t* fetchOffset, SWalCkHea
 // tqExec
 int32_t tqTaosxScanLog(STQ* pTq, STqHandle* pHandle, SSubmitReq* pReq, STaosxRsp* pRsp);
 int32_t tqAddBlockDataToRsp(const SSDataBlock* pBlock, SMqDataRsp* pRsp, int32_t numOfCols);
+void    tqPollBatchInit(STqPollBatch* pBatch);
+bool    tqPollBatchFull(STqPollBatch* pBatch, const SMqDataRsp* pRsp);
 int32_t tqSendDataRsp(STQ* pTq, const SRpcMsg* pMsg, const SMqPollReq* pReq, const SMqDataRsp* pRsp);
 int32_t tqPushDataRsp(STQ* pTq, STqPushEntry* pPushEntry);
 
@@ -69,6 +69,7 @@ typedef struct SDiskCol         SDiskCol;
 typedef struct SDiskData        SDiskData;
 typedef struct SDiskDataBuilder SDiskDataBuilder;
 typedef struct SBlkInfo         SBlkInfo;
+typedef struct STsdbDelCache    STsdbDelCache;
 
 #define TSDB_FILE_DLMT     ((uint32_t)0xF00AFA0F)
 #define TSDB_MAX_SUBBLOCKS 8
@@ -165,7 +166,7 @@ int32_t   tBlockDataCopy(SBlockData *pBlockDataSrc, SBlockData *pBlockDataDest);
 int32_t   tBlockDataMerge(SBlockData *pBlockData1, SBlockData *pBlockData2, SBlockData *pBlockData);
 int32_t   tBlockDataAddColData(SBlockData *pBlockData, int32_t iColData, SColData **ppColData);
 int32_t   tCmprBlockData(SBlockData *pBlockData, int8_t cmprAlg, uint8_t **ppOut, int32_t *szOut, uint8_t *aBuf[],
-                         int32_t aBufN[]);
+                         int32_t aBufN[], SHashObj *pCodecHint);
 int32_t   tDecmprBlockData(uint8_t *pIn, int32_t szIn, SBlockData *pBlockData, uint8_t *aBuf[]);
 // SDiskDataHdr
 int32_t tPutDiskDataHdr(uint8_t *p, const SDiskDataHdr *pHdr);
@@ -193,6 +194,7 @@ int32_t tsdbKeyFid(TSKEY key, int32_t minutes, int8_t precision);
 void    tsdbFidKeyRange(int32_t fid, int32_t minutes, int8_t precision, TSKEY *minKey, TSKEY *maxKey);
 int32_t tsdbFidLevel(int32_t fid, STsdbKeepCfg *pKeepCfg, int64_t now);
 int32_t tsdbBuildDeleteSkyline(SArray *aDelData, int32_t sidx, int32_t eidx, SArray *aSkyline);
+int32_t tsdbMergeSkyline(SArray *aSkyline1, SArray *aSkyline2, SArray *aSkyline);
 void    tsdbCalcColDataSMA(SColData *pColData, SColumnDataAgg *pColAgg);
 int32_t tPutColumnDataAgg(uint8_t *p, SColumnDataAgg *pColAgg);
 int32_t tGetColumnDataAgg(uint8_t *p, SColumnDataAgg *pColAgg);
@@ -200,6 +202,10 @@ int32_t tsdbCmprData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t cmprAlg, ui
                      int32_t *szOut, uint8_t **ppBuf);
 int32_t tsdbDecmprData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t cmprAlg, uint8_t **ppOut, int32_t szOut,
                        uint8_t **ppBuf);
+int32_t tsdbCmprCodecData(uint8_t *pIn, int32_t szIn, int8_t type, uint8_t **ppOut, int32_t nOut, int32_t *szOut,
+                          int8_t *codec, uint8_t **ppBuf);
+int32_t tsdbDecmprCodecData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t codec, uint8_t **ppOut, int32_t szOut,
+                            uint8_t **ppBuf);
 int32_t tsdbCmprColData(SColData *pColData, int8_t cmprAlg, SBlockCol *pBlockCol, uint8_t **ppOut, int32_t nOut,
                         uint8_t **ppBuf);
 int32_t tsdbDecmprColData(uint8_t *pIn, SBlockCol *pBlockCol, int8_t cmprAlg, int32_t nVal, SColData *pColData,
@@ -265,6 +271,7 @@ int32_t tsdbWriteSttBlk(SDataFWriter *pWriter, SArray *aSttBlk);
 int32_t tsdbWriteBlockData(SDataFWriter *pWriter, SBlockData *pBlockData, SBlockInfo *pBlkInfo, SSmaInfo *pSmaInfo,
                            int8_t cmprAlg, int8_t toLast);
 int32_t tsdbWriteDiskData(SDataFWriter *pWriter, const SDiskData *pDiskData, SBlockInfo *pBlkInfo, SSmaInfo *pSmaInfo);
+int32_t tsdbWriteDataBlockRaw(SDataFWriter *pWriter, SDataBlk *pDataBlk, const uint8_t *pRaw);
 
 int32_t tsdbDFileSetCopy(STsdb *pTsdb, SDFileSet *pSetFrom, SDFileSet *pSetTo);
 // SDataFReader
@@ -275,6 +282,7 @@ int32_t tsdbReadDataBlk(SDataFReader *pReader, SBlockIdx *pBlockIdx, SMapData *m
 int32_t tsdbReadSttBlk(SDataFReader *pReader, int32_t iStt, SArray *aSttBlk);
 int32_t tsdbReadBlockSma(SDataFReader *pReader, SDataBlk *pBlock, SArray *aColumnDataAgg);
 int32_t tsdbReadDataBlock(SDataFReader *pReader, SDataBlk *pBlock, SBlockData *pBlockData);
+int32_t tsdbReadDataBlockRaw(SDataFReader *pReader, SDataBlk *pDataBlk, uint8_t *pBuf);
 int32_t tsdbReadSttBlock(SDataFReader *pReader, int32_t iStt, SSttBlk *pSttBlk, SBlockData *pBlockData);
 int32_t tsdbReadSttBlockEx(SDataFReader *pReader, int32_t iStt, SSttBlk *pSttBlk, SBlockData *pBlockData);
 // SDelFWriter
@@ -316,6 +324,12 @@ size_t tsdbCacheGetCapacity(SVnode *pVnode);
 
 int32_t tsdbCacheLastArray2Row(SArray *pLastArray, STSRow **ppRow, STSchema *pSchema);
 
+// tsdbDelCache ==============================================================================================
+void    tsdbDelCacheOpen(STsdb *pTsdb);
+void    tsdbDelCacheClose(STsdb *pTsdb);
+void    tsdbDelCacheInvalidate(STsdb *pTsdb);
+int32_t tsdbDelCacheGetSkyline(STsdb *pTsdb, SDelFile *pDelFile, tb_uid_t suid, tb_uid_t uid, SArray **ppSkyline);
+
 // tsdbDiskData ==============================================================================================
 int32_t tDiskDataBuilderCreate(SDiskDataBuilder **ppBuilder);
 void   *tDiskDataBuilderDestroy(SDiskDataBuilder *pBuilder);
@@ -331,6 +345,16 @@ struct STsdbFS {
   SArray   *aDFileSet;  // SArray<SDFileSet>
 };
 
+struct STsdbDelCache {
+  TdThreadMutex mutex;
+  int64_t       commitID;  // version of the del file the cache is built on
+  int64_t       size;
+  int64_t       offset;
+  SArray       *aDelIdx;    // SArray<SDelIdx>
+  SHashObj     *pSkylines;  // uid -> SArray<TSDBKEY>, skyline of the del file tombstones of the table
+  int64_t       nKey;       // number of keys held by pSkylines
+};
+
 struct STsdb {
   char          *path;
   SVnode        *pVnode;
@@ -341,6 +365,7 @@ struct STsdb {
   STsdbFS        fs;
   SLRUCache     *lruCache;
   TdThreadMutex  lruMutex;
+  STsdbDelCache  delCache;
 };
 
 struct TSDBKEY {
@@ -422,11 +447,19 @@ struct SMapData {
   uint8_t *pData;
 };
 
+// var-length column stored as a dictionary plus codes instead of offsets plus values
+#define TSDB_BLOCK_COL_IS_DICT(PBLOCKCOL) \
+  (IS_VAR_DATA_TYPE((PBLOCKCOL)->type) && (PBLOCKCOL)->szOffset == 0 && (PBLOCKCOL)->szValue > 0)
+
+// set in the encoded flag of a column whose values carry their own codec
+#define TSDB_BLOCK_COL_CODEC ((int8_t)0x40)
+
 struct SBlockCol {
   int16_t cid;
   int8_t  type;
   int8_t  smaOn;
   int8_t  flag;      // HAS_NONE|HAS_NULL|HAS_VALUE
+  int8_t  codec;     // codec of the values chosen by sampling, CODEC_NONE to follow the block cmprAlg
   int32_t szOrigin;  // original column value size (only save for variant data type)
   int32_t szBitmap;  // bitmap size, 0 only for flag == HAS_VAL
   int32_t szOffset;  // offset size, 0 only for non-variant-length type
@@ -632,7 +665,8 @@ struct SDataFWriter {
   SSmaFile  fSma;
   SSttFile  fStt[TSDB_MAX_STT_TRIGGER];
 
-  uint8_t *aBuf[4];
+  uint8_t  *aBuf[4];
+  SHashObj *pCodecHint;  // codecs chosen for the columns written to the file set, see tCmprBlockData
 };
 
 struct SDataFReader {
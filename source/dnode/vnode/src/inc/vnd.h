@@ -75,6 +75,7 @@ struct SVBufPool {
 int32_t vnodeOpenBufPool(SVnode* pVnode);
 int32_t vnodeCloseBufPool(SVnode* pVnode);
 void    vnodeBufPoolReset(SVBufPool* pPool);
+int64_t vnodeGetMemtableUsage(SVnode* pVnode);
 
 // vnodeQuery.c
 int32_t vnodeQueryOpen(SVnode* pVnode);
@@ -103,6 +104,9 @@ void    vnodeRedirectRpcMsg(SVnode* pVnode, SRpcMsg* pMsg);
 bool    vnodeIsLeader(SVnode* pVnode);
 bool    vnodeIsRoleLeader(SVnode* pVnode);
 
+// vnodeSplit.c
+int32_t vnodeSplitCutover(SVnode* pVnode, int64_t version, SAlterVnodeHashRangeReq* pReq);
+
 #ifdef __cplusplus
 }
 #endif
@@ -58,6 +58,7 @@ typedef struct STQ                STQ;
 typedef struct SVState            SVState;
 typedef struct SVStatis           SVStatis;
 typedef struct SVBufPool          SVBufPool;
+typedef struct SVSplit            SVSplit;
 typedef struct SQWorker           SQHandle;
 typedef struct STsdbKeepCfg       STsdbKeepCfg;
 typedef struct SMetaSnapReader    SMetaSnapReader;
@@ -108,6 +109,7 @@ int             metaDropSTable(SMeta* pMeta, int64_t verison, SVDropStbReq* pReq
 int             metaCreateTable(SMeta* pMeta, int64_t version, SVCreateTbReq* pReq, STableMetaRsp** pMetaRsp);
 int             metaDropTable(SMeta* pMeta, int64_t version, SVDropTbReq* pReq, SArray* tbUids, int64_t* tbUid);
 int             metaTtlDropTable(SMeta* pMeta, int64_t ttl, SArray* tbUids);
+int             metaTrimTables(SMeta* pMeta, SArray* tbUids);
 int             metaAlterTable(SMeta* pMeta, int64_t version, SVAlterTbReq* pReq, STableMetaRsp* pMetaRsp);
 SSchemaWrapper* metaGetTableSchema(SMeta* pMeta, tb_uid_t uid, int32_t sver, int lock);
 STSchema*       metaGetTbTSchema(SMeta* pMeta, tb_uid_t uid, int32_t sver, int lock);
@@ -166,6 +168,7 @@ STsdbReader tsdbQueryCacheLastT(STsdb* tsdb, SQueryTableDataCond* pCond, STableL
                                 void* pMemRef);
 int32_t     tsdbSetKeepCfg(STsdb* pTsdb, STsdbCfg* pCfg);
 int32_t     tsdbGetStbIdList(SMeta* pMeta, int64_t suid, SArray* list);
+int64_t     tsdbFSSize(STsdb* pTsdb);
 
 // tq
 int     tqInit();
@@ -237,6 +240,7 @@ int32_t metaSnapWriterClose(SMetaSnapWriter** ppWriter, int8_t rollback);
 int32_t tsdbSnapReaderOpen(STsdb* pTsdb, int64_t sver, int64_t ever, int8_t type, STsdbSnapReader** ppReader);
 int32_t tsdbSnapReaderClose(STsdbSnapReader** ppReader);
 int32_t tsdbSnapRead(STsdbSnapReader* pReader, uint8_t** ppData);
+void    tsdbSnapReaderSetFilter(STsdbSnapReader* pReader, SHashObj* pUidFilter);
 // STsdbSnapWriter ========================================
 int32_t tsdbSnapWriterOpen(STsdb* pTsdb, int64_t sver, int64_t ever, STsdbSnapWriter** ppWriter);
 int32_t tsdbSnapWrite(STsdbSnapWriter* pWriter, uint8_t* pData, uint32_t nData);
@@ -299,6 +303,9 @@ struct SVStatis {
   int64_t nInsertSuccess;       // delta
   int64_t nBatchInsert;         // delta
   int64_t nBatchInsertSuccess;  // delta
+  int64_t nWriteRows;           // total
+  int64_t nSelect;              // total
+  int64_t nQueryTime;           // total, us
 };
 
 struct SVnodeInfo {
@@ -347,6 +354,7 @@ struct SVnode {
   bool          restored;
   tsem_t        syncSem;
   SQHandle*     pQuery;
+  SVSplit*      pSplit;
 };
 
 #define TD_VID(PVNODE) ((PVNODE)->config.vgId)
@@ -402,6 +410,7 @@ enum {
   SNAP_DATA_TQ_OFFSET = 8,
   SNAP_DATA_STREAM_TASK = 9,
   SNAP_DATA_STREAM_STATE = 10,
+  SNAP_DATA_TSDB_RAW = 11,  // one compressed data block as it is in the .data/.sma files
 };
 
 struct SSnapDataHdr {
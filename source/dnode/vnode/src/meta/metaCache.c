@@ -14,8 +14,9 @@
  */
 #include "meta.h"
 
-#define META_CACHE_BASE_BUCKET  1024
-#define META_CACHE_STATS_BUCKET 16
+#define META_CACHE_BASE_BUCKET     1024
+#define META_CACHE_STATS_BUCKET    16
+#define META_CACHE_SCHEMA_CAPACITY (4 * 1024 * 1024)
 
 // (uid , suid) : child table
 // (uid,     0) : normal table
@@ -31,6 +32,12 @@ typedef struct SMetaStbStatsEntry {
   SMetaStbStats              info;
 } SMetaStbStatsEntry;
 
+// decoded schema of (uid, sver), uid is the super table or normal table owning the schema
+typedef struct SMetaSchemaEntry {
+  SSchemaWrapper sw;
+  STSchema*      pTSchema;
+} SMetaSchemaEntry;
+
 struct SMetaCache {
   // child, normal, super, table entry cache
   struct SEntryCache {
@@ -46,6 +53,13 @@ struct SMetaCache {
     SMetaStbStatsEntry** aBucket;
   } sStbStatsCache;
 
+  // decoded schema cache, a (uid, sver) schema never changes once created
+  struct SSchemaCache {
+    SLRUCache* pCache;
+    int64_t    nHit;
+    int64_t    nMiss;
+  } sSchemaCache;
+
   // query cache
 };
 
@@ -64,6 +78,16 @@ static void entryCacheClose(SMeta* pMeta) {
   }
 }
 
+static void schemaCacheClose(SMeta* pMeta) {
+  if (pMeta->pCache && pMeta->pCache->sSchemaCache.pCache) {
+    metaDebug("vgId:%d meta schema cache closed, hit:%" PRId64 " miss:%" PRId64, TD_VID(pMeta->pVnode),
+              pMeta->pCache->sSchemaCache.nHit, pMeta->pCache->sSchemaCache.nMiss);
+
+    taosLRUCacheEraseUnrefEntries(pMeta->pCache->sSchemaCache.pCache);
+    taosLRUCacheCleanup(pMeta->pCache->sSchemaCache.pCache);
+  }
+}
+
 static void statsCacheClose(SMeta* pMeta) {
   if (pMeta->pCache) {
     // close entry cache
@@ -109,13 +133,25 @@ int32_t metaCacheOpen(SMeta* pMeta) {
     goto _err2;
   }
 
+  // open schema cache
+  pCache->sSchemaCache.nHit = 0;
+  pCache->sSchemaCache.nMiss = 0;
+  pCache->sSchemaCache.pCache = taosLRUCacheInit(META_CACHE_SCHEMA_CAPACITY, -1, .5);
+  if (pCache->sSchemaCache.pCache == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err3;
+  }
+
   pMeta->pCache = pCache;
 
 _exit:
   return code;
 
+_err3:
+  taosMemoryFree(pCache->sStbStatsCache.aBucket);
+
 _err2:
-  entryCacheClose(pMeta);
+  taosMemoryFree(pCache->sEntryCache.aBucket);
 
 _err:
   taosMemoryFree(pCache);
@@ -128,6 +164,7 @@ void metaCacheClose(SMeta* pMeta) {
   if (pMeta->pCache) {
     entryCacheClose(pMeta);
     statsCacheClose(pMeta);
+    schemaCacheClose(pMeta);
     taosMemoryFree(pMeta->pCache);
     pMeta->pCache = NULL;
   }
@@ -388,3 +425,112 @@ int32_t metaStatsCacheGet(SMeta* pMeta, int64_t uid, SMetaStbStats* pInfo) {
 
   return code;
 }
+
+static void metaSchemaEntryFree(const void* key, size_t keyLen, void* value) {
+  SMetaSchemaEntry* pEntry = (SMetaSchemaEntry*)value;
+
+  taosMemoryFree(pEntry->sw.pSchema);
+  taosMemoryFree(pEntry->pTSchema);
+  taosMemoryFree(pEntry);
+}
+
+static STSchema* metaCloneTSchema(const STSchema* pTSchema) {
+  int32_t   size = sizeof(STSchema) + sizeof(STColumn) * pTSchema->numOfCols;
+  STSchema* pNew = (STSchema*)taosMemoryMalloc(size);
+  if (pNew) {
+    memcpy(pNew, pTSchema, size);
+  }
+  return pNew;
+}
+
+int32_t metaSchemaCacheGet(SMeta* pMeta, int64_t uid, int32_t sver, SSchemaWrapper** ppSW, STSchema** ppTSchema) {
+  int32_t     code = 0;
+  SMetaCache* pCache = pMeta->pCache;
+  SSkmDbKey   key = {.uid = uid, .sver = sver};
+
+  LRUHandle* h = taosLRUCacheLookup(pCache->sSchemaCache.pCache, &key, sizeof(key));
+  if (h == NULL) {
+    atomic_add_fetch_64(&pCache->sSchemaCache.nMiss, 1);
+    return TSDB_CODE_NOT_FOUND;
+  }
+  atomic_add_fetch_64(&pCache->sSchemaCache.nHit, 1);
+
+  // the handle keeps the entry alive while it is copied out
+  SMetaSchemaEntry* pEntry = (SMetaSchemaEntry*)taosLRUCacheValue(pCache->sSchemaCache.pCache, h);
+  if (ppSW) {
+    *ppSW = tCloneSSchemaWrapper(&pEntry->sw);
+    if (*ppSW == NULL) code = TSDB_CODE_OUT_OF_MEMORY;
+  }
+  if (ppTSchema && code == 0) {
+    *ppTSchema = metaCloneTSchema(pEntry->pTSchema);
+    if (*ppTSchema == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      if (ppSW) {
+        tDeleteSSchemaWrapper(*ppSW);
+        *ppSW = NULL;
+      }
+    }
+  }
+
+  taosLRUCacheRelease(pCache->sSchemaCache.pCache, h, false);
+  return code;
+}
+
+int32_t metaSchemaCachePut(SMeta* pMeta, int64_t uid, const SSchemaWrapper* pSW) {
+  int32_t           code = 0;
+  SMetaSchemaEntry* pEntry = NULL;
+  STSchemaBuilder   sb = {0};
+
+  if (pSW->nCols <= 0) return code;
+
+  pEntry = (SMetaSchemaEntry*)taosMemoryCalloc(1, sizeof(*pEntry));
+  if (pEntry == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  pEntry->sw.nCols = pSW->nCols;
+  pEntry->sw.version = pSW->version;
+  pEntry->sw.pSchema = (SSchema*)taosMemoryMalloc(sizeof(SSchema) * pSW->nCols);
+  if (pEntry->sw.pSchema == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+  memcpy(pEntry->sw.pSchema, pSW->pSchema, sizeof(SSchema) * pSW->nCols);
+
+  if (tdInitTSchemaBuilder(&sb, pSW->version) < 0) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+  for (int32_t i = 0; i < pSW->nCols; i++) {
+    SSchema* pSchema = pSW->pSchema + i;
+    tdAddColToSchema(&sb, pSchema->type, pSchema->flags, pSchema->colId, pSchema->bytes);
+  }
+  pEntry->pTSchema = tdGetSchemaFromBuilder(&sb);
+  tdDestroyTSchemaBuilder(&sb);
+  if (pEntry->pTSchema == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  SSkmDbKey key = {.uid = uid, .sver = pSW->version};
+  size_t    charge = sizeof(*pEntry) + sizeof(SSchema) * pSW->nCols + sizeof(STSchema) + sizeof(STColumn) * pSW->nCols;
+  LRUStatus status = taosLRUCacheInsert(pMeta->pCache->sSchemaCache.pCache, &key, sizeof(key), pEntry, charge,
+                                        metaSchemaEntryFree, NULL, TAOS_LRU_PRIORITY_LOW);
+  if (status == TAOS_LRU_STATUS_FAIL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+  pEntry = NULL;  // owned by the cache from now on
+
+_exit:
+  if (pEntry) {
+    metaSchemaEntryFree(NULL, 0, pEntry);
+  }
+  return code;
+}
+
+void metaSchemaCacheDrop(SMeta* pMeta, int64_t uid, int32_t sver) {
+  SSkmDbKey key = {.uid = uid, .sver = sver};
+  taosLRUCacheErase(pMeta->pCache->sSchemaCache.pCache, &key, sizeof(key));
+}
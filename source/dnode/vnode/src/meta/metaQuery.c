@@ -306,7 +306,7 @@ int metaTbCursorNext(SMTbCursor *pTbCur) {
   return 0;
 }
 
-SSchemaWrapper *metaGetTableSchema(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock) {
+static SSchemaWrapper *metaGetTableSchemaFromDb(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock) {
   void           *pData = NULL;
   int             nData = 0;
   int64_t         version;
@@ -582,27 +582,92 @@ tb_uid_t metaStbCursorNext(SMStbCursor *pStbCur) {
   return *(tb_uid_t *)pStbCur->pKey;
 }
 
-STSchema *metaGetTbTSchema(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock) {
-  // SMetaReader     mr = {0};
-  STSchema       *pTSchema = NULL;
-  SSchemaWrapper *pSW = NULL;
-  STSchemaBuilder sb = {0};
-  SSchema        *pSchema;
+// find the table owning the schema of uid (itself, or the super table of a child table) and its latest schema
+// version, the meta lock must be held
+static int32_t metaGetSkmOwner(SMeta *pMeta, tb_uid_t uid, tb_uid_t *pSkmUid, int32_t *pSkmVer) {
+  int32_t   code = TSDB_CODE_NOT_FOUND;
+  void     *pData = NULL;
+  int       nData = 0;
+  SMetaInfo info;
 
-  pSW = metaGetTableSchema(pMeta, uid, sver, lock);
-  if (!pSW) return NULL;
+  for (int32_t i = 0; i < 2; i++) {
+    if (metaCacheGet(pMeta, uid, &info) != 0) {
+      if (tdbTbGet(pMeta->pUidIdx, &uid, sizeof(uid), &pData, &nData) < 0) break;
 
-  tdInitTSchemaBuilder(&sb, pSW->version);
-  for (int i = 0; i < pSW->nCols; i++) {
-    pSchema = pSW->pSchema + i;
-    tdAddColToSchema(&sb, pSchema->type, pSchema->flags, pSchema->colId, pSchema->bytes);
+      info.suid = ((SUidIdxVal *)pData)->suid;
+      info.skmVer = ((SUidIdxVal *)pData)->skmVer;
+    }
+
+    if (info.suid == 0 || info.suid == uid) {
+      *pSkmUid = uid;
+      *pSkmVer = info.skmVer;
+      code = 0;
+      break;
+    }
+
+    uid = info.suid;
   }
-  pTSchema = tdGetSchemaFromBuilder(&sb);
 
-  tdDestroyTSchemaBuilder(&sb);
+  tdbFree(pData);
+  return code;
+}
+
+static int32_t metaGetCachedSchema(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock, SSchemaWrapper **ppSW,
+                                   STSchema **ppTSchema) {
+  tb_uid_t skmUid = 0;
+  int32_t  skmVer = 0;
+  int32_t  code = 0;
+
+  if (lock) metaRLock(pMeta);
+  code = metaGetSkmOwner(pMeta, uid, &skmUid, &skmVer);
+  if (lock) metaULock(pMeta);
+
+  if (code == 0) {
+    if (sver != -1) skmVer = sver;
+    if (metaSchemaCacheGet(pMeta, skmUid, skmVer, ppSW, ppTSchema) == 0) return 0;
+  }
+
+  // decode it from TDB and keep it for the next time
+  SSchemaWrapper *pSW = metaGetTableSchemaFromDb(pMeta, uid, sver, lock);
+  if (pSW == NULL) return TSDB_CODE_NOT_FOUND;
+
+  if (code == 0 && pSW->version == skmVer) {
+    (void)metaSchemaCachePut(pMeta, skmUid, pSW);
+  }
 
-  taosMemoryFree(pSW->pSchema);
-  taosMemoryFree(pSW);
+  if (ppTSchema) {
+    STSchemaBuilder sb = {0};
+
+    tdInitTSchemaBuilder(&sb, pSW->version);
+    for (int i = 0; i < pSW->nCols; i++) {
+      SSchema *pSchema = pSW->pSchema + i;
+      tdAddColToSchema(&sb, pSchema->type, pSchema->flags, pSchema->colId, pSchema->bytes);
+    }
+    *ppTSchema = tdGetSchemaFromBuilder(&sb);
+
+    tdDestroyTSchemaBuilder(&sb);
+  }
+
+  if (ppSW) {
+    *ppSW = pSW;
+  } else {
+    tDeleteSSchemaWrapper(pSW);
+  }
+
+  return 0;
+}
+
+SSchemaWrapper *metaGetTableSchema(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock) {
+  SSchemaWrapper *pSW = NULL;
+
+  (void)metaGetCachedSchema(pMeta, uid, sver, lock, &pSW, NULL);
+  return pSW;
+}
+
+STSchema *metaGetTbTSchema(SMeta *pMeta, tb_uid_t uid, int32_t sver, int lock) {
+  STSchema *pTSchema = NULL;
+
+  (void)metaGetCachedSchema(pMeta, uid, sver, lock, NULL, &pTSchema);
   return pTSchema;
 }
 
@@ -661,6 +726,10 @@ int32_t metaGetTbTSchemaEx(SMeta *pMeta, tb_uid_t suid, tb_uid_t uid, int32_t sv
 
   skmDbKey.uid = suid ? suid : uid;
   skmDbKey.sver = sver;
+  if (metaSchemaCacheGet(pMeta, skmDbKey.uid, skmDbKey.sver, NULL, ppTSchema) == 0) {
+    goto _exit;
+  }
+
   metaRLock(pMeta);
   if (tdbTbGet(pMeta->pSkmDb, &skmDbKey, sizeof(SSkmDbKey), &pData, &nData) < 0) {
     metaULock(pMeta);
@@ -691,6 +760,7 @@ int32_t metaGetTbTSchemaEx(SMeta *pMeta, tb_uid_t suid, tb_uid_t uid, int32_t sv
   tdDestroyTSchemaBuilder(&sb);
 
   *ppTSchema = pTSchema;
+  (void)metaSchemaCachePut(pMeta, skmDbKey.uid, pSchemaWrapper);
   taosMemoryFree(pSchemaWrapper->pSchema);
 
 _exit:
@@ -1226,8 +1296,6 @@ int32_t metaGetTableTags(SMeta *pMeta, uint64_t suid, SArray *uidList, SHashObj
   return TSDB_CODE_SUCCESS;
 }
 
-int32_t metaCacheGet(SMeta *pMeta, int64_t uid, SMetaInfo *pInfo);
-
 int32_t metaGetInfo(SMeta *pMeta, int64_t uid, SMetaInfo *pInfo) {
   int32_t code = 0;
   void   *pData = NULL;
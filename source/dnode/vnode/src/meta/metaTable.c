@@ -367,6 +367,9 @@ int metaAlterSTable(SMeta *pMeta, int64_t version, SVCreateStbReq *pReq) {
 
   metaStatsCacheDrop(pMeta, nStbEntry.uid);
 
+  metaSchemaCacheDrop(pMeta, nStbEntry.uid, oStbEntry.stbEntry.schemaRow.version);
+  metaSchemaCacheDrop(pMeta, nStbEntry.uid, nStbEntry.stbEntry.schemaRow.version);
+
   metaULock(pMeta);
 
   if (oStbEntry.pBuf) taosMemoryFree(oStbEntry.pBuf);
@@ -532,6 +535,49 @@ int metaTtlDropTable(SMeta *pMeta, int64_t ttl, SArray *tbUids) {
   return 0;
 }
 
+int metaTrimTables(SMeta *pMeta, SArray *tbUids) {
+  TBC  *pCur = NULL;
+  void *pKey = NULL;
+  void *pVal = NULL;
+  int   kLen = 0;
+  int   vLen = 0;
+  char  tbFName[TSDB_TABLE_FNAME_LEN];
+
+  // collect the child/normal tables whose name no longer hashes into this vnode
+  if (tdbTbcOpen(pMeta->pNameIdx, &pCur, NULL) < 0) {
+    return -1;
+  }
+
+  tdbTbcMoveToFirst(pCur);
+  while (tdbTbcNext(pCur, &pKey, &kLen, &pVal, &vLen) == 0) {
+    tb_uid_t  uid = *(tb_uid_t *)pVal;
+    SMetaInfo info;
+
+    if (metaGetInfo(pMeta, uid, &info) < 0 || info.suid == uid) continue;
+
+    snprintf(tbFName, sizeof(tbFName), "%s.%s", pMeta->pVnode->config.dbname, (char *)pKey);
+    if (vnodeValidateTableHash(pMeta->pVnode, tbFName) < 0) {
+      taosArrayPush(tbUids, &uid);
+    }
+  }
+  tdbFree(pKey);
+  tdbFree(pVal);
+  tdbTbcClose(pCur);
+
+  if (taosArrayGetSize(tbUids) == 0) {
+    return 0;
+  }
+
+  metaWLock(pMeta);
+  for (int i = 0; i < taosArrayGetSize(tbUids); ++i) {
+    tb_uid_t *uid = (tb_uid_t *)taosArrayGet(tbUids, i);
+    metaDropTableByUid(pMeta, *uid, NULL);
+    metaDebug("vgId:%d, trim table:%" PRId64 " out of hash range", TD_VID(pMeta->pVnode), *uid);
+  }
+  metaULock(pMeta);
+  return 0;
+}
+
 static void metaBuildTtlIdxKey(STtlIdxKey *ttlKey, const SMetaEntry *pME) {
   int64_t ttlDays;
   int64_t ctime;
@@ -616,11 +662,14 @@ static int metaDropTableByUid(SMeta *pMeta, tb_uid_t uid, int *type) {
 
     --pMeta->pVnode->config.vndStats.numOfNTables;
     pMeta->pVnode->config.vndStats.numOfNTimeSeries -= e.ntbEntry.schemaRow.nCols - 1;
+
+    metaSchemaCacheDrop(pMeta, uid, e.ntbEntry.schemaRow.version);
   } else if (e.type == TSDB_SUPER_TABLE) {
     tdbTbDelete(pMeta->pSuidIdx, &e.uid, sizeof(tb_uid_t), &pMeta->txn);
     // drop schema.db (todo)
 
     metaStatsCacheDrop(pMeta, uid);
+    metaSchemaCacheDrop(pMeta, uid, e.stbEntry.schemaRow.version);
     --pMeta->pVnode->config.vndStats.numOfSTables;
   }
 
@@ -787,6 +836,9 @@ static int metaAlterTableColumn(SMeta *pMeta, int64_t version, SVAlterTbReq *pAl
 
   metaSaveToSkmDb(pMeta, &entry);
 
+  metaSchemaCacheDrop(pMeta, uid, pSchema->version - 1);
+  metaSchemaCacheDrop(pMeta, uid, pSchema->version);
+
   metaULock(pMeta);
 
   metaUpdateMetaRsp(uid, pAlterTbReq->tbName, pSchema, pMetaRsp);
@@ -634,6 +634,9 @@ int32_t tqProcessPollReq(STQ* pTq, SRpcMsg* pMsg) {
 
     walSetReaderCapacity(pHandle->pWalReader, 2048);
 
+    STqPollBatch batch;
+    tqPollBatchInit(&batch);
+
     while (1) {
       consumerEpoch = atomic_load_32(&pHandle->epoch);
       if (consumerEpoch > reqEpoch) {
@@ -664,9 +667,7 @@ int32_t tqProcessPollReq(STQ* pTq, SRpcMsg* pMsg) {
         if (tqTaosxScanLog(pTq, pHandle, pCont, &taosxRsp) < 0) {
           /*ASSERT(0);*/
         }
-        // TODO batch optimization:
-        // TODO continue scan until meeting batch requirement
-        if (taosxRsp.blockNum > 0 /* threshold */) {
+        if (taosxRsp.blockNum > 0 && tqPollBatchFull(&batch, (SMqDataRsp*)&taosxRsp)) {
           tqOffsetResetToLog(&taosxRsp.rspOffset, fetchVer);
           if (tqSendTaosxRsp(pTq, pMsg, pReq, &taosxRsp) < 0) {
             code = -1;
@@ -681,6 +682,18 @@ int32_t tqProcessPollReq(STQ* pTq, SRpcMsg* pMsg) {
       } else {
         ASSERT(pHandle->fetchMeta);
         ASSERT(IS_META_MSG(pHead->msgType));
+
+        // return the data batched so far first, the meta msg is fetched again by the next poll
+        if (taosxRsp.blockNum > 0) {
+          tqOffsetResetToLog(&taosxRsp.rspOffset, fetchVer - 1);
+          if (tqSendTaosxRsp(pTq, pMsg, pReq, &taosxRsp) < 0) {
+            code = -1;
+          }
+          tDeleteSTaosxRsp(&taosxRsp);
+          taosMemoryFreeClear(pCkHead);
+          return code;
+        }
+
         tqDebug("fetch meta msg, ver:%" PRId64 ", type:%d", pHead->version, pHead->msgType);
         tqOffsetResetToLog(&metaRsp.rspOffset, fetchVer);
         metaRsp.resMsgType = pHead->msgType;
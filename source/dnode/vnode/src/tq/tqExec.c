@@ -37,6 +37,22 @@ int32_t tqAddBlockDataToRsp(const SSDataBlock* pBlock, SMqDataRsp* pRsp, int32_t
   return 0;
 }
 
+void tqPollBatchInit(STqPollBatch* pBatch) {
+  memset(pBatch, 0, sizeof(STqPollBatch));
+  pBatch->startMs = taosGetTimestampMs();
+}
+
+bool tqPollBatchFull(STqPollBatch* pBatch, const SMqDataRsp* pRsp) {
+  for (; pBatch->blockNum < pRsp->blockNum; pBatch->blockNum++) {
+    const SRetrieveTableRsp* pRetrieve = taosArrayGetP(pRsp->blockData, pBatch->blockNum);
+    pBatch->rows += htonl(pRetrieve->numOfRows);
+    pBatch->bytes += *(int32_t*)taosArrayGet(pRsp->blockDataLen, pBatch->blockNum);
+  }
+
+  return pBatch->rows >= TQ_POLL_BATCH_ROWS || pBatch->bytes >= TQ_POLL_BATCH_BYTES ||
+         taosGetTimestampMs() - pBatch->startMs >= TQ_POLL_BATCH_MS;
+}
+
 static int32_t tqAddBlockSchemaToRsp(const STqExecHandle* pExec, SMqDataRsp* pRsp) {
   SSchemaWrapper* pSW = tCloneSSchemaWrapper(pExec->pExecReader->pSchemaWrapper);
   if (pSW == NULL) {
@@ -81,7 +97,11 @@ int32_t tqScanData(STQ* pTq, const STqHandle* pHandle, SMqDataRsp* pRsp, STqOffs
     }
   }
 
+  STqPollBatch batch;
+  tqPollBatchInit(&batch);
+
   int32_t rowCnt = 0;
+  int64_t lastVer = INT64_MIN;
   while (1) {
     SSDataBlock* pDataBlock = NULL;
     uint64_t     ts = 0;
@@ -92,7 +112,19 @@ int32_t tqScanData(STQ* pTq, const STqHandle* pHandle, SMqDataRsp* pRsp, STqOffs
     tqDebug("tmq task executed, get %p", pDataBlock);
 
     if (pDataBlock == NULL) {
-      break;
+      // the queue scan stops at each wal version, go on with the next one until the wal is drained or the batch is full.
+      // A version without data for the topic, e.g. a submit of other tables, does not end the batch.
+      if (pOffset->type != TMQ_OFFSET__LOG || tqPollBatchFull(&batch, pRsp)) {
+        break;
+      }
+
+      STqOffsetVal offset = {0};
+      if (qStreamExtractOffset(task, &offset) < 0 || offset.type != TMQ_OFFSET__LOG || offset.version == lastVer ||
+          qStreamPrepareScan(task, &offset, pExec->subType) < 0) {
+        break;
+      }
+      lastVer = offset.version;
+      continue;
     }
 
     tqAddBlockDataToRsp(pDataBlock, pRsp, pExec->numOfCols);
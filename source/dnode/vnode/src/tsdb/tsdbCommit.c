@@ -744,12 +744,25 @@ _exit:
   return code;
 }
 
+static bool tsdbCommitterTableDropped(SCommitter *pCommitter, int64_t uid) {
+  SMetaInfo info;
+
+  // tables dropped or moved out by a vgroup split are purged from the file sets a commit rewrites
+  return metaGetInfo(pCommitter->pTsdb->pVnode->pMeta, uid, &info) == TSDB_CODE_NOT_FOUND;
+}
+
 static int32_t tsdbMoveCommitData(SCommitter *pCommitter, TABLEID toTable) {
   int32_t code = 0;
   int32_t lino = 0;
 
   while (pCommitter->dReader.pBlockIdx && tTABLEIDCmprFn(pCommitter->dReader.pBlockIdx, &toTable) < 0) {
     SBlockIdx blockIdx = *pCommitter->dReader.pBlockIdx;
+    if (tsdbCommitterTableDropped(pCommitter, blockIdx.uid)) {
+      code = tsdbCommitterNextTableData(pCommitter);
+      TSDB_CHECK_CODE(code, lino, _exit);
+      continue;
+    }
+
     code = tsdbWriteDataBlk(pCommitter->dWriter.pWriter, &pCommitter->dReader.mBlock, &blockIdx);
     TSDB_CHECK_CODE(code, lino, _exit);
 
@@ -1576,6 +1589,20 @@ static int32_t tsdbCommitFileDataImpl(SCommitter *pCommitter) {
     code = tsdbMoveCommitData(pCommitter, id);
     TSDB_CHECK_CODE(code, lino, _exit);
 
+    if (tsdbCommitterTableDropped(pCommitter, id.uid)) {
+      if (pCommitter->dReader.pBlockIdx && tTABLEIDCmprFn(pCommitter->dReader.pBlockIdx, &id) == 0) {
+        code = tsdbCommitterNextTableData(pCommitter);
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
+
+      while ((pRowInfo = tsdbGetCommitRow(pCommitter)) != NULL && pRowInfo->suid == id.suid &&
+             pRowInfo->uid == id.uid) {
+        code = tsdbNextCommitRow(pCommitter);
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
+      continue;
+    }
+
     // start
     tMapDataReset(&pCommitter->dWriter.mBlock);
 
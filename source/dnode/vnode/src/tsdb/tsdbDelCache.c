@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdb.h"
+
+/*
+ * The del file only changes on commit, while every reader used to reopen it and decode the whole del index for each
+ * table it scanned. The cache keeps the decoded index of the latest del file version and the skyline of each table
+ * built from it, so a table without tombstones costs one binary search and a table with tombstones is decoded once.
+ * The del file is always read with the mutex released, only the lookups and the installs are done under it.
+ */
+
+// at most this many skyline keys are kept, the cached skylines are dropped all together once it is exceeded
+#define TSDB_DEL_CACHE_MAX_KEYS (1 << 20)
+
+static void tsdbDelCacheFreeSkyline(void *p) { taosArrayDestroy(*(SArray **)p); }
+
+static void tsdbDelCacheClear(STsdbDelCache *pCache) {
+  taosArrayDestroy(pCache->aDelIdx);
+  pCache->aDelIdx = NULL;
+  taosHashCleanup(pCache->pSkylines);
+  pCache->pSkylines = NULL;
+  pCache->nKey = 0;
+  pCache->commitID = 0;
+  pCache->size = 0;
+  pCache->offset = 0;
+}
+
+static bool tsdbDelCacheMatch(STsdbDelCache *pCache, SDelFile *pDelFile) {
+  return pCache->aDelIdx != NULL && pCache->commitID == pDelFile->commitID && pCache->size == pDelFile->size &&
+         pCache->offset == pDelFile->offset;
+}
+
+// the cache holds a newer version than the reader, do not evict it for the reader
+static bool tsdbDelCacheNewer(STsdbDelCache *pCache, SDelFile *pDelFile) {
+  return pCache->aDelIdx != NULL && pDelFile->commitID < pCache->commitID;
+}
+
+static int32_t tsdbReadDelIdxOfFile(STsdb *pTsdb, SDelFile *pDelFile, SArray **paDelIdx) {
+  int32_t      code = 0;
+  int32_t      lino = 0;
+  SDelFReader *pReader = NULL;
+  SArray      *aDelIdx = NULL;
+
+  aDelIdx = taosArrayInit(0, sizeof(SDelIdx));
+  if (aDelIdx == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  code = tsdbDelFReaderOpen(&pReader, pDelFile, pTsdb);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tsdbReadDelIdx(pReader, aDelIdx);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+_exit:
+  tsdbDelFReaderClose(&pReader);
+  if (code) {
+    tsdbError("vgId:%d %s failed at line %d since %s", TD_VID(pTsdb->pVnode), __func__, lino, tstrerror(code));
+    taosArrayDestroy(aDelIdx);
+  } else {
+    *paDelIdx = aDelIdx;
+  }
+  return code;
+}
+
+static int32_t tsdbBuildTableSkyline(STsdb *pTsdb, SDelFile *pDelFile, SDelIdx *pDelIdx, SArray **ppSkyline) {
+  int32_t      code = 0;
+  SDelFReader *pReader = NULL;
+  SArray      *aDelData = NULL;
+  SArray      *aSkyline = NULL;
+
+  aDelData = taosArrayInit(0, sizeof(SDelData));
+  aSkyline = taosArrayInit(0, sizeof(TSDBKEY));
+  if (aDelData == NULL || aSkyline == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  code = tsdbDelFReaderOpen(&pReader, pDelFile, pTsdb);
+  if (code) goto _err;
+
+  code = tsdbReadDelData(pReader, pDelIdx, aDelData);
+  if (code) goto _err;
+
+  if (taosArrayGetSize(aDelData) > 0) {
+    code = tsdbBuildDeleteSkyline(aDelData, 0, (int32_t)(taosArrayGetSize(aDelData) - 1), aSkyline);
+    if (code) goto _err;
+  }
+
+  tsdbDelFReaderClose(&pReader);
+  taosArrayDestroy(aDelData);
+  *ppSkyline = aSkyline;
+  return code;
+
+_err:
+  tsdbDelFReaderClose(&pReader);
+  taosArrayDestroy(aDelData);
+  taosArrayDestroy(aSkyline);
+  return code;
+}
+
+// read the tombstones of a table with the del index given, without touching the cache
+static int32_t tsdbReadTableSkyline(STsdb *pTsdb, SDelFile *pDelFile, SArray *aDelIdx, tb_uid_t suid, tb_uid_t uid,
+                                    SArray **ppSkyline) {
+  int32_t code = 0;
+  SArray *aSkyline = NULL;
+
+  SDelIdx *pDelIdx = taosArraySearch(aDelIdx, &(SDelIdx){.suid = suid, .uid = uid}, tCmprDelIdx, TD_EQ);
+  if (pDelIdx == NULL) return code;
+
+  code = tsdbBuildTableSkyline(pTsdb, pDelFile, pDelIdx, &aSkyline);
+  if (code) return code;
+
+  if (taosArrayGetSize(aSkyline) > 0) {
+    *ppSkyline = aSkyline;
+  } else {
+    taosArrayDestroy(aSkyline);
+  }
+  return code;
+}
+
+// install the del index read for pDelFile, unless another reader has installed the same or a newer version meanwhile
+static int32_t tsdbDelCacheInstall(STsdbDelCache *pCache, SDelFile *pDelFile, SArray **paDelIdx) {
+  if (tsdbDelCacheMatch(pCache, pDelFile) || tsdbDelCacheNewer(pCache, pDelFile)) return 0;
+
+  SHashObj *pSkylines = taosHashInit(64, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BIGINT), false, HASH_NO_LOCK);
+  if (pSkylines == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+  taosHashSetFreeFp(pSkylines, tsdbDelCacheFreeSkyline);
+
+  tsdbDelCacheClear(pCache);
+  pCache->aDelIdx = *paDelIdx;
+  pCache->pSkylines = pSkylines;
+  pCache->commitID = pDelFile->commitID;
+  pCache->size = pDelFile->size;
+  pCache->offset = pDelFile->offset;
+  *paDelIdx = NULL;
+  return 0;
+}
+
+// keep the skyline built for pDelFile, the cache takes the ownership of *paSkyline if it is kept
+static void tsdbDelCachePutSkyline(STsdbDelCache *pCache, SDelFile *pDelFile, tb_uid_t uid, SArray **paSkyline) {
+  if (!tsdbDelCacheMatch(pCache, pDelFile) || taosHashGet(pCache->pSkylines, &uid, sizeof(uid)) != NULL) return;
+
+  int64_t nKey = taosArrayGetSize(*paSkyline);
+  if (nKey > TSDB_DEL_CACHE_MAX_KEYS) return;
+
+  if (pCache->nKey + nKey > TSDB_DEL_CACHE_MAX_KEYS) {
+    taosHashClear(pCache->pSkylines);
+    pCache->nKey = 0;
+  }
+
+  if (taosHashPut(pCache->pSkylines, &uid, sizeof(uid), paSkyline, sizeof(*paSkyline)) == 0) {
+    pCache->nKey += nKey;
+    *paSkyline = NULL;
+  }
+}
+
+void tsdbDelCacheOpen(STsdb *pTsdb) {
+  memset(&pTsdb->delCache, 0, sizeof(pTsdb->delCache));
+  taosThreadMutexInit(&pTsdb->delCache.mutex, NULL);
+}
+
+void tsdbDelCacheClose(STsdb *pTsdb) {
+  tsdbDelCacheClear(&pTsdb->delCache);
+  taosThreadMutexDestroy(&pTsdb->delCache.mutex);
+}
+
+void tsdbDelCacheInvalidate(STsdb *pTsdb) {
+  taosThreadMutexLock(&pTsdb->delCache.mutex);
+  tsdbDelCacheClear(&pTsdb->delCache);
+  taosThreadMutexUnlock(&pTsdb->delCache.mutex);
+}
+
+/*
+ * Get a copy of the skyline built from the tombstones of table (suid, uid) in the del file. *ppSkyline is set to
+ * NULL if the table has no tombstone in the file. The caller owns the returned array.
+ */
+int32_t tsdbDelCacheGetSkyline(STsdb *pTsdb, SDelFile *pDelFile, tb_uid_t suid, tb_uid_t uid, SArray **ppSkyline) {
+  int32_t        code = 0;
+  STsdbDelCache *pCache = &pTsdb->delCache;
+  SArray        *aDelIdx = NULL;
+  SArray        *aSkyline = NULL;
+  SDelIdx        delIdx = {0};
+
+  *ppSkyline = NULL;
+  if (pDelFile == NULL) return code;
+
+  taosThreadMutexLock(&pCache->mutex);
+  bool match = tsdbDelCacheMatch(pCache, pDelFile);
+  bool newer = tsdbDelCacheNewer(pCache, pDelFile);
+  taosThreadMutexUnlock(&pCache->mutex);
+
+  if (!match) {
+    code = tsdbReadDelIdxOfFile(pTsdb, pDelFile, &aDelIdx);
+    if (code) goto _exit;
+
+    if (newer) {
+      code = tsdbReadTableSkyline(pTsdb, pDelFile, aDelIdx, suid, uid, ppSkyline);
+      goto _exit;
+    }
+
+    taosThreadMutexLock(&pCache->mutex);
+    code = tsdbDelCacheInstall(pCache, pDelFile, &aDelIdx);
+    match = tsdbDelCacheMatch(pCache, pDelFile);
+    taosThreadMutexUnlock(&pCache->mutex);
+    if (code) goto _exit;
+
+    if (!match) {
+      // a newer version has been installed meanwhile
+      code = tsdbReadTableSkyline(pTsdb, pDelFile, aDelIdx, suid, uid, ppSkyline);
+      goto _exit;
+    }
+  }
+
+  taosThreadMutexLock(&pCache->mutex);
+  if (!tsdbDelCacheMatch(pCache, pDelFile)) {
+    // the cache has been invalidated or replaced meanwhile, read the del file directly
+    taosThreadMutexUnlock(&pCache->mutex);
+
+    if (aDelIdx == NULL) {
+      code = tsdbReadDelIdxOfFile(pTsdb, pDelFile, &aDelIdx);
+      if (code) goto _exit;
+    }
+    code = tsdbReadTableSkyline(pTsdb, pDelFile, aDelIdx, suid, uid, ppSkyline);
+    goto _exit;
+  }
+
+  SDelIdx *pDelIdx = taosArraySearch(pCache->aDelIdx, &(SDelIdx){.suid = suid, .uid = uid}, tCmprDelIdx, TD_EQ);
+  if (pDelIdx == NULL) {
+    taosThreadMutexUnlock(&pCache->mutex);
+    goto _exit;
+  }
+
+  SArray **ppCached = taosHashGet(pCache->pSkylines, &uid, sizeof(uid));
+  if (ppCached) {
+    if (taosArrayGetSize(*ppCached) > 0) {
+      *ppSkyline = taosArrayDup(*ppCached);
+      if (*ppSkyline == NULL) code = TSDB_CODE_OUT_OF_MEMORY;
+    }
+    taosThreadMutexUnlock(&pCache->mutex);
+    goto _exit;
+  }
+
+  delIdx = *pDelIdx;
+  taosThreadMutexUnlock(&pCache->mutex);
+
+  code = tsdbBuildTableSkyline(pTsdb, pDelFile, &delIdx, &aSkyline);
+  if (code) goto _exit;
+
+  if (taosArrayGetSize(aSkyline) > 0) {
+    *ppSkyline = taosArrayDup(aSkyline);
+    if (*ppSkyline == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _exit;
+    }
+  }
+
+  taosThreadMutexLock(&pCache->mutex);
+  tsdbDelCachePutSkyline(pCache, pDelFile, uid, &aSkyline);
+  taosThreadMutexUnlock(&pCache->mutex);
+
+_exit:
+  taosArrayDestroy(aSkyline);
+  taosArrayDestroy(aDelIdx);
+  return code;
+}
@@ -726,6 +726,9 @@ int32_t tsdbFSCommit(STsdb *pTsdb) {
   code = tsdbFSApplyChange(pTsdb, &fs);
   TSDB_CHECK_CODE(code, lino, _exit);
 
+  // drop the tombstones cached on the old del file
+  tsdbDelCacheInvalidate(pTsdb);
+
 _exit:
   tsdbFSDestroy(&fs);
   if (code) {
@@ -830,6 +833,25 @@ int32_t tsdbFSClose(STsdb *pTsdb) {
   return code;
 }
 
+int64_t tsdbFSSize(STsdb *pTsdb) {
+  int64_t size = 0;
+
+  taosThreadRwlockRdlock(&pTsdb->rwLock);
+  if (pTsdb->fs.pDelFile) {
+    size += pTsdb->fs.pDelFile->size;
+  }
+  for (int32_t iSet = 0; iSet < taosArrayGetSize(pTsdb->fs.aDFileSet); iSet++) {
+    SDFileSet *pSet = (SDFileSet *)taosArrayGet(pTsdb->fs.aDFileSet, iSet);
+    size += pSet->pHeadF->size + pSet->pDataF->size + pSet->pSmaF->size;
+    for (int32_t iStt = 0; iStt < pSet->nSttF; iStt++) {
+      size += pSet->aSttF[iStt]->size;
+    }
+  }
+  taosThreadRwlockUnlock(&pTsdb->rwLock);
+
+  return size;
+}
+
 int32_t tsdbFSCopy(STsdb *pTsdb, STsdbFS *pFS) {
   int32_t code = 0;
   int32_t lino = 0;
@@ -52,6 +52,7 @@ int tsdbOpen(SVnode *pVnode, STsdb **ppTsdb, const char *dir, STsdbKeepCfg *pKee
   taosRealPath(pTsdb->path, NULL, slen);
   pTsdb->pVnode = pVnode;
   taosThreadRwlockInit(&pTsdb->rwLock, NULL);
+  tsdbDelCacheOpen(pTsdb);
   if (!pKeepCfg) {
     tsdbSetKeepCfg(pTsdb, &pVnode->config.tsdbCfg);
   } else {
@@ -81,6 +82,7 @@ int tsdbOpen(SVnode *pVnode, STsdb **ppTsdb, const char *dir, STsdbKeepCfg *pKee
   return 0;
 
 _err:
+  tsdbDelCacheClose(pTsdb);
   taosMemoryFree(pTsdb);
   return -1;
 }
@@ -96,6 +98,7 @@ int tsdbClose(STsdb **pTsdb) {
 
     tsdbFSClose(*pTsdb);
     tsdbCloseCache(*pTsdb);
+    tsdbDelCacheClose(*pTsdb);
     taosMemoryFreeClear(*pTsdb);
   }
   return 0;
@@ -2289,43 +2289,19 @@ int32_t initDelSkylineIterator(STableBlockScanInfo* pBlockScanInfo, STsdbReader*
 
   int32_t code = 0;
   STsdb*  pTsdb = pReader->pTsdb;
+  SArray* pFileSkyline = NULL;
+  SArray* pMemSkyline = NULL;
 
   SArray* pDelData = taosArrayInit(4, sizeof(SDelData));
+  if (pDelData == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
 
-  SDelFile* pDelFile = pReader->pReadSnap->fs.pDelFile;
-  if (pDelFile) {
-    SDelFReader* pDelFReader = NULL;
-    code = tsdbDelFReaderOpen(&pDelFReader, pDelFile, pTsdb);
-    if (code != TSDB_CODE_SUCCESS) {
-      goto _err;
-    }
-
-    SArray* aDelIdx = taosArrayInit(4, sizeof(SDelIdx));
-    if (aDelIdx == NULL) {
-      tsdbDelFReaderClose(&pDelFReader);
-      goto _err;
-    }
-
-    code = tsdbReadDelIdx(pDelFReader, aDelIdx);
-    if (code != TSDB_CODE_SUCCESS) {
-      taosArrayDestroy(aDelIdx);
-      tsdbDelFReaderClose(&pDelFReader);
-      goto _err;
-    }
-
-    SDelIdx  idx = {.suid = pReader->suid, .uid = pBlockScanInfo->uid};
-    SDelIdx* pIdx = taosArraySearch(aDelIdx, &idx, tCmprDelIdx, TD_EQ);
-
-    if (pIdx != NULL) {
-      code = tsdbReadDelData(pDelFReader, pIdx, pDelData);
-    }
-
-    taosArrayDestroy(aDelIdx);
-    tsdbDelFReaderClose(&pDelFReader);
-
-    if (code != TSDB_CODE_SUCCESS) {
-      goto _err;
-    }
+  // the tombstones in the del file are decoded once per del file version and shared by all readers
+  code = tsdbDelCacheGetSkyline(pTsdb, pReader->pReadSnap->fs.pDelFile, pReader->suid, pBlockScanInfo->uid,
+                                &pFileSkyline);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _err;
   }
 
   SDelData* p = NULL;
@@ -2346,8 +2322,33 @@ int32_t initDelSkylineIterator(STableBlockScanInfo* pBlockScanInfo, STsdbReader*
   }
 
   if (taosArrayGetSize(pDelData) > 0) {
-    pBlockScanInfo->delSkyline = taosArrayInit(4, sizeof(TSDBKEY));
-    code = tsdbBuildDeleteSkyline(pDelData, 0, (int32_t)(taosArrayGetSize(pDelData) - 1), pBlockScanInfo->delSkyline);
+    pMemSkyline = taosArrayInit(4, sizeof(TSDBKEY));
+    if (pMemSkyline == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _err;
+    }
+
+    code = tsdbBuildDeleteSkyline(pDelData, 0, (int32_t)(taosArrayGetSize(pDelData) - 1), pMemSkyline);
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _err;
+    }
+  }
+
+  if (pFileSkyline != NULL && pMemSkyline != NULL) {
+    pBlockScanInfo->delSkyline = taosArrayInit(taosArrayGetSize(pFileSkyline) + taosArrayGetSize(pMemSkyline),
+                                               sizeof(TSDBKEY));
+    if (pBlockScanInfo->delSkyline == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _err;
+    }
+
+    code = tsdbMergeSkyline(pFileSkyline, pMemSkyline, pBlockScanInfo->delSkyline);
+    taosArrayDestroy(pFileSkyline);
+    taosArrayDestroy(pMemSkyline);
+  } else if (pFileSkyline != NULL) {
+    pBlockScanInfo->delSkyline = pFileSkyline;
+  } else {
+    pBlockScanInfo->delSkyline = pMemSkyline;
   }
 
   taosArrayDestroy(pDelData);
@@ -2359,6 +2360,8 @@ int32_t initDelSkylineIterator(STableBlockScanInfo* pBlockScanInfo, STsdbReader*
   return code;
 
 _err:
+  taosArrayDestroy(pFileSkyline);
+  taosArrayDestroy(pMemSkyline);
   taosArrayDestroy(pDelData);
   return code;
 }
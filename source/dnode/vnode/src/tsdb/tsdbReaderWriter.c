@@ -228,6 +228,11 @@ int32_t tsdbDataFWriterOpen(SDataFWriter **ppWriter, STsdb *pTsdb, SDFileSet *pS
     goto _err;
   }
   pWriter->pTsdb = pTsdb;
+  pWriter->pCodecHint = taosHashInit(64, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY), false, HASH_NO_LOCK);
+  if (pWriter->pCodecHint == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
   pWriter->wSet = (SDFileSet){.diskId = pSet->diskId,
                               .fid = pSet->fid,
                               .pHeadF = &pWriter->fHead,
@@ -331,6 +336,7 @@ int32_t tsdbDataFWriterClose(SDataFWriter **ppWriter, int8_t sync) {
   for (int32_t iBuf = 0; iBuf < sizeof((*ppWriter)->aBuf) / sizeof(uint8_t *); iBuf++) {
     tFree((*ppWriter)->aBuf[iBuf]);
   }
+  taosHashCleanup((*ppWriter)->pCodecHint);
   taosMemoryFree(*ppWriter);
 _exit:
   *ppWriter = NULL;
@@ -558,7 +564,7 @@ int32_t tsdbWriteBlockData(SDataFWriter *pWriter, SBlockData *pBlockData, SBlock
   pBlkInfo->szKey = 0;
 
   int32_t aBufN[4] = {0};
-  code = tCmprBlockData(pBlockData, cmprAlg, NULL, NULL, pWriter->aBuf, aBufN);
+  code = tCmprBlockData(pBlockData, cmprAlg, NULL, NULL, pWriter->aBuf, aBufN, pWriter->pCodecHint);
   if (code) goto _err;
 
   // write =================
@@ -737,6 +743,37 @@ _exit:
   return code;
 }
 
+// write a compressed data block and its sma as they are, offsets of pDataBlk are reset to the new position
+int32_t tsdbWriteDataBlockRaw(SDataFWriter *pWriter, SDataBlk *pDataBlk, const uint8_t *pRaw) {
+  int32_t code = 0;
+  int32_t lino = 0;
+
+  SBlockInfo *pBlkInfo = &pDataBlk->aSubBlock[0];
+  SSmaInfo   *pSmaInfo = &pDataBlk->smaInfo;
+
+  ASSERT(pDataBlk->nSubBlock == 1);
+
+  pBlkInfo->offset = pWriter->fData.size;
+  code = tsdbWriteFile(pWriter->pDataFD, pBlkInfo->offset, pRaw, pBlkInfo->szBlock);
+  TSDB_CHECK_CODE(code, lino, _exit);
+  pWriter->fData.size += pBlkInfo->szBlock;
+
+  if (pSmaInfo->size) {
+    pSmaInfo->offset = pWriter->fSma.size;
+    code = tsdbWriteFile(pWriter->pSmaFD, pSmaInfo->offset, pRaw + pBlkInfo->szBlock, pSmaInfo->size);
+    TSDB_CHECK_CODE(code, lino, _exit);
+    pWriter->fSma.size += pSmaInfo->size;
+  } else {
+    pSmaInfo->offset = 0;
+  }
+
+_exit:
+  if (code) {
+    tsdbError("vgId:%d %s failed at %d since %s", TD_VID(pWriter->pTsdb->pVnode), __func__, lino, tstrerror(code));
+  }
+  return code;
+}
+
 int32_t tsdbDFileSetCopy(STsdb *pTsdb, SDFileSet *pSetFrom, SDFileSet *pSetTo) {
   int32_t   code = 0;
   int64_t   n;
@@ -1204,6 +1241,28 @@ _err:
   return code;
 }
 
+// read a compressed data block followed by its sma into pBuf, which holds szBlock + smaInfo.size bytes
+int32_t tsdbReadDataBlockRaw(SDataFReader *pReader, SDataBlk *pDataBlk, uint8_t *pBuf) {
+  int32_t     code = 0;
+  SBlockInfo *pBlockInfo = &pDataBlk->aSubBlock[0];
+
+  ASSERT(pDataBlk->nSubBlock == 1);
+
+  code = tsdbReadFile(pReader->pDataFD, pBlockInfo->offset, pBuf, pBlockInfo->szBlock);
+  if (code) goto _err;
+
+  if (pDataBlk->smaInfo.size) {
+    code = tsdbReadFile(pReader->pSmaFD, pDataBlk->smaInfo.offset, pBuf + pBlockInfo->szBlock, pDataBlk->smaInfo.size);
+    if (code) goto _err;
+  }
+
+  return code;
+
+_err:
+  tsdbError("vgId:%d tsdb read data block raw failed since %s", TD_VID(pReader->pTsdb->pVnode), tstrerror(code));
+  return code;
+}
+
 int32_t tsdbReadDataBlock(SDataFReader *pReader, SDataBlk *pDataBlk, SBlockData *pBlockData) {
   int32_t code = 0;
 
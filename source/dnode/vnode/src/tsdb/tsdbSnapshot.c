@@ -28,6 +28,9 @@ typedef struct {
       SBlockIdx* pBlockIdx;
       SMapData   mBlock;
       int32_t    iBlock;
+      SDataBlk   dataBlk;  // current data block
+      int8_t     rawBlk;   // current data block is not loaded, rInfo.row only holds its min key
+      STSRow*    pKeyRow;
     };  // .data file
     struct {
       int32_t iStt;
@@ -45,6 +48,7 @@ struct STsdbSnapReader {
   int64_t ever;
   STsdbFS fs;
   int8_t  type;
+  int8_t  rawBlk;  // ship data blocks entirely in [sver, ever] without decoding them
   // for data file
   int8_t        dataDone;
   int32_t       fid;
@@ -61,6 +65,8 @@ struct STsdbSnapReader {
   int32_t      iDelIdx;
   SArray*      aDelData;  // SArray<SDelData>
   uint8_t*     aBuf[5];
+  // table filter, NULL means all tables
+  SHashObj* pUidFilter;
 };
 
 extern int32_t tRowInfoCmprFn(const void* p1, const void* p2);
@@ -74,6 +80,49 @@ static int32_t tFDataIterCmprFn(const SRBTreeNode* pNode1, const SRBTreeNode* pN
   return tRowInfoCmprFn(&pIter1->rInfo, &pIter2->rInfo);
 }
 
+// position the .data file iterator at the first row of pDataBlk in [sver, ever], if any
+static int32_t tsdbSnapLoadDataBlk(STsdbSnapReader* pReader, SFDataIter* pIter, SDataBlk* pDataBlk, int8_t* hasRow) {
+  int32_t code = 0;
+
+  *hasRow = 0;
+  if (pDataBlk->minVer > pReader->ever || pDataBlk->maxVer < pReader->sver) return code;
+
+  pIter->dataBlk = *pDataBlk;
+  pIter->rInfo.suid = pIter->pBlockIdx->suid;
+  pIter->rInfo.uid = pIter->pBlockIdx->uid;
+
+  if (pReader->rawBlk && pDataBlk->nSubBlock == 1 && pDataBlk->minVer >= pReader->sver &&
+      pDataBlk->maxVer <= pReader->ever) {
+    // all rows are shipped, decide whether the block can go as it is when it gets its turn
+    pIter->rawBlk = 1;
+    pIter->pKeyRow->ts = pDataBlk->minKey.ts;
+    pIter->rInfo.row = (TSDBROW){.type = 0, .version = pDataBlk->minKey.version, .pTSRow = pIter->pKeyRow};
+    tBlockDataReset(&pIter->bData);
+    pIter->iRow = 0;
+    *hasRow = 1;
+    return code;
+  }
+
+  pIter->rawBlk = 0;
+  code = tsdbReadDataBlockEx(pReader->pDataFReader, pDataBlk, &pIter->bData);
+  if (code) return code;
+
+  ASSERT(pIter->pBlockIdx->suid == pIter->bData.suid);
+  ASSERT(pIter->pBlockIdx->uid == pIter->bData.uid);
+
+  for (pIter->iRow = 0; pIter->iRow < pIter->bData.nRow; pIter->iRow++) {
+    int64_t rowVer = pIter->bData.aVersion[pIter->iRow];
+
+    if (rowVer >= pReader->sver && rowVer <= pReader->ever) {
+      pIter->rInfo.row = tsdbRowFromBlockData(&pIter->bData, pIter->iRow);
+      *hasRow = 1;
+      break;
+    }
+  }
+
+  return code;
+}
+
 static int32_t tsdbSnapReadOpenFile(STsdbSnapReader* pReader) {
   int32_t code = 0;
 
@@ -105,24 +154,11 @@ static int32_t tsdbSnapReadOpenFile(STsdbSnapReader* pReader) {
       SDataBlk dataBlk;
       tMapDataGetItemByIdx(&pIter->mBlock, pIter->iBlock, &dataBlk, tGetDataBlk);
 
-      if (dataBlk.minVer > pReader->ever || dataBlk.maxVer < pReader->sver) continue;
-
-      code = tsdbReadDataBlockEx(pReader->pDataFReader, &dataBlk, &pIter->bData);
+      int8_t hasRow = 0;
+      code = tsdbSnapLoadDataBlk(pReader, pIter, &dataBlk, &hasRow);
       if (code) goto _err;
 
-      ASSERT(pIter->pBlockIdx->suid == pIter->bData.suid);
-      ASSERT(pIter->pBlockIdx->uid == pIter->bData.uid);
-
-      for (pIter->iRow = 0; pIter->iRow < pIter->bData.nRow; pIter->iRow++) {
-        int64_t rowVer = pIter->bData.aVersion[pIter->iRow];
-
-        if (rowVer >= pReader->sver && rowVer <= pReader->ever) {
-          pIter->rInfo.suid = pIter->pBlockIdx->suid;
-          pIter->rInfo.uid = pIter->pBlockIdx->uid;
-          pIter->rInfo.row = tsdbRowFromBlockData(&pIter->bData, pIter->iRow);
-          goto _add_iter_and_break;
-        }
-      }
+      if (hasRow) goto _add_iter_and_break;
     }
 
     continue;
@@ -205,13 +241,11 @@ static int32_t tsdbSnapNextRow(STsdbSnapReader* pReader) {
             SDataBlk dataBlk;
             tMapDataGetItemByIdx(&pIter->mBlock, pIter->iBlock, &dataBlk, tGetDataBlk);
 
-            if (dataBlk.minVer > pReader->ever || dataBlk.maxVer < pReader->sver) continue;
-
-            code = tsdbReadDataBlockEx(pReader->pDataFReader, &dataBlk, &pIter->bData);
+            int8_t hasRow = 0;
+            code = tsdbSnapLoadDataBlk(pReader, pIter, &dataBlk, &hasRow);
             if (code) goto _err;
 
-            pIter->iRow = -1;
-            goto _find_row;
+            if (hasRow) goto _out;
           }
 
           pIter->iBlockIdx++;
@@ -275,7 +309,7 @@ static int32_t tsdbSnapCmprData(STsdbSnapReader* pReader, uint8_t** ppData) {
   ASSERT(pReader->bData.nRow);
 
   int32_t aBufN[5] = {0};
-  code = tCmprBlockData(&pReader->bData, TWO_STAGE_COMP, NULL, NULL, pReader->aBuf, aBufN);
+  code = tCmprBlockData(&pReader->bData, TWO_STAGE_COMP, NULL, NULL, pReader->aBuf, aBufN, NULL);
   if (code) goto _exit;
 
   int32_t size = aBufN[0] + aBufN[1] + aBufN[2] + aBufN[3];
@@ -302,6 +336,67 @@ _exit:
   return code;
 }
 
+static int32_t tsdbSnapReadRawBlock(STsdbSnapReader* pReader, uint8_t** ppData) {
+  int32_t     code = 0;
+  SFDataIter* pIter = pReader->pIter;
+  SDataBlk*   pDataBlk = &pIter->dataBlk;
+
+  ASSERT(pIter->type == SNAP_DATA_FILE_ITER && pIter->rawBlk);
+
+  // rows of the table in the .stt files fall into the block, merge them row by row
+  SFDataIter* pNext = (SFDataIter*)tRBTreeMin(&pReader->rbt);
+  if (pNext && pNext->rInfo.suid == pIter->rInfo.suid && pNext->rInfo.uid == pIter->rInfo.uid) {
+    TSDBKEY key = TSDBROW_KEY(&pNext->rInfo.row);
+    if (tsdbKeyCmprFn(&key, &pDataBlk->maxKey) <= 0) {
+      code = tsdbReadDataBlockEx(pReader->pDataFReader, pDataBlk, &pIter->bData);
+      if (code) goto _exit;
+
+      pIter->rawBlk = 0;
+      pIter->iRow = 0;
+      pIter->rInfo.row = tsdbRowFromBlockData(&pIter->bData, pIter->iRow);
+      goto _exit;
+    }
+  }
+
+  // TABLEID + checksum + SDataBlk + block data + block sma
+  int32_t szRaw = pDataBlk->aSubBlock[0].szBlock + pDataBlk->smaInfo.size;
+  int32_t size = sizeof(TABLEID) + sizeof(TSCKSUM) + tPutDataBlk(NULL, pDataBlk) + szRaw;
+  *ppData = taosMemoryMalloc(sizeof(SSnapDataHdr) + size);
+  if (*ppData == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  SSnapDataHdr* pHdr = (SSnapDataHdr*)*ppData;
+  pHdr->type = SNAP_DATA_TSDB_RAW;
+  pHdr->size = size;
+
+  uint8_t* p = pHdr->data;
+  *(TABLEID*)p = (TABLEID){.suid = pIter->rInfo.suid, .uid = pIter->rInfo.uid};
+  p += sizeof(TABLEID);
+  TSCKSUM* pCksum = (TSCKSUM*)p;
+  p += sizeof(TSCKSUM);
+  p += tPutDataBlk(p, pDataBlk);
+
+  code = tsdbReadDataBlockRaw(pReader->pDataFReader, pDataBlk, p);
+  if (code) {
+    taosMemoryFree(*ppData);
+    *ppData = NULL;
+    goto _exit;
+  }
+  *pCksum = taosCalcChecksum(0, p, szRaw);
+
+  code = tsdbSnapNextRow(pReader);
+  if (code) goto _exit;
+
+  if (tsdbSnapGetRow(pReader) == NULL) {
+    tsdbDataFReaderClose(&pReader->pDataFReader);
+  }
+
+_exit:
+  return code;
+}
+
 static int32_t tsdbSnapReadData(STsdbSnapReader* pReader, uint8_t** ppData) {
   int32_t code = 0;
   STsdb*  pTsdb = pReader->pTsdb;
@@ -323,6 +418,27 @@ static int32_t tsdbSnapReadData(STsdbSnapReader* pReader, uint8_t** ppData) {
     TABLEID     id = {.suid = pRowInfo->suid, .uid = pRowInfo->uid};
     SBlockData* pBlockData = &pReader->bData;
 
+    if (pReader->pUidFilter && taosHashGet(pReader->pUidFilter, &id.uid, sizeof(id.uid)) == NULL) {
+      // skip all rows of the table
+      while (pRowInfo && pRowInfo->suid == id.suid && pRowInfo->uid == id.uid) {
+        code = tsdbSnapNextRow(pReader);
+        if (code) goto _err;
+
+        pRowInfo = tsdbSnapGetRow(pReader);
+      }
+      if (pRowInfo == NULL) {
+        tsdbDataFReaderClose(&pReader->pDataFReader);
+      }
+      continue;
+    }
+
+    if (pReader->pIter->type == SNAP_DATA_FILE_ITER && pReader->pIter->rawBlk) {
+      code = tsdbSnapReadRawBlock(pReader, ppData);
+      if (code) goto _err;
+
+      if (*ppData) break;
+    }
+
     code = tsdbUpdateTableSchema(pTsdb->pVnode->pMeta, id.suid, id.uid, &pReader->skmTable);
     if (code) goto _err;
 
@@ -343,6 +459,7 @@ static int32_t tsdbSnapReadData(STsdbSnapReader* pReader, uint8_t** ppData) {
       }
 
       if (pBlockData->nRow >= 4096) break;
+      if (pReader->pIter->type == SNAP_DATA_FILE_ITER && pReader->pIter->rawBlk) break;
     }
 
     code = tsdbSnapCmprData(pReader, ppData);
@@ -390,6 +507,10 @@ static int32_t tsdbSnapReadDel(STsdbSnapReader* pReader, uint8_t** ppData) {
 
     pReader->iDelIdx++;
 
+    if (pReader->pUidFilter && taosHashGet(pReader->pUidFilter, &pDelIdx->uid, sizeof(pDelIdx->uid)) == NULL) {
+      continue;
+    }
+
     code = tsdbReadDelData(pReader->pDelFReader, pDelIdx, pReader->aDelData);
     if (code) goto _err;
 
@@ -458,6 +579,7 @@ int32_t tsdbSnapReaderOpen(STsdb* pTsdb, int64_t sver, int64_t ever, int8_t type
   pReader->sver = sver;
   pReader->ever = ever;
   pReader->type = type;
+  pReader->rawBlk = (type == SNAP_DATA_TSDB && tsSnapshotRawBlock) ? 1 : 0;
 
   code = taosThreadRwlockRdlock(&pTsdb->rwLock);
   if (code) {
@@ -488,6 +610,11 @@ int32_t tsdbSnapReaderOpen(STsdb* pTsdb, int64_t sver, int64_t ever, int8_t type
         code = TSDB_CODE_OUT_OF_MEMORY;
         TSDB_CHECK_CODE(code, lino, _exit);
       }
+      pIter->pKeyRow = (STSRow*)taosMemoryCalloc(1, sizeof(STSRow));
+      if (pIter->pKeyRow == NULL) {
+        code = TSDB_CODE_OUT_OF_MEMORY;
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
     } else {
       pIter->aSttBlk = taosArrayInit(0, sizeof(SSttBlk));
       if (pIter->aSttBlk == NULL) {
@@ -535,6 +662,8 @@ _exit:
   return code;
 }
 
+void tsdbSnapReaderSetFilter(STsdbSnapReader* pReader, SHashObj* pUidFilter) { pReader->pUidFilter = pUidFilter; }
+
 int32_t tsdbSnapReaderClose(STsdbSnapReader** ppReader) {
   int32_t          code = 0;
   STsdbSnapReader* pReader = *ppReader;
@@ -547,6 +676,7 @@ int32_t tsdbSnapReaderClose(STsdbSnapReader** ppReader) {
     if (iIter == 0) {
       taosArrayDestroy(pIter->aBlockIdx);
       tMapDataClear(&pIter->mBlock);
+      taosMemoryFree(pIter->pKeyRow);
     } else {
       taosArrayDestroy(pIter->aSttBlk);
     }
@@ -1076,6 +1206,47 @@ _err:
   return code;
 }
 
+static int32_t tsdbSnapWriteSwitchFile(STsdbSnapWriter* pWriter, int32_t fid) {
+  int32_t code = 0;
+
+  if (pWriter->dWriter.pWriter == NULL || pWriter->fid != fid) {
+    if (pWriter->dWriter.pWriter) {
+      ASSERT(fid > pWriter->fid);
+
+      code = tsdbSnapWriteCloseFile(pWriter);
+      if (code) goto _exit;
+    }
+
+    code = tsdbSnapWriteOpenFile(pWriter, fid);
+    if (code) goto _exit;
+  }
+
+_exit:
+  return code;
+}
+
+static int32_t tsdbSnapWriteBlockRows(STsdbSnapWriter* pWriter) {
+  int32_t     code = 0;
+  SBlockData* pBlockData = &pWriter->bData;
+
+  ASSERT(pBlockData->nRow > 0);
+
+  // Loop to handle each row
+  for (int32_t iRow = 0; iRow < pBlockData->nRow; iRow++) {
+    TSKEY   ts = pBlockData->aTSKEY[iRow];
+    int32_t fid = tsdbKeyFid(ts, pWriter->minutes, pWriter->precision);
+
+    code = tsdbSnapWriteSwitchFile(pWriter, fid);
+    if (code) goto _exit;
+
+    code = tsdbSnapWriteRowData(pWriter, iRow);
+    if (code) goto _exit;
+  }
+
+_exit:
+  return code;
+}
+
 static int32_t tsdbSnapWriteData(STsdbSnapWriter* pWriter, uint8_t* pData, uint32_t nData) {
   int32_t     code = 0;
   STsdb*      pTsdb = pWriter->pTsdb;
@@ -1086,34 +1257,137 @@ static int32_t tsdbSnapWriteData(STsdbSnapWriter* pWriter, uint8_t* pData, uint3
   code = tDecmprBlockData(pHdr->data, pHdr->size, pBlockData, pWriter->aBuf);
   if (code) goto _err;
 
-  ASSERT(pBlockData->nRow > 0);
+  code = tsdbSnapWriteBlockRows(pWriter);
+  if (code) goto _err;
 
-  // Loop to handle each row
-  for (int32_t iRow = 0; iRow < pBlockData->nRow; iRow++) {
-    TSKEY   ts = pBlockData->aTSKEY[iRow];
-    int32_t fid = tsdbKeyFid(ts, pWriter->minutes, pWriter->precision);
+  return code;
+
+_err:
+  tsdbError("vgId:%d, vnode snapshot tsdb write data for %s failed since %s", TD_VID(pTsdb->pVnode), pTsdb->path,
+            tstrerror(code));
+  return code;
+}
 
-    if (pWriter->dWriter.pWriter == NULL || pWriter->fid != fid) {
-      if (pWriter->dWriter.pWriter) {
-        ASSERT(fid > pWriter->fid);
+// SNAP_DATA_TSDB_RAW
+// append the incoming block to the table as it is, unless it overlaps the data the vnode already has
+static int32_t tsdbSnapWriteRawBlk(STsdbSnapWriter* pWriter, SDataBlk* pDataBlk, const uint8_t* pRaw, int8_t* done) {
+  int32_t     code = 0;
+  int32_t     lino = 0;
+  SBlockData* pBData = &pWriter->dWriter.bData;
 
-        code = tsdbSnapWriteCloseFile(pWriter);
-        if (code) goto _err;
+  *done = 0;
+  if (pWriter->dReader.pBlockIdx && tTABLEIDCmprFn(pWriter->dReader.pBlockIdx, &pWriter->id) == 0) {
+    // move existing rows before the block
+    for (; pWriter->dReader.iRow < pWriter->dReader.bData.nRow; pWriter->dReader.iRow++) {
+      TSDBROW row = tsdbRowFromBlockData(&pWriter->dReader.bData, pWriter->dReader.iRow);
+      TSDBKEY key = TSDBROW_KEY(&row);
+
+      if (tsdbKeyCmprFn(&key, &pDataBlk->minKey) >= 0) {
+        if (tsdbKeyCmprFn(&key, &pDataBlk->maxKey) <= 0) goto _exit;
+        break;
       }
 
-      code = tsdbSnapWriteOpenFile(pWriter, fid);
-      if (code) goto _err;
+      code = tBlockDataAppendRow(pBData, &row, NULL, pWriter->id.uid);
+      TSDB_CHECK_CODE(code, lino, _exit);
+
+      if (pBData->nRow >= pWriter->maxRow) {
+        code = tsdbWriteDataBlock(pWriter->dWriter.pWriter, pBData, &pWriter->dWriter.mDataBlk, pWriter->cmprAlg);
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
     }
 
-    code = tsdbSnapWriteRowData(pWriter, iRow);
-    if (code) goto _err;
+    // move existing blocks before the block
+    if (pWriter->dReader.iRow >= pWriter->dReader.bData.nRow) {
+      for (; pWriter->dReader.iDataBlk < pWriter->dReader.mDataBlk.nItem; pWriter->dReader.iDataBlk++) {
+        SDataBlk dataBlk;
+        tMapDataGetItemByIdx(&pWriter->dReader.mDataBlk, pWriter->dReader.iDataBlk, &dataBlk, tGetDataBlk);
+
+        if (tsdbKeyCmprFn(&dataBlk.maxKey, &pDataBlk->minKey) >= 0) {
+          if (tsdbKeyCmprFn(&dataBlk.minKey, &pDataBlk->maxKey) <= 0) goto _exit;
+          break;
+        }
+
+        code = tsdbWriteDataBlock(pWriter->dWriter.pWriter, pBData, &pWriter->dWriter.mDataBlk, pWriter->cmprAlg);
+        TSDB_CHECK_CODE(code, lino, _exit);
+
+        code = tMapDataPutItem(&pWriter->dWriter.mDataBlk, &dataBlk, tPutDataBlk);
+        TSDB_CHECK_CODE(code, lino, _exit);
+      }
+    }
   }
 
+  code = tsdbWriteDataBlock(pWriter->dWriter.pWriter, pBData, &pWriter->dWriter.mDataBlk, pWriter->cmprAlg);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tsdbWriteDataBlockRaw(pWriter->dWriter.pWriter, pDataBlk, pRaw);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tMapDataPutItem(&pWriter->dWriter.mDataBlk, pDataBlk, tPutDataBlk);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  *done = 1;
+
+_exit:
+  if (code) {
+    tsdbError("vgId:%d %s failed at line %d since %s", TD_VID(pWriter->pTsdb->pVnode), __func__, lino, tstrerror(code));
+  }
   return code;
+}
 
-_err:
-  tsdbError("vgId:%d, vnode snapshot tsdb write data for %s failed since %s", TD_VID(pTsdb->pVnode), pTsdb->path,
-            tstrerror(code));
+static int32_t tsdbSnapWriteRawData(STsdbSnapWriter* pWriter, uint8_t* pData, uint32_t nData) {
+  int32_t code = 0;
+  int32_t lino = 0;
+  STsdb*  pTsdb = pWriter->pTsdb;
+
+  SSnapDataHdr* pHdr = (SSnapDataHdr*)pData;
+  uint8_t*      p = pHdr->data;
+  TABLEID       id = *(TABLEID*)p;
+  p += sizeof(TABLEID);
+  TSCKSUM cksum = *(TSCKSUM*)p;
+  p += sizeof(TSCKSUM);
+  SDataBlk dataBlk;
+  p += tGetDataBlk(p, &dataBlk);
+
+  int32_t szRaw = dataBlk.aSubBlock[0].szBlock + dataBlk.smaInfo.size;
+  if (dataBlk.nSubBlock != 1 || p + szRaw != pHdr->data + pHdr->size || taosCalcChecksum(0, p, szRaw) != cksum) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  int32_t fid = tsdbKeyFid(dataBlk.minKey.ts, pWriter->minutes, pWriter->precision);
+  ASSERT(fid == tsdbKeyFid(dataBlk.maxKey.ts, pWriter->minutes, pWriter->precision));
+
+  code = tsdbSnapWriteSwitchFile(pWriter, fid);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  if (tTABLEIDCmprFn(&pWriter->id, &id) != 0) {
+    code = tsdbSnapWriteTableDataEnd(pWriter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  if (pWriter->id.suid == 0 && pWriter->id.uid == 0) {
+    code = tsdbSnapWriteTableDataStart(pWriter, &id);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  int8_t done = 0;
+  code = tsdbSnapWriteRawBlk(pWriter, &dataBlk, p, &done);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  if (!done) {
+    // overlap with the data of the vnode, merge row by row
+    code = tDecmprBlockData(p, dataBlk.aSubBlock[0].szBlock, &pWriter->bData, pWriter->aBuf);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = tsdbSnapWriteBlockRows(pWriter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+_exit:
+  if (code) {
+    tsdbError("vgId:%d, vnode snapshot tsdb write raw data for %s failed at line %d since %s", TD_VID(pTsdb->pVnode),
+              pTsdb->path, lino, tstrerror(code));
+  }
   return code;
 }
 
@@ -1443,6 +1717,11 @@ int32_t tsdbSnapWrite(STsdbSnapWriter* pWriter, uint8_t* pData, uint32_t nData)
     code = tsdbSnapWriteData(pWriter, pData, nData);
     if (code) goto _err;
 
+    goto _exit;
+  } else if (pHdr->type == SNAP_DATA_TSDB_RAW) {
+    code = tsdbSnapWriteRawData(pWriter, pData, nData);
+    if (code) goto _err;
+
     goto _exit;
   } else {
     if (pWriter->dWriter.pWriter) {
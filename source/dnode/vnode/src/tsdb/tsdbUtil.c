@@ -360,8 +360,11 @@ int32_t tPutBlockCol(uint8_t *p, void *ph) {
   n += tPutI16v(p ? p + n : p, pBlockCol->cid);
   n += tPutI8(p ? p + n : p, pBlockCol->type);
   n += tPutI8(p ? p + n : p, pBlockCol->smaOn);
-  n += tPutI8(p ? p + n : p, pBlockCol->flag);
+  n += tPutI8(p ? p + n : p, pBlockCol->codec ? (pBlockCol->flag | TSDB_BLOCK_COL_CODEC) : pBlockCol->flag);
   n += tPutI32v(p ? p + n : p, pBlockCol->szOrigin);
+  if (pBlockCol->codec) {
+    n += tPutI8(p ? p + n : p, pBlockCol->codec);
+  }
 
   if (pBlockCol->flag != HAS_NULL) {
     if (pBlockCol->flag != HAS_VALUE) {
@@ -392,6 +395,11 @@ int32_t tGetBlockCol(uint8_t *p, void *ph) {
   n += tGetI8(p + n, &pBlockCol->smaOn);
   n += tGetI8(p + n, &pBlockCol->flag);
   n += tGetI32v(p + n, &pBlockCol->szOrigin);
+  pBlockCol->codec = CODEC_NONE;
+  if (pBlockCol->flag & TSDB_BLOCK_COL_CODEC) {
+    pBlockCol->flag &= ~TSDB_BLOCK_COL_CODEC;
+    n += tGetI8(p + n, &pBlockCol->codec);
+  }
 
   ASSERT(pBlockCol->flag && (pBlockCol->flag != HAS_NONE));
 
@@ -802,7 +810,7 @@ int32_t tRowMergerGetRow(SRowMerger *pMerger, STSRow **ppRow) {
 }
 
 // delete skyline ======================================================
-static int32_t tsdbMergeSkyline(SArray *aSkyline1, SArray *aSkyline2, SArray *aSkyline) {
+int32_t tsdbMergeSkyline(SArray *aSkyline1, SArray *aSkyline2, SArray *aSkyline) {
   int32_t  code = 0;
   int32_t  i1 = 0;
   int32_t  n1 = taosArrayGetSize(aSkyline1);
@@ -1294,8 +1302,36 @@ void tBlockDataGetColData(SBlockData *pBlockData, int16_t cid, SColData **ppColD
   *ppColData = NULL;
 }
 
+// The codec chosen by sampling a column is reused for the next blocks of the same column written to a file set, and
+// the column is sampled again every TSDB_CODEC_RESAMPLE_BLOCKS blocks or once the codec stops shrinking its values.
+#define TSDB_CODEC_RESAMPLE_BLOCKS 32
+
+typedef struct {
+  int64_t suid;  // uid of a normal table
+  int64_t cid;
+} STsdbCodecKey;
+
+typedef struct {
+  int8_t  codec;
+  int32_t nBlock;  // blocks written with the codec since it was chosen
+} STsdbCodecHint;
+
+static STsdbCodecHint *tsdbGetCodecHint(SHashObj *pCodecHint, SBlockData *pBlockData, SColData *pColData) {
+  if (pCodecHint == NULL || !tsAdaptiveCodec || IS_VAR_DATA_TYPE(pColData->type)) return NULL;
+
+  STsdbCodecKey   key = {.suid = pBlockData->suid ? pBlockData->suid : pBlockData->uid, .cid = pColData->cid};
+  STsdbCodecHint *pHint = taosHashGet(pCodecHint, &key, sizeof(key));
+  if (pHint == NULL) {
+    STsdbCodecHint hint = {0};
+    if (taosHashPut(pCodecHint, &key, sizeof(key), &hint, sizeof(hint)) != 0) return NULL;
+    pHint = taosHashGet(pCodecHint, &key, sizeof(key));
+  }
+
+  return pHint;
+}
+
 int32_t tCmprBlockData(SBlockData *pBlockData, int8_t cmprAlg, uint8_t **ppOut, int32_t *szOut, uint8_t *aBuf[],
-                       int32_t aBufN[]) {
+                       int32_t aBufN[], SHashObj *pCodecHint) {
   int32_t code = 0;
 
   SDiskDataHdr hdr = {.delimiter = TSDB_FILE_DLMT,
@@ -1322,9 +1358,21 @@ int32_t tCmprBlockData(SBlockData *pBlockData, int8_t cmprAlg, uint8_t **ppOut,
                           .szOrigin = pColData->nData};
 
     if (pColData->flag != HAS_NULL) {
+      STsdbCodecHint *pHint = tsdbGetCodecHint(pCodecHint, pBlockData, pColData);
+      if (pHint && pHint->nBlock < TSDB_CODEC_RESAMPLE_BLOCKS) {
+        blockCol.codec = pHint->codec;
+      }
+
       code = tsdbCmprColData(pColData, cmprAlg, &blockCol, &aBuf[0], aBufN[0], &aBuf[2]);
       if (code) goto _exit;
 
+      if (pHint && pHint->nBlock < TSDB_CODEC_RESAMPLE_BLOCKS && pHint->codec == blockCol.codec) {
+        pHint->nBlock++;
+      } else if (pHint) {
+        pHint->codec = blockCol.codec;
+        pHint->nBlock = 0;
+      }
+
       blockCol.offset = aBufN[0];
       aBufN[0] = aBufN[0] + blockCol.szBitmap + blockCol.szOffset + blockCol.szValue;
     }
@@ -1683,15 +1731,277 @@ _exit:
   return code;
 }
 
+int32_t tsdbCmprCodecData(uint8_t *pIn, int32_t szIn, int8_t type, uint8_t **ppOut, int32_t nOut, int32_t *szOut,
+                          int8_t *codec, uint8_t **ppBuf) {
+  int32_t code = 0;
+  int32_t size = szIn + COMP_OVERFLOW_BYTES;
+
+  ASSERT(szIn > 0 && ppOut);
+
+  code = tRealloc(ppOut, nOut + size);
+  if (code) goto _exit;
+
+  code = tRealloc(ppBuf, size);
+  if (code) goto _exit;
+
+  *szOut =
+      tsCompressAdaptive(type, pIn, szIn, szIn / tDataTypes[type].bytes, *ppOut + nOut, size, *ppBuf, size, codec);
+  if (*szOut <= 0) {
+    code = TSDB_CODE_COMPRESS_ERROR;
+    goto _exit;
+  }
+
+_exit:
+  return code;
+}
+
+int32_t tsdbDecmprCodecData(uint8_t *pIn, int32_t szIn, int8_t type, int8_t codec, uint8_t **ppOut, int32_t szOut,
+                            uint8_t **ppBuf) {
+  int32_t code = 0;
+
+  code = tRealloc(ppOut, szOut);
+  if (code) goto _exit;
+
+  code = tRealloc(ppBuf, szOut + COMP_OVERFLOW_BYTES);
+  if (code) goto _exit;
+
+  int32_t size = tsDecompressCodec(type, codec, pIn, szIn, szOut / tDataTypes[type].bytes, *ppOut, szOut, *ppBuf,
+                                   szOut + COMP_OVERFLOW_BYTES);
+  if (size != szOut) {
+    code = TSDB_CODE_COMPRESS_ERROR;
+    goto _exit;
+  }
+
+_exit:
+  return code;
+}
+
+// Dictionary encoding of var-length columns ==============================
+// A var-length column with few distinct values in a block is stored as the compressed payload
+//   nDict | (len, value) * nDict | nBit | code * nVal (bit-packed, LSB first)
+// prefixed by the raw payload size. It has no offset part, so szOffset == 0 marks a dictionary
+// encoded column (see TSDB_BLOCK_COL_IS_DICT). It is a new column encoding that older versions
+// can not read, so it is written only when dictCodec is enabled (tsDictCodec).
+// Follow-up: the codes are expanded back to values when the block is read, so the executor only
+// sees plain values. A filter could be evaluated once per dictionary entry and then matched on the
+// codes, and a group by could hash the codes instead of the values, once the codes reach it.
+#define TSDB_DICT_MAX_SIZE  1024
+#define TSDB_DICT_MAX_BIT   10  // bits of the largest code, TSDB_DICT_MAX_SIZE - 1
+#define TSDB_DICT_HASH_SIZE (TSDB_DICT_MAX_SIZE * 2)
+#define TSDB_DICT_MIN_ROWS  16
+
+typedef struct {
+  int32_t nDict;
+  int32_t aOffset[TSDB_DICT_MAX_SIZE];  // offset of the first occurrence in SColData.pData
+  int32_t aLen[TSDB_DICT_MAX_SIZE];
+  int16_t aSlot[TSDB_DICT_HASH_SIZE];  // dictionary code + 1, 0 for an empty slot
+} STsdbDict;
+
+static FORCE_INLINE int32_t tsdbColDataValueLen(SColData *pColData, int32_t iVal) {
+  return ((iVal < pColData->nVal - 1) ? pColData->aOffset[iVal + 1] : pColData->nData) - pColData->aOffset[iVal];
+}
+
+static int32_t tsdbDictGetOrAdd(STsdbDict *pDict, uint8_t *pData, int32_t offset, int32_t len) {
+  uint32_t iSlot = MurmurHash3_32((const char *)pData + offset, len) % TSDB_DICT_HASH_SIZE;
+
+  while (pDict->aSlot[iSlot]) {
+    int32_t code = pDict->aSlot[iSlot] - 1;
+    if (pDict->aLen[code] == len && memcmp(pData + pDict->aOffset[code], pData + offset, len) == 0) return code;
+    iSlot = (iSlot + 1) % TSDB_DICT_HASH_SIZE;
+  }
+
+  if (pDict->nDict >= TSDB_DICT_MAX_SIZE) return -1;
+
+  pDict->aOffset[pDict->nDict] = offset;
+  pDict->aLen[pDict->nDict] = len;
+  pDict->aSlot[iSlot] = pDict->nDict + 1;
+  return pDict->nDict++;
+}
+
+static int32_t tsdbCmprDictColData(SColData *pColData, int8_t cmprAlg, SBlockCol *pBlockCol, uint8_t **ppOut,
+                                   int32_t nOut, uint8_t **ppBuf, int8_t *encoded) {
+  int32_t    code = 0;
+  STsdbDict *pDict = NULL;
+  int32_t   *aCode = NULL;
+  uint8_t   *pPayload = NULL;
+
+  *encoded = 0;
+  if (pColData->nVal < TSDB_DICT_MIN_ROWS || pColData->nData == 0) goto _exit;
+
+  pDict = (STsdbDict *)taosMemoryCalloc(1, sizeof(*pDict));
+  aCode = (int32_t *)taosMemoryMalloc(sizeof(int32_t) * pColData->nVal);
+  if (pDict == NULL || aCode == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  // build the dictionary, give up once there are too many distinct values
+  int32_t szDict = 0;
+  for (int32_t iVal = 0; iVal < pColData->nVal; iVal++) {
+    int32_t len = tsdbColDataValueLen(pColData, iVal);
+    int32_t nDict = pDict->nDict;
+
+    aCode[iVal] = tsdbDictGetOrAdd(pDict, pColData->pData, pColData->aOffset[iVal], len);
+    if (aCode[iVal] < 0) goto _exit;
+    if (pDict->nDict > nDict) {
+      szDict += tPutBinary(NULL, NULL, len);
+    }
+  }
+
+  int8_t  nBit = (pDict->nDict > 1) ? (32 - BUILDIN_CLZ((uint32_t)(pDict->nDict - 1))) : 0;
+  int32_t szCode = (int32_t)(((int64_t)pColData->nVal * nBit + 7) / 8) + 2;  // 2 bytes to unpack without bound checks
+  int32_t szPayload = tPutI32v(NULL, pDict->nDict) + szDict + tPutI8(NULL, nBit) + szCode;
+
+  // only worth it when the payload is at most half of the offsets plus values
+  if (szPayload > (pColData->nData + (int32_t)sizeof(int32_t) * pColData->nVal) / 2) goto _exit;
+
+  pPayload = (uint8_t *)taosMemoryCalloc(1, szPayload);
+  if (pPayload == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  int32_t n = 0;
+  n += tPutI32v(pPayload + n, pDict->nDict);
+  for (int32_t iDict = 0; iDict < pDict->nDict; iDict++) {
+    n += tPutBinary(pPayload + n, pColData->pData + pDict->aOffset[iDict], pDict->aLen[iDict]);
+  }
+  n += tPutI8(pPayload + n, nBit);
+  if (nBit) {
+    uint8_t *pCode = pPayload + n;
+    for (int32_t iVal = 0; iVal < pColData->nVal; iVal++) {
+      int64_t  bit = (int64_t)iVal * nBit;
+      uint32_t v = ((uint32_t)aCode[iVal]) << (bit & 7);
+      uint8_t *q = pCode + (bit >> 3);
+      q[0] |= (uint8_t)v;
+      q[1] |= (uint8_t)(v >> 8);
+      q[2] |= (uint8_t)(v >> 16);
+    }
+  }
+  n += szCode;
+  ASSERT(n == szPayload);
+
+  // raw payload size + compressed payload
+  code = tRealloc(ppOut, nOut + sizeof(int32_t));
+  if (code) goto _exit;
+  tPutI32(*ppOut + nOut, szPayload);
+
+  int32_t szValue = 0;
+  code = tsdbCmprData(pPayload, szPayload, TSDB_DATA_TYPE_BINARY, cmprAlg, ppOut, nOut + sizeof(int32_t), &szValue,
+                      ppBuf);
+  if (code) goto _exit;
+
+  pBlockCol->szOffset = 0;
+  pBlockCol->szValue = sizeof(int32_t) + szValue;
+  *encoded = 1;
+
+_exit:
+  taosMemoryFree(pPayload);
+  taosMemoryFree(aCode);
+  taosMemoryFree(pDict);
+  return code;
+}
+
+static int32_t tsdbDecmprDictColData(uint8_t *pIn, SBlockCol *pBlockCol, int8_t cmprAlg, SColData *pColData,
+                                     uint8_t **ppBuf) {
+  int32_t   code = 0;
+  uint8_t  *pPayload = NULL;
+  uint8_t **aValue = NULL;
+  uint32_t *aLen = NULL;
+
+  int32_t szPayload;
+  int32_t n = tGetI32(pIn, &szPayload);
+  code = tsdbDecmprData(pIn + n, pBlockCol->szValue - n, TSDB_DATA_TYPE_BINARY, cmprAlg, &pPayload, szPayload, ppBuf);
+  if (code) goto _exit;
+
+  // dictionary
+  int32_t nDict;
+  n = tGetI32v(pPayload, &nDict);
+  if (nDict <= 0 || nDict > TSDB_DICT_MAX_SIZE) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    goto _exit;
+  }
+
+  aValue = (uint8_t **)taosMemoryMalloc(sizeof(uint8_t *) * nDict);
+  aLen = (uint32_t *)taosMemoryMalloc(sizeof(uint32_t) * nDict);
+  if (aValue == NULL || aLen == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+  for (int32_t iDict = 0; iDict < nDict; iDict++) {
+    if (n >= szPayload) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      goto _exit;
+    }
+    n += tGetBinary(pPayload + n, &aValue[iDict], &aLen[iDict]);
+    if (n > szPayload) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      goto _exit;
+    }
+  }
+
+  int8_t nBit;
+  if (n >= szPayload) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    goto _exit;
+  }
+  n += tGetI8(pPayload + n, &nBit);
+  if (nBit < 0 || nBit > TSDB_DICT_MAX_BIT || n + ((int64_t)pColData->nVal * nBit + 7) / 8 + 2 > szPayload) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    goto _exit;
+  }
+  uint8_t *pCode = pPayload + n;
+  uint32_t mask = (1u << nBit) - 1;
+
+  // codes to offsets + values
+  code = tRealloc((uint8_t **)&pColData->aOffset, sizeof(int32_t) * pColData->nVal);
+  if (code) goto _exit;
+  code = tRealloc(&pColData->pData, pColData->nData);
+  if (code) goto _exit;
+
+  int32_t offset = 0;
+  for (int32_t iVal = 0; iVal < pColData->nVal; iVal++) {
+    uint32_t c = 0;
+    if (nBit) {
+      int64_t        bit = (int64_t)iVal * nBit;
+      const uint8_t *q = pCode + (bit >> 3);
+      c = (((uint32_t)q[0] | ((uint32_t)q[1] << 8) | ((uint32_t)q[2] << 16)) >> (bit & 7)) & mask;
+    }
+
+    if (c >= nDict || offset + aLen[c] > pColData->nData) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      goto _exit;
+    }
+
+    pColData->aOffset[iVal] = offset;
+    memcpy(pColData->pData + offset, aValue[c], aLen[c]);
+    offset += aLen[c];
+  }
+
+  if (offset != pColData->nData) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+  }
+
+_exit:
+  taosMemoryFree(aLen);
+  taosMemoryFree(aValue);
+  tFree(pPayload);
+  return code;
+}
+
 int32_t tsdbCmprColData(SColData *pColData, int8_t cmprAlg, SBlockCol *pBlockCol, uint8_t **ppOut, int32_t nOut,
                         uint8_t **ppBuf) {
   int32_t code = 0;
 
   ASSERT(pColData->flag && (pColData->flag != HAS_NONE) && (pColData->flag != HAS_NULL));
 
+  // the codec chosen for the previous blocks of the column, if any, is tried before sampling again
+  int8_t codec = pBlockCol->codec;
+
   pBlockCol->szBitmap = 0;
   pBlockCol->szOffset = 0;
   pBlockCol->szValue = 0;
+  pBlockCol->codec = 0;
 
   int32_t size = 0;
   // bitmap
@@ -1709,6 +2019,16 @@ int32_t tsdbCmprColData(SColData *pColData, int8_t cmprAlg, SBlockCol *pBlockCol
   }
   size += pBlockCol->szBitmap;
 
+  // dictionary
+  if (tsDictCodec && IS_VAR_DATA_TYPE(pColData->type) && (pColData->flag & HAS_VALUE)) {
+    int8_t encoded = 0;
+
+    code = tsdbCmprDictColData(pColData, cmprAlg, pBlockCol, ppOut, nOut + size, ppBuf, &encoded);
+    if (code) goto _exit;
+
+    if (encoded) goto _exit;
+  }
+
   // offset
   if (IS_VAR_DATA_TYPE(pColData->type)) {
     code = tsdbCmprData((uint8_t *)pColData->aOffset, sizeof(int32_t) * pColData->nVal, TSDB_DATA_TYPE_INT, cmprAlg,
@@ -1719,8 +2039,14 @@ int32_t tsdbCmprColData(SColData *pColData, int8_t cmprAlg, SBlockCol *pBlockCol
 
   // value
   if ((pColData->flag != (HAS_NULL | HAS_NONE)) && pColData->nData) {
-    code = tsdbCmprData((uint8_t *)pColData->pData, pColData->nData, pColData->type, cmprAlg, ppOut, nOut + size,
-                        &pBlockCol->szValue, ppBuf);
+    if (tsAdaptiveCodec && cmprAlg != NO_COMPRESSION && !IS_VAR_DATA_TYPE(pColData->type)) {
+      pBlockCol->codec = codec;
+      code = tsdbCmprCodecData((uint8_t *)pColData->pData, pColData->nData, pColData->type, ppOut, nOut + size,
+                               &pBlockCol->szValue, &pBlockCol->codec, ppBuf);
+    } else {
+      code = tsdbCmprData((uint8_t *)pColData->pData, pColData->nData, pColData->type, cmprAlg, ppOut, nOut + size,
+                          &pBlockCol->szValue, ppBuf);
+    }
     if (code) goto _exit;
   }
   size += pBlockCol->szValue;
@@ -1755,6 +2081,12 @@ int32_t tsdbDecmprColData(uint8_t *pIn, SBlockCol *pBlockCol, int8_t cmprAlg, in
   }
   p += pBlockCol->szBitmap;
 
+  // dictionary
+  if (TSDB_BLOCK_COL_IS_DICT(pBlockCol)) {
+    code = tsdbDecmprDictColData(p, pBlockCol, cmprAlg, pColData, ppBuf);
+    goto _exit;
+  }
+
   // offset
   if (pBlockCol->szOffset) {
     code = tsdbDecmprData(p, pBlockCol->szOffset, TSDB_DATA_TYPE_INT, cmprAlg, (uint8_t **)&pColData->aOffset,
@@ -1765,7 +2097,12 @@ int32_t tsdbDecmprColData(uint8_t *pIn, SBlockCol *pBlockCol, int8_t cmprAlg, in
 
   // value
   if (pBlockCol->szValue) {
-    code = tsdbDecmprData(p, pBlockCol->szValue, pColData->type, cmprAlg, &pColData->pData, pColData->nData, ppBuf);
+    if (pBlockCol->codec) {
+      code = tsdbDecmprCodecData(p, pBlockCol->szValue, pColData->type, pBlockCol->codec, &pColData->pData,
+                                 pColData->nData, ppBuf);
+    } else {
+      code = tsdbDecmprData(p, pBlockCol->szValue, pColData->type, cmprAlg, &pColData->pData, pColData->nData, ppBuf);
+    }
     if (code) goto _exit;
   }
   p += pBlockCol->szValue;
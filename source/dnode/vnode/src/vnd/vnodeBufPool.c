@@ -109,6 +109,11 @@ void vnodeBufPoolReset(SVBufPool *pPool) {
   pPool->ptr = pPool->node.data;
 }
 
+int64_t vnodeGetMemtableUsage(SVnode *pVnode) {
+  SVBufPool *pPool = pVnode->inUse;
+  return pPool ? pPool->size : 0;
+}
+
 void *vnodeBufPoolMalloc(SVBufPool *pPool, int size) {
   SVBufPoolNode *pNode;
   void          *p = NULL;
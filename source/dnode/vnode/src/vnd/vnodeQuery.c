@@ -388,10 +388,12 @@ int32_t vnodeGetLoad(SVnode *pVnode, SVnodeLoad *pLoad) {
   pLoad->cacheUsage = tsdbCacheGetUsage(pVnode);
   pLoad->numOfTables = metaGetTbNum(pVnode->pMeta);
   pLoad->numOfTimeSeries = metaGetTimeSeriesNum(pVnode->pMeta);
-  pLoad->totalStorage = (int64_t)3 * 1073741824;
-  pLoad->compStorage = (int64_t)2 * 1073741824;
-  pLoad->pointsWritten = 100;
-  pLoad->numOfSelectReqs = 1;
+  pLoad->compStorage = tsdbFSSize(pVnode->pTsdb);
+  pLoad->totalStorage = pLoad->compStorage;
+  pLoad->pointsWritten = atomic_load_64(&pVnode->statis.nWriteRows);
+  pLoad->numOfSelectReqs = atomic_load_64(&pVnode->statis.nSelect);
+  pLoad->queryElapsedTime = atomic_load_64(&pVnode->statis.nQueryTime);
+  pLoad->memtableUsage = vnodeGetMemtableUsage(pVnode);
   pLoad->numOfInsertReqs = atomic_load_64(&pVnode->statis.nInsert);
   pLoad->numOfInsertSuccessReqs = atomic_load_64(&pVnode->statis.nInsertSuccess);
   pLoad->numOfBatchInsertReqs = atomic_load_64(&pVnode->statis.nBatchInsert);
@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "meta.h"
+#include "vnd.h"
+
+/*
+ * Online split of a vnode by hash range. The new vnode is seeded from a filtered snapshot of the source, then
+ * caught up by replaying the source WAL. The cut-over itself is a TDMT_VND_ALTER_HASHRANGE entry proposed to the
+ * source: when it is applied, the remaining WAL is replayed, the new vnode is committed at that version and the
+ * source shrinks its hash range, so no write is lost or applied twice.
+ */
+
+#define VND_SPLIT_CATCHUP_LAG    1024
+#define VND_SPLIT_CATCHUP_ROUNDS 16
+#define VND_SPLIT_WAIT_MS        1000
+#define VND_SPLIT_WAIT_ROUNDS    60
+
+struct SVSplit {
+  SVnode     *pVnode;  // source vnode
+  SVnode     *pNew;    // new vnode, not started yet
+  SHashObj   *pUids;   // tables moved to the new vnode by the seed
+  SWalRef    *pRef;
+  SWalReader *pWalReader;
+  int64_t     ver;  // last source version applied to the new vnode
+  int32_t     code;
+  tsem_t      sem;
+};
+
+int32_t vnodeSplitCreate(SVnode *pVnode, const char *path, STfs *pTfs, SAlterVnodeHashRangeReq *pReq) {
+  SVnodeCfg cfg = pVnode->config;
+
+  cfg.vgId = pReq->dstVgId;
+  cfg.walCfg.vgId = pReq->dstVgId;
+  cfg.hashBegin = pReq->dstHashBegin;
+  cfg.hashEnd = pReq->dstHashEnd;
+  memset(&cfg.vndStats, 0, sizeof(cfg.vndStats));
+
+  // the new vnode starts with the local replica only, mnode adds the others later
+  cfg.syncCfg.replicaNum = 1;
+  cfg.syncCfg.myIndex = 0;
+  cfg.syncCfg.nodeInfo[0] = pVnode->config.syncCfg.nodeInfo[pVnode->config.syncCfg.myIndex];
+  memset(&cfg.syncCfg.nodeInfo[1], 0, sizeof(SNodeInfo) * (TSDB_MAX_REPLICA - 1));
+
+  vInfo("vgId:%d, create vnode:%d for split, hash begin:%u end:%u", TD_VID(pVnode), cfg.vgId, cfg.hashBegin,
+        cfg.hashEnd);
+  return vnodeCreate(path, &cfg, pTfs);
+}
+
+bool vnodeSplitIsDone(SVnode *pVnode, SAlterVnodeHashRangeReq *pReq) {
+  return pVnode->config.hashBegin == pReq->srcHashBegin && pVnode->config.hashEnd == pReq->srcHashEnd;
+}
+
+static bool vnodeSplitKeepMeta(SVSplit *pSplit, uint8_t *pData) {
+  SSnapDataHdr *pHdr = (SSnapDataHdr *)pData;
+  SMetaEntry    me = {0};
+  SDecoder      dc = {0};
+  char          tbFName[TSDB_TABLE_FNAME_LEN];
+  bool          keep = true;
+
+  tDecoderInit(&dc, pHdr->data, pHdr->size);
+  if (metaDecodeEntry(&dc, &me) < 0) {
+    tDecoderClear(&dc);
+    return true;
+  }
+
+  // super tables go to both vnodes, child and normal tables follow their hash
+  if (me.type == TSDB_CHILD_TABLE || me.type == TSDB_NORMAL_TABLE) {
+    snprintf(tbFName, sizeof(tbFName), "%s.%s", pSplit->pNew->config.dbname, me.name);
+    if (vnodeValidateTableHash(pSplit->pNew, tbFName) == 0) {
+      taosHashPut(pSplit->pUids, &me.uid, sizeof(me.uid), NULL, 0);
+    } else {
+      keep = false;
+    }
+  }
+
+  tDecoderClear(&dc);
+  return keep;
+}
+
+static int32_t vnodeSplitSeed(SVSplit *pSplit, int64_t ever) {
+  int32_t          code = 0;
+  SVnode          *pVnode = pSplit->pVnode;
+  SMetaSnapReader *pMetaReader = NULL;
+  STsdbSnapReader *pTsdbReader = NULL;
+  SVSnapWriter    *pWriter = NULL;
+  uint8_t         *pData = NULL;
+  int64_t          index = 0;
+
+  code = vnodeSnapWriterOpen(pSplit->pNew, 0, ever, &pWriter);
+  if (code) goto _err;
+
+  // META
+  code = metaSnapReaderOpen(pVnode->pMeta, 0, ever, &pMetaReader);
+  if (code) goto _err;
+
+  for (;;) {
+    code = metaSnapRead(pMetaReader, &pData);
+    if (code) goto _err;
+    if (pData == NULL) break;
+
+    if (vnodeSplitKeepMeta(pSplit, pData)) {
+      SSnapDataHdr *pHdr = (SSnapDataHdr *)pData;
+      pHdr->index = ++index;
+      code = vnodeSnapWrite(pWriter, pData, sizeof(SSnapDataHdr) + pHdr->size);
+      if (code) goto _err;
+    }
+    taosMemoryFreeClear(pData);
+  }
+  metaSnapReaderClose(&pMetaReader);
+
+  // TSDB and DEL, only the tables seeded above
+  code = tsdbSnapReaderOpen(pVnode->pTsdb, 0, ever, SNAP_DATA_TSDB, &pTsdbReader);
+  if (code) goto _err;
+  tsdbSnapReaderSetFilter(pTsdbReader, pSplit->pUids);
+
+  for (;;) {
+    code = tsdbSnapRead(pTsdbReader, &pData);
+    if (code) goto _err;
+    if (pData == NULL) break;
+
+    SSnapDataHdr *pHdr = (SSnapDataHdr *)pData;
+    pHdr->index = ++index;
+    code = vnodeSnapWrite(pWriter, pData, sizeof(SSnapDataHdr) + pHdr->size);
+    if (code) goto _err;
+    taosMemoryFreeClear(pData);
+  }
+  tsdbSnapReaderClose(&pTsdbReader);
+
+  SSnapshot snapshot = {.lastApplyIndex = ever, .lastApplyTerm = pVnode->state.commitTerm};
+  code = vnodeSnapWriterClose(pWriter, 0, &snapshot);
+  pWriter = NULL;
+  if (code) goto _err;
+
+  vInfo("vgId:%d, vnode:%d is seeded, ever:%" PRId64 " tables:%d", TD_VID(pVnode), TD_VID(pSplit->pNew), ever,
+        taosHashGetSize(pSplit->pUids));
+  return code;
+
+_err:
+  vError("vgId:%d, failed to seed vnode:%d since %s", TD_VID(pVnode), TD_VID(pSplit->pNew), tstrerror(code));
+  taosMemoryFree(pData);
+  if (pMetaReader) metaSnapReaderClose(&pMetaReader);
+  if (pTsdbReader) tsdbSnapReaderClose(&pTsdbReader);
+  if (pWriter) taosMemoryFree(pWriter);
+  return code;
+}
+
+static bool vnodeSplitIsReplayMsg(tmsg_t msgType) {
+  return msgType == TDMT_VND_CREATE_STB || msgType == TDMT_VND_ALTER_STB || msgType == TDMT_VND_DROP_STB ||
+         msgType == TDMT_VND_CREATE_TABLE || msgType == TDMT_VND_ALTER_TABLE || msgType == TDMT_VND_DROP_TABLE ||
+         msgType == TDMT_VND_DROP_TTL_TABLE || msgType == TDMT_VND_SUBMIT || msgType == TDMT_VND_DELETE ||
+         msgType == TDMT_VND_BATCH_DEL;
+}
+
+// keep the submit blocks of tables owned by the new vnode, return the number of blocks kept
+static int32_t vnodeSplitFilterSubmit(SVSplit *pSplit, SRpcMsg *pMsg) {
+  SSubmitReq    *pSubmitReq = (SSubmitReq *)pMsg->pCont;
+  SSubmitMsgIter msgIter = {0};
+  SSubmitBlk    *pBlock = NULL;
+  SVnode        *pNew = pSplit->pNew;
+  char           tbFName[TSDB_TABLE_FNAME_LEN];
+  int32_t        len = sizeof(SSubmitReq);
+  int32_t        nBlock = 0;
+
+  if (tInitSubmitMsgIter(pSubmitReq, &msgIter) < 0) return 0;
+
+  for (;;) {
+    tGetSubmitMsgNext(&msgIter, &pBlock);
+    if (pBlock == NULL) break;
+
+    bool keep = false;
+    if (msgIter.schemaLen > 0) {
+      SDecoder dc = {0};
+      char    *name = NULL;
+
+      tDecoderInit(&dc, pBlock->data, msgIter.schemaLen);
+      if (tStartDecode(&dc) == 0 && tDecodeI32v(&dc, NULL) == 0 && tDecodeCStr(&dc, &name) == 0) {
+        snprintf(tbFName, sizeof(tbFName), "%s.%s", pNew->config.dbname, name);
+        keep = (vnodeValidateTableHash(pNew, tbFName) == 0);
+      }
+      tDecoderClear(&dc);
+    } else {
+      SMetaInfo info;
+      keep = (metaGetInfo(pNew->pMeta, msgIter.uid, &info) == 0);
+    }
+
+    if (keep) {
+      int32_t blkLen = sizeof(SSubmitBlk) + msgIter.schemaLen + msgIter.dataLen;
+      memmove(POINTER_SHIFT(pSubmitReq, len), pBlock, blkLen);
+      len += blkLen;
+      nBlock++;
+    }
+  }
+
+  pSubmitReq->header.contLen = htonl(len);
+  pSubmitReq->length = htonl(len);
+  pSubmitReq->numOfBlocks = htonl(nBlock);
+  pMsg->contLen = len;
+  return nBlock;
+}
+
+// keep the deleted tables owned by the new vnode, return the number of tables kept
+static int32_t vnodeSplitFilterDelete(SVSplit *pSplit, SRpcMsg *pMsg) {
+  SVnode   *pNew = pSplit->pNew;
+  void     *pReq = POINTER_SHIFT(pMsg->pCont, sizeof(SMsgHead));
+  int32_t   len = pMsg->contLen - sizeof(SMsgHead);
+  SDecoder  dc = {0};
+  SEncoder  ec = {0};
+  SMetaInfo info;
+  int32_t   nKeep = 0;
+  int32_t   code = 0;
+
+  tDecoderInit(&dc, pReq, len);
+  if (pMsg->msgType == TDMT_VND_DELETE) {
+    SDeleteRes res = {0};
+    res.uidList = taosArrayInit(0, sizeof(tb_uid_t));
+    if (res.uidList == NULL || tDecodeDeleteRes(&dc, &res) < 0) {
+      code = -1;
+    } else {
+      for (int32_t i = 0; i < taosArrayGetSize(res.uidList); i++) {
+        tb_uid_t uid = *(tb_uid_t *)taosArrayGet(res.uidList, i);
+        if (metaGetInfo(pNew->pMeta, uid, &info) == 0) taosArraySet(res.uidList, nKeep++, &uid);
+      }
+      taosArraySetSize(res.uidList, nKeep);
+
+      // the request only shrinks, so it is encoded back in place
+      tEncoderInit(&ec, pReq, len);
+      if (tEncodeDeleteRes(&ec, &res) < 0) code = -1;
+    }
+    taosArrayDestroy(res.uidList);
+  } else {
+    SBatchDeleteReq req = {0};
+    if (tDecodeSBatchDeleteReq(&dc, &req) < 0) {
+      code = -1;
+    } else {
+      for (int32_t i = 0; i < taosArrayGetSize(req.deleteReqs); i++) {
+        SSingleDeleteReq oneReq = *(SSingleDeleteReq *)taosArrayGet(req.deleteReqs, i);
+        if (metaGetInfo(pNew->pMeta, oneReq.uid, &info) == 0) taosArraySet(req.deleteReqs, nKeep++, &oneReq);
+      }
+      taosArraySetSize(req.deleteReqs, nKeep);
+
+      tEncoderInit(&ec, pReq, len);
+      if (tEncodeSBatchDeleteReq(&ec, &req) < 0) code = -1;
+    }
+    taosArrayDestroy(req.deleteReqs);
+  }
+  tDecoderClear(&dc);
+
+  if (code == 0) {
+    len = ec.pos;
+    ((SMsgHead *)pMsg->pCont)->contLen = htonl(sizeof(SMsgHead) + len);
+    pMsg->contLen = sizeof(SMsgHead) + len;
+  }
+  tEncoderClear(&ec);
+
+  if (code) {
+    terrno = TSDB_CODE_INVALID_MSG;
+    return -1;
+  }
+  return nKeep;
+}
+
+// filter the message by the hash range of the new vnode, return the number of parts left to replay
+static int32_t vnodeSplitFilter(SVSplit *pSplit, SRpcMsg *pMsg) {
+  switch (pMsg->msgType) {
+    case TDMT_VND_SUBMIT:
+      return vnodeSplitFilterSubmit(pSplit, pMsg);
+    case TDMT_VND_DELETE:
+    case TDMT_VND_BATCH_DEL:
+      return vnodeSplitFilterDelete(pSplit, pMsg);
+    default:
+      return 1;
+  }
+}
+
+static int32_t vnodeSplitReplay(SVSplit *pSplit, int64_t ever) {
+  SWalReader *pReader = pSplit->pWalReader;
+
+  for (int64_t ver = pSplit->ver + 1; ver <= ever; ver++) {
+    if (walReadVer(pReader, ver) < 0) {
+      vError("vgId:%d, failed to read wal for split since %s, ver:%" PRId64, TD_VID(pSplit->pVnode), terrstr(), ver);
+      return -1;
+    }
+
+    SWalCont *pCont = &pReader->pHead->head;
+    if (vnodeSplitIsReplayMsg(pCont->msgType)) {
+      SRpcMsg msg = {.msgType = pCont->msgType, .contLen = pCont->bodyLen};
+      msg.pCont = rpcMallocCont(pCont->bodyLen);
+      if (msg.pCont == NULL) {
+        terrno = TSDB_CODE_OUT_OF_MEMORY;
+        return -1;
+      }
+      memcpy(msg.pCont, pCont->body, pCont->bodyLen);
+      msg.info.conn.applyTerm = pCont->syncMeta.term;
+
+      int32_t nKeep = vnodeSplitFilter(pSplit, &msg);
+      if (nKeep < 0) {
+        rpcFreeCont(msg.pCont);
+        return -1;
+      }
+
+      if (nKeep > 0) {
+        SRpcMsg rsp = {0};
+        if (vnodeProcessWriteMsg(pSplit->pNew, &msg, ver, &rsp) < 0) {
+          rpcFreeCont(msg.pCont);
+          return -1;
+        }
+        rpcFreeCont(rsp.pCont);
+      }
+      rpcFreeCont(msg.pCont);
+    }
+
+    pSplit->ver = ver;
+  }
+
+  walPreRefVer(pSplit->pRef, pSplit->ver + 1);
+  return 0;
+}
+
+int32_t vnodeSplitCutover(SVnode *pVnode, int64_t version, SAlterVnodeHashRangeReq *pReq) {
+  SVSplit *pSplit = NULL;
+  SArray  *tbUids = NULL;
+  int32_t  code = 0;
+
+  taosThreadMutexLock(&pVnode->lock);
+  pSplit = pVnode->pSplit;
+  pVnode->pSplit = NULL;
+  taosThreadMutexUnlock(&pVnode->lock);
+
+  // replayed from wal after a restart, the split was abandoned and will be retried by mnode
+  if (pSplit == NULL || TD_VID(pSplit->pNew) != pReq->dstVgId) {
+    vInfo("vgId:%d, no split to vnode:%d in progress, hash range unchanged", TD_VID(pVnode), pReq->dstVgId);
+    if (pSplit) {
+      pSplit->code = TSDB_CODE_INVALID_MSG;
+      tsem_post(&pSplit->sem);
+    }
+    return 0;
+  }
+
+  SVnode *pNew = pSplit->pNew;
+
+  // bring the new vnode to the cut-over version and make it durable
+  code = vnodeSplitReplay(pSplit, version - 1);
+  if (code) goto _exit;
+
+  pNew->state.applied = version;
+  pNew->state.applyTerm = pVnode->state.applyTerm;
+  vnodeCommit(pNew);
+
+  code = walRestoreFromSnapshot(pNew->pWal, version);
+  if (code) goto _exit;
+
+  // shrink the source, rows of the trimmed tables are skipped by every later commit of their file sets
+  pVnode->config.hashBegin = pReq->srcHashBegin;
+  pVnode->config.hashEnd = pReq->srcHashEnd;
+
+  tbUids = taosArrayInit(taosHashGetSize(pSplit->pUids) + 1, sizeof(int64_t));
+  if (tbUids == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    code = -1;
+    goto _exit;
+  }
+
+  code = metaTrimTables(pVnode->pMeta, tbUids);
+  if (code) goto _exit;
+  tqUpdateTbUidList(pVnode->pTq, tbUids, false);
+
+  vnodeCommit(pVnode);
+
+  code = vnodeBegin(pVnode);
+  if (code) goto _exit;
+
+  vInfo("vgId:%d, split to vnode:%d is cut over at version:%" PRId64 ", %d tables trimmed, hash begin:%u end:%u",
+        TD_VID(pVnode), TD_VID(pNew), version, (int32_t)taosArrayGetSize(tbUids), pVnode->config.hashBegin,
+        pVnode->config.hashEnd);
+
+_exit:
+  if (code) {
+    vError("vgId:%d, failed to cut over split to vnode:%d since %s", TD_VID(pVnode), TD_VID(pNew), terrstr());
+  }
+  taosArrayDestroy(tbUids);
+  pSplit->code = code ? (terrno ? terrno : code) : 0;
+  tsem_post(&pSplit->sem);
+  return code;
+}
+
+int32_t vnodeSplit(SVnode *pVnode, SVnode *pNew, SRpcMsg *pMsg) {
+  int32_t  code = 0;
+  SVSplit *pSplit = taosMemoryCalloc(1, sizeof(SVSplit));
+  if (pSplit == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  pSplit->pVnode = pVnode;
+  pSplit->pNew = pNew;
+  tsem_init(&pSplit->sem, 0, 0);
+  pSplit->pUids = taosHashInit(1024, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BIGINT), false, HASH_NO_LOCK);
+  pSplit->pWalReader = walOpenReader(pVnode->pWal, NULL);
+  pSplit->pRef = walOpenRef(pVnode->pWal);
+  if (pSplit->pUids == NULL || pSplit->pWalReader == NULL || pSplit->pRef == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    code = -1;
+    goto _exit;
+  }
+
+  // pin the wal before taking the snapshot version, so everything after it can be replayed
+  walPreRefVer(pSplit->pRef, pVnode->state.committed + 1);
+  pSplit->ver = pVnode->state.committed;
+
+  code = vnodeSplitSeed(pSplit, pSplit->ver);
+  if (code) {
+    terrno = code;
+    goto _exit;
+  }
+
+  // catch up until the remaining lag is small enough to be replayed at cut-over
+  for (int32_t i = 0; i < VND_SPLIT_CATCHUP_ROUNDS; i++) {
+    int64_t applied = pVnode->state.applied;
+    if (applied - pSplit->ver <= VND_SPLIT_CATCHUP_LAG) break;
+
+    code = vnodeSplitReplay(pSplit, applied);
+    if (code) goto _exit;
+  }
+
+  vInfo("vgId:%d, vnode:%d caught up to version:%" PRId64 ", start to cut over", TD_VID(pVnode), TD_VID(pNew),
+        pSplit->ver);
+
+  taosThreadMutexLock(&pVnode->lock);
+  pVnode->pSplit = pSplit;
+  taosThreadMutexUnlock(&pVnode->lock);
+
+  SRpcMsg rpcMsg = {.msgType = pMsg->msgType, .pCont = pMsg->pCont, .contLen = pMsg->contLen};
+  code = syncPropose(pVnode->sync, &rpcMsg, false);
+  if (code < 0) {
+    taosThreadMutexLock(&pVnode->lock);
+    bool proposed = (pVnode->pSplit == NULL);
+    pVnode->pSplit = NULL;
+    taosThreadMutexUnlock(&pVnode->lock);
+    if (!proposed) {
+      vError("vgId:%d, failed to propose cut over to vnode:%d since %s", TD_VID(pVnode), TD_VID(pNew), terrstr());
+      goto _exit;
+    }
+  }
+
+  // the cut-over is applied by the source, give up if it is not applied in time and let mnode retry the split
+  for (int32_t i = 0;; i++) {
+    if (tsem_timewait(&pSplit->sem, VND_SPLIT_WAIT_MS * 1000000L) == 0) {
+      code = pSplit->code;
+      break;
+    }
+    if (i < VND_SPLIT_WAIT_ROUNDS) continue;
+
+    taosThreadMutexLock(&pVnode->lock);
+    bool applying = (pVnode->pSplit == NULL);
+    pVnode->pSplit = NULL;
+    taosThreadMutexUnlock(&pVnode->lock);
+
+    // already taken by the cut-over, which always posts when done
+    if (applying) continue;
+
+    vError("vgId:%d, cut over to vnode:%d is not applied in %d ms", TD_VID(pVnode), TD_VID(pNew),
+           VND_SPLIT_WAIT_MS * VND_SPLIT_WAIT_ROUNDS);
+    code = TSDB_CODE_SYN_TIMEOUT;
+    break;
+  }
+  if (code) terrno = code;
+
+_exit:
+  walCloseRef(pVnode->pWal, pSplit->pRef ? pSplit->pRef->refId : -1);
+  if (pSplit->pWalReader) walCloseReader(pSplit->pWalReader);
+  taosHashCleanup(pSplit->pUids);
+  tsem_destroy(&pSplit->sem);
+  taosMemoryFree(pSplit);
+  return code;
+}
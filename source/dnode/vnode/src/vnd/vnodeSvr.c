@@ -331,16 +331,25 @@ int32_t vnodeProcessQueryMsg(SVnode *pVnode, SRpcMsg *pMsg) {
   }
 
   SReadHandle handle = {.meta = pVnode->pMeta, .config = &pVnode->config, .vnode = pVnode, .pMsgCb = &pVnode->msgCb};
+  int64_t     st = taosGetTimestampUs();
+  int32_t     code = 0;
   switch (pMsg->msgType) {
     case TDMT_SCH_QUERY:
     case TDMT_SCH_MERGE_QUERY:
-      return qWorkerProcessQueryMsg(&handle, pVnode->pQuery, pMsg, 0);
+      atomic_add_fetch_64(&pVnode->statis.nSelect, 1);
+      code = qWorkerProcessQueryMsg(&handle, pVnode->pQuery, pMsg, 0);
+      break;
     case TDMT_SCH_QUERY_CONTINUE:
-      return qWorkerProcessCQueryMsg(&handle, pVnode->pQuery, pMsg, 0);
+      code = qWorkerProcessCQueryMsg(&handle, pVnode->pQuery, pMsg, 0);
+      break;
     default:
       vError("unknown msg type:%d in query queue", pMsg->msgType);
       return TSDB_CODE_VND_APP_ERROR;
   }
+
+  // used by mnode to estimate the query load of this vnode
+  atomic_add_fetch_64(&pVnode->statis.nQueryTime, taosGetTimestampUs() - st);
+  return code;
 }
 
 int32_t vnodeProcessFetchMsg(SVnode *pVnode, SRpcMsg *pMsg, SQueueInfo *pInfo) {
@@ -990,6 +999,7 @@ _exit:
   atomic_add_fetch_64(&pVnode->statis.nInsertSuccess, submitRsp.affectedRows);
   atomic_add_fetch_64(&pVnode->statis.nBatchInsert, statis.nBatchInsert);
   atomic_add_fetch_64(&pVnode->statis.nBatchInsertSuccess, statis.nBatchInsertSuccess);
+  atomic_add_fetch_64(&pVnode->statis.nWriteRows, submitRsp.affectedRows);
 
   vDebug("vgId:%d, submit success, index:%" PRId64, pVnode->config.vgId, version);
   return 0;
@@ -1055,13 +1065,22 @@ static int32_t vnodeProcessAlterConfirmReq(SVnode *pVnode, int64_t version, void
 }
 
 static int32_t vnodeProcessAlterHashRangeReq(SVnode *pVnode, int64_t version, void *pReq, int32_t len, SRpcMsg *pRsp) {
-  vInfo("vgId:%d, alter hashrange msg will be processed", TD_VID(pVnode));
+  SAlterVnodeHashRangeReq req = {0};
 
-  // todo
-  // 1. stop work
-  // 2. adjust hash range / compact / remove wals / rename vgroups
-  // 3. reload sync
-  return 0;
+  if (tDeserializeSAlterVnodeHashRangeReq(pReq, len, &req) != 0) {
+    terrno = TSDB_CODE_INVALID_MSG;
+    return TSDB_CODE_INVALID_MSG;
+  }
+
+  vInfo("vgId:%d, alter hashrange msg will be processed, dst vgId:%d src hash begin:%u end:%u, index:%" PRId64,
+        TD_VID(pVnode), req.dstVgId, req.srcHashBegin, req.srcHashEnd, version);
+
+  pRsp->msgType = TDMT_VND_ALTER_HASHRANGE_RSP;
+  pRsp->code = TSDB_CODE_SUCCESS;
+  pRsp->pCont = NULL;
+  pRsp->contLen = 0;
+
+  return vnodeSplitCutover(pVnode, version, &req);
 }
 
 static int32_t vnodeProcessAlterConfigReq(SVnode *pVnode, int64_t version, void *pReq, int32_t len, SRpcMsg *pRsp) {
@@ -751,6 +751,7 @@ int32_t vnodeSyncOpen(SVnode *pVnode, char *path) {
       .snapshotStrategy = SYNC_STRATEGY_WAL_FIRST,
       //.snapshotStrategy = SYNC_STRATEGY_NO_SNAPSHOT,
       .batchSize = 1,
+      .pipelineWindow = tsSyncPipelineWindow,
       .vgId = pVnode->config.vgId,
       .isStandBy = pVnode->config.standby,
       .syncCfg = pVnode->config.syncCfg,
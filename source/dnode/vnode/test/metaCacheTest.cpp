@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include <meta.h>
+#include <taoserror.h>
+#include <vnodeInt.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+/*
+ * The meta here has the caches only, no TDB is opened. A schema lookup that misses the caches would read the TDB
+ * tables and crash, so every schema returned below is served by the caches.
+ */
+class MetaCacheEnv : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    pVnode = (SVnode *)taosMemoryCalloc(1, sizeof(SVnode));
+    pMeta = (SMeta *)taosMemoryCalloc(1, sizeof(SMeta));
+    ASSERT_NE(pVnode, nullptr);
+    ASSERT_NE(pMeta, nullptr);
+    pMeta->pVnode = pVnode;
+    taosThreadRwlockInit(&pMeta->lock, NULL);
+    ASSERT_EQ(metaCacheOpen(pMeta), 0);
+  }
+
+  void TearDown() override {
+    metaCacheClose(pMeta);
+    taosThreadRwlockDestroy(&pMeta->lock);
+    taosMemoryFree(pMeta);
+    taosMemoryFree(pVnode);
+  }
+
+  // schema of version sver, the first column is the timestamp followed by nCols - 1 int columns
+  void buildSchema(SSchemaWrapper *pSW, int32_t sver, int32_t nCols) {
+    pSW->version = sver;
+    pSW->nCols = nCols;
+    pSW->pSchema = (SSchema *)taosMemoryCalloc(nCols, sizeof(SSchema));
+    for (int32_t i = 0; i < nCols; i++) {
+      SSchema *pSchema = pSW->pSchema + i;
+      pSchema->type = (i == 0) ? TSDB_DATA_TYPE_TIMESTAMP : TSDB_DATA_TYPE_INT;
+      pSchema->bytes = tDataTypes[pSchema->type].bytes;
+      pSchema->colId = PRIMARYKEY_TIMESTAMP_COL_ID + i;
+      snprintf(pSchema->name, sizeof(pSchema->name), "c%d", i);
+    }
+  }
+
+  void putSchema(tb_uid_t uid, int32_t sver, int32_t nCols) {
+    SSchemaWrapper sw = {0};
+    buildSchema(&sw, sver, nCols);
+    ASSERT_EQ(metaSchemaCachePut(pMeta, uid, &sw), 0);
+    taosMemoryFree(sw.pSchema);
+  }
+
+  // the entry cache only takes the entries of a newer version
+  void putEntry(tb_uid_t uid, tb_uid_t suid, int64_t version, int32_t skmVer) {
+    SMetaInfo info = {.uid = uid, .suid = suid, .version = version, .skmVer = skmVer};
+    ASSERT_EQ(metaCacheUpsert(pMeta, &info), 0);
+  }
+
+  SVnode *pVnode = nullptr;
+  SMeta  *pMeta = nullptr;
+};
+
+void checkTSchema(STSchema *pTSchema, int32_t sver, int32_t nCols) {
+  ASSERT_NE(pTSchema, nullptr);
+  EXPECT_EQ(pTSchema->version, sver);
+  ASSERT_EQ(pTSchema->numOfCols, nCols);
+  for (int32_t i = 0; i < nCols; i++) {
+    EXPECT_EQ(pTSchema->columns[i].colId, PRIMARYKEY_TIMESTAMP_COL_ID + i);
+    EXPECT_EQ(pTSchema->columns[i].type, (i == 0) ? TSDB_DATA_TYPE_TIMESTAMP : TSDB_DATA_TYPE_INT);
+  }
+}
+
+void checkSchemaWrapper(SSchemaWrapper *pSW, int32_t sver, int32_t nCols) {
+  ASSERT_NE(pSW, nullptr);
+  EXPECT_EQ(pSW->version, sver);
+  ASSERT_EQ(pSW->nCols, nCols);
+  for (int32_t i = 0; i < nCols; i++) {
+    EXPECT_EQ(pSW->pSchema[i].colId, PRIMARYKEY_TIMESTAMP_COL_ID + i);
+    EXPECT_STREQ(pSW->pSchema[i].name, ("c" + std::to_string(i)).c_str());
+  }
+}
+
+}  // namespace
+
+TEST_F(MetaCacheEnv, schemaCacheHitTest) {
+  const tb_uid_t stbUid = 100;
+
+  SSchemaWrapper *pSW = NULL;
+  STSchema       *pTSchema = NULL;
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid, 1, &pSW, &pTSchema), TSDB_CODE_NOT_FOUND);
+  EXPECT_EQ(pSW, nullptr);
+  EXPECT_EQ(pTSchema, nullptr);
+
+  putSchema(stbUid, 1, 3);
+
+  // every hit returns copies owned by the caller
+  for (int32_t i = 0; i < 2; i++) {
+    ASSERT_EQ(metaSchemaCacheGet(pMeta, stbUid, 1, &pSW, &pTSchema), 0);
+    checkSchemaWrapper(pSW, 1, 3);
+    checkTSchema(pTSchema, 1, 3);
+    tDeleteSSchemaWrapper(pSW);
+    taosMemoryFree(pTSchema);
+    pSW = NULL;
+    pTSchema = NULL;
+  }
+
+  ASSERT_EQ(metaSchemaCacheGet(pMeta, stbUid, 1, NULL, &pTSchema), 0);
+  checkTSchema(pTSchema, 1, 3);
+  taosMemoryFree(pTSchema);
+
+  // the other versions and tables are not mixed up with it
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid, 2, &pSW, NULL), TSDB_CODE_NOT_FOUND);
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid + 1, 1, &pSW, NULL), TSDB_CODE_NOT_FOUND);
+
+  // a schema without columns is not kept
+  SSchemaWrapper empty = {.nCols = 0, .version = 3, .pSchema = NULL};
+  EXPECT_EQ(metaSchemaCachePut(pMeta, stbUid, &empty), 0);
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid, 3, &pSW, NULL), TSDB_CODE_NOT_FOUND);
+}
+
+TEST_F(MetaCacheEnv, schemaCacheDropTest) {
+  const tb_uid_t stbUid = 100;
+
+  putSchema(stbUid, 1, 3);
+  putSchema(stbUid, 2, 4);
+
+  // altering the table drops its old and new versions, the others are kept
+  metaSchemaCacheDrop(pMeta, stbUid, 1);
+
+  STSchema *pTSchema = NULL;
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid, 1, NULL, &pTSchema), TSDB_CODE_NOT_FOUND);
+  ASSERT_EQ(metaSchemaCacheGet(pMeta, stbUid, 2, NULL, &pTSchema), 0);
+  checkTSchema(pTSchema, 2, 4);
+  taosMemoryFree(pTSchema);
+
+  // dropping a version not cached is a no-op
+  metaSchemaCacheDrop(pMeta, stbUid, 5);
+  metaSchemaCacheDrop(pMeta, stbUid, 2);
+  EXPECT_EQ(metaSchemaCacheGet(pMeta, stbUid, 2, NULL, &pTSchema), TSDB_CODE_NOT_FOUND);
+
+  // a schema put again after the drop is served again
+  putSchema(stbUid, 2, 4);
+  ASSERT_EQ(metaSchemaCacheGet(pMeta, stbUid, 2, NULL, &pTSchema), 0);
+  checkTSchema(pTSchema, 2, 4);
+  taosMemoryFree(pTSchema);
+}
+
+TEST_F(MetaCacheEnv, schemaOwnerTest) {
+  const tb_uid_t stbUid = 100;
+  const tb_uid_t ctbUid = 200;
+  const tb_uid_t ntbUid = 300;
+
+  putEntry(stbUid, stbUid, 1, 1);
+  putEntry(ctbUid, stbUid, 2, 1);
+  putEntry(ntbUid, 0, 3, 5);
+  putSchema(stbUid, 1, 3);
+  putSchema(ntbUid, 5, 2);
+
+  // a child table is served the latest schema of its super table
+  STSchema *pTSchema = metaGetTbTSchema(pMeta, ctbUid, -1, 1);
+  checkTSchema(pTSchema, 1, 3);
+  taosMemoryFree(pTSchema);
+
+  SSchemaWrapper *pSW = metaGetTableSchema(pMeta, ctbUid, 1, 1);
+  checkSchemaWrapper(pSW, 1, 3);
+  tDeleteSSchemaWrapper(pSW);
+
+  pSW = metaGetTableSchema(pMeta, stbUid, -1, 0);
+  checkSchemaWrapper(pSW, 1, 3);
+  tDeleteSSchemaWrapper(pSW);
+
+  // a normal table owns its schema
+  pTSchema = metaGetTbTSchema(pMeta, ntbUid, -1, 1);
+  checkTSchema(pTSchema, 5, 2);
+  taosMemoryFree(pTSchema);
+
+  // the super table is altered, the child table follows the new latest version and still reads the old one
+  putSchema(stbUid, 2, 4);
+  putEntry(stbUid, stbUid, 4, 2);
+
+  pTSchema = metaGetTbTSchema(pMeta, ctbUid, -1, 1);
+  checkTSchema(pTSchema, 2, 4);
+  taosMemoryFree(pTSchema);
+
+  pTSchema = metaGetTbTSchema(pMeta, ctbUid, 1, 1);
+  checkTSchema(pTSchema, 1, 3);
+  taosMemoryFree(pTSchema);
+}
+
+#pragma GCC diagnostic pop
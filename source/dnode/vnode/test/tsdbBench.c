@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * tsdbBench builds a vnode in a scratch directory for every (maxRows, sttTrigger) pair and measures:
+ *   - memtable insert rate through tsdbInsertTableData
+ *   - commit throughput of the memtable into data/stt files
+ *   - tsdbReaderOpen latency and tsdbNextDataBlock scan rate
+ *   - last row cache hit and miss latency
+ * The result is written as JSON so that two runs can be diffed.
+ */
+
+#include "tsdb.h"
+#include "vnd.h"
+
+#define BENCH_MAX_CASES 16
+#define BENCH_TS_STEP   1000  // ms between two rows of a table
+#define BENCH_SUID      10000
+
+typedef struct {
+  char    dir[PATH_MAX];
+  char    output[PATH_MAX];
+  int32_t nCols;  // including the primary timestamp column
+  int32_t nTables;
+  int32_t nRows;  // rows per table
+  int32_t nCommits;
+  int32_t nLoops;  // rounds of the last row cache test
+  int32_t nMaxRows;
+  int32_t aMaxRows[BENCH_MAX_CASES];
+  int32_t nSttTrigger;
+  int32_t aSttTrigger[BENCH_MAX_CASES];
+} SBenchCfg;
+
+typedef struct {
+  int32_t   vgId;
+  int32_t   nCols;
+  int32_t   maxRows;
+  int32_t   sttTrigger;
+  STfs     *pTfs;
+  SVnode   *pVnode;
+  SSchema  *aSchema;
+  STSchema *pTSchema;
+  int64_t   version;
+  // result
+  int64_t insertRows;
+  int64_t insertUs;
+  int64_t insertBytes;
+  int64_t commitUs;
+  int64_t commitMaxUs;
+  int64_t openUs;
+  int64_t scanUs;
+  int64_t scanRows;
+  int64_t scanBlocks;
+  int64_t nHit;
+  int64_t hitUs;
+  int64_t nMiss;
+  int64_t missUs;
+} SBenchCase;
+
+static int32_t benchParseList(const char *str, int32_t *aVal, int32_t *nVal) {
+  char *p = (char *)str;
+
+  *nVal = 0;
+  while (*p) {
+    char   *pEnd = NULL;
+    int32_t val = taosStr2Int32(p, &pEnd, 10);
+    if (pEnd == p || val <= 0 || *nVal >= BENCH_MAX_CASES) return -1;
+
+    aVal[(*nVal)++] = val;
+    p = pEnd;
+    if (*p == ',') p++;
+  }
+
+  return (*nVal > 0) ? 0 : -1;
+}
+
+static int32_t benchOpenVnode(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  char      path[TSDB_FILENAME_LEN];
+  SVnodeCfg vnodeCfg = {0};
+  SMsgCb    msgCb = {0};
+
+  memcpy(&vnodeCfg, &vnodeCfgDefault, sizeof(SVnodeCfg));
+  vnodeCfg.vgId = pCase->vgId;
+  snprintf(vnodeCfg.dbname, sizeof(vnodeCfg.dbname), "1.bench%d", pCase->vgId);
+  vnodeCfg.dbId = pCase->vgId;
+  vnodeCfg.cacheLast = 1;
+  vnodeCfg.szBuf = 256 * 1024 * 1024;
+  vnodeCfg.tsdbCfg.maxRows = pCase->maxRows;
+  vnodeCfg.tsdbCfg.minRows = TMAX(pCase->maxRows / 10, 1);
+  vnodeCfg.sttTrigger = pCase->sttTrigger;
+  vnodeCfg.walCfg.vgId = pCase->vgId;
+  vnodeCfg.syncCfg.replicaNum = 1;
+  vnodeCfg.syncCfg.myIndex = 0;
+  vnodeCfg.syncCfg.nodeInfo[0].nodePort = 6030;
+  tstrncpy(vnodeCfg.syncCfg.nodeInfo[0].nodeFqdn, "localhost", sizeof(vnodeCfg.syncCfg.nodeInfo[0].nodeFqdn));
+
+  snprintf(path, TSDB_FILENAME_LEN, "vnode%svnode%d", TD_DIRSEP, pCase->vgId);
+  if (vnodeCreate(path, &vnodeCfg, pCase->pTfs) < 0) {
+    printf("failed to create vnode %d since %s\n", pCase->vgId, terrstr());
+    return -1;
+  }
+
+  pCase->pVnode = vnodeOpen(path, pCase->pTfs, msgCb);
+  if (pCase->pVnode == NULL) {
+    printf("failed to open vnode %d since %s\n", pCase->vgId, terrstr());
+    return -1;
+  }
+
+  return 0;
+}
+
+static void benchCloseVnode(SBenchCase *pCase) {
+  char path[TSDB_FILENAME_LEN];
+
+  if (pCase->pVnode) {
+    vnodePreClose(pCase->pVnode);
+    vnodeClose(pCase->pVnode);
+    pCase->pVnode = NULL;
+  }
+
+  snprintf(path, TSDB_FILENAME_LEN, "vnode%svnode%d", TD_DIRSEP, pCase->vgId);
+  vnodeDestroy(path, pCase->pTfs);
+
+  taosMemoryFreeClear(pCase->aSchema);
+  taosMemoryFreeClear(pCase->pTSchema);
+}
+
+static int32_t benchCreateTables(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  SSchema tagSchema = {.type = TSDB_DATA_TYPE_BIGINT, .colId = pCfg->nCols + 1, .bytes = sizeof(int64_t)};
+  SMeta  *pMeta = pCase->pVnode->pMeta;
+  char    name[TSDB_TABLE_NAME_LEN];
+
+  pCase->aSchema = taosMemoryCalloc(pCfg->nCols, sizeof(SSchema));
+  if (pCase->aSchema == NULL) return -1;
+
+  // ts, then bigint and double columns in turn
+  for (int32_t iCol = 0; iCol < pCfg->nCols; iCol++) {
+    SSchema *pSchema = &pCase->aSchema[iCol];
+    pSchema->colId = PRIMARYKEY_TIMESTAMP_COL_ID + iCol;
+    pSchema->type = (iCol == 0) ? TSDB_DATA_TYPE_TIMESTAMP : (iCol % 2 ? TSDB_DATA_TYPE_BIGINT : TSDB_DATA_TYPE_DOUBLE);
+    pSchema->bytes = sizeof(int64_t);
+    pSchema->flags = COL_SMA_ON;
+    snprintf(pSchema->name, sizeof(pSchema->name), "c%d", iCol);
+  }
+  tstrncpy(tagSchema.name, "t0", sizeof(tagSchema.name));
+
+  pCase->pTSchema = tdGetSTSChemaFromSSChema(pCase->aSchema, pCfg->nCols, 1);
+  if (pCase->pTSchema == NULL) return -1;
+
+  SVCreateStbReq stbReq = {.name = "stb",
+                           .suid = BENCH_SUID,
+                           .schemaRow = {.nCols = pCfg->nCols, .version = 1, .pSchema = pCase->aSchema},
+                           .schemaTag = {.nCols = 1, .version = 1, .pSchema = &tagSchema}};
+  if (metaCreateSTable(pMeta, ++pCase->version, &stbReq) < 0) {
+    printf("failed to create super table since %s\n", terrstr());
+    return -1;
+  }
+
+  SArray *pTagVals = taosArrayInit(1, sizeof(STagVal));
+  if (pTagVals == NULL) return -1;
+
+  for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+    STagVal tagVal = {.cid = tagSchema.colId, .type = TSDB_DATA_TYPE_BIGINT, .i64 = iTable};
+    STag   *pTag = NULL;
+
+    taosArrayClear(pTagVals);
+    taosArrayPush(pTagVals, &tagVal);
+    if (tTagNew(pTagVals, 1, false, &pTag) < 0) {
+      taosArrayDestroy(pTagVals);
+      return -1;
+    }
+
+    snprintf(name, sizeof(name), "t%d", iTable);
+    SVCreateTbReq tbReq = {.name = name,
+                           .uid = BENCH_SUID + 1 + iTable,
+                           .ctime = taosGetTimestampMs(),
+                           .type = TSDB_CHILD_TABLE,
+                           .ctb = {.stbName = "stb", .tagNum = 1, .suid = BENCH_SUID, .pTag = (uint8_t *)pTag}};
+    int32_t code = metaCreateTable(pMeta, ++pCase->version, &tbReq, NULL);
+    tTagFree(pTag);
+    if (code < 0) {
+      printf("failed to create table %s since %s\n", name, terrstr());
+      taosArrayDestroy(pTagVals);
+      return -1;
+    }
+  }
+
+  taosArrayDestroy(pTagVals);
+  return 0;
+}
+
+// build a submit request of one block in the network byte order used on the wire
+static SSubmitReq *benchBuildSubmitReq(SBenchCase *pCase, tb_uid_t uid, TSKEY skey, int32_t nRows) {
+  STSchema   *pTSchema = pCase->pTSchema;
+  int32_t     cap = sizeof(SSubmitReq) + sizeof(SSubmitBlk) + nRows * TD_ROW_MAX_BYTES_FROM_SCHEMA(pTSchema);
+  SSubmitReq *pReq = taosMemoryCalloc(1, cap);
+  if (pReq == NULL) return NULL;
+
+  SSubmitBlk *pBlk = POINTER_SHIFT(pReq, sizeof(SSubmitReq));
+  STSRow     *pRow = POINTER_SHIFT(pBlk, sizeof(SSubmitBlk));
+  int32_t     dataLen = 0;
+
+  for (int32_t iRow = 0; iRow < nRows; iRow++) {
+    SRowBuilder rb = {0};
+    TSKEY       ts = skey + (TSKEY)iRow * BENCH_TS_STEP;
+
+    tdSRowInit(&rb, pTSchema->version);
+    tdSRowSetTpInfo(&rb, pTSchema->numOfCols, pTSchema->flen);
+    tdSRowResetBuf(&rb, pRow);
+    for (int32_t iCol = 0; iCol < pTSchema->numOfCols; iCol++) {
+      STColumn *pCol = &pTSchema->columns[iCol];
+      int64_t   i64 = ts / BENCH_TS_STEP + iCol;
+      double    d = i64 * 0.25;
+      void     *pVal = (iCol == 0) ? (void *)&ts : (pCol->type == TSDB_DATA_TYPE_DOUBLE ? (void *)&d : (void *)&i64);
+
+      tdAppendColValToRow(&rb, pCol->colId, pCol->type, TD_VTYPE_NORM, pVal, true, pCol->offset, iCol);
+    }
+    tdSRowEnd(&rb);
+
+    dataLen += TD_ROW_LEN(pRow);
+    pRow = POINTER_SHIFT(pRow, TD_ROW_LEN(pRow));
+  }
+
+  pBlk->uid = htobe64(uid);
+  pBlk->suid = htobe64(BENCH_SUID);
+  pBlk->sversion = htonl(pTSchema->version);
+  pBlk->schemaLen = htonl(0);
+  pBlk->dataLen = htonl(dataLen);
+  pBlk->numOfRows = htonl(nRows);
+
+  pReq->header.vgId = htonl(pCase->vgId);
+  pReq->length = htonl(sizeof(SSubmitReq) + sizeof(SSubmitBlk) + dataLen);
+  pReq->numOfBlocks = htonl(1);
+
+  return pReq;
+}
+
+static int32_t benchInsertAndCommit(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  SVnode      *pVnode = pCase->pVnode;
+  STsdb       *pTsdb = pVnode->pTsdb;
+  int32_t      nRowsPerCommit = TMAX(pCfg->nRows / pCfg->nCommits, 1);
+  TSKEY        skey = taosGetTimestampMs() - (TSKEY)pCfg->nRows * BENCH_TS_STEP;
+  SSubmitReq **aReq = taosMemoryCalloc(pCfg->nTables, sizeof(SSubmitReq *));
+  int32_t      code = 0;
+
+  if (aReq == NULL) return -1;
+
+  for (int32_t iCommit = 0; iCommit < pCfg->nCommits; iCommit++) {
+    // prepare the requests outside the timed section
+    for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+      aReq[iTable] = benchBuildSubmitReq(pCase, BENCH_SUID + 1 + iTable, skey, nRowsPerCommit);
+      if (aReq[iTable] == NULL || tsdbScanAndConvertSubmitMsg(pTsdb, aReq[iTable]) < 0) {
+        code = -1;
+        goto _exit;
+      }
+      pCase->insertBytes += htonl(aReq[iTable]->length);
+    }
+
+    int64_t start = taosGetTimestampUs();
+    for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+      SSubmitMsgIter msgIter = {0};
+      SSubmitBlk    *pBlock = NULL;
+
+      if (tInitSubmitMsgIter(aReq[iTable], &msgIter) < 0) {
+        code = -1;
+        goto _exit;
+      }
+      while (true) {
+        SSubmitBlkRsp blkRsp = {0};
+        tGetSubmitMsgNext(&msgIter, &pBlock);
+        if (pBlock == NULL) break;
+        if (tsdbInsertTableData(pTsdb, ++pCase->version, &msgIter, pBlock, &blkRsp) < 0) {
+          printf("failed to insert into table %" PRId64 " since %s\n", msgIter.uid, terrstr());
+          code = -1;
+          goto _exit;
+        }
+        pCase->insertRows += blkRsp.numOfRows;
+      }
+    }
+    pCase->insertUs += taosGetTimestampUs() - start;
+
+    for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+      taosMemoryFreeClear(aReq[iTable]);
+    }
+    skey += (TSKEY)nRowsPerCommit * BENCH_TS_STEP;
+
+    pVnode->state.applied = pCase->version;
+    start = taosGetTimestampUs();
+    if (vnodeCommit(pVnode) < 0) {
+      code = -1;
+      goto _exit;
+    }
+    int64_t elapsed = taosGetTimestampUs() - start;
+    pCase->commitUs += elapsed;
+    pCase->commitMaxUs = TMAX(pCase->commitMaxUs, elapsed);
+
+    if (vnodeBegin(pVnode) < 0) {
+      code = -1;
+      goto _exit;
+    }
+  }
+
+_exit:
+  for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+    taosMemoryFreeClear(aReq[iTable]);
+  }
+  taosMemoryFree(aReq);
+  return code;
+}
+
+static int32_t benchScan(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  SQueryTableDataCond cond = {0};
+  STsdbReader        *pReader = NULL;
+  SArray             *pTableList = taosArrayInit(pCfg->nTables, sizeof(STableKeyInfo));
+  int32_t             code = 0;
+
+  if (pTableList == NULL) return -1;
+  for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+    STableKeyInfo info = {.uid = BENCH_SUID + 1 + iTable, .groupId = 0};
+    taosArrayPush(pTableList, &info);
+  }
+
+  cond.suid = BENCH_SUID;
+  cond.order = TSDB_ORDER_ASC;
+  cond.numOfCols = pCfg->nCols;
+  cond.colList = taosMemoryCalloc(pCfg->nCols, sizeof(SColumnInfo));
+  if (cond.colList == NULL) {
+    code = -1;
+    goto _exit;
+  }
+  for (int32_t iCol = 0; iCol < pCfg->nCols; iCol++) {
+    cond.colList[iCol].colId = pCase->aSchema[iCol].colId;
+    cond.colList[iCol].type = pCase->aSchema[iCol].type;
+    cond.colList[iCol].bytes = pCase->aSchema[iCol].bytes;
+  }
+  cond.twindows = (STimeWindow){.skey = INT64_MIN, .ekey = INT64_MAX};
+  cond.type = TIMEWINDOW_RANGE_CONTAINED;
+  cond.startVersion = -1;
+  cond.endVersion = -1;
+
+  int64_t start = taosGetTimestampUs();
+  if (tsdbReaderOpen(pCase->pVnode, &cond, pTableList, &pReader, "tsdbBench") < 0) {
+    code = -1;
+    goto _exit;
+  }
+  pCase->openUs = taosGetTimestampUs() - start;
+
+  start = taosGetTimestampUs();
+  while (tsdbNextDataBlock(pReader)) {
+    SDataBlockInfo info = {0};
+    tsdbRetrieveDataBlockInfo(pReader, &info);
+    if (tsdbRetrieveDataBlock(pReader, NULL) == NULL) {
+      code = -1;
+      break;
+    }
+    pCase->scanRows += info.rows;
+    pCase->scanBlocks++;
+  }
+  pCase->scanUs = taosGetTimestampUs() - start;
+
+  tsdbReaderClose(pReader);
+
+_exit:
+  taosMemoryFree(cond.colList);
+  taosArrayDestroy(pTableList);
+  return code;
+}
+
+static int32_t benchLastRow(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  STsdb     *pTsdb = pCase->pVnode->pTsdb;
+  SLRUCache *pCache = pTsdb->lruCache;
+
+  for (int32_t iLoop = 0; iLoop < pCfg->nLoops; iLoop++) {
+    for (int32_t iTable = 0; iTable < pCfg->nTables; iTable++) {
+      tb_uid_t   uid = BENCH_SUID + 1 + iTable;
+      LRUHandle *h = NULL;
+
+      // a miss merges the last row out of the committed files
+      tsdbCacheDeleteLastrow(pCache, uid, TSKEY_MAX);
+      int64_t start = taosGetTimestampUs();
+      if (tsdbCacheGetLastrowH(pCache, uid, pTsdb, &h) < 0) return -1;
+      pCase->missUs += taosGetTimestampUs() - start;
+      pCase->nMiss++;
+      if (h) tsdbCacheRelease(pCache, h);
+
+      h = NULL;
+      start = taosGetTimestampUs();
+      if (tsdbCacheGetLastrowH(pCache, uid, pTsdb, &h) < 0) return -1;
+      pCase->hitUs += taosGetTimestampUs() - start;
+      pCase->nHit++;
+      if (h) tsdbCacheRelease(pCache, h);
+    }
+  }
+
+  return 0;
+}
+
+static int32_t benchRunCase(const SBenchCfg *pCfg, SBenchCase *pCase) {
+  int32_t code = 0;
+
+  if (benchOpenVnode(pCfg, pCase) < 0 || benchCreateTables(pCfg, pCase) < 0 || benchInsertAndCommit(pCfg, pCase) < 0 ||
+      benchScan(pCfg, pCase) < 0 || benchLastRow(pCfg, pCase) < 0) {
+    printf("vgId:%d, maxRows:%d sttTrigger:%d failed since %s\n", pCase->vgId, pCase->maxRows, pCase->sttTrigger,
+           terrstr());
+    code = -1;
+  }
+
+  benchCloseVnode(pCase);
+  return code;
+}
+
+static double benchRate(int64_t num, int64_t us) { return (double)num * 1000000 / TMAX(us, 1); }
+
+static int32_t benchCaseToJson(const void *pObj, SJson *pJson) {
+  const SBenchCase *pCase = (const SBenchCase *)pObj;
+  SJson            *pItem = NULL;
+
+  if (tjsonAddIntegerToObject(pJson, "maxRows", pCase->maxRows) < 0) return -1;
+  if (tjsonAddIntegerToObject(pJson, "sttTrigger", pCase->sttTrigger) < 0) return -1;
+  if (tjsonAddIntegerToObject(pJson, "columns", pCase->nCols) < 0) return -1;
+
+  if ((pItem = tjsonCreateObject()) == NULL || tjsonAddItemToObject(pJson, "insert", pItem) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "rows", pCase->insertRows) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "us", pCase->insertUs) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "rowsPerSec", benchRate(pCase->insertRows, pCase->insertUs)) < 0) return -1;
+
+  if ((pItem = tjsonCreateObject()) == NULL || tjsonAddItemToObject(pJson, "commit", pItem) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "us", pCase->commitUs) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "maxUs", pCase->commitMaxUs) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "rowsPerSec", benchRate(pCase->insertRows, pCase->commitUs)) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "MBPerSec", benchRate(pCase->insertBytes, pCase->commitUs) / (1024 * 1024)) < 0) {
+    return -1;
+  }
+
+  if ((pItem = tjsonCreateObject()) == NULL || tjsonAddItemToObject(pJson, "scan", pItem) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "openUs", pCase->openUs) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "us", pCase->scanUs) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "rows", pCase->scanRows) < 0) return -1;
+  if (tjsonAddIntegerToObject(pItem, "blocks", pCase->scanBlocks) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "rowsPerSec", benchRate(pCase->scanRows, pCase->scanUs)) < 0) return -1;
+
+  if ((pItem = tjsonCreateObject()) == NULL || tjsonAddItemToObject(pJson, "lastRowCache", pItem) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "hitUs", (double)pCase->hitUs / TMAX(pCase->nHit, 1)) < 0) return -1;
+  if (tjsonAddDoubleToObject(pItem, "missUs", (double)pCase->missUs / TMAX(pCase->nMiss, 1)) < 0) return -1;
+
+  return 0;
+}
+
+static int32_t benchWriteResult(const SBenchCfg *pCfg, const SBenchCase *aCase, int32_t nCase) {
+  SJson  *pJson = tjsonCreateObject();
+  char   *pData = NULL;
+  int32_t code = -1;
+
+  if (pJson == NULL) return -1;
+  if (tjsonAddIntegerToObject(pJson, "tables", pCfg->nTables) < 0) goto _exit;
+  if (tjsonAddIntegerToObject(pJson, "rowsPerTable", pCfg->nRows) < 0) goto _exit;
+  if (tjsonAddIntegerToObject(pJson, "commits", pCfg->nCommits) < 0) goto _exit;
+  if (tjsonAddArray(pJson, "cases", benchCaseToJson, aCase, sizeof(SBenchCase), nCase) < 0) goto _exit;
+
+  pData = tjsonToString(pJson);
+  if (pData == NULL) goto _exit;
+
+  if (pCfg->output[0] == 0) {
+    printf("%s\n", pData);
+  } else {
+    TdFilePtr pFile = taosOpenFile(pCfg->output, TD_FILE_CREATE | TD_FILE_WRITE | TD_FILE_TRUNC);
+    if (pFile == NULL) goto _exit;
+    int64_t n = taosWriteFile(pFile, pData, strlen(pData));
+    taosCloseFile(&pFile);
+    if (n < 0) goto _exit;
+  }
+  code = 0;
+
+_exit:
+  taosMemoryFree(pData);
+  tjsonDelete(pJson);
+  return code;
+}
+
+int main(int argc, char *argv[]) {
+  SBenchCfg cfg = {.nCols = 8, .nTables = 100, .nRows = 10000, .nCommits = 4, .nLoops = 10};
+  SDiskCfg  diskCfg = {.level = 0, .primary = 1};
+  STfs     *pTfs = NULL;
+  int32_t   code = -1;
+
+  snprintf(cfg.dir, sizeof(cfg.dir), "%stsdbBench", TD_TMP_DIR_PATH);
+  cfg.nMaxRows = 2;
+  cfg.aMaxRows[0] = 1024;
+  cfg.aMaxRows[1] = 4096;
+  cfg.nSttTrigger = 2;
+  cfg.aSttTrigger[0] = 1;
+  cfg.aSttTrigger[1] = 8;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-d") == 0 && i < argc - 1) {
+      tstrncpy(cfg.dir, argv[++i], sizeof(cfg.dir));
+    } else if (strcmp(argv[i], "-o") == 0 && i < argc - 1) {
+      tstrncpy(cfg.output, argv[++i], sizeof(cfg.output));
+    } else if (strcmp(argv[i], "-c") == 0 && i < argc - 1) {
+      cfg.nCols = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-t") == 0 && i < argc - 1) {
+      cfg.nTables = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-r") == 0 && i < argc - 1) {
+      cfg.nRows = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-n") == 0 && i < argc - 1) {
+      cfg.nCommits = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-l") == 0 && i < argc - 1) {
+      cfg.nLoops = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-b") == 0 && i < argc - 1) {
+      if (benchParseList(argv[++i], cfg.aMaxRows, &cfg.nMaxRows) < 0) goto _usage;
+    } else if (strcmp(argv[i], "-s") == 0 && i < argc - 1) {
+      if (benchParseList(argv[++i], cfg.aSttTrigger, &cfg.nSttTrigger) < 0) goto _usage;
+    } else {
+      goto _usage;
+    }
+  }
+  if (cfg.nCols < 2 || cfg.nCols > TSDB_MAX_COLUMNS || cfg.nTables <= 0 || cfg.nRows <= 0 || cfg.nCommits <= 0 ||
+      cfg.nLoops <= 0) {
+    goto _usage;
+  }
+
+  taosRemoveDir(cfg.dir);
+  if (taosMkDir(cfg.dir) < 0) {
+    printf("failed to create dir %s\n", cfg.dir);
+    return -1;
+  }
+
+  // keep the log out of the JSON output
+  tstrncpy(tsLogDir, cfg.dir, PATH_MAX);
+  taosInitLog("tsdbBench.log", 1);
+
+  tstrncpy(diskCfg.dir, cfg.dir, TSDB_FILENAME_LEN);
+  pTfs = tfsOpen(&diskCfg, 1);
+  if (pTfs == NULL || walInit() != 0 || syncInit() != 0 || vnodeInit(1) != 0) {
+    printf("failed to init vnode env since %s\n", terrstr());
+    goto _exit;
+  }
+
+  int32_t     nCase = cfg.nMaxRows * cfg.nSttTrigger;
+  SBenchCase *aCase = taosMemoryCalloc(nCase, sizeof(SBenchCase));
+  if (aCase == NULL) goto _exit;
+
+  for (int32_t iCase = 0; iCase < nCase; iCase++) {
+    SBenchCase *pCase = &aCase[iCase];
+    pCase->vgId = iCase + 2;
+    pCase->nCols = cfg.nCols;
+    pCase->maxRows = cfg.aMaxRows[iCase / cfg.nSttTrigger];
+    pCase->sttTrigger = cfg.aSttTrigger[iCase % cfg.nSttTrigger];
+    pCase->pTfs = pTfs;
+    if (benchRunCase(&cfg, pCase) < 0) {
+      taosMemoryFree(aCase);
+      goto _exit;
+    }
+  }
+
+  code = benchWriteResult(&cfg, aCase, nCase);
+  taosMemoryFree(aCase);
+
+_exit:
+  vnodeCleanup();
+  syncCleanUp();
+  walCleanUp();
+  if (pTfs) tfsClose(pTfs);
+  taosCloseLog();
+  if (code == 0) taosRemoveDir(cfg.dir);
+  return code;
+
+_usage:
+  printf("\nusage: %s [options] \n", argv[0]);
+  printf("  [-d dir]: scratch directory of the vnodes, default is:%s\n", cfg.dir);
+  printf("  [-o file]: write the JSON result to file instead of stdout\n");
+  printf("  [-c columns]: number of columns including the timestamp, default is:%d\n", cfg.nCols);
+  printf("  [-t tables]: number of child tables, default is:%d\n", cfg.nTables);
+  printf("  [-r rows]: rows per table, default is:%d\n", cfg.nRows);
+  printf("  [-n commits]: number of commits the rows are split into, default is:%d\n", cfg.nCommits);
+  printf("  [-l loops]: rounds of the last row cache test, default is:%d\n", cfg.nLoops);
+  printf("  [-b maxRows,...]: list of tsdb maxRows (block size) values, default is:1024,4096\n");
+  printf("  [-s sttTrigger,...]: list of stt trigger values, default is:1,8\n");
+  printf("  [-h help]: print out this help\n\n");
+  return 0;
+}
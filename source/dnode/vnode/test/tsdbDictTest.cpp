@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <taoserror.h>
+#include <tglobal.h>
+#include <tsdb.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+enum { DICT_ROW_VALUE, DICT_ROW_NULL, DICT_ROW_NONE };
+
+struct SDictTestRow {
+  int32_t     kind;
+  std::string value;
+};
+
+typedef std::vector<SDictTestRow> SDictTestRows;
+
+// tColDataInit keeps the buffers, so a destroyed column is zeroed before it is used again
+void destroyColData(SColData *pColData) {
+  tColDataDestroy(pColData);
+  memset(pColData, 0, sizeof(*pColData));
+}
+
+class DictCodecEnv : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dictCodec = tsDictCodec;
+    tsDictCodec = true;
+  }
+
+  void TearDown() override {
+    tsDictCodec = dictCodec;
+    destroyColData(&colData);
+    tFree(pOut);
+    tFree(pBuf);
+  }
+
+  void buildColData(int8_t type, const SDictTestRows &rows) {
+    tColDataInit(&colData, 2, type, 0);
+    for (const SDictTestRow &row : rows) {
+      SColVal cv;
+      if (row.kind == DICT_ROW_NONE) {
+        cv = COL_VAL_NONE(2, type);
+      } else if (row.kind == DICT_ROW_NULL) {
+        cv = COL_VAL_NULL(2, type);
+      } else {
+        SValue value = {0};
+        value.nData = (uint32_t)row.value.size();
+        value.pData = (uint8_t *)row.value.data();
+        cv = COL_VAL_VALUE(2, type, value);
+      }
+      ASSERT_EQ(tColDataAppendValue(&colData, &cv), 0);
+    }
+  }
+
+  // encode the column as tCmprBlockData does
+  void encode(int8_t cmprAlg) {
+    blockCol = (SBlockCol){0};
+    blockCol.cid = colData.cid;
+    blockCol.type = colData.type;
+    blockCol.smaOn = colData.smaOn;
+    blockCol.flag = colData.flag;
+    blockCol.szOrigin = colData.nData;
+    ASSERT_EQ(tsdbCmprColData(&colData, cmprAlg, &blockCol, &pOut, 0, &pBuf), 0);
+  }
+
+  int32_t decode(int8_t cmprAlg, SColData *pColData) {
+    tColDataInit(pColData, blockCol.cid, blockCol.type, 0);
+    return tsdbDecmprColData(pOut, &blockCol, cmprAlg, colData.nVal, pColData, &pBuf);
+  }
+
+  void checkRows(SColData *pColData, const SDictTestRows &rows) {
+    ASSERT_EQ(pColData->nVal, (int32_t)rows.size());
+    for (int32_t i = 0; i < pColData->nVal; i++) {
+      SColVal cv;
+      tColDataGetValue(pColData, i, &cv);
+      if (rows[i].kind == DICT_ROW_NONE) {
+        ASSERT_TRUE(COL_VAL_IS_NONE(&cv)) << "row " << i;
+      } else if (rows[i].kind == DICT_ROW_NULL) {
+        ASSERT_TRUE(COL_VAL_IS_NULL(&cv)) << "row " << i;
+      } else {
+        ASSERT_TRUE(COL_VAL_IS_VALUE(&cv)) << "row " << i;
+        ASSERT_EQ(std::string((char *)cv.value.pData, cv.value.nData), rows[i].value) << "row " << i;
+      }
+    }
+  }
+
+  // encode and decode the rows, and check whether the dictionary was used
+  void roundTrip(int8_t type, const SDictTestRows &rows, bool isDict) {
+    for (int8_t cmprAlg : {NO_COMPRESSION, ONE_STAGE_COMP, TWO_STAGE_COMP}) {
+      buildColData(type, rows);
+      encode(cmprAlg);
+      EXPECT_EQ(TSDB_BLOCK_COL_IS_DICT(&blockCol), isDict) << "cmprAlg " << (int32_t)cmprAlg;
+
+      SColData decoded = {0};
+      ASSERT_EQ(decode(cmprAlg, &decoded), 0);
+      checkRows(&decoded, rows);
+      destroyColData(&decoded);
+      destroyColData(&colData);
+    }
+  }
+
+  bool      dictCodec = false;
+  SColData  colData = {0};
+  SBlockCol blockCol = {0};
+  uint8_t  *pOut = NULL;
+  uint8_t  *pBuf = NULL;
+};
+
+SDictTestRows buildRows(int32_t nRow, int32_t nDistinct) {
+  SDictTestRows rows;
+  for (int32_t i = 0; i < nRow; i++) {
+    rows.push_back({DICT_ROW_VALUE, "value_" + std::to_string((i * 7) % nDistinct)});
+  }
+  return rows;
+}
+
+}  // namespace
+
+TEST_F(DictCodecEnv, dictHitTest) {
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(1000, 5), true);
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(1000, 1), true);
+
+  // the largest dictionary, codes of 10 bits
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(20000, 1024), true);
+
+  // too few rows to be worth it
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(15, 1), false);
+}
+
+TEST_F(DictCodecEnv, dictFallbackTest) {
+  // more distinct values than a dictionary holds
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(20000, 1025), false);
+
+  // the dictionary is not smaller than the plain values
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(1000, 1000), false);
+
+  // the dictionary is used only when it is enabled
+  tsDictCodec = false;
+  roundTrip(TSDB_DATA_TYPE_BINARY, buildRows(1000, 5), false);
+}
+
+TEST_F(DictCodecEnv, dictNullNoneTest) {
+  SDictTestRows rows;
+  for (int32_t i = 0; i < 1000; i++) {
+    if (i % 5 == 1) {
+      rows.push_back({DICT_ROW_NULL, ""});
+    } else {
+      rows.push_back({DICT_ROW_VALUE, (i % 3) ? "shanghai" : "beijing"});
+    }
+  }
+  roundTrip(TSDB_DATA_TYPE_BINARY, rows, true);
+
+  for (int32_t i = 0; i < 1000; i += 7) {
+    rows[i] = {DICT_ROW_NONE, ""};
+  }
+  roundTrip(TSDB_DATA_TYPE_BINARY, rows, true);
+
+  // the rows are none or null only, nothing is left for a dictionary
+  for (int32_t i = 0; i < 1000; i++) {
+    if (rows[i].kind == DICT_ROW_VALUE) rows[i] = {DICT_ROW_NULL, ""};
+  }
+  buildColData(TSDB_DATA_TYPE_BINARY, rows);
+  EXPECT_EQ(colData.flag, HAS_NULL | HAS_NONE);
+  destroyColData(&colData);
+}
+
+TEST_F(DictCodecEnv, dictEmptyStringTest) {
+  SDictTestRows rows;
+  for (int32_t i = 0; i < 1000; i++) {
+    rows.push_back({DICT_ROW_VALUE, (i % 4) ? "" : "abc"});
+  }
+  roundTrip(TSDB_DATA_TYPE_BINARY, rows, true);
+
+  // all the values are empty, the column has no value data
+  for (int32_t i = 0; i < 1000; i++) {
+    rows[i].value = "";
+  }
+  roundTrip(TSDB_DATA_TYPE_BINARY, rows, false);
+
+  for (int32_t i = 0; i < 1000; i += 3) {
+    rows[i] = {DICT_ROW_NULL, ""};
+  }
+  roundTrip(TSDB_DATA_TYPE_BINARY, rows, false);
+}
+
+TEST_F(DictCodecEnv, dictNcharTest) {
+  // nchar values are stored as UCS-4
+  const std::string aValue[] = {std::string("\x4e\x2d\x00\x00\x56\xfd\x00\x00", 8), std::string("a\0\0\0", 4),
+                                std::string("\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00", 12)};
+
+  SDictTestRows rows;
+  for (int32_t i = 0; i < 1000; i++) {
+    if (i % 11 == 0) {
+      rows.push_back({DICT_ROW_NULL, ""});
+    } else {
+      rows.push_back({DICT_ROW_VALUE, aValue[i % 3]});
+    }
+  }
+  roundTrip(TSDB_DATA_TYPE_NCHAR, rows, true);
+}
+
+TEST_F(DictCodecEnv, dictCorruptTest) {
+  // 3 distinct values of 1 byte, the payload after the raw size is
+  //   nDict(1) | (1, 'a') (1, 'b') (1, 'c') | nBit(1) = 2 | codes
+  SDictTestRows rows;
+  for (int32_t i = 0; i < 100; i++) {
+    rows.push_back({DICT_ROW_VALUE, std::string(1, 'a' + i % 3)});
+  }
+
+  const int32_t nBitOffset = sizeof(int32_t) + 1 + 3 * 2;
+
+  buildColData(TSDB_DATA_TYPE_BINARY, rows);
+  encode(NO_COMPRESSION);
+  ASSERT_TRUE(TSDB_BLOCK_COL_IS_DICT(&blockCol));
+  ASSERT_EQ(pOut[nBitOffset], 2);
+
+  SColData decoded = {0};
+  ASSERT_EQ(decode(NO_COMPRESSION, &decoded), 0);
+  checkRows(&decoded, rows);
+  destroyColData(&decoded);
+
+  // codes wider than a dictionary can need
+  for (uint8_t nBit : {11, 32, 0x80}) {
+    pOut[nBitOffset] = nBit;
+    EXPECT_EQ(decode(NO_COMPRESSION, &decoded), TSDB_CODE_FILE_CORRUPTED) << "nBit " << (int32_t)nBit;
+    destroyColData(&decoded);
+  }
+
+  // a code out of the dictionary
+  pOut[nBitOffset] = 2;
+  pOut[nBitOffset + 1] |= 0x3;
+  EXPECT_EQ(decode(NO_COMPRESSION, &decoded), TSDB_CODE_FILE_CORRUPTED);
+  destroyColData(&decoded);
+
+  // a dictionary larger than allowed
+  pOut[nBitOffset + 1] &= ~0x3;
+  pOut[sizeof(int32_t)] = 0x7f;
+  EXPECT_EQ(decode(NO_COMPRESSION, &decoded), TSDB_CODE_FILE_CORRUPTED);
+  destroyColData(&decoded);
+}
+
+#pragma GCC diagnostic pop
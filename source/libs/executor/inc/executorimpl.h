@@ -173,6 +173,12 @@ typedef struct {
   SSchemaWrapper* qsw;
 } SSchemaInfo;
 
+typedef struct STaskMemInfo {
+  int64_t limit;     // memory budget of the hash tables of all blocking operators in bytes, 0 for no limit
+  int64_t used;      // memory acquired by the blocking operators
+  int64_t reserved;  // memory reserved from the data node query buffer
+} STaskMemInfo;
+
 typedef struct SExecTaskInfo {
   STaskIdInfo   id;
   uint32_t      status;
@@ -191,6 +197,7 @@ typedef struct SExecTaskInfo {
   SSubplan*             pSubplan;
   struct SOperatorInfo* pRoot;
   SLocalFetch      localFetch;
+  STaskMemInfo     memInfo;
 } SExecTaskInfo;
 
 enum {
@@ -317,8 +324,14 @@ typedef struct SAggSupporter {
   SDiskbasedBuf* pResultBuf;           // query result buffer based on blocked-wised disk file
   int32_t        resultRowSize;  // the result buffer size for each result row, with the meta data size for each row
   int32_t        currentPageId;  // current write page id
+  STaskMemInfo*  pMemInfo;       // the task memory governor that memUsed is acquired from
+  int64_t        memUsed;        // memory acquired by the result row hash table
 } SAggSupporter;
 
+// memory of one entry in the result row hash table, including the bucket slot
+#define GET_RES_ROW_ENTRY_SIZE(_l) \
+  (sizeof(SHNode) + GET_RES_WINDOW_KEY_LEN(_l) + sizeof(SResultRowPosition) + POINTER_BYTES)
+
 typedef struct {
   // if the upstream is an interval operator, the interval info is also kept here to get the time window to check if
   // current data block needs to be loaded.
@@ -589,6 +602,11 @@ typedef struct SIntervalAggOperatorInfo {
   STimeWindowAggSupp twAggSup;
   SArray*            pPrevValues;  //  SArray<SGroupKeys> used to keep the previous not null value for interpolation.
   SNode*             pCondition;
+  bool               paneAgg;      // sliding windows are merged from the panes of gcd(interval, sliding)
+  SInterval          paneInterval;
+  SExprSupp          paneSup;
+  SAggSupporter      paneAggSup;
+  SResultRowInfo     paneRowInfo;
 } SIntervalAggOperatorInfo;
 
 typedef struct SMergeAlignedIntervalAggOperatorInfo {
@@ -681,6 +699,43 @@ typedef struct SFillOperatorInfo {
   int32_t           numOfNotFillExpr;
 } SFillOperatorInfo;
 
+#define GROUP_SPILL_FANOUT_BITS 3
+#define GROUP_SPILL_FANOUT      (1 << GROUP_SPILL_FANOUT_BITS)
+#define GROUP_SPILL_MAX_LEVEL   4
+
+typedef struct SGroupSpillPage {
+  int32_t  pageId;
+  uint64_t groupId;
+} SGroupSpillPage;
+
+typedef struct SGroupSpillPartition {
+  int32_t level;      // number of hash bits consumed to build this partition
+  SArray* pPageList;  // SArray<SGroupSpillPage>
+} SGroupSpillPartition;
+
+#define GROUP_FIXED_KEY_MAX_COLS 2
+
+// a group of one or two fixed width keys, located by the packed key values
+typedef struct SGroupFixedEntry {
+  uint64_t           key[GROUP_FIXED_KEY_MAX_COLS];
+  uint64_t           groupId;
+  SResultRowPosition pos;
+  int8_t             nullMask;  // bit i is set if the key of column i is null
+  bool               used;
+} SGroupFixedEntry;
+
+typedef struct SGroupFixedHash {
+  SGroupFixedEntry* pEntries;  // open addressing slots, linear probing
+  uint32_t          mask;      // number of slots - 1
+  uint32_t          size;
+  STaskMemInfo*     pMemInfo;  // the task memory governor that memUsed is acquired from
+  int64_t           memUsed;
+  int32_t           rows;       // capacity of the buffers of current block
+  uint64_t*         pKeys;      // packed keys of each row, GROUP_FIXED_KEY_MAX_COLS words per row
+  int8_t*           pNullMask;  // null mask of each row
+  uint32_t*         pHashes;    // hash value of each row
+} SGroupFixedHash;
+
 typedef struct SGroupbyOperatorInfo {
   SOptrBasicInfo binfo;
   SAggSupporter  aggSup;
@@ -693,6 +748,20 @@ typedef struct SGroupbyOperatorInfo {
   int32_t       groupKeyLen;  // total group by column width
   SGroupResInfo groupResInfo;
   SExprSupp     scalarSup;
+
+  // rows of groups that do not fit in the task memory budget are spilled into hash partitions
+  bool           spilled;    // no more new groups are accepted in current pass
+  int32_t        spillLevel;  // hash bits consumed by the partition of current pass
+  SDiskbasedBuf* pSpillBuf;
+  SSDataBlock*   pSpillBlock[GROUP_SPILL_FANOUT];  // rows waiting to be written into pages for each partition
+  SArray*        pSpillPages[GROUP_SPILL_FANOUT];  // pages of each partition generated in current pass
+  SArray*        pSpillQueue;                      // partitions waiting to be aggregated, SArray<SGroupSpillPartition>
+  SSDataBlock*   pLoadBlock;                       // read buffer of the spilled pages
+
+  // the groups of at most two fixed width keys are looked up in fixedHash before the key is serialized for the
+  // result row hash table
+  bool            fixedKey;
+  SGroupFixedHash fixedHash;
 } SGroupbyOperatorInfo;
 
 typedef struct SDataGroupInfo {
@@ -709,6 +778,7 @@ typedef struct SPartitionOperatorInfo {
   char*          keyBuf;         // group by keys for hash
   int32_t        groupKeyLen;    // total group by column width
   SHashObj*      pGroupSet;      // quick locate the window object for each result
+  int64_t        memUsed;        // memory acquired from the task memory governor by pGroupSet
 
   SDiskbasedBuf* pBuf;              // query result buffer based on blocked-wised disk file
   int32_t        rowCapacity;       // maximum number of rows for each buffer page
@@ -926,7 +996,7 @@ int32_t getTableScanInfo(SOperatorInfo* pOperator, int32_t* order, int32_t* scan
 int32_t getBufferPgSize(int32_t rowSize, uint32_t* defaultPgsz, uint32_t* defaultBufsz);
 
 void    doSetOperatorCompleted(SOperatorInfo* pOperator);
-void    doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColMatchInfo, SFilterInfo* pFilterInfo);
+int32_t doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColMatchInfo, SFilterInfo* pFilterInfo);
 int32_t addTagPseudoColumnData(SReadHandle* pHandle, SExprInfo* pPseudoExpr, int32_t numOfPseudoExpr,
                                SSDataBlock* pBlock, const char* idStr);
 
@@ -1024,7 +1094,14 @@ void setInputDataBlock(SOperatorInfo* pOperator, SqlFunctionCtx* pCtx, SSDataBlo
                        int32_t scanFlag, bool createDummyCol);
 
 bool    isTaskKilled(SExecTaskInfo* pTaskInfo);
-int32_t checkForQueryBuf(size_t numOfTables);
+int32_t reserveQueryBuf(int64_t size);
+void    releaseQueryBuf(int64_t size);
+
+int32_t initTaskMemInfo(SExecTaskInfo* pTaskInfo);
+void    cleanupTaskMemInfo(SExecTaskInfo* pTaskInfo);
+bool    taskMemAvailable(const STaskMemInfo* pMemInfo, int64_t size);
+int32_t taskMemAcquire(STaskMemInfo* pMemInfo, int64_t size);
+void    taskMemRelease(STaskMemInfo* pMemInfo, int64_t size);
 
 void setTaskKilled(SExecTaskInfo* pTaskInfo);
 void queryCostStatis(SExecTaskInfo* pTaskInfo);
@@ -1060,6 +1137,7 @@ int32_t aggEncodeResultRow(SOperatorInfo* pOperator, char** result, int32_t* len
 
 STimeWindow getActiveTimeWindow(SDiskbasedBuf* pBuf, SResultRowInfo* pResultRowInfo, int64_t ts, SInterval* pInterval,
                                 int32_t order);
+int64_t     getIntervalPaneLength(const SInterval* pInterval);
 int32_t getNumOfRowsInTimeWindow(SDataBlockInfo* pDataBlockInfo, TSKEY* pPrimaryColumn, int32_t startPos, TSKEY ekey,
                                  __block_search_fn_t searchFn, STableQueryInfo* item, int32_t order);
 int32_t binarySearchForKey(char* pValue, int num, TSKEY key, int order);
@@ -1070,6 +1148,8 @@ bool               functionNeedToExecute(SqlFunctionCtx* pCtx);
 bool               isOverdue(TSKEY ts, STimeWindowAggSupp* pSup);
 bool               isCloseWindow(STimeWindow* pWin, STimeWindowAggSupp* pSup);
 bool               isDeletedWindow(STimeWindow* pWin, uint64_t groupId, SAggSupporter* pSup);
+void               compactFunctions(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx, int32_t numOfOutput,
+                                    SExecTaskInfo* pTaskInfo, SColumnInfoData* pTimeWindowData);
 bool               isDeletedStreamWindow(STimeWindow* pWin, uint64_t groupId, SStreamState* pState, STimeWindowAggSupp* pTwSup);
 void               appendOneRowToStreamSpecialBlock(SSDataBlock* pBlock, TSKEY* pStartTs, TSKEY* pEndTs, uint64_t* pUid, uint64_t* pGp, void* pTbName);
 void               printDataBlock(SSDataBlock* pBlock, const char* flag);
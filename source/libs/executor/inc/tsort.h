@@ -32,6 +32,8 @@ typedef struct SMultiMergeSource {
   int32_t      type;
   int32_t      rowIndex;
   SSDataBlock* pBlock;
+  char*        pKeys;  // normalized sort keys of pBlock, one fixed-width entry per row
+  int32_t      keyCap;
 } SMultiMergeSource;
 
 typedef struct SSortSource {
@@ -51,6 +53,7 @@ typedef struct SMsortComparParam {
   int32_t numOfSources;
   SArray* orderInfo;  // SArray<SBlockOrderInfo>
   bool    cmpGroupId;
+  int32_t keyWidth;  // 0: not decided yet, -1: normalized keys not applicable
 } SMsortComparParam;
 
 typedef struct SSortHandle  SSortHandle;
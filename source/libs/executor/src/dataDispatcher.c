@@ -112,7 +112,9 @@ static bool allocBuf(SDataDispatchHandle* pDispatcher, const SInputData* pInput,
     }
   */
 
-  pBuf->allocSize = sizeof(SDataCacheEntry) + blockGetEncodeSize(pInput->pData);
+  int32_t size =
+      (tsCompressColData < 0) ? blockGetEncodeSize(pInput->pData) : blockGetCompressedEncodeSize(pInput->pData);
+  pBuf->allocSize = sizeof(SDataCacheEntry) + size;
 
   pBuf->pData = taosMemoryMalloc(pBuf->allocSize);
   if (pBuf->pData == NULL) {
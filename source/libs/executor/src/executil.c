@@ -878,6 +878,14 @@ static int32_t optimizeTbnameInCondImpl(void* metaHandle, int64_t suid, SArray*
   }
   return -1;
 }
+// the tables of a vnode are distributed to the slices of a parallel scan by the hash of uid
+bool isTableInScanSlice(SScanPhysiNode* pScanNode, uint64_t uid) {
+  if (pScanNode->numOfSlices <= 1) {
+    return true;
+  }
+  return MurmurHash3_32((const char*)&uid, sizeof(uid)) % pScanNode->numOfSlices == pScanNode->sliceIdx;
+}
+
 int32_t getTableList(void* metaHandle, void* pVnode, SScanPhysiNode* pScanNode, SNode* pTagCond, SNode* pTagIndexCond,
                      STableListInfo* pListInfo) {
   int32_t code = TSDB_CODE_SUCCESS;
@@ -946,7 +954,11 @@ int32_t getTableList(void* metaHandle, void* pVnode, SScanPhysiNode* pScanNode,
   size_t numOfTables = taosArrayGetSize(res);
   for (int i = 0; i < numOfTables; i++) {
     STableKeyInfo info = {.uid = *(uint64_t*)taosArrayGet(res, i), .groupId = 0};
-    void*         p = taosArrayPush(pListInfo->pTableList, &info);
+    if (!isTableInScanSlice(pScanNode, info.uid)) {
+      continue;
+    }
+
+    void* p = taosArrayPush(pListInfo->pTableList, &info);
     if (p == NULL) {
       taosArrayDestroy(res);
       return TSDB_CODE_OUT_OF_MEMORY;
@@ -1595,6 +1607,18 @@ STimeWindow getActiveTimeWindow(SDiskbasedBuf* pBuf, SResultRowInfo* pResultRowI
   return w;
 }
 
+// all the window boundaries of a sliding interval fall on the boundaries of the panes of gcd(interval, sliding)
+int64_t getIntervalPaneLength(const SInterval* pInterval) {
+  int64_t a = pInterval->interval;
+  int64_t b = pInterval->sliding;
+  while (b != 0) {
+    int64_t t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
 bool hasLimitOffsetInfo(SLimitInfo* pLimitInfo) {
   return (pLimitInfo->limit.limit != -1 || pLimitInfo->limit.offset != -1 || pLimitInfo->slimit.limit != -1 ||
           pLimitInfo->slimit.offset != -1);
@@ -83,8 +83,6 @@ int32_t getMaximumIdleDurationSec() { return tsShellActivityTimer * 2; }
 
 static void setBlockSMAInfo(SqlFunctionCtx* pCtx, SExprInfo* pExpr, SSDataBlock* pBlock);
 
-static void releaseQueryBuf(size_t numOfTables);
-
 static void destroyFillOperatorInfo(void* param);
 static void destroyProjectOperatorInfo(void* param);
 static void destroyOrderOperatorInfo(void* param);
@@ -253,6 +251,16 @@ SResultRow* doSetResultOutBufByKey(SDiskbasedBuf* pResultBuf, SResultRowInfo* pR
   // allocate a new buffer page
   if (pResult == NULL) {
     ASSERT(pSup->resultRowSize > 0);
+    int64_t size = GET_RES_ROW_ENTRY_SIZE(bytes);
+    int32_t code = taskMemAcquire(&pTaskInfo->memInfo, size);
+    if (code != TSDB_CODE_SUCCESS) {
+      qError("too many result rows in query, used:%" PRId64 ", limit:%" PRId64 ", %s", pTaskInfo->memInfo.used,
+             pTaskInfo->memInfo.limit, GET_TASKID(pTaskInfo));
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+
+    pSup->pMemInfo = &pTaskInfo->memInfo;
+    pSup->memUsed += size;
     pResult = getNewResultRow(pResultBuf, &pSup->currentPageId, pSup->resultRowSize);
 
     // add a new result set for a new group
@@ -1082,12 +1090,12 @@ void setResultRowInitCtx(SResultRow* pResult, SqlFunctionCtx* pCtx, int32_t numO
   }
 }
 
-static void extractQualifiedTupleByFilterResult(SSDataBlock* pBlock, const SColumnInfoData* p, bool keep,
-                                                int32_t status);
+static int32_t extractQualifiedTupleByFilterResult(SSDataBlock* pBlock, const SColumnInfoData* p, bool keep,
+                                                   int32_t status);
 
-void doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColMatchInfo, SFilterInfo* pFilterInfo) {
+int32_t doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColMatchInfo, SFilterInfo* pFilterInfo) {
   if (pFilterNode == NULL || pBlock->info.rows == 0) {
-    return;
+    return TSDB_CODE_SUCCESS;
   }
 
   SFilterInfo* filter = pFilterInfo;
@@ -1101,10 +1109,21 @@ void doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColM
   if (filter == NULL) {
     needFree = true;
     code = filterInitFromNode((SNode*)pFilterNode, &filter, 0);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return code;
+    }
   }
 
   SFilterColumnParam param1 = {.numOfCols = taosArrayGetSize(pBlock->pDataBlock), .pDataBlock = pBlock->pDataBlock};
   code = filterSetDataFromSlotId(filter, &param1);
+  if (code != TSDB_CODE_SUCCESS) {
+    if (needFree) {
+      filterFreeInfo(filter);
+    }
+    terrno = code;
+    return code;
+  }
 
   SColumnInfoData* p = NULL;
   int32_t          status = 0;
@@ -1116,7 +1135,13 @@ void doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColM
     filterFreeInfo(filter);
   }
 
-  extractQualifiedTupleByFilterResult(pBlock, p, keep, status);
+  code = extractQualifiedTupleByFilterResult(pBlock, p, keep, status);
+  if (code != TSDB_CODE_SUCCESS) {
+    colDataDestroy(p);
+    taosMemoryFree(p);
+    terrno = code;
+    return code;
+  }
 
   if (pColMatchInfo != NULL) {
     for (int32_t i = 0; i < taosArrayGetSize(pColMatchInfo); ++i) {
@@ -1133,13 +1158,100 @@ void doFilter(const SNode* pFilterNode, SSDataBlock* pBlock, const SArray* pColM
 
   colDataDestroy(p);
   taosMemoryFree(p);
+  return TSDB_CODE_SUCCESS;
 }
 
-void extractQualifiedTupleByFilterResult(SSDataBlock* pBlock, const SColumnInfoData* p, bool keep, int32_t status) {
-  if (keep) {
+// Qualified rows are compacted in place: pSel is ascending and pSel[k] >= k, so a row is always read before the slot
+// it occupies can be overwritten.
+static void extractQualifiedFixedColumn(SColumnInfoData* pCol, const int32_t* pSel, int32_t numOfRows,
+                                        int32_t totalRows) {
+  int32_t bytes = pCol->info.bytes;
+  char*   pData = pCol->pData;
+  char*   bm = pCol->nullbitmap;
+
+  switch (bytes) {
+    case sizeof(int8_t):
+      for (int32_t k = 0; k < numOfRows; ++k) ((int8_t*)pData)[k] = ((int8_t*)pData)[pSel[k]];
+      break;
+    case sizeof(int16_t):
+      for (int32_t k = 0; k < numOfRows; ++k) ((int16_t*)pData)[k] = ((int16_t*)pData)[pSel[k]];
+      break;
+    case sizeof(int32_t):
+      for (int32_t k = 0; k < numOfRows; ++k) ((int32_t*)pData)[k] = ((int32_t*)pData)[pSel[k]];
+      break;
+    case sizeof(int64_t):
+      for (int32_t k = 0; k < numOfRows; ++k) ((int64_t*)pData)[k] = ((int64_t*)pData)[pSel[k]];
+      break;
+    default:
+      for (int32_t k = 0; k < numOfRows; ++k) {
+        if (pSel[k] != k) {
+          memcpy(pData + k * bytes, pData + pSel[k] * bytes, bytes);
+        }
+      }
+      break;
+  }
+
+  if (bm == NULL) {
     return;
   }
 
+  for (int32_t k = 0; k < numOfRows; ++k) {
+    if (colDataIsNull_f(bm, pSel[k])) {
+      colDataSetNull_f(bm, k);
+    } else {
+      colDataSetNotNull_f(bm, k);
+    }
+  }
+
+  // clear the bits of the rows that have been filtered out of the tail
+  for (int32_t k = numOfRows; k < totalRows; ++k) {
+    colDataSetNotNull_f(bm, k);
+  }
+}
+
+// The payload of var length column is repacked into a buffer that only holds the qualified rows.
+static int32_t extractQualifiedVarColumn(SColumnInfoData* pCol, const int32_t* pSel, int32_t numOfRows) {
+  int32_t* offset = pCol->varmeta.offset;
+  uint32_t len = 0;
+  for (int32_t k = 0; k < numOfRows; ++k) {
+    if (offset[pSel[k]] != -1) {
+      char* pVal = pCol->pData + offset[pSel[k]];
+      len += (pCol->info.type == TSDB_DATA_TYPE_JSON) ? getJsonValueLen(pVal) : varDataTLen(pVal);
+    }
+  }
+
+  char* pData = taosMemoryMalloc(TMAX(len, 1));
+  if (pData == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  len = 0;
+  for (int32_t k = 0; k < numOfRows; ++k) {
+    int32_t pos = offset[pSel[k]];
+    if (pos == -1) {
+      offset[k] = -1;
+      continue;
+    }
+
+    char*   pVal = pCol->pData + pos;
+    int32_t dataLen = (pCol->info.type == TSDB_DATA_TYPE_JSON) ? getJsonValueLen(pVal) : varDataTLen(pVal);
+    memcpy(pData + len, pVal, dataLen);
+    offset[k] = len;
+    len += dataLen;
+  }
+
+  taosMemoryFree(pCol->pData);
+  pCol->pData = pData;
+  pCol->varmeta.length = len;
+  pCol->varmeta.allocLen = TMAX(len, 1);
+  return TSDB_CODE_SUCCESS;
+}
+
+int32_t extractQualifiedTupleByFilterResult(SSDataBlock* pBlock, const SColumnInfoData* p, bool keep, int32_t status) {
+  if (keep) {
+    return TSDB_CODE_SUCCESS;
+  }
+
   int32_t totalRows = pBlock->info.rows;
 
   if (status == FILTER_RESULT_ALL_QUALIFIED) {
@@ -1147,43 +1259,44 @@ void extractQualifiedTupleByFilterResult(SSDataBlock* pBlock, const SColumnInfoD
   } else if (status == FILTER_RESULT_NONE_QUALIFIED) {
     pBlock->info.rows = 0;
   } else {
-    SSDataBlock* px = createOneDataBlock(pBlock, true);
+    // turn the filter result into a selection vector once, instead of scanning it again for every column
+    int32_t* pSel = taosMemoryMalloc(sizeof(int32_t) * totalRows);
+    if (pSel == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+
+    const int8_t* pRes = (const int8_t*)p->pData;
+    int32_t       numOfRows = 0;
+    for (int32_t j = 0; j < totalRows; ++j) {
+      pSel[numOfRows] = j;
+      numOfRows += (pRes[j] != 0);
+    }
 
     size_t numOfCols = taosArrayGetSize(pBlock->pDataBlock);
     for (int32_t i = 0; i < numOfCols; ++i) {
-      SColumnInfoData* pSrc = taosArrayGet(px->pDataBlock, i);
       SColumnInfoData* pDst = taosArrayGet(pBlock->pDataBlock, i);
       // it is a reserved column for scalar function, and no data in this column yet.
-      if (pDst->pData == NULL || pSrc->pData == NULL) {
+      if (pDst->pData == NULL) {
         continue;
       }
 
-      colInfoDataCleanup(pDst, pBlock->info.rows);
-
-      int32_t numOfRows = 0;
-      for (int32_t j = 0; j < totalRows; ++j) {
-        if (((int8_t*)p->pData)[j] == 0) {
-          continue;
-        }
-
-        if (colDataIsNull_s(pSrc, j)) {
-          colDataAppendNULL(pDst, numOfRows);
-        } else {
-          colDataAppend(pDst, numOfRows, colDataGetData(pSrc, j), false);
+      if (IS_VAR_DATA_TYPE(pDst->info.type)) {
+        int32_t code = extractQualifiedVarColumn(pDst, pSel, numOfRows);
+        if (code != TSDB_CODE_SUCCESS) {
+          // the columns are left half compacted, the caller has to abort the task
+          taosMemoryFree(pSel);
+          return code;
         }
-        numOfRows += 1;
-      }
-
-      // todo this value can be assigned directly
-      if (pBlock->info.rows == totalRows) {
-        pBlock->info.rows = numOfRows;
       } else {
-        ASSERT(pBlock->info.rows == numOfRows);
+        extractQualifiedFixedColumn(pDst, pSel, numOfRows, totalRows);
       }
     }
 
-    blockDataDestroy(px);  // fix memory leak
+    pBlock->info.rows = numOfRows;
+    taosMemoryFree(pSel);
   }
+
+  return TSDB_CODE_SUCCESS;
 }
 
 void doSetTableGroupOutputBuf(SOperatorInfo* pOperator, int32_t numOfOutput, uint64_t groupId) {
@@ -2465,7 +2578,9 @@ static SSDataBlock* getAggregateResult(SOperatorInfo* pOperator) {
   blockDataEnsureCapacity(pInfo->pRes, pOperator->resultInfo.capacity);
   while (1) {
     doBuildResultDatablock(pOperator, pInfo, &pAggInfo->groupResInfo, pAggInfo->aggSup.pResultBuf);
-    doFilter(pAggInfo->pCondition, pInfo->pRes, NULL, NULL);
+    if (doFilter(pAggInfo->pCondition, pInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
 
     if (!hasRemainResults(&pAggInfo->groupResInfo)) {
       doSetOperatorCompleted(pOperator);
@@ -2861,7 +2976,9 @@ static SSDataBlock* doFill(SOperatorInfo* pOperator) {
       break;
     }
 
-    doFilter(pInfo->pCondition, fillResult, pInfo->pColMatchColInfo, NULL);
+    if (doFilter(pInfo->pCondition, fillResult, pInfo->pColMatchColInfo, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
     if (fillResult->info.rows > 0) {
       break;
     }
@@ -2959,6 +3076,11 @@ int32_t doInitAggInfoSup(SAggSupporter* pAggSup, SqlFunctionCtx* pCtx, int32_t n
 }
 
 void cleanupAggSup(SAggSupporter* pAggSup) {
+  if (pAggSup->pMemInfo != NULL) {
+    taskMemRelease(pAggSup->pMemInfo, pAggSup->memUsed);
+    pAggSup->memUsed = 0;
+  }
+
   taosMemoryFreeClear(pAggSup->keyBuf);
   tSimpleHashCleanup(pAggSup->pResultRowHashTable);
   destroyDiskbasedBuf(pAggSup->pResultBuf);
@@ -4063,6 +4185,11 @@ int32_t createExecTaskInfoImpl(SSubplan* pPlan, SExecTaskInfo** pTaskInfo, SRead
     goto _complete;
   }
 
+  code = initTaskMemInfo(*pTaskInfo);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _complete;
+  }
+
   if (pHandle && pHandle->pStateBackend) {
     (*pTaskInfo)->streamInfo.pState = pHandle->pStateBackend;
   }
@@ -4117,19 +4244,13 @@ void doDestroyTask(SExecTaskInfo* pTaskInfo) {
     nodesDestroyNode((SNode*)pTaskInfo->pSubplan);
   }
 
+  cleanupTaskMemInfo(pTaskInfo);
   taosMemoryFreeClear(pTaskInfo->sql);
   taosMemoryFreeClear(pTaskInfo->id.str);
   taosMemoryFreeClear(pTaskInfo);
 }
 
-static int64_t getQuerySupportBufSize(size_t numOfTables) {
-  size_t s1 = sizeof(STableQueryInfo);
-  //  size_t s3 = sizeof(STableCheckInfo);  buffer consumption in tsdb
-  return (int64_t)(s1 * 1.5 * numOfTables);
-}
-
-int32_t checkForQueryBuf(size_t numOfTables) {
-  int64_t t = getQuerySupportBufSize(numOfTables);
+int32_t reserveQueryBuf(int64_t t) {
   if (tsQueryBufferSizeBytes < 0) {
     return TSDB_CODE_SUCCESS;
   } else if (tsQueryBufferSizeBytes > 0) {
@@ -4150,17 +4271,78 @@ int32_t checkForQueryBuf(size_t numOfTables) {
   return TSDB_CODE_QRY_NOT_ENOUGH_BUFFER;
 }
 
-void releaseQueryBuf(size_t numOfTables) {
-  if (tsQueryBufferSizeBytes < 0) {
+void releaseQueryBuf(int64_t t) {
+  if (tsQueryBufferSizeBytes < 0 || t == 0) {
     return;
   }
 
-  int64_t t = getQuerySupportBufSize(numOfTables);
-
   // restore value is not enough buffer available
   atomic_add_fetch_64(&tsQueryBufferSizeBytes, t);
 }
 
+int32_t initTaskMemInfo(SExecTaskInfo* pTaskInfo) {
+  STaskMemInfo* pMemInfo = &pTaskInfo->memInfo;
+
+  // the stream tasks are long-lived, and the size of their states is bounded by the stream state backend.
+  if (pTaskInfo->execModel != OPTR_EXEC_MODEL_BATCH || tsQueryMaxTaskMemory <= 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  // the memory is charged to the data node query buffer when it is acquired, not when the task is created.
+  pMemInfo->limit = tsQueryMaxTaskMemory * 1048576L;
+  return TSDB_CODE_SUCCESS;
+}
+
+void cleanupTaskMemInfo(SExecTaskInfo* pTaskInfo) {
+  STaskMemInfo* pMemInfo = &pTaskInfo->memInfo;
+  releaseQueryBuf(pMemInfo->reserved);
+  pMemInfo->reserved = 0;
+  pMemInfo->used = 0;
+}
+
+bool taskMemAvailable(const STaskMemInfo* pMemInfo, int64_t size) {
+  if (pMemInfo->limit == 0) {
+    return true;
+  }
+
+  int64_t remain = atomic_load_64(&tsQueryBufferSizeBytes);
+  return (pMemInfo->used + size <= pMemInfo->limit) && (remain < 0 || remain >= size);
+}
+
+int32_t taskMemAcquire(STaskMemInfo* pMemInfo, int64_t size) {
+  if (pMemInfo->limit == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (pMemInfo->used + size > pMemInfo->limit) {
+    return TSDB_CODE_QRY_NOT_ENOUGH_BUFFER;
+  }
+
+  int32_t code = reserveQueryBuf(size);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  if (tsQueryBufferSizeBytes >= 0) {
+    pMemInfo->reserved += size;
+  }
+  pMemInfo->used += size;
+  return TSDB_CODE_SUCCESS;
+}
+
+void taskMemRelease(STaskMemInfo* pMemInfo, int64_t size) {
+  if (pMemInfo->limit == 0) {
+    return;
+  }
+
+  int64_t reserved = TMIN(size, pMemInfo->reserved);
+  releaseQueryBuf(reserved);
+  pMemInfo->reserved -= reserved;
+
+  pMemInfo->used -= size;
+  ASSERT(pMemInfo->used >= 0);
+}
+
 int32_t getOperatorExplainExecInfo(SOperatorInfo* operatorInfo, SArray* pExecInfoList) {
   SExplainExecInfo  execInfo = {0};
   SExplainExecInfo* pExplainInfo = taosArrayPush(pExecInfoList, &execInfo);
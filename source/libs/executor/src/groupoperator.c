@@ -26,7 +26,22 @@
 #include "thash.h"
 #include "ttypes.h"
 
-static void*    getCurrentDataGroupInfo(const SPartitionOperatorInfo* pInfo, SDataGroupInfo** pGroupInfo, int32_t len);
+#define GROUP_SPILL_BLOCK_ROWS 1024
+
+#define GROUP_FIXED_INIT_SLOTS    1024
+#define GROUP_FIXED_PREFETCH_ROWS 8  // rows ahead of the probe whose slot is prefetched
+
+#ifdef WINDOWS
+#define GROUP_FIXED_PREFETCH(_p)
+#else
+#define GROUP_FIXED_PREFETCH(_p) __builtin_prefetch(_p)
+#endif
+
+// memory of one group in the partition operator: the hash node and key, the group info and the initial page id list
+#define GET_DATA_GROUP_ENTRY_SIZE(_l) ((_l) + sizeof(SDataGroupInfo) + sizeof(SArray) + 100 * sizeof(int32_t) + 64)
+
+static void*    getCurrentDataGroupInfo(SPartitionOperatorInfo* pInfo, SDataGroupInfo** pGroupInfo, int32_t len,
+                                        STaskMemInfo* pMemInfo);
 static int32_t* setupColumnOffset(const SSDataBlock* pBlock, int32_t rowCapacity);
 static int32_t  setGroupResultOutputBuf(SOperatorInfo* pOperator, SOptrBasicInfo* binfo, int32_t numOfCols, char* pData,
                                         int16_t bytes, uint64_t groupId, SDiskbasedBuf* pBuf, SAggSupporter* pAggSup);
@@ -36,6 +51,18 @@ static void freeGroupKey(void* param) {
   taosMemoryFree(pKey->pData);
 }
 
+static void destroyFixedGroupHash(SGroupFixedHash* pHash) {
+  if (pHash->pMemInfo != NULL) {
+    taskMemRelease(pHash->pMemInfo, pHash->memUsed);
+    pHash->memUsed = 0;
+  }
+
+  taosMemoryFreeClear(pHash->pEntries);
+  taosMemoryFreeClear(pHash->pKeys);
+  taosMemoryFreeClear(pHash->pNullMask);
+  taosMemoryFreeClear(pHash->pHashes);
+}
+
 static void destroyGroupOperatorInfo(void* param) {
   SGroupbyOperatorInfo* pInfo = (SGroupbyOperatorInfo*)param;
   if (pInfo == NULL) {
@@ -50,6 +77,21 @@ static void destroyGroupOperatorInfo(void* param) {
 
   cleanupGroupResInfo(&pInfo->groupResInfo);
   cleanupAggSup(&pInfo->aggSup);
+
+  for (int32_t i = 0; i < GROUP_SPILL_FANOUT; ++i) {
+    blockDataDestroy(pInfo->pSpillBlock[i]);
+    taosArrayDestroy(pInfo->pSpillPages[i]);
+  }
+
+  for (int32_t i = 0; i < taosArrayGetSize(pInfo->pSpillQueue); ++i) {
+    SGroupSpillPartition* pPart = taosArrayGet(pInfo->pSpillQueue, i);
+    taosArrayDestroy(pPart->pPageList);
+  }
+
+  taosArrayDestroy(pInfo->pSpillQueue);
+  blockDataDestroy(pInfo->pLoadBlock);
+  destroyDiskbasedBuf(pInfo->pSpillBuf);
+  destroyFixedGroupHash(&pInfo->fixedHash);
   taosMemoryFreeClear(param);
 }
 
@@ -231,20 +273,438 @@ static void doAssignGroupKeys(SqlFunctionCtx* pCtx, int32_t numOfOutput, int32_t
   }
 }
 
+static int32_t initGroupSpill(SGroupbyOperatorInfo* pInfo, const SSDataBlock* pBlock, const char* id) {
+  if (pInfo->pSpillBuf != NULL) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (!osTempSpaceAvailable()) {
+    qError("Init group spill buf failed since %s, %s", tstrerror(TSDB_CODE_NO_AVAIL_DISK), id);
+    return TSDB_CODE_NO_AVAIL_DISK;
+  }
+
+  uint32_t pageSize = 0;
+  uint32_t bufSize = 0;
+  getBufferPgSize(blockDataGetRowSize((SSDataBlock*)pBlock), &pageSize, &bufSize);
+
+  int32_t code = createDiskbasedBuf(&pInfo->pSpillBuf, pageSize, bufSize, id, tsTempDir);
+  if (code != TSDB_CODE_SUCCESS) {
+    qError("Create group spill buf failed since %s, %s", tstrerror(code), id);
+    return code;
+  }
+
+  for (int32_t i = 0; i < GROUP_SPILL_FANOUT; ++i) {
+    pInfo->pSpillBlock[i] = createOneDataBlock(pBlock, false);
+    pInfo->pSpillPages[i] = taosArrayInit(4, sizeof(SGroupSpillPage));
+    if (pInfo->pSpillBlock[i] == NULL || pInfo->pSpillPages[i] == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  pInfo->pLoadBlock = createOneDataBlock(pBlock, false);
+  pInfo->pSpillQueue = taosArrayInit(GROUP_SPILL_FANOUT, sizeof(SGroupSpillPartition));
+  if (pInfo->pLoadBlock == NULL || pInfo->pSpillQueue == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+// the high bits are used, since the low bits of the same hash value locate the slot in the result row hash table.
+static int32_t getGroupSpillPartition(const char* pKey, int32_t len, int32_t level) {
+  uint32_t hashVal = MurmurHash3_32(pKey, len);
+  return (hashVal >> (32 - (level + 1) * GROUP_SPILL_FANOUT_BITS)) & (GROUP_SPILL_FANOUT - 1);
+}
+
+static int32_t flushGroupSpillBlock(SGroupbyOperatorInfo* pInfo, int32_t index) {
+  SSDataBlock* pBlock = pInfo->pSpillBlock[index];
+  int32_t      pageSize = getBufPageSize(pInfo->pSpillBuf);
+
+  int32_t start = 0;
+  while (start < pBlock->info.rows) {
+    int32_t stop = 0;
+    blockDataSplitRows(pBlock, pBlock->info.hasVarCol, start, &stop, pageSize);
+    SSDataBlock* p = blockDataExtractBlock(pBlock, start, stop - start + 1);
+    if (p == NULL) {
+      return terrno;
+    }
+
+    SGroupSpillPage page = {.pageId = -1, .groupId = pBlock->info.groupId};
+    void*           pPage = getNewBufPage(pInfo->pSpillBuf, &page.pageId);
+    if (pPage == NULL) {
+      blockDataDestroy(p);
+      return terrno;
+    }
+
+    blockDataToBuf(pPage, p);
+    setBufPageDirty(pPage, true);
+    releaseBufPage(pInfo->pSpillBuf, pPage);
+
+    taosArrayPush(pInfo->pSpillPages[index], &page);
+    blockDataDestroy(p);
+    start = stop + 1;
+  }
+
+  blockDataCleanup(pBlock);
+  return TSDB_CODE_SUCCESS;
+}
+
+static void doSpillGroupRows(SOperatorInfo* pOperator, SSDataBlock* pBlock, int32_t rowIndex, int32_t num,
+                             int32_t len) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+
+  int32_t      index = getGroupSpillPartition(pInfo->keyBuf, len, pInfo->spillLevel);
+  SSDataBlock* pDst = pInfo->pSpillBlock[index];
+
+  // all rows in one page belong to the same group id
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (pDst->info.rows > 0 && pDst->info.groupId != pBlock->info.groupId) {
+    code = flushGroupSpillBlock(pInfo, index);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+  }
+
+  code = blockDataEnsureCapacity(pDst, pDst->info.rows + num);
+  if (code != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pTaskInfo->env, code);
+  }
+
+  size_t numOfCols = taosArrayGetSize(pBlock->pDataBlock);
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* pSrc = taosArrayGet(pBlock->pDataBlock, i);
+    SColumnInfoData* pDstCol = taosArrayGet(pDst->pDataBlock, i);
+
+    for (int32_t k = 0; k < num; ++k) {
+      bool isNull = colDataIsNull_s(pSrc, rowIndex + k);
+      code = colDataAppend(pDstCol, pDst->info.rows + k, isNull ? NULL : colDataGetData(pSrc, rowIndex + k), isNull);
+      if (code != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pTaskInfo->env, code);
+      }
+    }
+  }
+
+  pDst->info.rows += num;
+  pDst->info.groupId = pBlock->info.groupId;
+
+  if (pDst->info.rows >= GROUP_SPILL_BLOCK_ROWS) {
+    code = flushGroupSpillBlock(pInfo, index);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+  }
+}
+
+// Once a group is rejected in one pass, no more new groups are accepted in this pass, so that all rows of a group are
+// either aggregated in memory or spilled into the same partition.
+static bool acceptNewGroup(SOperatorInfo* pOperator, SSDataBlock* pBlock, int32_t len) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SAggSupporter*        pSup = &pInfo->aggSup;
+
+  // the hash bits are used up, let the memory governor fail the query if the groups still do not fit
+  if (pInfo->spillLevel >= GROUP_SPILL_MAX_LEVEL) {
+    return true;
+  }
+
+  if (!pInfo->spilled && taskMemAvailable(&pTaskInfo->memInfo, GET_RES_ROW_ENTRY_SIZE(len))) {
+    return true;
+  }
+
+  SET_RES_WINDOW_KEY(pSup->keyBuf, pInfo->keyBuf, len, pBlock->info.groupId);
+  if (tSimpleHashGet(pSup->pResultRowHashTable, pSup->keyBuf, GET_RES_WINDOW_KEY_LEN(len)) != NULL) {
+    return true;
+  }
+
+  if (!pInfo->spilled) {
+    int32_t code = initGroupSpill(pInfo, pBlock, GET_TASKID(pTaskInfo));
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+
+    pInfo->spilled = true;
+    qDebug("group by memory used:%" PRId64 " reaches the limit:%" PRId64 ", spill new groups at level:%d, %s",
+           pTaskInfo->memInfo.used, pTaskInfo->memInfo.limit, pInfo->spillLevel, GET_TASKID(pTaskInfo));
+  }
+
+  return false;
+}
+
+// return false if the rows are spilled
+static bool doAggregateGroupRows(SOperatorInfo* pOperator, SSDataBlock* pBlock, int32_t rowIndex, int32_t num) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SqlFunctionCtx*       pCtx = pOperator->exprSupp.pCtx;
+
+  int32_t len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
+  if (!acceptNewGroup(pOperator, pBlock, len)) {
+    doSpillGroupRows(pOperator, pBlock, rowIndex, num, len);
+    return false;
+  }
+
+  int32_t ret = setGroupResultOutputBuf(pOperator, &(pInfo->binfo), pOperator->exprSupp.numOfExprs, pInfo->keyBuf, len,
+                                        pBlock->info.groupId, pInfo->aggSup.pResultBuf, &pInfo->aggSup);
+  if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
+    T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_APP_ERROR);
+  }
+
+  doApplyFunctions(pTaskInfo, pCtx, NULL, rowIndex, num, pBlock->info.rows, pOperator->exprSupp.numOfExprs);
+
+  // assign the group keys or user input constant values if required
+  doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, pBlock->info.rows, rowIndex);
+  return true;
+}
+
+static bool isFixedGroupKey(const SArray* pGroupCols) {
+  int32_t numOfGroupCols = taosArrayGetSize(pGroupCols);
+  if (numOfGroupCols == 0 || numOfGroupCols > GROUP_FIXED_KEY_MAX_COLS) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < numOfGroupCols; ++i) {
+    SColumn* pCol = taosArrayGet(pGroupCols, i);
+    if (IS_VAR_DATA_TYPE(pCol->type) || pCol->type == TSDB_DATA_TYPE_JSON || pCol->bytes <= 0 ||
+        pCol->bytes > sizeof(uint64_t)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static FORCE_INLINE uint32_t fixedGroupHash(const uint64_t* pKey, int8_t nullMask, uint64_t groupId) {
+  uint64_t h = pKey[0] * 0x9E3779B97F4A7C15ULL;
+  h ^= pKey[1] * 0xC2B2AE3D27D4EB4FULL;
+  h ^= (groupId + (uint64_t)nullMask) * 0x165667B19E3779F9ULL;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  return (uint32_t)h;
+}
+
+static FORCE_INLINE bool fixedGroupKeyEqual(const uint64_t* pKey1, const uint64_t* pKey2) {
+  return pKey1[0] == pKey2[0] && pKey1[1] == pKey2[1];
+}
+
+// pack the keys and compute the hash values of all rows in the block, column by column
+static int32_t packFixedGroupKeys(SGroupbyOperatorInfo* pInfo, SSDataBlock* pBlock) {
+  SGroupFixedHash* pHash = &pInfo->fixedHash;
+  int32_t          rows = pBlock->info.rows;
+
+  if (rows > pHash->rows) {
+    uint64_t* pKeys = taosMemoryRealloc(pHash->pKeys, sizeof(uint64_t) * GROUP_FIXED_KEY_MAX_COLS * rows);
+    if (pKeys == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+    pHash->pKeys = pKeys;
+
+    int8_t* pNullMask = taosMemoryRealloc(pHash->pNullMask, rows);
+    if (pNullMask == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+    pHash->pNullMask = pNullMask;
+
+    uint32_t* pHashes = taosMemoryRealloc(pHash->pHashes, sizeof(uint32_t) * rows);
+    if (pHashes == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+    pHash->pHashes = pHashes;
+
+    pHash->rows = rows;
+  }
+
+  memset(pHash->pKeys, 0, sizeof(uint64_t) * GROUP_FIXED_KEY_MAX_COLS * rows);
+  memset(pHash->pNullMask, 0, rows);
+
+  int32_t numOfGroupCols = taosArrayGetSize(pInfo->pGroupCols);
+  for (int32_t i = 0; i < numOfGroupCols; ++i) {
+    SColumn*         pCol = taosArrayGet(pInfo->pGroupCols, i);
+    SColumnInfoData* pColInfoData = taosArrayGet(pBlock->pDataBlock, pCol->slotId);
+    SColumnDataAgg*  pColAgg = (pBlock->pBlockAgg != NULL) ? pBlock->pBlockAgg[pCol->slotId] : NULL;
+    uint64_t*        pKey = pHash->pKeys + i;
+
+    for (int32_t j = 0; j < rows; ++j, pKey += GROUP_FIXED_KEY_MAX_COLS) {
+      if (colDataIsNull(pColInfoData, rows, j, pColAgg)) {
+        pHash->pNullMask[j] |= (1 << i);
+      } else {
+        memcpy(pKey, colDataGetData(pColInfoData, j), pCol->bytes);
+      }
+    }
+  }
+
+  for (int32_t j = 0; j < rows; ++j) {
+    pHash->pHashes[j] =
+        fixedGroupHash(pHash->pKeys + j * GROUP_FIXED_KEY_MAX_COLS, pHash->pNullMask[j], pBlock->info.groupId);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+// the slot of the group, or the empty slot where it is to be put
+static FORCE_INLINE SGroupFixedEntry* getFixedGroupEntry(SGroupFixedHash* pHash, const uint64_t* pKey,
+                                                         int8_t nullMask, uint64_t groupId, uint32_t hashVal) {
+  uint32_t slot = hashVal & pHash->mask;
+  while (1) {
+    SGroupFixedEntry* pEntry = &pHash->pEntries[slot];
+    if (!pEntry->used || (pEntry->nullMask == nullMask && pEntry->groupId == groupId &&
+                          fixedGroupKeyEqual(pEntry->key, pKey))) {
+      return pEntry;
+    }
+    slot = (slot + 1) & pHash->mask;
+  }
+}
+
+static int32_t resizeFixedGroupHash(SGroupFixedHash* pHash, STaskMemInfo* pMemInfo) {
+  uint32_t numOfSlots = (pHash->pEntries == NULL) ? GROUP_FIXED_INIT_SLOTS : (pHash->mask + 1) * 2;
+  int64_t  size = (int64_t)numOfSlots * sizeof(SGroupFixedEntry);
+
+  int32_t code = taskMemAcquire(pMemInfo, size);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  SGroupFixedEntry* pEntries = taosMemoryCalloc(numOfSlots, sizeof(SGroupFixedEntry));
+  if (pEntries == NULL) {
+    taskMemRelease(pMemInfo, size);
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  SGroupFixedHash newHash = *pHash;
+  newHash.pEntries = pEntries;
+  newHash.mask = numOfSlots - 1;
+
+  for (uint32_t i = 0; pHash->pEntries != NULL && i <= pHash->mask; ++i) {
+    SGroupFixedEntry* pEntry = &pHash->pEntries[i];
+    if (!pEntry->used) continue;
+
+    uint32_t hashVal = fixedGroupHash(pEntry->key, pEntry->nullMask, pEntry->groupId);
+    *getFixedGroupEntry(&newHash, pEntry->key, pEntry->nullMask, pEntry->groupId, hashVal) = *pEntry;
+  }
+
+  if (pHash->pMemInfo != NULL) {
+    taskMemRelease(pHash->pMemInfo, pHash->memUsed);
+  }
+
+  taosMemoryFree(pHash->pEntries);
+  pHash->pEntries = pEntries;
+  pHash->mask = numOfSlots - 1;
+  pHash->pMemInfo = pMemInfo;
+  pHash->memUsed = size;
+  return TSDB_CODE_SUCCESS;
+}
+
+static void clearFixedGroupHash(SGroupFixedHash* pHash) {
+  if (pHash->pEntries != NULL) {
+    memset(pHash->pEntries, 0, (pHash->mask + 1) * sizeof(SGroupFixedEntry));
+  }
+  pHash->size = 0;
+}
+
+// the same as doSetResultOutBufByKey for a group that is already in the result row hash table
+static void setFixedGroupResultOutputBuf(SOperatorInfo* pOperator, SResultRowPosition* pPos) {
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SResultRowInfo*       pResultRowInfo = &pInfo->binfo.resultRowInfo;
+  SDiskbasedBuf*        pBuf = pInfo->aggSup.pResultBuf;
+
+  SResultRow* pResultRow = getResultRowByPos(pBuf, pPos, true);
+  if (pResultRowInfo->cur.pageId != -1 && pResultRow->pageId != pResultRowInfo->cur.pageId) {
+    SFilePage* pPage = getBufPage(pBuf, pResultRowInfo->cur.pageId);
+    releaseBufPage(pBuf, pPage);
+  }
+
+  pResultRowInfo->cur = *pPos;
+  setResultRowInitCtx(pResultRow, pOperator->exprSupp.pCtx, pOperator->exprSupp.numOfExprs,
+                      pOperator->exprSupp.rowEntryInfoOffset);
+}
+
+// Rows of the groups met before are aggregated without building the group key. The groups met for the first time
+// go through doAggregateGroupRows, so that the result row hash table, the memory limit and the spill are handled as
+// the other group by keys.
+static void doHashGroupbyAggFixed(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupFixedHash*      pHash = &pInfo->fixedHash;
+  SqlFunctionCtx*       pCtx = pOperator->exprSupp.pCtx;
+  int32_t               rows = pBlock->info.rows;
+  uint64_t              groupId = pBlock->info.groupId;
+
+  if (pHash->pEntries == NULL) {
+    int32_t code = resizeFixedGroupHash(pHash, &pTaskInfo->memInfo);
+    if (code == TSDB_CODE_QRY_NOT_ENOUGH_BUFFER) {
+      // not even the first slots fit in the memory limit, the generic path is taken, which spills the groups
+      qDebug("group by fixed key path is off since %s, %s", tstrerror(code), GET_TASKID(pTaskInfo));
+      pInfo->fixedKey = false;
+      return;
+    } else if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+  }
+
+  int32_t code = packFixedGroupKeys(pInfo, pBlock);
+  if (code != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pTaskInfo->env, code);
+  }
+
+  int32_t start = 0;
+  while (start < rows) {
+    uint64_t* pKey = pHash->pKeys + start * GROUP_FIXED_KEY_MAX_COLS;
+    int8_t    nullMask = pHash->pNullMask[start];
+    uint32_t  hashVal = pHash->pHashes[start];
+
+    // rows of the same group in a row are aggregated together
+    int32_t end = start + 1;
+    while (end < rows && pHash->pHashes[end] == hashVal && pHash->pNullMask[end] == nullMask &&
+           fixedGroupKeyEqual(pHash->pKeys + end * GROUP_FIXED_KEY_MAX_COLS, pKey)) {
+      ++end;
+    }
+
+    if (end + GROUP_FIXED_PREFETCH_ROWS < rows) {
+      GROUP_FIXED_PREFETCH(&pHash->pEntries[pHash->pHashes[end + GROUP_FIXED_PREFETCH_ROWS] & pHash->mask]);
+    }
+
+    int32_t           num = end - start;
+    SGroupFixedEntry* pEntry = getFixedGroupEntry(pHash, pKey, nullMask, groupId, hashVal);
+    if (pEntry->used) {
+      setFixedGroupResultOutputBuf(pOperator, &pEntry->pos);
+      doApplyFunctions(pTaskInfo, pCtx, NULL, start, num, rows, pOperator->exprSupp.numOfExprs);
+      doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, rows, start);
+      start = end;
+      continue;
+    }
+
+    recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, start);
+    if (doAggregateGroupRows(pOperator, pBlock, start, num)) {
+      // the group stays in the result row hash table only, if the slots can not grow within the memory limit
+      if ((pHash->size + 1) * 2 <= pHash->mask + 1 ||
+          resizeFixedGroupHash(pHash, &pTaskInfo->memInfo) == TSDB_CODE_SUCCESS) {
+        pEntry = getFixedGroupEntry(pHash, pKey, nullMask, groupId, hashVal);
+        pEntry->key[0] = pKey[0];
+        pEntry->key[1] = pKey[1];
+        pEntry->groupId = groupId;
+        pEntry->nullMask = nullMask;
+        pEntry->pos = pInfo->binfo.resultRowInfo.cur;
+        pEntry->used = true;
+        pHash->size += 1;
+      }
+    }
+
+    start = end;
+  }
+}
+
 static void doHashGroupbyAgg(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
   SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
   SGroupbyOperatorInfo* pInfo = pOperator->info;
 
-  SqlFunctionCtx* pCtx = pOperator->exprSupp.pCtx;
-  int32_t         numOfGroupCols = taosArrayGetSize(pInfo->pGroupCols);
+  if (pInfo->fixedKey) {
+    doHashGroupbyAggFixed(pOperator, pBlock);
+    // the block is left to the generic path if the fixed key path has been turned off
+    if (pInfo->fixedKey) {
+      return;
+    }
+  }
+
+  int32_t numOfGroupCols = taosArrayGetSize(pInfo->pGroupCols);
   //  if (type == TSDB_DATA_TYPE_FLOAT || type == TSDB_DATA_TYPE_DOUBLE) {
   // qError("QInfo:0x%"PRIx64" group by not supported on double/float columns, abort", GET_TASKID(pRuntimeEnv));
   //    return;
   //  }
 
-  int32_t     len = 0;
-  STimeWindow w = TSWINDOW_INITIALIZER;
-
   terrno = TSDB_CODE_SUCCESS;
   int32_t num = 0;
   for (int32_t j = 0; j < pBlock->info.rows; ++j) {
@@ -275,34 +735,105 @@ static void doHashGroupbyAgg(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
       continue;
     }
 
-    len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
-    int32_t ret = setGroupResultOutputBuf(pOperator, &(pInfo->binfo), pOperator->exprSupp.numOfExprs, pInfo->keyBuf,
-                                          len, pBlock->info.groupId, pInfo->aggSup.pResultBuf, &pInfo->aggSup);
-    if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
-      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_APP_ERROR);
-    }
-
-    int32_t rowIndex = j - num;
-    doApplyFunctions(pTaskInfo, pCtx, NULL, rowIndex, num, pBlock->info.rows, pOperator->exprSupp.numOfExprs);
-
-    // assign the group keys or user input constant values if required
-    doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, pBlock->info.rows, rowIndex);
+    doAggregateGroupRows(pOperator, pBlock, j - num, num);
     recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j);
     num = 1;
   }
 
   if (num > 0) {
-    len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
-    int32_t ret = setGroupResultOutputBuf(pOperator, &(pInfo->binfo), pOperator->exprSupp.numOfExprs, pInfo->keyBuf,
-                                          len, pBlock->info.groupId, pInfo->aggSup.pResultBuf, &pInfo->aggSup);
-    if (ret != TSDB_CODE_SUCCESS) {
-      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_APP_ERROR);
+    doAggregateGroupRows(pOperator, pBlock, pBlock->info.rows - num, num);
+  }
+}
+
+// move the pending rows of all partitions of current pass into the spill queue
+static void finishGroupSpillPass(SOperatorInfo* pOperator) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  if (!pInfo->spilled) {
+    return;
+  }
+
+  for (int32_t i = 0; i < GROUP_SPILL_FANOUT; ++i) {
+    int32_t code = flushGroupSpillBlock(pInfo, i);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+
+    if (taosArrayGetSize(pInfo->pSpillPages[i]) == 0) {
+      continue;
+    }
+
+    SGroupSpillPartition part = {.level = pInfo->spillLevel + 1, .pPageList = pInfo->pSpillPages[i]};
+    taosArrayPush(pInfo->pSpillQueue, &part);
+
+    pInfo->pSpillPages[i] = taosArrayInit(4, sizeof(SGroupSpillPage));
+    if (pInfo->pSpillPages[i] == NULL) {
+      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_OUT_OF_MEMORY);
     }
+  }
+
+  pInfo->spilled = false;
+}
+
+// all results of the previous pass have been returned, so the groups in memory are discarded.
+static void resetGroupAggSup(SGroupbyOperatorInfo* pInfo) {
+  SAggSupporter* pSup = &pInfo->aggSup;
 
-    int32_t rowIndex = pBlock->info.rows - num;
-    doApplyFunctions(pTaskInfo, pCtx, NULL, rowIndex, num, pBlock->info.rows, pOperator->exprSupp.numOfExprs);
-    doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, pBlock->info.rows, rowIndex);
+  tSimpleHashClear(pSup->pResultRowHashTable);
+  clearDiskbasedBuf(pSup->pResultBuf);
+  pSup->currentPageId = -1;
+  if (pSup->pMemInfo != NULL) {
+    taskMemRelease(pSup->pMemInfo, pSup->memUsed);
+    pSup->memUsed = 0;
   }
+
+  initResultRowInfo(&pInfo->binfo.resultRowInfo);
+  cleanupGroupResInfo(&pInfo->groupResInfo);
+  clearFixedGroupHash(&pInfo->fixedHash);
+  pInfo->isInit = false;
+}
+
+static void doAggregateSpilledPartition(SOperatorInfo* pOperator) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SSDataBlock*          pBlock = pInfo->pLoadBlock;
+
+  // the most recently spilled partition first, to release the disk space as soon as possible
+  SGroupSpillPartition part = *(SGroupSpillPartition*)taosArrayPop(pInfo->pSpillQueue);
+
+  resetGroupAggSup(pInfo);
+  pInfo->spillLevel = part.level;
+
+  for (int32_t i = 0; i < taosArrayGetSize(part.pPageList); ++i) {
+    SGroupSpillPage* pPageInfo = taosArrayGet(part.pPageList, i);
+
+    void* pPage = getBufPage(pInfo->pSpillBuf, pPageInfo->pageId);
+    if (pPage == NULL) {
+      taosArrayDestroy(part.pPageList);
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
+
+    int32_t code = blockDataFromBuf(pBlock, pPage);
+    dBufSetBufPageRecycled(pInfo->pSpillBuf, pPage);
+    if (code != TSDB_CODE_SUCCESS) {
+      taosArrayDestroy(part.pPageList);
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+
+    pBlock->info.groupId = pPageInfo->groupId;
+
+    // the scalar expressions have been applied before these rows are spilled
+    setInputDataBlock(pOperator, pOperator->exprSupp.pCtx, pBlock, TSDB_ORDER_ASC, MAIN_SCAN, true);
+    doHashGroupbyAgg(pOperator, pBlock);
+  }
+
+  taosArrayDestroy(part.pPageList);
+  finishGroupSpillPass(pOperator);
+
+  qDebug("spilled group partition at level:%d is aggregated, %d groups, %d partitions remain, %s", part.level,
+         tSimpleHashGetSize(pInfo->aggSup.pResultRowHashTable), (int32_t)taosArrayGetSize(pInfo->pSpillQueue),
+         GET_TASKID(pTaskInfo));
+  initGroupedResultInfo(&pInfo->groupResInfo, pInfo->aggSup.pResultRowHashTable, 0);
 }
 
 static SSDataBlock* buildGroupResultDataBlock(SOperatorInfo* pOperator) {
@@ -311,11 +842,23 @@ static SSDataBlock* buildGroupResultDataBlock(SOperatorInfo* pOperator) {
   SSDataBlock* pRes = pInfo->binfo.pRes;
   while (1) {
     doBuildResultDatablock(pOperator, &pInfo->binfo, &pInfo->groupResInfo, pInfo->aggSup.pResultBuf);
-    doFilter(pInfo->pCondition, pRes, NULL, NULL);
+    if (doFilter(pInfo->pCondition, pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pOperator->pTaskInfo->env, terrno);
+    }
 
     if (!hasRemainResults(&pInfo->groupResInfo)) {
-      doSetOperatorCompleted(pOperator);
-      break;
+      if (taosArrayGetSize(pInfo->pSpillQueue) == 0) {
+        doSetOperatorCompleted(pOperator);
+        break;
+      }
+
+      // return the results of current pass before the groups in memory are discarded
+      if (pRes->info.rows > 0) {
+        break;
+      }
+
+      doAggregateSpilledPartition(pOperator);
+      continue;
     }
 
     if (pRes->info.rows > 0) {
@@ -373,6 +916,7 @@ static SSDataBlock* hashGroupbyAggregate(SOperatorInfo* pOperator) {
     doHashGroupbyAgg(pOperator, pBlock);
   }
 
+  finishGroupSpillPass(pOperator);
   pOperator->status = OP_RES_TO_RETURN;
 
 #if 0
@@ -407,6 +951,7 @@ SOperatorInfo* createGroupOperatorInfo(SOperatorInfo* downstream, SExprInfo* pEx
 
   pInfo->pGroupCols = pGroupColList;
   pInfo->pCondition = pCondition;
+  pInfo->fixedKey = isFixedGroupKey(pGroupColList);
 
   int32_t code = initExprSupp(&pInfo->scalarSup, pScalarExprInfo, numOfScalarExpr);
   if (code != TSDB_CODE_SUCCESS) {
@@ -451,7 +996,7 @@ _error:
 }
 
 static void doHashPartition(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
-  //  SExecTaskInfo* pTaskInfo = pOperator->pTaskInfo;
+  SExecTaskInfo* pTaskInfo = pOperator->pTaskInfo;
 
   SPartitionOperatorInfo* pInfo = pOperator->info;
 
@@ -460,7 +1005,10 @@ static void doHashPartition(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
     int32_t len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
 
     SDataGroupInfo* pGroupInfo = NULL;
-    void*           pPage = getCurrentDataGroupInfo(pInfo, &pGroupInfo, len);
+    void*           pPage = getCurrentDataGroupInfo(pInfo, &pGroupInfo, len, &pTaskInfo->memInfo);
+    if (pPage == NULL) {
+      return;
+    }
 
     pGroupInfo->numOfRows += 1;
 
@@ -538,11 +1086,22 @@ static void doHashPartition(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
   }
 }
 
-void* getCurrentDataGroupInfo(const SPartitionOperatorInfo* pInfo, SDataGroupInfo** pGroupInfo, int32_t len) {
+void* getCurrentDataGroupInfo(SPartitionOperatorInfo* pInfo, SDataGroupInfo** pGroupInfo, int32_t len,
+                              STaskMemInfo* pMemInfo) {
   SDataGroupInfo* p = taosHashGet(pInfo->pGroupSet, pInfo->keyBuf, len);
 
   void* pPage = NULL;
   if (p == NULL) {  // it is a new group
+    // the rows are kept in the disk based buffer, while the group info stays in memory
+    int64_t size = GET_DATA_GROUP_ENTRY_SIZE(len);
+    terrno = taskMemAcquire(pMemInfo, size);
+    if (terrno != TSDB_CODE_SUCCESS) {
+      qError("too many groups in partition, used:%" PRId64 ", limit:%" PRId64, pMemInfo->used, pMemInfo->limit);
+      return NULL;
+    }
+
+    pInfo->memUsed += size;
+
     SDataGroupInfo gi = {0};
     gi.pPageList = taosArrayInit(100, sizeof(int32_t));
     taosHashPut(pInfo->pGroupSet, pInfo->keyBuf, len, &gi, sizeof(SDataGroupInfo));
@@ -612,13 +1171,16 @@ int32_t* setupColumnOffset(const SSDataBlock* pBlock, int32_t rowCapacity) {
   return offset;
 }
 
-static void clearPartitionOperator(SPartitionOperatorInfo* pInfo) {
+static void clearPartitionOperator(SPartitionOperatorInfo* pInfo, STaskMemInfo* pMemInfo) {
   void* ite = NULL;
   while ((ite = taosHashIterate(pInfo->pGroupSet, ite)) != NULL) {
     taosArrayDestroy(((SDataGroupInfo*)ite)->pPageList);
   }
   taosArrayClear(pInfo->sortedGroupArray);
   clearDiskbasedBuf(pInfo->pBuf);
+
+  taskMemRelease(pMemInfo, pInfo->memUsed);
+  pInfo->memUsed = 0;
 }
 
 static int compareDataGroupInfo(const void* group1, const void* group2) {
@@ -643,7 +1205,7 @@ static SSDataBlock* buildPartitionResult(SOperatorInfo* pOperator) {
     ++pInfo->groupIndex;
     if (pInfo->groupIndex >= taosArrayGetSize(pInfo->sortedGroupArray)) {
       doSetOperatorCompleted(pOperator);
-      clearPartitionOperator(pInfo);
+      clearPartitionOperator(pInfo, &pOperator->pTaskInfo->memInfo);
       return NULL;
     }
 
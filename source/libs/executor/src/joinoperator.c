@@ -387,7 +387,9 @@ SSDataBlock* doMergeJoin(struct SOperatorInfo* pOperator) {
       break;
     }
     if (pJoinInfo->pCondAfterMerge != NULL) {
-      doFilter(pJoinInfo->pCondAfterMerge, pRes, NULL, NULL);
+      if (doFilter(pJoinInfo->pCondAfterMerge, pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pOperator->pTaskInfo->env, terrno);
+      }
     }
     if (pRes->info.rows >= pOperator->resultInfo.threshold) {
       break;
@@ -315,7 +315,9 @@ SSDataBlock* doProjectOperation(SOperatorInfo* pOperator) {
       }
 
       // do apply filter
-      doFilter(pProjectInfo->pFilterNode, pFinalRes, NULL, NULL);
+      if (doFilter(pProjectInfo->pFilterNode, pFinalRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pTaskInfo->env, terrno);
+      }
 
       // when apply the limit/offset for each group, pRes->info.rows may be 0, due to limit constraint.
       if (pFinalRes->info.rows > 0 || (pOperator->status == OP_EXEC_DONE)) {
@@ -325,7 +327,9 @@ SSDataBlock* doProjectOperation(SOperatorInfo* pOperator) {
     } else {
       // do apply filter
       if (pRes->info.rows > 0) {
-        doFilter(pProjectInfo->pFilterNode, pRes, NULL, NULL);
+        if (doFilter(pProjectInfo->pFilterNode, pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+          T_LONG_JMP(pTaskInfo->env, terrno);
+        }
         if (pRes->info.rows == 0) {
           continue;
         }
@@ -518,7 +522,9 @@ SSDataBlock* doApplyIndefinitFunction(SOperatorInfo* pOperator) {
       }
     }
 
-    doFilter(pIndefInfo->pCondition, pInfo->pRes, NULL, NULL);
+    if (doFilter(pIndefInfo->pCondition, pInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
     size_t rows = pInfo->pRes->info.rows;
     if (rows > 0 || pOperator->status == OP_EXEC_DONE) {
       break;
@@ -620,7 +626,9 @@ SSDataBlock* doGenerateSourceData(SOperatorInfo* pOperator) {
   }
 
   pRes->info.rows = 1;
-  doFilter(pProjectInfo->pFilterNode, pRes, NULL, NULL);
+  if (doFilter(pProjectInfo->pFilterNode, pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pOperator->pTaskInfo->env, terrno);
+  }
 
   /*int32_t status = */ doIngroupLimitOffset(&pProjectInfo->limitInfo, 0, pRes, pOperator);
 
@@ -45,7 +45,8 @@ static int32_t sysTableUserTagsFillOneTableTags(const SSysTableScanInfo* pInfo,
                                                 SMetaReader* smrChildTable, const char* dbname, const char* tableName,
                                                 int32_t* pNumOfRows, const SSDataBlock* dataBlock);
 
-static void relocateAndFilterSysTagsScanResult(SSysTableScanInfo* pInfo, int32_t numOfRows, SSDataBlock* dataBlock);
+static void relocateAndFilterSysTagsScanResult(SSysTableScanInfo* pInfo, int32_t numOfRows, SSDataBlock* dataBlock,
+                                               SExecTaskInfo* pTaskInfo);
 bool        processBlockWithProbability(const SSampleExecInfo* pInfo) {
 #if 0
   if (pInfo->sampleRatio == 1) {
@@ -172,6 +173,27 @@ static bool overlapWithTimeWindow(SInterval* pInterval, SDataBlockInfo* pBlockIn
   return false;
 }
 
+// A block that lies in one time window (or one pane of a sliding interval) can be aggregated from its SMA by the
+// upstream interval operator, otherwise the rows are needed to split the block into windows.
+static bool blockCrossWindowBoundary(SInterval* pInterval, SDataBlockInfo* pBlockInfo) {
+  // 0 by default, which means it is not a interval operator of the upstream operator.
+  if (pInterval->interval == 0) {
+    return false;
+  }
+
+  SInterval interval = *pInterval;
+  if (interval.interval != interval.sliding) {
+    if (TIME_IS_VAR_DURATION(interval.intervalUnit) || TIME_IS_VAR_DURATION(interval.slidingUnit)) {
+      return true;
+    }
+    interval.interval = getIntervalPaneLength(pInterval);
+    interval.sliding = interval.interval;
+  }
+
+  STimeWindow w = getAlignQueryTimeWindow(&interval, interval.precision, pBlockInfo->window.skey);
+  return w.skey > pBlockInfo->window.skey || w.ekey < pBlockInfo->window.ekey;
+}
+
 // this function is for table scanner to extract temporary results of upstream aggregate results.
 static SResultRow* getTableGroupOutputBuf(SOperatorInfo* pOperator, uint64_t groupId, SFilePage** pPage) {
   if (pOperator->operatorType != QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN) {
@@ -309,8 +331,7 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanInfo* pTableSca
   bool loadSMA = false;
 
   *status = pInfo->dataBlockLoadFlag;
-  if (pTableScanInfo->pFilterNode != NULL ||
-      overlapWithTimeWindow(&pTableScanInfo->pdInfo.interval, &pBlock->info, pTableScanInfo->cond.order)) {
+  if (pTableScanInfo->pFilterNode != NULL || blockCrossWindowBoundary(&pTableScanInfo->pdInfo.interval, &pBlock->info)) {
     (*status) = FUNC_DATA_REQUIRED_DATA_LOAD;
   }
 
@@ -390,7 +411,10 @@ static int32_t loadDataBlock(SOperatorInfo* pOperator, STableScanInfo* pTableSca
 
   if (pTableScanInfo->pFilterNode != NULL) {
     int64_t st = taosGetTimestampUs();
-    doFilter(pTableScanInfo->pFilterNode, pBlock, pTableScanInfo->pColMatchInfo, pOperator->exprSupp.pFilterInfo);
+    if (doFilter(pTableScanInfo->pFilterNode, pBlock, pTableScanInfo->pColMatchInfo,
+                 pOperator->exprSupp.pFilterInfo) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
 
     double el = (taosGetTimestampUs() - st) / 1000.0;
     pTableScanInfo->readRecorder.filterTime += el;
@@ -1133,7 +1157,9 @@ static SSDataBlock* doRangeScan(SStreamScanInfo* pInfo, SSDataBlock* pSDB, int32
       return NULL;
     }
 
-    doFilter(pInfo->pCondition, pResult, NULL, NULL);
+    if (doFilter(pInfo->pCondition, pResult, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pInfo->pTableScanOp->pTaskInfo->env, terrno);
+    }
     if (pResult->info.rows == 0) {
       continue;
     }
@@ -1486,7 +1512,9 @@ static int32_t setBlockIntoRes(SStreamScanInfo* pInfo, const SSDataBlock* pBlock
   }
 
   if (filter) {
-    doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL);
+    if (doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
   }
   blockDataUpdateTsWindow(pInfo->pRes, pInfo->primaryTsIndex);
   blockDataFreeRes((SSDataBlock*)pBlock);
@@ -1909,7 +1937,9 @@ FETCH_NEXT_BLOCK:
           }
         }
 
-        doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL);
+        if (doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+          T_LONG_JMP(pTaskInfo->env, terrno);
+        }
         blockDataUpdateTsWindow(pInfo->pRes, pInfo->primaryTsIndex);
 
         if (pBlockInfo->rows > 0 || pInfo->pUpdateDataRes->info.rows > 0) {
@@ -2387,12 +2417,14 @@ static int32_t loadSysTableCallback(void* param, SDataBuf* pMsg, int32_t code) {
   return TSDB_CODE_SUCCESS;
 }
 
-static SSDataBlock* doFilterResult(SSysTableScanInfo* pInfo) {
+static SSDataBlock* doFilterResult(SSysTableScanInfo* pInfo, SExecTaskInfo* pTaskInfo) {
   if (pInfo->pCondition == NULL) {
     return pInfo->pRes->info.rows == 0 ? NULL : pInfo->pRes;
   }
 
-  doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL);
+  if (doFilter(pInfo->pCondition, pInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pTaskInfo->env, terrno);
+  }
   return pInfo->pRes->info.rows == 0 ? NULL : pInfo->pRes;
 }
 
@@ -2598,7 +2630,7 @@ static SSDataBlock* sysTableScanUserTags(SOperatorInfo* pOperator) {
     metaReaderClear(&smrSuperTable);
     metaReaderClear(&smrChildTable);
     if (numOfRows > 0) {
-      relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock);
+      relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock, pOperator->pTaskInfo);
       numOfRows = 0;
     }
     blockDataDestroy(dataBlock);
@@ -2638,7 +2670,7 @@ static SSDataBlock* sysTableScanUserTags(SOperatorInfo* pOperator) {
     metaReaderClear(&smrSuperTable);
 
     if (numOfRows >= pOperator->resultInfo.capacity) {
-      relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock);
+      relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock, pOperator->pTaskInfo);
       numOfRows = 0;
 
       if (pInfo->pRes->info.rows > 0) {
@@ -2648,7 +2680,7 @@ static SSDataBlock* sysTableScanUserTags(SOperatorInfo* pOperator) {
   }
 
   if (numOfRows > 0) {
-    relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock);
+    relocateAndFilterSysTagsScanResult(pInfo, numOfRows, dataBlock, pOperator->pTaskInfo);
     numOfRows = 0;
   }
 
@@ -2663,12 +2695,13 @@ static SSDataBlock* sysTableScanUserTags(SOperatorInfo* pOperator) {
   return (pInfo->pRes->info.rows == 0) ? NULL : pInfo->pRes;
 }
 
-static void relocateAndFilterSysTagsScanResult(SSysTableScanInfo* pInfo, int32_t numOfRows, SSDataBlock* dataBlock) {
+static void relocateAndFilterSysTagsScanResult(SSysTableScanInfo* pInfo, int32_t numOfRows, SSDataBlock* dataBlock,
+                                               SExecTaskInfo* pTaskInfo) {
   dataBlock->info.rows = numOfRows;
   pInfo->pRes->info.rows = numOfRows;
 
   relocateColumnData(pInfo->pRes, pInfo->scanCols, dataBlock->pDataBlock, false);
-  doFilterResult(pInfo);
+  doFilterResult(pInfo, pTaskInfo);
 
   blockDataCleanup(dataBlock);
 }
@@ -2779,7 +2812,7 @@ static SSDataBlock* sysTableScanUserTables(SOperatorInfo* pOperator) {
   if (pInfo->readHandle.mnd != NULL) {
     buildSysDbTableInfo(pInfo, pOperator->resultInfo.capacity);
 
-    doFilterResult(pInfo);
+    doFilterResult(pInfo, pOperator->pTaskInfo);
     pInfo->loadInfo.totalRows += pInfo->pRes->info.rows;
 
     doSetOperatorCompleted(pOperator);
@@ -2924,7 +2957,7 @@ static SSDataBlock* sysTableScanUserTables(SOperatorInfo* pOperator) {
         pInfo->pRes->info.rows = numOfRows;
 
         relocateColumnData(pInfo->pRes, pInfo->scanCols, p->pDataBlock, false);
-        doFilterResult(pInfo);
+        doFilterResult(pInfo, pOperator->pTaskInfo);
 
         blockDataCleanup(p);
         numOfRows = 0;
@@ -2940,7 +2973,7 @@ static SSDataBlock* sysTableScanUserTables(SOperatorInfo* pOperator) {
       pInfo->pRes->info.rows = numOfRows;
 
       relocateColumnData(pInfo->pRes, pInfo->scanCols, p->pDataBlock, false);
-      doFilterResult(pInfo);
+      doFilterResult(pInfo, pOperator->pTaskInfo);
 
       blockDataCleanup(p);
       numOfRows = 0;
@@ -3055,7 +3088,7 @@ static SSDataBlock* doSysTableScan(SOperatorInfo* pOperator) {
       updateLoadRemoteInfo(&pInfo->loadInfo, pRsp->numOfRows, pRsp->compLen, startTs, pOperator);
 
       // todo log the filter info
-      doFilterResult(pInfo);
+      doFilterResult(pInfo, pOperator->pTaskInfo);
       taosMemoryFree(pRsp);
       if (pInfo->pRes->info.rows > 0) {
         return pInfo->pRes;
@@ -3481,7 +3514,9 @@ static int32_t loadDataBlockFromOneTable(SOperatorInfo* pOperator, STableMergeSc
 
   if (pTableScanInfo->pFilterNode != NULL) {
     int64_t st = taosGetTimestampMs();
-    doFilter(pTableScanInfo->pFilterNode, pBlock, pTableScanInfo->pColMatchInfo, NULL);
+    if (doFilter(pTableScanInfo->pFilterNode, pBlock, pTableScanInfo->pColMatchInfo, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
 
     double el = (taosGetTimestampUs() - st) / 1000.0;
     pTableScanInfo->readRecorder.filterTime += el;
@@ -216,7 +216,9 @@ SSDataBlock* doSort(SOperatorInfo* pOperator) {
       return NULL;
     }
 
-    doFilter(pInfo->pCondition, pBlock, pInfo->pColMatchInfo, NULL);
+    if (doFilter(pInfo->pCondition, pBlock, pInfo->pColMatchInfo, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
     if (blockDataGetNumOfRows(pBlock) == 0) {
       continue;
     }
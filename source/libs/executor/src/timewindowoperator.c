@@ -915,12 +915,11 @@ bool needDeleteWindowBuf(STimeWindow* pWin, STimeWindowAggSupp* pTwSup) {
   return pTwSup->maxTs != INT64_MIN && pWin->ekey < pTwSup->maxTs - pTwSup->deleteMark;
 }
 
-static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResultRowInfo, SSDataBlock* pBlock,
-                            int32_t scanFlag) {
+static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResultRowInfo, SExprSupp* pSup,
+                            SAggSupporter* pAggSup, SInterval* pInterval, SSDataBlock* pBlock, int32_t scanFlag) {
   SIntervalAggOperatorInfo* pInfo = (SIntervalAggOperatorInfo*)pOperatorInfo->info;
 
   SExecTaskInfo* pTaskInfo = pOperatorInfo->pTaskInfo;
-  SExprSupp*     pSup = &pOperatorInfo->exprSupp;
 
   int32_t     startPos = 0;
   int32_t     numOfOutput = pSup->numOfExprs;
@@ -930,10 +929,9 @@ static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResul
   TSKEY       ts = getStartTsKey(&pBlock->info.window, tsCols);
   SResultRow* pResult = NULL;
 
-  STimeWindow win =
-      getActiveTimeWindow(pInfo->aggSup.pResultBuf, pResultRowInfo, ts, &pInfo->interval, pInfo->inputOrder);
-  int32_t ret = setTimeWindowOutputBuf(pResultRowInfo, &win, (scanFlag == MAIN_SCAN), &pResult, tableGroupId,
-                                       pSup->pCtx, numOfOutput, pSup->rowEntryInfoOffset, &pInfo->aggSup, pTaskInfo);
+  STimeWindow win = getActiveTimeWindow(pAggSup->pResultBuf, pResultRowInfo, ts, pInterval, pInfo->inputOrder);
+  int32_t     ret = setTimeWindowOutputBuf(pResultRowInfo, &win, (scanFlag == MAIN_SCAN), &pResult, tableGroupId,
+                                           pSup->pCtx, numOfOutput, pSup->rowEntryInfoOffset, pAggSup, pTaskInfo);
   if (ret != TSDB_CODE_SUCCESS || pResult == NULL) {
     T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
   }
@@ -949,7 +947,7 @@ static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResul
 
     // restore current time window
     ret = setTimeWindowOutputBuf(pResultRowInfo, &win, (scanFlag == MAIN_SCAN), &pResult, tableGroupId, pSup->pCtx,
-                                 numOfOutput, pSup->rowEntryInfoOffset, &pInfo->aggSup, pTaskInfo);
+                                 numOfOutput, pSup->rowEntryInfoOffset, pAggSup, pTaskInfo);
     if (ret != TSDB_CODE_SUCCESS) {
       T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
     }
@@ -967,13 +965,13 @@ static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResul
   STimeWindow nextWin = win;
   while (1) {
     int32_t prevEndPos = forwardRows - 1 + startPos;
-    startPos = getNextQualifiedWindow(&pInfo->interval, &nextWin, &pBlock->info, tsCols, prevEndPos, pInfo->inputOrder);
+    startPos = getNextQualifiedWindow(pInterval, &nextWin, &pBlock->info, tsCols, prevEndPos, pInfo->inputOrder);
     if (startPos < 0) {
       break;
     }
     // null data, failed to allocate more memory buffer
     int32_t code = setTimeWindowOutputBuf(pResultRowInfo, &nextWin, (scanFlag == MAIN_SCAN), &pResult, tableGroupId,
-                                          pSup->pCtx, numOfOutput, pSup->rowEntryInfoOffset, &pInfo->aggSup, pTaskInfo);
+                                          pSup->pCtx, numOfOutput, pSup->rowEntryInfoOffset, pAggSup, pTaskInfo);
     if (code != TSDB_CODE_SUCCESS || pResult == NULL) {
       T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
     }
@@ -1034,6 +1032,11 @@ SResultRowPosition addToOpenWindowList(SResultRowInfo* pResultRowInfo, const SRe
 int64_t* extractTsCol(SSDataBlock* pBlock, const SIntervalAggOperatorInfo* pInfo) {
   TSKEY* tsCols = NULL;
 
+  // only the block SMA is loaded, the rows of the block are in one time window
+  if (pBlock->pBlockAgg != NULL) {
+    return NULL;
+  }
+
   if (pBlock->pDataBlock != NULL) {
     SColumnInfoData* pColDataInfo = taosArrayGet(pBlock->pDataBlock, pInfo->primaryTsIndex);
     tsCols = (int64_t*)pColDataInfo->pData;
@@ -1051,6 +1054,62 @@ int64_t* extractTsCol(SSDataBlock* pBlock, const SIntervalAggOperatorInfo* pInfo
   return tsCols;
 }
 
+// Each sliding window is the union of the panes it covers, so the windows are built by combining the intermediate
+// results of the panes instead of aggregating every row once for each window it falls in.
+static void doMergeIntervalPanes(SOperatorInfo* pOperator) {
+  SIntervalAggOperatorInfo* pInfo = pOperator->info;
+  SExecTaskInfo*            pTaskInfo = pOperator->pTaskInfo;
+  SExprSupp*                pSup = &pOperator->exprSupp;
+  SExprSupp*                pPaneSup = &pInfo->paneSup;
+  SDiskbasedBuf*            pPaneBuf = pInfo->paneAggSup.pResultBuf;
+  SInterval*                pInterval = &pInfo->interval;
+
+  // panes are merged in the ascending order of time, since the combine of some functions relies on the row order.
+  SGroupResInfo paneResInfo = {0};
+  initGroupedResultInfo(&paneResInfo, pInfo->paneAggSup.pResultRowHashTable, TSDB_ORDER_ASC);
+
+  int32_t numOfPanes = getNumOfTotalRes(&paneResInfo);
+  for (int32_t i = 0; i < numOfPanes; ++i) {
+    SResKeyPos* pPos = taosArrayGetP(paneResInfo.pRows, i);
+    SFilePage*  page = getBufPage(pPaneBuf, pPos->pos.pageId);
+    SResultRow* pPane = (SResultRow*)((char*)page + pPos->pos.offset);
+    setResultRowInitCtx(pPane, pPaneSup->pCtx, pPaneSup->numOfExprs, pPaneSup->rowEntryInfoOffset);
+
+    // find the first window that covers the pane
+    TSKEY       ts = pPane->win.skey;
+    STimeWindow win = {0};
+    win.skey = taosTimeTruncate(ts, pInterval, pInterval->precision);
+    win.ekey = taosTimeAdd(win.skey, pInterval->interval, pInterval->intervalUnit, pInterval->precision) - 1;
+    while (win.ekey - pInterval->sliding >= ts) {
+      win.skey -= pInterval->sliding;
+      win.ekey -= pInterval->sliding;
+    }
+    while (win.ekey < ts) {
+      win.skey += pInterval->sliding;
+      win.ekey += pInterval->sliding;
+    }
+
+    for (; win.skey <= ts; win.skey += pInterval->sliding, win.ekey += pInterval->sliding) {
+      SResultRow* pResult = NULL;
+      int32_t code = setTimeWindowOutputBuf(&pInfo->binfo.resultRowInfo, &win, true, &pResult, pPos->groupId,
+                                            pSup->pCtx, pSup->numOfExprs, pSup->rowEntryInfoOffset, &pInfo->aggSup,
+                                            pTaskInfo);
+      if (code != TSDB_CODE_SUCCESS || pResult == NULL) {
+        releaseBufPage(pPaneBuf, page);
+        cleanupGroupResInfo(&paneResInfo);
+        T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_OUT_OF_MEMORY);
+      }
+
+      updateTimeWindowInfo(&pInfo->twAggSup.timeWindowData, &win, true);
+      compactFunctions(pSup->pCtx, pPaneSup->pCtx, pSup->numOfExprs, pTaskInfo, &pInfo->twAggSup.timeWindowData);
+    }
+
+    releaseBufPage(pPaneBuf, page);
+  }
+
+  cleanupGroupResInfo(&paneResInfo);
+}
+
 static int32_t doOpenIntervalAgg(SOperatorInfo* pOperator) {
   if (OPTR_IS_OPENED(pOperator)) {
     return TSDB_CODE_SUCCESS;
@@ -1078,11 +1137,24 @@ static int32_t doOpenIntervalAgg(SOperatorInfo* pOperator) {
       projectApplyFunctions(pExprSup->pExprInfo, pBlock, pBlock, pExprSup->pCtx, pExprSup->numOfExprs, NULL);
     }
 
+    if (pBlock->pBlockAgg == NULL) {
+      blockDataUpdateTsWindow(pBlock, pInfo->primaryTsIndex);
+    }
+
+    if (pInfo->paneAgg) {
+      setInputDataBlock(pOperator, pInfo->paneSup.pCtx, pBlock, pInfo->inputOrder, scanFlag, true);
+      hashIntervalAgg(pOperator, &pInfo->paneRowInfo, &pInfo->paneSup, &pInfo->paneAggSup, &pInfo->paneInterval,
+                      pBlock, scanFlag);
+      continue;
+    }
+
     // the pDataBlock are always the same one, no need to call this again
     setInputDataBlock(pOperator, pSup->pCtx, pBlock, pInfo->inputOrder, scanFlag, true);
-    blockDataUpdateTsWindow(pBlock, pInfo->primaryTsIndex);
+    hashIntervalAgg(pOperator, &pInfo->binfo.resultRowInfo, pSup, &pInfo->aggSup, &pInfo->interval, pBlock, scanFlag);
+  }
 
-    hashIntervalAgg(pOperator, &pInfo->binfo.resultRowInfo, pBlock, scanFlag);
+  if (pInfo->paneAgg) {
+    doMergeIntervalPanes(pOperator);
   }
 
   initGroupedResultInfo(&pInfo->groupResInfo, pInfo->aggSup.pResultRowHashTable, pInfo->resultTsOrder);
@@ -1249,7 +1321,9 @@ static SSDataBlock* doStateWindowAgg(SOperatorInfo* pOperator) {
   blockDataEnsureCapacity(pBInfo->pRes, pOperator->resultInfo.capacity);
   while (1) {
     doBuildResultDatablock(pOperator, &pInfo->binfo, &pInfo->groupResInfo, pInfo->aggSup.pResultBuf);
-    doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL);
+    if (doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
 
     bool hasRemain = hasRemainResults(&pInfo->groupResInfo);
     if (!hasRemain) {
@@ -1287,7 +1361,9 @@ static SSDataBlock* doBuildIntervalResult(SOperatorInfo* pOperator) {
     blockDataEnsureCapacity(pBlock, pOperator->resultInfo.capacity);
     while (1) {
       doBuildResultDatablock(pOperator, &pInfo->binfo, &pInfo->groupResInfo, pInfo->aggSup.pResultBuf);
-      doFilter(pInfo->pCondition, pBlock, NULL, NULL);
+      if (doFilter(pInfo->pCondition, pBlock, NULL, NULL) != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pTaskInfo->env, terrno);
+      }
 
       bool hasRemain = hasRemainResults(&pInfo->groupResInfo);
       if (!hasRemain) {
@@ -1635,6 +1711,11 @@ void destroyIntervalOperatorInfo(void* param) {
   cleanupAggSup(&pInfo->aggSup);
   cleanupExprSupp(&pInfo->scalarSupp);
 
+  if (pInfo->paneAgg) {
+    cleanupExprSupp(&pInfo->paneSup);
+    cleanupAggSup(&pInfo->paneAggSup);
+  }
+
   tdListFree(pInfo->binfo.resultRowInfo.openWindow);
 
   pInfo->pInterpCols = taosArrayDestroy(pInfo->pInterpCols);
@@ -1731,6 +1812,52 @@ static bool timeWindowinterpNeeded(SqlFunctionCtx* pCtx, int32_t numOfCols, SInt
   return needed;
 }
 
+static bool paneAggAvailable(SqlFunctionCtx* pCtx, int32_t numOfCols, SIntervalAggOperatorInfo* pInfo) {
+  SInterval* pInterval = &pInfo->interval;
+  if (pInfo->timeWindowInterpo || pInterval->sliding >= pInterval->interval ||
+      TIME_IS_VAR_DURATION(pInterval->intervalUnit) || TIME_IS_VAR_DURATION(pInterval->slidingUnit)) {
+    return false;
+  }
+
+  // only the functions whose intermediate results can be combined are able to be computed from panes
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    int32_t functionId = pCtx[i].functionId;
+    if (fmIsWindowPseudoColumnFunc(functionId)) {
+      continue;
+    }
+
+    if (functionId < 0 || fmIsUserDefinedFunc(functionId) || fmIsRepeatScanFunc(functionId) ||
+        pCtx[i].fpSet.combine == NULL || pCtx[i].subsidiaries.num > 0) {
+      return false;
+    }
+
+    // the x of leastsquares is the position of the row in the window, which a pane does not know
+    if (strcmp(pCtx[i].pExpr->pExpr->_function.functionName, "leastsquares") == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static int32_t initIntervalPaneAgg(SIntervalAggOperatorInfo* pInfo, SExprSupp* pSup, size_t keyBufSize,
+                                   const char* pKey) {
+  SExprSupp* pPaneSup = &pInfo->paneSup;
+
+  int32_t code = initAggInfo(pPaneSup, &pInfo->paneAggSup, pSup->pExprInfo, pSup->numOfExprs, keyBufSize, pKey);
+  // the expressions are owned by the operator, the pane supporter only keeps its own function contexts
+  pPaneSup->pExprInfo = NULL;
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  pInfo->paneInterval = pInfo->interval;
+  pInfo->paneInterval.interval = getIntervalPaneLength(&pInfo->interval);
+  pInfo->paneInterval.sliding = pInfo->paneInterval.interval;
+  initResultRowInfo(&pInfo->paneRowInfo);
+  return TSDB_CODE_SUCCESS;
+}
+
 void initIntervalDownStream(SOperatorInfo* downstream, uint16_t type, SAggSupporter* pSup, SInterval* pInterval,
                             STimeWindowAggSupp* pTwSup) {
   if (downstream->operatorType != QUERY_NODE_PHYSICAL_PLAN_STREAM_SCAN) {
@@ -1810,6 +1937,14 @@ SOperatorInfo* createIntervalOperatorInfo(SOperatorInfo* downstream, SExprInfo*
 
   initResultRowInfo(&pInfo->binfo.resultRowInfo);
 
+  if (!isStream && paneAggAvailable(pSup->pCtx, pSup->numOfExprs, pInfo)) {
+    pInfo->paneAgg = true;
+    code = initIntervalPaneAgg(pInfo, pSup, keyBufSize, pTaskInfo->id.str);
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _error;
+    }
+  }
+
   pOperator->name = "TimeIntervalAggOperator";
   pOperator->operatorType = QUERY_NODE_PHYSICAL_PLAN_HASH_INTERVAL;
   pOperator->blocking = true;
@@ -1916,7 +2051,9 @@ static SSDataBlock* doSessionWindowAgg(SOperatorInfo* pOperator) {
   if (pOperator->status == OP_RES_TO_RETURN) {
     while (1) {
       doBuildResultDatablock(pOperator, &pInfo->binfo, &pInfo->groupResInfo, pInfo->aggSup.pResultBuf);
-      doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL);
+      if (doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pOperator->pTaskInfo->env, terrno);
+      }
 
       bool hasRemain = hasRemainResults(&pInfo->groupResInfo);
       if (!hasRemain) {
@@ -1959,7 +2096,9 @@ static SSDataBlock* doSessionWindowAgg(SOperatorInfo* pOperator) {
   blockDataEnsureCapacity(pBInfo->pRes, pOperator->resultInfo.capacity);
   while (1) {
     doBuildResultDatablock(pOperator, &pInfo->binfo, &pInfo->groupResInfo, pInfo->aggSup.pResultBuf);
-    doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL);
+    if (doFilter(pInfo->pCondition, pBInfo->pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pOperator->pTaskInfo->env, terrno);
+    }
 
     bool hasRemain = hasRemainResults(&pInfo->groupResInfo);
     if (!hasRemain) {
@@ -4920,7 +5059,9 @@ static void doMergeAlignedIntervalAgg(SOperatorInfo* pOperator) {
     setInputDataBlock(pOperator, pSup->pCtx, pBlock, pIaInfo->inputOrder, scanFlag, true);
     doMergeAlignedIntervalAggImpl(pOperator, &pIaInfo->binfo.resultRowInfo, pBlock, pRes);
 
-    doFilter(pMiaInfo->pCondition, pRes, NULL, NULL);
+    if (doFilter(pMiaInfo->pCondition, pRes, NULL, NULL) != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, terrno);
+    }
     if (pRes->info.rows >= pOperator->resultInfo.capacity) {
       break;
     }
@@ -103,6 +103,7 @@ static int32_t sortComparCleanup(SMsortComparParam* cmpParam) {
     SSortSource* pSource =
         cmpParam->pSources[i];  // NOTICE: pSource may be SGenericSource *, if it is SORT_MULTISOURCE_MERGE
     blockDataDestroy(pSource->src.pBlock);
+    taosMemoryFreeClear(pSource->src.pKeys);
     taosMemoryFreeClear(pSource);
   }
 
@@ -125,6 +126,9 @@ void tsortDestroySortHandle(SSortHandle* pSortHandle) {
   blockDataDestroy(pSortHandle->pDataBlock);
   for (size_t i = 0; i < taosArrayGetSize(pSortHandle->pOrderedSource); i++) {
     SSortSource** pSource = taosArrayGet(pSortHandle->pOrderedSource, i);
+    if (*pSource != NULL) {
+      taosMemoryFreeClear((*pSource)->src.pKeys);
+    }
     taosMemoryFreeClear(*pSource);
   }
   taosArrayDestroy(pSortHandle->pOrderedSource);
@@ -216,10 +220,47 @@ static void setCurrentSourceIsDone(SSortSource* pSource, SSortHandle* pHandle) {
   ++pHandle->numOfCompletedSources;
 }
 
+/*
+ * Encode the sort keys of the newly loaded block of a source, so that the loser tree compares two candidates with
+ * a single memcmp instead of walking the order columns one by one.
+ */
+static int32_t sortComparBuildKeys(SMsortComparParam* cmpParam, SSortSource* pSource) {
+  SSDataBlock* pBlock = pSource->src.pBlock;
+  if (cmpParam->keyWidth < 0 || pBlock == NULL) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (cmpParam->keyWidth == 0) {
+    cmpParam->keyWidth = blockDataGetNormalizedKeyWidth(pBlock, cmpParam->orderInfo);
+    if (cmpParam->keyWidth <= 0) {
+      cmpParam->keyWidth = -1;
+      return TSDB_CODE_SUCCESS;
+    }
+  } else if (pBlock->pBlockAgg != NULL) {
+    cmpParam->keyWidth = -1;
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t size = pBlock->info.rows * cmpParam->keyWidth;
+  if (size > pSource->src.keyCap) {
+    char* p = taosMemoryRealloc(pSource->src.pKeys, size);
+    if (p == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+
+    pSource->src.pKeys = p;
+    pSource->src.keyCap = size;
+  }
+
+  blockDataEncodeNormalizedKeys(pBlock, cmpParam->orderInfo, pSource->src.pKeys, cmpParam->keyWidth);
+  return TSDB_CODE_SUCCESS;
+}
+
 static int32_t sortComparInit(SMsortComparParam* cmpParam, SArray* pSources, int32_t startIndex, int32_t endIndex,
                               SSortHandle* pHandle) {
   cmpParam->pSources = taosArrayGet(pSources, startIndex);
   cmpParam->numOfSources = (endIndex - startIndex + 1);
+  cmpParam->keyWidth = (pHandle->comparFn == msortComparFn) ? 0 : -1;
 
   int32_t code = 0;
 
@@ -242,6 +283,11 @@ static int32_t sortComparInit(SMsortComparParam* cmpParam, SArray* pSources, int
       }
 
       releaseBufPage(pHandle->pBuf, pPage);
+
+      code = sortComparBuildKeys(cmpParam, pSource);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
     }
   } else {
     // multi-pass internal merge sort is required
@@ -267,6 +313,12 @@ static int32_t sortComparInit(SMsortComparParam* cmpParam, SArray* pSources, int
       // set current source is done
       if (pSource->src.pBlock == NULL) {
         setCurrentSourceIsDone(pSource, pHandle);
+        continue;
+      }
+
+      code = sortComparBuildKeys(cmpParam, pSource);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
       }
     }
   }
@@ -319,12 +371,22 @@ static int32_t adjustMergeTreeForNextTuple(SSortSource* pSource, SMultiwayMergeT
         }
 
         releaseBufPage(pHandle->pBuf, pPage);
+
+        code = sortComparBuildKeys(&pHandle->cmpParam, pSource);
+        if (code != TSDB_CODE_SUCCESS) {
+          return code;
+        }
       }
     } else {
       pSource->src.pBlock = pHandle->fetchfp(((SSortSource*)pSource)->param);
       if (pSource->src.pBlock == NULL) {
         (*numOfCompleted) += 1;
         pSource->src.rowIndex = -1;
+      } else {
+        int32_t code = sortComparBuildKeys(&pHandle->cmpParam, pSource);
+        if (code != TSDB_CODE_SUCCESS) {
+          return code;
+        }
       }
     }
   }
@@ -405,6 +467,12 @@ int32_t msortComparFn(const void* pLeft, const void* pRight, void* param) {
     }
   }
 
+  if (pParam->keyWidth > 0) {
+    int32_t width = pParam->keyWidth;
+    return memcmp(pLeftSource->src.pKeys + pLeftSource->src.rowIndex * width,
+                  pRightSource->src.pKeys + pRightSource->src.rowIndex * width, width);
+  }
+
   for (int32_t i = 0; i < pInfo->size; ++i) {
     SBlockOrderInfo* pOrder = TARRAY_GET_ELEM(pInfo, i);
     SColumnInfoData* pLeftColInfoData = TARRAY_GET_ELEM(pLeftBlock->pDataBlock, pOrder->slotId);
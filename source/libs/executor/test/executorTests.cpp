@@ -15,6 +15,9 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wwrite-strings"
@@ -26,6 +29,7 @@
 #include "executor.h"
 #include "executorimpl.h"
 #include "function.h"
+#include "functionMgt.h"
 #include "taos.h"
 #include "tdatablock.h"
 #include "tdef.h"
@@ -1205,4 +1209,589 @@ TEST(testCase, time_interval_Operator_Test) {
 }
 #endif
 
+namespace {
+
+// "c1 > val" over the int column in slot 1
+SNode* createIntGreaterThanCond(int32_t val) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = TSDB_DATA_TYPE_INT;
+  pCol->node.resType.bytes = sizeof(int32_t);
+  pCol->slotId = 1;
+  pCol->colId = 2;
+
+  SValueNode* pVal = (SValueNode*)nodesMakeNode(QUERY_NODE_VALUE);
+  pVal->node.resType.type = TSDB_DATA_TYPE_INT;
+  pVal->node.resType.bytes = sizeof(int32_t);
+  pVal->datum.i = val;
+  pVal->typeData = val;
+
+  SOperatorNode* pOp = (SOperatorNode*)nodesMakeNode(QUERY_NODE_OPERATOR);
+  pOp->node.resType.type = TSDB_DATA_TYPE_BOOL;
+  pOp->node.resType.bytes = sizeof(bool);
+  pOp->opType = OP_TYPE_GREATER_THAN;
+  pOp->pLeft = (SNode*)pCol;
+  pOp->pRight = (SNode*)pVal;
+  return (SNode*)pOp;
+}
+
+// ts | c1 int (every 5th row null) | c2 binary (every 3rd row null) | c3 nchar
+SSDataBlock* createFilterBlock(int32_t numOfRows) {
+  SSDataBlock* pBlock = createDataBlock();
+
+  SColumnInfoData ts = createColumnInfoData(TSDB_DATA_TYPE_TIMESTAMP, sizeof(int64_t), 1);
+  SColumnInfoData c1 = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 2);
+  SColumnInfoData c2 = createColumnInfoData(TSDB_DATA_TYPE_BINARY, 20 + VARSTR_HEADER_SIZE, 3);
+  SColumnInfoData c3 = createColumnInfoData(TSDB_DATA_TYPE_NCHAR, 20 * TSDB_NCHAR_SIZE + VARSTR_HEADER_SIZE, 4);
+  blockDataAppendColInfo(pBlock, &ts);
+  blockDataAppendColInfo(pBlock, &c1);
+  blockDataAppendColInfo(pBlock, &c2);
+  blockDataAppendColInfo(pBlock, &c3);
+  blockDataEnsureCapacity(pBlock, numOfRows);
+
+  char buf[64] = {0};
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int64_t key = 1620000000000 + i;
+    colDataAppend((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), i, (const char*)&key, false);
+
+    SColumnInfoData* pC1 = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+    colDataAppend(pC1, i, (const char*)&i, (i % 5 == 0));
+
+    // the payload length differs per row, so the repacked offsets are checked as well
+    SColumnInfoData* pC2 = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 2);
+    int32_t          len = snprintf(varDataVal(buf), 20, "row-%d%.*s", i, i % 7, "xxxxxxx");
+    varDataSetLen(buf, len);
+    colDataAppend(pC2, i, buf, (i % 3 == 0));
+
+    SColumnInfoData* pC3 = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 3);
+    TdUcs4*          pUcs = (TdUcs4*)varDataVal(buf);
+    for (int32_t j = 0; j <= i % 4; ++j) {
+      pUcs[j] = 'a' + i % 26;
+    }
+    varDataSetLen(buf, (i % 4 + 1) * TSDB_NCHAR_SIZE);
+    colDataAppend(pC3, i, buf, false);
+  }
+
+  pBlock->info.rows = numOfRows;
+  return pBlock;
+}
+
+}  // namespace
+
+TEST(testCase, filter_compact_fixed_and_var_columns_Test) {
+  const int32_t numOfRows = 37;
+  const int32_t val = 10;
+
+  SNode*       pCond = createIntGreaterThanCond(val);
+  SSDataBlock* pBlock = createFilterBlock(numOfRows);
+  SSDataBlock* pOrigin = createOneDataBlock(pBlock, true);
+
+  ASSERT_EQ(doFilter(pCond, pBlock, NULL, NULL), TSDB_CODE_SUCCESS);
+
+  // null rows of c1 never satisfy the condition
+  int32_t numOfQualified = 0;
+  for (int32_t i = val + 1; i < numOfRows; ++i) {
+    numOfQualified += (i % 5 != 0);
+  }
+  ASSERT_EQ(pBlock->info.rows, numOfQualified);
+
+  for (int32_t c = 0; c < taosArrayGetSize(pBlock->pDataBlock); ++c) {
+    SColumnInfoData* pSrc = (SColumnInfoData*)taosArrayGet(pOrigin->pDataBlock, c);
+    SColumnInfoData* pDst = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, c);
+
+    for (int32_t i = val + 1, k = 0; i < numOfRows; ++i) {
+      if (i % 5 == 0) {
+        continue;
+      }
+
+      bool isNull = colDataIsNull(pSrc, numOfRows, i, NULL);
+      ASSERT_EQ(colDataIsNull(pDst, pBlock->info.rows, k, NULL), isNull) << "col " << c << " row " << k;
+      if (!isNull) {
+        char* pExpect = colDataGetData(pSrc, i);
+        char* pData = colDataGetData(pDst, k);
+        if (IS_VAR_DATA_TYPE(pDst->info.type)) {
+          ASSERT_EQ(varDataTLen(pData), varDataTLen(pExpect));
+          ASSERT_EQ(memcmp(pData, pExpect, varDataTLen(pExpect)), 0);
+        } else {
+          ASSERT_EQ(memcmp(pData, pExpect, pDst->info.bytes), 0);
+        }
+      }
+      ++k;
+    }
+
+    // the var column buffer only keeps the payload of the qualified rows
+    if (IS_VAR_DATA_TYPE(pDst->info.type)) {
+      int32_t len = 0;
+      for (int32_t k = 0; k < pBlock->info.rows; ++k) {
+        if (pDst->varmeta.offset[k] != -1) {
+          len += varDataTLen(pDst->pData + pDst->varmeta.offset[k]);
+        }
+      }
+      ASSERT_EQ(pDst->varmeta.length, len);
+    } else {
+      // bits of the filtered out tail rows are cleared
+      for (int32_t k = pBlock->info.rows; k < numOfRows; ++k) {
+        ASSERT_FALSE(colDataIsNull_f(pDst->nullbitmap, k));
+      }
+    }
+  }
+
+  // no qualified row at all, and every row qualified
+  blockDataDestroy(pBlock);
+  pBlock = createOneDataBlock(pOrigin, true);
+  nodesDestroyNode(pCond);
+  pCond = createIntGreaterThanCond(numOfRows);
+  ASSERT_EQ(doFilter(pCond, pBlock, NULL, NULL), TSDB_CODE_SUCCESS);
+  ASSERT_EQ(pBlock->info.rows, 0);
+
+  blockDataDestroy(pBlock);
+  pBlock = createOneDataBlock(pOrigin, true);
+  SColumnInfoData* pC1 = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+  for (int32_t i = 0; i < numOfRows; i += 5) {
+    colDataAppend(pC1, i, (const char*)&i, false);
+    colDataSetNotNull_f(pC1->nullbitmap, i);
+  }
+  nodesDestroyNode(pCond);
+  pCond = createIntGreaterThanCond(-1);
+  ASSERT_EQ(doFilter(pCond, pBlock, NULL, NULL), TSDB_CODE_SUCCESS);
+  ASSERT_EQ(pBlock->info.rows, numOfRows);
+
+  nodesDestroyNode(pCond);
+  blockDataDestroy(pBlock);
+  blockDataDestroy(pOrigin);
+}
+
+namespace {
+
+typedef struct SGroupTestKey {
+  int8_t  type;
+  int32_t numOfValues;  // distinct non-null values of the key
+  bool    hasNull;
+} SGroupTestKey;
+
+typedef struct SGroupInputInfo {
+  SArray* pBlocks;  // SArray<SSDataBlock*>, owned by the test
+  int32_t current;
+} SGroupInputInfo;
+
+// count(v) and sum(v) of each group, the map key is the group id followed by the null flag and value of every key
+typedef std::map<std::string, std::pair<int64_t, int64_t>> SGroupResMap;
+
+SSDataBlock* getGroupInputBlock(SOperatorInfo* pOperator) {
+  SGroupInputInfo* pInfo = static_cast<SGroupInputInfo*>(pOperator->info);
+  if (pInfo->current >= taosArrayGetSize(pInfo->pBlocks)) {
+    return NULL;
+  }
+
+  return *(SSDataBlock**)taosArrayGet(pInfo->pBlocks, pInfo->current++);
+}
+
+void setGroupKeyValue(SColumnInfoData* pCol, int32_t row, int64_t val) {
+  switch (pCol->info.type) {
+    case TSDB_DATA_TYPE_BOOL: {
+      bool v = (val % 2 == 1);
+      colDataAppend(pCol, row, (const char*)&v, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_TINYINT: {
+      int8_t v = (int8_t)(val - 100);
+      colDataAppend(pCol, row, (const char*)&v, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_TIMESTAMP: {
+      int64_t v = 1620000000000 + val * 1000;
+      colDataAppend(pCol, row, (const char*)&v, false);
+      break;
+    }
+    case TSDB_DATA_TYPE_DOUBLE: {
+      double v = val * 0.25 - 100;
+      colDataAppend(pCol, row, (const char*)&v, false);
+      break;
+    }
+    default: {
+      int32_t v = (int32_t)val;
+      colDataAppend(pCol, row, (const char*)&v, false);
+      break;
+    }
+  }
+}
+
+// v bigint (every 11th row null) | key0 | key1 ..., rows of a group often come in short runs
+SSDataBlock* createGroupInputBlock(const std::vector<SGroupTestKey>& keys, int32_t numOfRows, int64_t start,
+                                   uint64_t groupId) {
+  SSDataBlock* pBlock = createDataBlock();
+
+  SColumnInfoData v = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+  blockDataAppendColInfo(pBlock, &v);
+  for (int32_t k = 0; k < keys.size(); ++k) {
+    SColumnInfoData key = createColumnInfoData(keys[k].type, tDataTypes[keys[k].type].bytes, k + 2);
+    blockDataAppendColInfo(pBlock, &key);
+  }
+  blockDataEnsureCapacity(pBlock, numOfRows);
+
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int64_t seq = start + i;
+    colDataAppend((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), i, (const char*)&seq, (seq % 11 == 0));
+
+    for (int32_t k = 0; k < keys.size(); ++k) {
+      SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, k + 1);
+      int64_t          val = ((seq / 3) * 7919 + k * 31) % (keys[k].numOfValues + (keys[k].hasNull ? 1 : 0));
+      if (val == keys[k].numOfValues) {
+        colDataAppendNULL(pCol, i);
+      } else {
+        setGroupKeyValue(pCol, i, val);
+      }
+    }
+  }
+
+  pBlock->info.rows = numOfRows;
+  pBlock->info.groupId = groupId;
+  return pBlock;
+}
+
+std::string buildGroupResKey(SSDataBlock* pBlock, int32_t row, int32_t firstKeySlot, int32_t numOfKeys) {
+  std::string key((const char*)&pBlock->info.groupId, sizeof(uint64_t));
+  for (int32_t k = 0; k < numOfKeys; ++k) {
+    SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, firstKeySlot + k);
+    if (colDataIsNull_s(pCol, row)) {
+      key.push_back('\1');
+    } else {
+      key.push_back('\0');
+      key.append(colDataGetData(pCol, row), pCol->info.bytes);
+    }
+  }
+  return key;
+}
+
+void calcGroupExpectRes(SArray* pBlocks, int32_t numOfKeys, SGroupResMap* pRes) {
+  for (int32_t i = 0; i < taosArrayGetSize(pBlocks); ++i) {
+    SSDataBlock*     pBlock = *(SSDataBlock**)taosArrayGet(pBlocks, i);
+    SColumnInfoData* pVal = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+    for (int32_t j = 0; j < pBlock->info.rows; ++j) {
+      std::pair<int64_t, int64_t>& res = (*pRes)[buildGroupResKey(pBlock, j, 1, numOfKeys)];
+      if (!colDataIsNull_s(pVal, j)) {
+        res.first += 1;
+        res.second += *(int64_t*)colDataGetData(pVal, j);
+      }
+    }
+  }
+}
+
+SNode* createGroupFuncTarget(const char* name, int16_t slotId) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = TSDB_DATA_TYPE_BIGINT;
+  pCol->node.resType.bytes = sizeof(int64_t);
+  pCol->slotId = 0;
+  pCol->colId = 1;
+  pCol->colType = COLUMN_TYPE_COLUMN;
+
+  SFunctionNode* pFunc = (SFunctionNode*)nodesMakeNode(QUERY_NODE_FUNCTION);
+  strcpy(pFunc->functionName, name);
+  nodesListMakeAppend(&pFunc->pParameterList, (SNode*)pCol);
+
+  char msg[128] = {0};
+  int32_t code = fmGetFuncInfo(pFunc, msg, sizeof(msg));
+  EXPECT_EQ(code, TSDB_CODE_SUCCESS) << msg;
+
+  STargetNode* pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+  pTarget->slotId = slotId;
+  pTarget->pExpr = (SNode*)pFunc;
+  return (SNode*)pTarget;
+}
+
+SNode* createGroupKeyTarget(const SGroupTestKey& key, int16_t inputSlotId, int16_t slotId) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = key.type;
+  pCol->node.resType.bytes = tDataTypes[key.type].bytes;
+  pCol->slotId = inputSlotId;
+  pCol->colId = inputSlotId + 1;
+  pCol->colType = COLUMN_TYPE_COLUMN;
+
+  STargetNode* pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+  pTarget->slotId = slotId;
+  pTarget->pExpr = (SNode*)pCol;
+  return (SNode*)pTarget;
+}
+
+// Run "select count(v), sum(v), key0, key1 ... group by key0, key1 ..." over the blocks within the task memory limit.
+// The operator picks the fixed key path by itself, which can be turned off by fixedKey.
+void runHashGroupby(SArray* pBlocks, const std::vector<SGroupTestKey>& keys, bool fixedKey, int64_t memLimit,
+                    SGroupResMap* pRes, int32_t* spillLevel) {
+  int32_t numOfKeys = keys.size();
+
+  SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)taosMemoryCalloc(1, sizeof(SExecTaskInfo));
+  pTaskInfo->id.str = (char*)taosMemoryStrDup("group-by-test");
+  pTaskInfo->execModel = OPTR_EXEC_MODEL_BATCH;
+  pTaskInfo->memInfo.limit = memLimit;
+
+  SNodeList* pFuncs = NULL;
+  nodesListMakeAppend(&pFuncs, createGroupFuncTarget("count", 0));
+  nodesListMakeAppend(&pFuncs, createGroupFuncTarget("sum", 1));
+
+  SNodeList*   pKeys = NULL;
+  SArray*      pGroupCols = taosArrayInit(numOfKeys, sizeof(SColumn));
+  SSDataBlock* pResBlock = createDataBlock();
+
+  SColumnInfoData count = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+  SColumnInfoData sum = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 2);
+  blockDataAppendColInfo(pResBlock, &count);
+  blockDataAppendColInfo(pResBlock, &sum);
+  for (int32_t k = 0; k < numOfKeys; ++k) {
+    nodesListMakeAppend(&pKeys, createGroupKeyTarget(keys[k], k + 1, k + 2));
+
+    SColumn col = {0};
+    col.slotId = k + 1;
+    col.colId = k + 2;
+    col.type = keys[k].type;
+    col.bytes = tDataTypes[keys[k].type].bytes;
+    taosArrayPush(pGroupCols, &col);
+
+    SColumnInfoData key = createColumnInfoData(keys[k].type, tDataTypes[keys[k].type].bytes, k + 3);
+    blockDataAppendColInfo(pResBlock, &key);
+  }
+
+  int32_t    numOfExprs = 0;
+  SExprInfo* pExprInfo = createExprInfo(pFuncs, pKeys, &numOfExprs);
+
+  SGroupInputInfo input = {.pBlocks = pBlocks, .current = 0};
+  SOperatorInfo*  pDownstream = (SOperatorInfo*)taosMemoryCalloc(1, sizeof(SOperatorInfo));
+  pDownstream->name = "dummyInputOpertor4GroupBy";
+  pDownstream->operatorType = QUERY_NODE_PHYSICAL_PLAN_EXCHANGE;
+  pDownstream->fpSet.getNextFn = getGroupInputBlock;
+  pDownstream->info = &input;
+
+  SOperatorInfo* pOperator = createGroupOperatorInfo(pDownstream, pExprInfo, numOfExprs, pResBlock, pGroupCols, NULL,
+                                                     NULL, 0, pTaskInfo);
+  ASSERT_NE(pOperator, nullptr);
+
+  SGroupbyOperatorInfo* pInfo = (SGroupbyOperatorInfo*)pOperator->info;
+  if (fixedKey) {
+    ASSERT_TRUE(pInfo->fixedKey) << "the keys do not take the fixed key path";
+  }
+  pInfo->fixedKey = pInfo->fixedKey && fixedKey;
+  *spillLevel = 0;
+
+  int32_t code = setjmp(pTaskInfo->env);
+  if (code == 0) {
+    while (1) {
+      SSDataBlock* pBlock = pOperator->fpSet.getNextFn(pOperator);
+      if (pBlock == NULL) {
+        break;
+      }
+
+      // level 1 is a partition spilled by the first pass, the deeper levels are spilled again by their parents
+      *spillLevel = TMAX(*spillLevel, pInfo->spillLevel);
+
+      // the fixed key hash holds the groups of the current pass only, all of them in the result row hash table
+      ASSERT_LE(pInfo->fixedHash.size, tSimpleHashGetSize(pInfo->aggSup.pResultRowHashTable));
+
+      for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+        std::string key = buildGroupResKey(pBlock, i, 2, numOfKeys);
+        ASSERT_EQ(pRes->count(key), 0) << "the group is returned more than once";
+
+        SColumnInfoData* pCount = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+        SColumnInfoData* pSum = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+        int64_t          s = colDataIsNull_s(pSum, i) ? 0 : *(int64_t*)colDataGetData(pSum, i);
+        (*pRes)[key] = std::make_pair(*(int64_t*)colDataGetData(pCount, i), s);
+      }
+    }
+  }
+  ASSERT_EQ(code, TSDB_CODE_SUCCESS) << tstrerror(code);
+
+  // all the memory acquired by the operator is given back, both to the task and to the query buffer of the node
+  pOperator->fpSet.closeFn(pOperator->info);
+  cleanupExprSupp(&pOperator->exprSupp);
+  taosMemoryFree(pOperator->pDownstream);
+  taosMemoryFree(pOperator);
+  taosMemoryFree(pDownstream);
+
+  EXPECT_EQ(pTaskInfo->memInfo.used, 0);
+  EXPECT_EQ(pTaskInfo->memInfo.reserved, 0);
+
+  cleanupTaskMemInfo(pTaskInfo);
+  nodesDestroyList(pFuncs);
+  nodesDestroyList(pKeys);
+  taosMemoryFree(pTaskInfo->id.str);
+  taosMemoryFree(pTaskInfo);
+}
+
+void destroyGroupInputBlocks(SArray* pBlocks) {
+  for (int32_t i = 0; i < taosArrayGetSize(pBlocks); ++i) {
+    blockDataDestroy(*(SSDataBlock**)taosArrayGet(pBlocks, i));
+  }
+  taosArrayDestroy(pBlocks);
+}
+
+void initGroupbyTestEnv() {
+  osDefaultInit();
+  osUpdate();
+  fmFuncMgtInit();
+}
+
+}  // namespace
+
+TEST(testCase, group_by_spill_Test) {
+  initGroupbyTestEnv();
+
+  // 3000 groups of int keys in 2 group ids, far more than the result rows the memory limit allows
+  std::vector<SGroupTestKey> keys = {{TSDB_DATA_TYPE_INT, 3000, true}};
+
+  SArray* pBlocks = taosArrayInit(16, POINTER_BYTES);
+  for (int32_t i = 0; i < 16; ++i) {
+    SSDataBlock* pBlock = createGroupInputBlock(keys, 1000, i * 1000, i % 2 + 1);
+    taosArrayPush(pBlocks, &pBlock);
+  }
+
+  SGroupResMap expect;
+  calcGroupExpectRes(pBlocks, keys.size(), &expect);
+
+  // no limit, everything is aggregated in memory
+  SGroupResMap res;
+  int32_t      spillLevel = 0;
+  runHashGroupby(pBlocks, keys, false, 0, &res, &spillLevel);
+  ASSERT_EQ(spillLevel, 0);
+  ASSERT_EQ(res, expect);
+
+  // the new groups are spilled once the limit is reached, and the spilled partitions spill again if they still do
+  // not fit
+  int64_t limits[] = {128 * 1024, 32 * 1024, 8 * 1024};
+  int32_t levels[] = {1, 1, 2};
+  for (int32_t i = 0; i < tListLen(limits); ++i) {
+    res.clear();
+    runHashGroupby(pBlocks, keys, false, limits[i], &res, &spillLevel);
+    ASSERT_GE(spillLevel, levels[i]) << "limit " << limits[i];
+    ASSERT_EQ(res, expect) << "limit " << limits[i];
+  }
+
+  // the memory is charged to the query buffer of the node when it is used, not reserved up front
+  int64_t bufSize = tsQueryBufferSizeBytes;
+  tsQueryBufferSizeBytes = 1024 * 1024;
+  res.clear();
+  runHashGroupby(pBlocks, keys, false, 512 * 1048576L, &res, &spillLevel);
+  ASSERT_EQ(spillLevel, 0);
+  ASSERT_EQ(res, expect);
+  ASSERT_EQ(tsQueryBufferSizeBytes, 1024 * 1024);
+
+  // the query buffer of the node runs out before the task limit is reached
+  tsQueryBufferSizeBytes = 32 * 1024;
+  res.clear();
+  runHashGroupby(pBlocks, keys, false, 512 * 1048576L, &res, &spillLevel);
+  ASSERT_GE(spillLevel, 1);
+  ASSERT_EQ(res, expect);
+  ASSERT_EQ(tsQueryBufferSizeBytes, 32 * 1024);
+  tsQueryBufferSizeBytes = bufSize;
+
+  destroyGroupInputBlocks(pBlocks);
+}
+
+TEST(testCase, group_by_fixed_key_Test) {
+  initGroupbyTestEnv();
+
+  // the fixed key path must return the same groups as the generic one, null keys and group ids included
+  std::vector<std::vector<SGroupTestKey>> keySets = {
+      {{TSDB_DATA_TYPE_INT, 50, true}},
+      {{TSDB_DATA_TYPE_BOOL, 2, true}},
+      {{TSDB_DATA_TYPE_TINYINT, 200, true}},
+      {{TSDB_DATA_TYPE_TIMESTAMP, 500, false}},
+      {{TSDB_DATA_TYPE_DOUBLE, 300, true}},
+      {{TSDB_DATA_TYPE_INT, 40, true}, {TSDB_DATA_TYPE_BOOL, 2, true}},
+      {{TSDB_DATA_TYPE_TIMESTAMP, 100, false}, {TSDB_DATA_TYPE_DOUBLE, 30, true}},
+      {{TSDB_DATA_TYPE_TINYINT, 10, true}, {TSDB_DATA_TYPE_TINYINT, 10, true}},
+  };
+
+  for (int32_t s = 0; s < keySets.size(); ++s) {
+    const std::vector<SGroupTestKey>& keys = keySets[s];
+
+    SArray* pBlocks = taosArrayInit(12, POINTER_BYTES);
+    for (int32_t i = 0; i < 12; ++i) {
+      SSDataBlock* pBlock = createGroupInputBlock(keys, 1000, i * 1000, i % 3 + 1);
+      taosArrayPush(pBlocks, &pBlock);
+    }
+
+    SGroupResMap expect;
+    calcGroupExpectRes(pBlocks, keys.size(), &expect);
+
+    SGroupResMap generic;
+    int32_t      spillLevel = 0;
+    runHashGroupby(pBlocks, keys, false, 0, &generic, &spillLevel);
+    ASSERT_EQ(generic, expect) << "key set " << s;
+
+    SGroupResMap fixed;
+    runHashGroupby(pBlocks, keys, true, 0, &fixed, &spillLevel);
+    ASSERT_EQ(spillLevel, 0);
+    ASSERT_EQ(fixed, generic) << "key set " << s;
+
+    destroyGroupInputBlocks(pBlocks);
+  }
+}
+
+TEST(testCase, group_by_fixed_key_spill_Test) {
+  initGroupbyTestEnv();
+
+  // the groups of a pass are discarded after it, and so are their positions kept by the fixed key hash
+  std::vector<std::vector<SGroupTestKey>> keySets = {
+      {{TSDB_DATA_TYPE_INT, 3000, true}},
+      {{TSDB_DATA_TYPE_INT, 1500, true}, {TSDB_DATA_TYPE_BOOL, 2, true}},
+  };
+
+  for (int32_t s = 0; s < keySets.size(); ++s) {
+    const std::vector<SGroupTestKey>& keys = keySets[s];
+
+    SArray* pBlocks = taosArrayInit(16, POINTER_BYTES);
+    for (int32_t i = 0; i < 16; ++i) {
+      SSDataBlock* pBlock = createGroupInputBlock(keys, 1000, i * 1000, i % 2 + 1);
+      taosArrayPush(pBlocks, &pBlock);
+    }
+
+    SGroupResMap expect;
+    calcGroupExpectRes(pBlocks, keys.size(), &expect);
+
+    // the slots of the fixed key hash do not fit in the smallest limit, and the generic path is taken instead
+    int64_t limits[] = {128 * 1024, 64 * 1024, 32 * 1024};
+    int32_t levels[] = {1, 1, 1};
+    for (int32_t i = 0; i < tListLen(limits); ++i) {
+      SGroupResMap res;
+      int32_t      spillLevel = 0;
+      runHashGroupby(pBlocks, keys, true, limits[i], &res, &spillLevel);
+      ASSERT_GE(spillLevel, levels[i]) << "key set " << s << " limit " << limits[i];
+      ASSERT_EQ(res, expect) << "key set " << s << " limit " << limits[i];
+    }
+
+    destroyGroupInputBlocks(pBlocks);
+  }
+}
+
+TEST(testCase, scan_slice_Test) {
+  SScanPhysiNode scanNode = {};
+
+  // every table of a vnode is scanned by exactly one slice, so the slices together return what a single scan does
+  for (int32_t numOfSlices : {2, 3, 4, 16}) {
+    std::vector<int32_t> numOfTables(numOfSlices, 0);
+    for (uint64_t uid = 1; uid <= 10000; ++uid) {
+      int32_t numOfOwners = 0;
+      for (int32_t i = 0; i < numOfSlices; ++i) {
+        scanNode.numOfSlices = numOfSlices;
+        scanNode.sliceIdx = i;
+        if (isTableInScanSlice(&scanNode, uid)) {
+          ++numOfOwners;
+          ++numOfTables[i];
+        }
+      }
+      ASSERT_EQ(numOfOwners, 1) << "uid " << uid << " slices " << numOfSlices;
+    }
+
+    for (int32_t i = 0; i < numOfSlices; ++i) {
+      ASSERT_GT(numOfTables[i], 10000 / numOfSlices / 2) << "slice " << i << " of " << numOfSlices;
+    }
+  }
+
+  // a scan that is not sliced keeps every table
+  for (int32_t numOfSlices : {0, 1}) {
+    scanNode.numOfSlices = numOfSlices;
+    scanNode.sliceIdx = 0;
+    for (uint64_t uid = 1; uid <= 100; ++uid) {
+      ASSERT_TRUE(isTableInScanSlice(&scanNode, uid));
+    }
+  }
+}
+
 #pragma GCC diagnosti
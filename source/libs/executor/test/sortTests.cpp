@@ -14,9 +14,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iostream>
+#include <vector>
 #include <tglobal.h>
 #include <tsort.h>
-#include <iostream>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wwrite-strings"
@@ -393,4 +395,141 @@ TEST(testCase, ordered_merge_sort_Test) {
 
 #endif
 
+namespace {
+typedef struct SFloatSortRow {
+  double  v;
+  bool    isNull;
+  int32_t id;
+} SFloatSortRow;
+
+typedef struct SFloatSortSource {
+  std::vector<SSDataBlock*> blocks;
+  int32_t                   current;
+} SFloatSortSource;
+
+// null first, then all NaNs before the other values and -0 equals +0, which is the order of compareDoubleVal. The id
+// breaks the tie of the equal values.
+bool floatSortRowLess(const SFloatSortRow& l, const SFloatSortRow& r) {
+  if (l.isNull != r.isNull) {
+    return l.isNull;
+  }
+
+  if (!l.isNull) {
+    if (isnan(l.v) != isnan(r.v)) {
+      return isnan(l.v);
+    }
+
+    if (!isnan(l.v) && l.v != r.v) {
+      return l.v < r.v;
+    }
+  }
+
+  return l.id < r.id;
+}
+
+SSDataBlock* getFloatSortBlock(void* param) {
+  SFloatSortSource* pSource = (SFloatSortSource*)param;
+  if (pSource->current >= pSource->blocks.size()) {
+    return NULL;
+  }
+
+  return pSource->blocks[pSource->current++];
+}
+
+SSDataBlock* createFloatSortBlock(const std::vector<SFloatSortRow>& rows) {
+  SSDataBlock*    pBlock = createDataBlock();
+  SColumnInfoData col0 = createColumnInfoData(TSDB_DATA_TYPE_DOUBLE, sizeof(double), 1);
+  SColumnInfoData col1 = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 2);
+  blockDataAppendColInfo(pBlock, &col0);
+  blockDataAppendColInfo(pBlock, &col1);
+  blockDataEnsureCapacity(pBlock, rows.size());
+
+  for (int32_t i = 0; i < rows.size(); ++i) {
+    colDataAppend((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0), i, (const char*)&rows[i].v, rows[i].isNull);
+    colDataAppend((SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1), i, (const char*)&rows[i].id, false);
+  }
+
+  pBlock->info.rows = rows.size();
+  return pBlock;
+}
+}  // namespace
+
+// merge sources ordered by a double column that contains NaNs, -0 and +0 on the normalized keys, the result must be
+// the same as the order defined by compareDoubleVal
+TEST(testCase, normalized_key_merge_Test) {
+  // the sort handle requires the temp space
+  osDefaultInit();
+  osUpdate();
+
+  double nan = NAN;
+  double values[] = {nan, -nan, -INFINITY, -1.5, -0.0, 0.0, 1e-3, 2.5, INFINITY, DBL_MAX};
+
+  std::vector<SFloatSortRow> rows;
+  for (int32_t i = 0; i < 600; ++i) {
+    SFloatSortRow row = {.v = values[(i * 7) % tListLen(values)], .isNull = (i % 13 == 0), .id = i};
+    rows.push_back(row);
+  }
+  std::sort(rows.begin(), rows.end(), floatSortRowLess);
+
+  // every source is a sorted subsequence of the result, and is fetched in several blocks
+  const int32_t    numOfSources = 5;
+  SFloatSortSource sources[numOfSources];
+  for (int32_t i = 0; i < numOfSources; ++i) {
+    std::vector<SFloatSortRow> part;
+    for (int32_t j = i; j < rows.size(); j += numOfSources) {
+      part.push_back(rows[j]);
+      if (part.size() == 17) {
+        sources[i].blocks.push_back(createFloatSortBlock(part));
+        part.clear();
+      }
+    }
+    if (!part.empty()) {
+      sources[i].blocks.push_back(createFloatSortBlock(part));
+    }
+    sources[i].current = 0;
+  }
+
+  SArray*         orderInfo = taosArrayInit(2, sizeof(SBlockOrderInfo));
+  SBlockOrderInfo oi = {.nullFirst = true, .order = TSDB_ORDER_ASC, .slotId = 0};
+  taosArrayPush(orderInfo, &oi);
+  SBlockOrderInfo oi1 = {.nullFirst = true, .order = TSDB_ORDER_ASC, .slotId = 1};
+  taosArrayPush(orderInfo, &oi1);
+
+  SSDataBlock* pBlock = createFloatSortBlock(std::vector<SFloatSortRow>());
+
+  // the default comparator, so that the sources are compared on the normalized keys
+  SSortHandle* phandle = tsortCreateSortHandle(orderInfo, SORT_MULTISOURCE_MERGE, 1024, 5, pBlock, "test_normalized");
+  tsortSetFetchRawDataFp(phandle, getFloatSortBlock, NULL, NULL);
+  for (int32_t i = 0; i < numOfSources; ++i) {
+    SSortSource* ps = static_cast<SSortSource*>(taosMemoryCalloc(1, sizeof(SSortSource)));
+    ps->param = &sources[i];
+    tsortAddSource(phandle, ps);
+  }
+
+  ASSERT_EQ(tsortOpen(phandle), 0);
+
+  int32_t index = 0;
+  while (1) {
+    STupleHandle* pTupleHandle = tsortNextTuple(phandle);
+    if (pTupleHandle == NULL) {
+      break;
+    }
+
+    ASSERT_LT(index, rows.size());
+    ASSERT_EQ(*(int32_t*)tsortGetValue(pTupleHandle, 1), rows[index].id) << "row " << index;
+    ASSERT_EQ(tsortIsNullVal(pTupleHandle, 0), rows[index].isNull) << "row " << index;
+    index += 1;
+  }
+  ASSERT_EQ(index, rows.size());
+
+  tsortDestroySortHandle(phandle);
+  blockDataDestroy(pBlock);
+  taosArrayDestroy(orderInfo);
+  for (int32_t i = 0; i < numOfSources; ++i) {
+    for (int32_t j = 0; j < sources[i].blocks.size(); ++j) {
+      blockDataDestroy(sources[i].blocks[j]);
+    }
+  }
+}
+
 #pragma GCC diagnostic pop
@@ -487,13 +487,16 @@ int32_t functionFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
 int32_t firstCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   SResultRowEntryInfo* pDResInfo = GET_RES_INFO(pDestCtx);
   SFirstLastRes*       pDBuf = GET_ROWCELL_INTERBUF(pDResInfo);
-  int32_t              bytes = pDBuf->bytes;
 
   SResultRowEntryInfo* pSResInfo = GET_RES_INFO(pSourceCtx);
   SFirstLastRes*       pSBuf = GET_ROWCELL_INTERBUF(pSResInfo);
 
+  // the destination may be freshly set up, so take the value header from the source as well
   if (pSResInfo->numOfRes != 0 && (pDResInfo->numOfRes == 0 || pDBuf->ts > pSBuf->ts)) {
-    memcpy(pDBuf->buf, pSBuf->buf, bytes);
+    pDBuf->bytes = pSBuf->bytes;
+    pDBuf->isNull = pSBuf->isNull;
+    pDBuf->hasResult = pSBuf->hasResult;
+    memcpy(pDBuf->buf, pSBuf->buf, pSBuf->bytes);
     pDBuf->ts = pSBuf->ts;
     pDResInfo->numOfRes = 1;
   }
@@ -754,6 +757,7 @@ int32_t sumCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   } else if (type == TSDB_DATA_TYPE_DOUBLE || type == TSDB_DATA_TYPE_FLOAT) {
     pDBuf->dsum += pSBuf->dsum;
   }
+  pDBuf->type = type;
   pDResInfo->numOfRes = TMAX(pDResInfo->numOfRes, pSResInfo->numOfRes);
   pDResInfo->isNullRes &= pSResInfo->isNullRes;
   return TSDB_CODE_SUCCESS;
@@ -1087,6 +1091,9 @@ int32_t avgCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
     pDBuf->sum.dsum += pSBuf->sum.dsum;
   }
   pDBuf->count += pSBuf->count;
+  pDBuf->type = type;
+  pDResInfo->numOfRes = TMAX(pDResInfo->numOfRes, pSResInfo->numOfRes);
+  pDResInfo->isNullRes &= pSResInfo->isNullRes;
 
   return TSDB_CODE_SUCCESS;
 }
@@ -2124,6 +2131,7 @@ int32_t stddevCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
     pDBuf->quadraticDSum += pSBuf->quadraticDSum;
   }
   pDBuf->count += pSBuf->count;
+  pDBuf->type = type;
   pDResInfo->numOfRes = TMAX(pDResInfo->numOfRes, pSResInfo->numOfRes);
   pDResInfo->isNullRes &= pSResInfo->isNullRes;
   return TSDB_CODE_SUCCESS;
@@ -3091,13 +3099,16 @@ int32_t firstLastPartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
 int32_t lastCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   SResultRowEntryInfo* pDResInfo = GET_RES_INFO(pDestCtx);
   SFirstLastRes*       pDBuf = GET_ROWCELL_INTERBUF(pDResInfo);
-  int32_t              bytes = pDBuf->bytes;
 
   SResultRowEntryInfo* pSResInfo = GET_RES_INFO(pSourceCtx);
   SFirstLastRes*       pSBuf = GET_ROWCELL_INTERBUF(pSResInfo);
 
+  // the destination may be freshly set up, so take the value header from the source as well
   if (pSResInfo->numOfRes != 0 && (pDResInfo->numOfRes == 0 || pDBuf->ts < pSBuf->ts)) {
-    memcpy(pDBuf->buf, pSBuf->buf, bytes);
+    pDBuf->bytes = pSBuf->bytes;
+    pDBuf->isNull = pSBuf->isNull;
+    pDBuf->hasResult = pSBuf->hasResult;
+    memcpy(pDBuf->buf, pSBuf->buf, pSBuf->bytes);
     pDBuf->ts = pSBuf->ts;
     pDResInfo->numOfRes = 1;
   }
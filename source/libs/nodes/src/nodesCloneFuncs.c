@@ -384,6 +384,8 @@ static int32_t logicScanCopy(const SScanLogicNode* pSrc, SScanLogicNode* pDst) {
   CLONE_NODE_LIST_FIELD(pTags);
   CLONE_NODE_FIELD(pSubtable);
   COPY_SCALAR_FIELD(igLastNull);
+  COPY_SCALAR_FIELD(numOfSlices);
+  COPY_SCALAR_FIELD(sliceIdx);
   return TSDB_CODE_SUCCESS;
 }
 
@@ -537,6 +539,8 @@ static int32_t physiScanCopy(const SScanPhysiNode* pSrc, SScanPhysiNode* pDst) {
   COPY_SCALAR_FIELD(suid);
   COPY_SCALAR_FIELD(tableType);
   COPY_OBJECT_FIELD(tableName, sizeof(SName));
+  COPY_SCALAR_FIELD(numOfSlices);
+  COPY_SCALAR_FIELD(sliceIdx);
   return TSDB_CODE_SUCCESS;
 }
 
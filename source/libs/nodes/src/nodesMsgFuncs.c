@@ -1892,7 +1892,9 @@ enum {
   PHY_SCAN_CODE_BASE_UID,
   PHY_SCAN_CODE_BASE_SUID,
   PHY_SCAN_CODE_BASE_TABLE_TYPE,
-  PHY_SCAN_CODE_BASE_TABLE_NAME
+  PHY_SCAN_CODE_BASE_TABLE_NAME,
+  PHY_SCAN_CODE_BASE_NUM_OF_SLICES,
+  PHY_SCAN_CODE_BASE_SLICE_IDX
 };
 
 static int32_t physiScanNodeToMsg(const void* pObj, STlvEncoder* pEncoder) {
@@ -1917,6 +1919,12 @@ static int32_t physiScanNodeToMsg(const void* pObj, STlvEncoder* pEncoder) {
   if (TSDB_CODE_SUCCESS == code) {
     code = tlvEncodeObj(pEncoder, PHY_SCAN_CODE_BASE_TABLE_NAME, nameToMsg, &pNode->tableName);
   }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = tlvEncodeI32(pEncoder, PHY_SCAN_CODE_BASE_NUM_OF_SLICES, pNode->numOfSlices);
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = tlvEncodeI32(pEncoder, PHY_SCAN_CODE_BASE_SLICE_IDX, pNode->sliceIdx);
+  }
 
   return code;
 }
@@ -1949,6 +1957,12 @@ static int32_t msgToPhysiScanNode(STlvDecoder* pDecoder, void* pObj) {
       case PHY_SCAN_CODE_BASE_TABLE_NAME:
         code = tlvDecodeObjFromTlv(pTlv, msgToName, &pNode->tableName);
         break;
+      case PHY_SCAN_CODE_BASE_NUM_OF_SLICES:
+        code = tlvDecodeI32(pTlv, &pNode->numOfSlices);
+        break;
+      case PHY_SCAN_CODE_BASE_SLICE_IDX:
+        code = tlvDecodeI32(pTlv, &pNode->sliceIdx);
+        break;
       default:
         break;
     }
@@ -527,7 +527,10 @@ cmd ::= KILL QUERY NK_STRING(A).
 cmd ::= KILL TRANSACTION NK_INTEGER(A).                                           { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_TRANSACTION_STMT, &A); }
 
 /************************************************ merge/redistribute/ vgroup ******************************************/
-cmd ::= BALANCE VGROUP.                                                           { pCxt->pRootNode = createBalanceVgroupStmt(pCxt); }
+cmd ::= BALANCE VGROUP.                                                           { pCxt->pRootNode = createBalanceVgroupStmt(pCxt, false, NULL); }
+cmd ::= BALANCE VGROUP LIMIT NK_INTEGER(A).                                       { pCxt->pRootNode = createBalanceVgroupStmt(pCxt, false, &A); }
+cmd ::= EXPLAIN BALANCE VGROUP.                                                   { pCxt->pRootNode = createBalanceVgroupStmt(pCxt, true, NULL); }
+cmd ::= EXPLAIN BALANCE VGROUP LIMIT NK_INTEGER(A).                               { pCxt->pRootNode = createBalanceVgroupStmt(pCxt, true, &A); }
 cmd ::= MERGE VGROUP NK_INTEGER(A) NK_INTEGER(B).                                 { pCxt->pRootNode = createMergeVgroupStmt(pCxt, &A, &B); }
 cmd ::= REDISTRIBUTE VGROUP NK_INTEGER(A) dnode_list(B).                          { pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &A, B); }
 cmd ::= SPLIT VGROUP NK_INTEGER(A).                                               { pCxt->pRootNode = createSplitVgroupStmt(pCxt, &A); }
@@ -1749,10 +1749,12 @@ SNode* createKillQueryStmt(SAstCreateContext* pCxt, const SToken* pQueryId) {
   return (SNode*)pStmt;
 }
 
-SNode* createBalanceVgroupStmt(SAstCreateContext* pCxt) {
+SNode* createBalanceVgroupStmt(SAstCreateContext* pCxt, bool dryRun, const SToken* pMaxMoves) {
   CHECK_PARSER_STATUS(pCxt);
   SBalanceVgroupStmt* pStmt = (SBalanceVgroupStmt*)nodesMakeNode(QUERY_NODE_BALANCE_VGROUP_STMT);
   CHECK_OUT_OF_MEM(pStmt);
+  pStmt->dryRun = dryRun;
+  pStmt->maxMoves = (NULL != pMaxMoves ? taosStr2Int32(pMaxMoves->z, NULL, 10) : 0);
   return (SNode*)pStmt;
 }
 
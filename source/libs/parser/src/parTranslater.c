@@ -5650,7 +5650,7 @@ static int32_t translateRevoke(STranslateContext* pCxt, SRevokeStmt* pStmt) {
 }
 
 static int32_t translateBalanceVgroup(STranslateContext* pCxt, SBalanceVgroupStmt* pStmt) {
-  SBalanceVgroupReq req = {0};
+  SBalanceVgroupReq req = {.dryRun = pStmt->dryRun, .maxMoves = pStmt->maxMoves};
   return buildCmdMsg(pCxt, TDMT_MND_BALANCE_VGROUP, (FSerializeFunc)tSerializeSBalanceVgroupReq, &req);
 }
 
@@ -6018,6 +6018,32 @@ static int32_t extractShowVariablesResultSchema(int32_t* numOfCols, SSchema** pS
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t extractBalanceVgroupResultSchema(int32_t* numOfCols, SSchema** pSchema) {
+  *numOfCols = 4;
+  *pSchema = taosMemoryCalloc((*numOfCols), sizeof(SSchema));
+  if (NULL == (*pSchema)) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  (*pSchema)[0].type = TSDB_DATA_TYPE_INT;
+  (*pSchema)[0].bytes = tDataTypes[TSDB_DATA_TYPE_INT].bytes;
+  strcpy((*pSchema)[0].name, "vgroup_id");
+
+  (*pSchema)[1].type = TSDB_DATA_TYPE_INT;
+  (*pSchema)[1].bytes = tDataTypes[TSDB_DATA_TYPE_INT].bytes;
+  strcpy((*pSchema)[1].name, "src_dnode");
+
+  (*pSchema)[2].type = TSDB_DATA_TYPE_INT;
+  (*pSchema)[2].bytes = tDataTypes[TSDB_DATA_TYPE_INT].bytes;
+  strcpy((*pSchema)[2].name, "dst_dnode");
+
+  (*pSchema)[3].type = TSDB_DATA_TYPE_DOUBLE;
+  (*pSchema)[3].bytes = tDataTypes[TSDB_DATA_TYPE_DOUBLE].bytes;
+  strcpy((*pSchema)[3].name, "cost");
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t extractResultSchema(const SNode* pRoot, int32_t* numOfCols, SSchema** pSchema) {
   if (NULL == pRoot) {
     return TSDB_CODE_SUCCESS;
@@ -6039,6 +6065,8 @@ int32_t extractResultSchema(const SNode* pRoot, int32_t* numOfCols, SSchema** pS
     case QUERY_NODE_SHOW_LOCAL_VARIABLES_STMT:
     case QUERY_NODE_SHOW_VARIABLES_STMT:
       return extractShowVariablesResultSchema(numOfCols, pSchema);
+    case QUERY_NODE_BALANCE_VGROUP_STMT:
+      return extractBalanceVgroupResultSchema(numOfCols, pSchema);
     default:
       break;
   }
@@ -7516,6 +7544,14 @@ static int32_t setQuery(STranslateContext* pCxt, SQuery* pQuery) {
         pQuery->msgType = pQuery->pCmdMsg->msgType;
       }
       break;
+    case QUERY_NODE_BALANCE_VGROUP_STMT:
+      pQuery->haveResultSet = ((SBalanceVgroupStmt*)pQuery->pRoot)->dryRun;
+      pQuery->execMode = QUERY_EXEC_MODE_RPC;
+      if (NULL != pCxt->pCmdMsg) {
+        TSWAP(pQuery->pCmdMsg, pCxt->pCmdMsg);
+        pQuery->msgType = pQuery->pCmdMsg->msgType;
+      }
+      break;
     default:
       pQuery->execMode = QUERY_EXEC_MODE_RPC;
       if (NULL != pCxt->pCmdMsg) {
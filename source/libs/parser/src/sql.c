@@ -139,17 +139,17 @@ typedef union {
 #define ParseCTX_FETCH
 #define ParseCTX_STORE
 #define YYFALLBACK 1
-#define YYNSTATE             694
-#define YYNRULE              522
+#define YYNSTATE             700
+#define YYNRULE              525
 #define YYNTOKEN             317
-#define YY_MAX_SHIFT         693
-#define YY_MIN_SHIFTREDUCE   1025
-#define YY_MAX_SHIFTREDUCE   1546
-#define YY_ERROR_ACTION      1547
-#define YY_ACCEPT_ACTION     1548
-#define YY_NO_ACTION         1549
-#define YY_MIN_REDUCE        1550
-#define YY_MAX_REDUCE        2071
+#define YY_MAX_SHIFT         699
+#define YY_MIN_SHIFTREDUCE   1031
+#define YY_MAX_SHIFTREDUCE   1555
+#define YY_ERROR_ACTION      1556
+#define YY_ACCEPT_ACTION     1557
+#define YY_NO_ACTION         1558
+#define YY_MIN_REDUCE        1559
+#define YY_MAX_REDUCE        2083
 /************* End control #defines *******************************************/
 #define YY_NLOOKAHEAD ((int)(sizeof(yy_lookahead)/sizeof(yy_lookahead[0])))
 
@@ -216,755 +216,759 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (2819)
+#define YY_ACTTAB_COUNT (2840)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */  1873,   34,  267, 1873,  156, 1058, 1562, 1887,   62,  532,
- /*    10 */  1690, 1869,   44,   42, 1869,  446,  334,  447, 1585, 1799,
- /*    20 */   349, 1869, 1327,   43,   41,   40,   39,   38,  586,  157,
- /*    30 */   167, 1548, 1352, 1407, 1654, 1325, 1905, 1865, 1871,  337,
- /*    40 */  1865, 1871,  343, 1738,  587, 1062, 1063, 1865, 1871, 1855,
- /*    50 */   593,  599,   30,  593,  445, 1573, 1402,  449,   37,   36,
- /*    60 */   593,   17,   43,   41,   40,   39,   38, 1887, 1333,   44,
- /*    70 */    42, 1477, 1885, 1572,  503,  586, 1921,  349,  571, 1327,
- /*    80 */    97, 1886, 1888,  603, 1890, 1891,  598,   77,  593,  513,
- /*    90 */  1407,  364, 1325,  168,    1, 1974, 1905, 1855,   58,  342,
- /*   100 */  1970,  125,   46,  218,  600,  583,   58, 2042,  528, 1855,
- /*   110 */  1694,  599,  173, 1402,  463, 1855,  690,  506,   17, 1571,
- /*   120 */  2000,  500,  570,  171,  586, 1333,  217, 2043,  572, 2046,
- /*   130 */  1409, 1410,  601, 2047,  132,  583, 1921, 2042,  394, 1570,
- /*   140 */    98,  348, 1888,  603, 1890, 1891,  598,  454,  593,  447,
- /*   150 */  1585,    1, 2048,  171, 1075, 1974, 1074, 2043,  572,  314,
- /*   160 */  1970, 1855, 2042,   64,  132, 1474,   63,   58, 1481,  482,
- /*   170 */  2042,  130,  335,  690, 1352, 1328,  310, 1326, 2046,  219,
- /*   180 */   154, 1855, 2043, 2045, 1076,  570,  171, 1409, 1410, 1701,
- /*   190 */  2043,  572,  585,  169, 1982, 1983, 1353, 1987,   46, 1331,
- /*   200 */  1332,  121, 1382, 1383, 1385, 1386, 1387, 1388, 1389, 1390,
- /*   210 */  1391, 1392,  595,  591, 1400, 1401, 1403, 1404, 1405, 1406,
- /*   220 */  1408, 1411,    3,  264, 1982,  582, 1676,  581, 1745, 1746,
- /*   230 */  2042, 1417, 1328,  383, 1326,   79,  312, 1352,  388,  535,
- /*   240 */   174, 1503,  494,  493,  174,  570,  171,  387,  174,  386,
- /*   250 */  2043,  572,  174,  385,  381,  528, 1331, 1332,   58, 1382,
- /*   260 */  1383, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,  595,
- /*   270 */   591, 1400, 1401, 1403, 1404, 1405, 1406, 1408, 1411,    3,
- /*   280 */    44,   42,  693,  181, 2042,  233,  234,  628,  349,   77,
- /*   290 */  1327,  558, 1501, 1502, 1504, 1505,  274,  545, 1887, 2048,
- /*   300 */   171, 1407,  545, 1325, 2043,  572, 1222, 1223, 1569,   52,
- /*   310 */   165, 1874, 1695,  174,  120,  683,  679,  675,  671,  272,
- /*   320 */    74,  484, 1869,   73, 1402,  220, 1699, 1905, 1729,   17,
- /*   330 */   354, 1699,  634, 1744, 1746,  600, 1333,   44,   42, 1075,
- /*   340 */  1855, 1074,  599,  312,  143,  349,  535, 1327, 1865, 1871,
- /*   350 */  1855,  145,  144,  631,  630,  629,   95, 1384, 1407,  240,
- /*   360 */  1325,  593,    1,  601,  451,  561,  545, 1921,  634, 1076,
- /*   370 */  1350,  294,  348, 1888,  603, 1890, 1891,  598,  120,  593,
- /*   380 */    47, 1402, 1551,  574,  690,  489,   17,  145,  144,  631,
- /*   390 */   630,  629,  542, 1333, 1568, 1699,   51,  453, 1409, 1410,
- /*   400 */   449, 2042, 1473,  110,  174, 1140,  109,  108,  107,  106,
- /*   410 */   105,  104,  103,  102,  101, 1352,  570,  171, 1989,    1,
- /*   420 */  1384, 2043,  572,  110,  229,  227,  109,  108,  107,  106,
- /*   430 */   105,  104,  103,  102,  101,  545, 1855,  545, 1142,  431,
- /*   440 */   545,  690, 1299, 1328,  222, 1326, 1986,  176, 1353,  392,
- /*   450 */   567,  562,  393,   37,   36, 1409, 1410,   43,   41,   40,
- /*   460 */    39,   38, 1567,   58, 1699,   81, 1699, 1331, 1332, 1699,
- /*   470 */  1382, 1383, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
- /*   480 */   595,  591, 1400, 1401, 1403, 1404, 1405, 1406, 1408, 1411,
- /*   490 */     3,   11,   11,    9,    7,  185,  184,   40,   39,   38,
- /*   500 */  1328,  547, 1326, 1946, 1855,  325, 1180,  625,  624,  623,
- /*   510 */  1184,  622, 1186, 1187,  621, 1189,  618,  636, 1195,  615,
- /*   520 */  1197, 1198,  612,  609, 1331, 1332,  174, 1382, 1383, 1385,
- /*   530 */  1386, 1387, 1388, 1389, 1390, 1391, 1392,  595,  591, 1400,
- /*   540 */  1401, 1403, 1404, 1405, 1406, 1408, 1411,    3,   44,   42,
- /*   550 */  1751,  545, 1905,  498,  497,  496,  349,  336, 1327, 1550,
- /*   560 */   565,  126,  492,  403,  545,  326, 1749,  324,  323, 1407,
- /*   570 */   486, 1325,  491,  495,  488, 1352,  417, 1566,  490, 1565,
- /*   580 */  1699, 1887,  512,  119,  118,  117,  116,  115,  114,  113,
- /*   590 */   112,  111, 1402, 1699,  352,  510,  487,  508, 1384,  564,
- /*   600 */  1887, 1751,  154, 1564, 1333,   44,   42, 1412,  353,  174,
- /*   610 */  1905, 1701, 1543,  349, 2047, 1327,  355, 1749,  600, 1855,
- /*   620 */  1354, 1855, 1677, 1855,  154,  599, 1407, 1751, 1325, 1905,
- /*   630 */     8, 1354, 1802, 1701,  319, 2047,   11,  600,  232,  545,
- /*   640 */    13,   12, 1855, 1749,  599, 1855, 1885, 1561, 1675, 1402,
- /*   650 */  1921,  418,  690,  531,  158, 1886, 1888,  603, 1890, 1891,
- /*   660 */   598, 1333,  593, 1842, 2042, 1885, 1409, 1410, 1699, 1921,
- /*   670 */   528,  545,  571,   97, 1886, 1888,  603, 1890, 1891,  598,
- /*   680 */  2046,  593,  463,  461, 2043, 2044, 2062,    8, 1974, 1855,
- /*   690 */    94, 1438,  342, 1970, 1470,  550, 2011, 1305, 1306, 2042,
- /*   700 */  1699, 2042, 2008,  566,  127,   87, 1536, 1542,  636,  690,
- /*   710 */   371, 1328, 1691, 1326, 2048,  171,  570,  171,  532, 2043,
- /*   720 */   572, 2043,  572, 1409, 1410,   37,   36, 1692, 1800,   43,
- /*   730 */    41,   40,   39,   38, 1450, 1331, 1332, 1355, 1382, 1383,
- /*   740 */  1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,  595,  591,
- /*   750 */  1400, 1401, 1403, 1404, 1405, 1406, 1408, 1411,    3,   37,
- /*   760 */    36,   31,  266,   43,   41,   40,   39,   38, 1328, 1615,
- /*   770 */  1326, 1443, 1351,  266,   37,   36,  174,   32,   43,   41,
- /*   780 */    40,   39,   38,   37,   36, 1560, 1559,   43,   41,   40,
- /*   790 */    39,   38, 1331, 1332, 1558, 1382, 1383, 1385, 1386, 1387,
- /*   800 */  1388, 1389, 1390, 1391, 1392,  595,  591, 1400, 1401, 1403,
- /*   810 */  1404, 1405, 1406, 1408, 1411,    3,   44,   42,  549,  583,
- /*   820 */  1946,  661,  659, 1798,  349,  307, 1327, 1855, 1855, 1797,
- /*   830 */   395,  307,  498,  497,  496, 1333, 1855, 1407,  545, 1325,
- /*   840 */   126,  492,  545,  396, 1792, 1792, 1513, 1355,  132, 1887,
- /*   850 */   462,  491,  495, 1557, 1696,  179,  180,  490,   37,   36,
- /*   860 */  1402, 1493,   43,   41,   40,   39,   38, 1699, 1887, 1792,
- /*   870 */   545, 1699, 1333,   44,   42,  545, 1688,  545, 1905,  243,
- /*   880 */   183,  349,  137, 1327, 1751,  130,  600,  524, 1989,  529,
- /*   890 */   545, 1855,  154,  599, 1407, 1855, 1325, 1905,    8, 1699,
- /*   900 */  1750, 1702,  237,  545, 1699,  600, 1699,  170, 1982, 1983,
- /*   910 */  1855, 1987,  599, 1336, 1885,  541, 1985, 1402, 1921, 1699,
- /*   920 */   690, 1887,  159, 1886, 1888,  603, 1890, 1891,  598, 1333,
- /*   930 */   593,  488, 1699, 1885, 1409, 1410, 1556, 1921, 1555,  402,
- /*   940 */   545,   97, 1886, 1888,  603, 1890, 1891,  598,  128,  593,
- /*   950 */  1905, 1945,  356,  487, 2062,    1, 1974, 1989,  600,  545,
- /*   960 */   342, 1970,  578, 1855,  545,  599,  649,  648, 1669, 1699,
- /*   970 */  2036,  543,  545,  575,  573, 2063,  544,  690, 1855, 1328,
- /*   980 */  1855, 1326, 1674, 1602,  268, 1984, 1885,   72, 1699,  242,
- /*   990 */  1921, 1409, 1410, 1699,  159, 1886, 1888,  603, 1890, 1891,
- /*  1000 */   598, 1699,  593, 1331, 1332,  499, 1382, 1383, 1385, 1386,
- /*  1010 */  1387, 1388, 1389, 1390, 1391, 1392,  595,  591, 1400, 1401,
- /*  1020 */  1403, 1404, 1405, 1406, 1408, 1411,    3,   37,   36,  205,
- /*  1030 */  1684,   43,   41,   40,   39,   38, 1328,  632, 1326,  362,
- /*  1040 */  1742,  633,   45,  161, 1742, 1554, 1335, 2064,  480,  476,
- /*  1050 */   472,  468,  204, 1553,  279, 1339,  528, 1729, 1062, 1063,
- /*  1060 */  1331, 1332, 1612, 1382, 1383, 1385, 1386, 1387, 1388, 1389,
- /*  1070 */  1390, 1391, 1392,  595,  591, 1400, 1401, 1403, 1404, 1405,
- /*  1080 */  1406, 1408, 1411,    3,  309, 2042, 1350, 1855,  634,   78,
- /*  1090 */  1994, 1470,  202,  425, 1276, 1855,  436,   48,    4,  210,
- /*  1100 */  2048,  171,  208,   50,  527, 2043,  572,  145,  144,  631,
- /*  1110 */   630,  629, 1686,  410,  231,  437,  212,  412,  214,  211,
- /*  1120 */   216,  213,  138,  215,  226,  667,  666,  665,  664,  359,
- /*  1130 */  1682,  663,  662,  133,  657,  656,  655,  654,  653,  652,
- /*  1140 */   651,  650,  147,  646,  645,  644,  358,  357,  641,  640,
- /*  1150 */   639,  638,  637,  155,  201,  195, 1597,  200,  285,  322,
- /*  1160 */  1595,  459, 1545, 1546,   80,  642,  235,  142,   13,   12,
- /*  1170 */   590,  398,  283,   66,  538,  143,   65,  193,  501,   60,
- /*  1180 */   579,  153,  504,  247, 1327, 1876,   60, 1122, 1338,  576,
- /*  1190 */   223,   45,  189,  442,  440, 1887,  594, 1325, 2047,  435,
- /*  1200 */    45,  607,  430,  429,  428,  427,  424,  423,  422,  421,
- /*  1210 */   420,  416,  415,  414,  413,  407,  406,  405,  404,  239,
- /*  1220 */   400,  399,  321,  142, 1905,  523,  627, 1173,  143,   58,
- /*  1230 */  1333, 1500,  600, 1878, 1563,  250, 1655, 1855, 1444,  599,
- /*  1240 */  2014,   37,   36, 1393,  122,   43,   41,   40,   39,   38,
- /*  1250 */    37,   36,  278, 1201,   43,   41,   40,   39,   38, 1102,
- /*  1260 */  1885,  142,  643,  261, 1921,  559,  481,   96,   97, 1886,
- /*  1270 */  1888,  603, 1890, 1891,  598, 1205,  593, 1887,  690,  129,
- /*  1280 */  1212,  141, 1945, 1974, 1120,   26, 1591,  342, 1970,  255,
- /*  1290 */  1536, 1906, 1103,  360,  315, 1586, 1210, 1739, 2004,   93,
- /*  1300 */   584,  260,   71,   70,  391,  263, 1905,  178, 1428,   90,
- /*  1310 */     2,  332,    5,  146,  600,  365,  370,  320, 1292, 1855,
- /*  1320 */   182,  599,  275,  397,  308,  401, 1350,  379, 1887,  377,
- /*  1330 */   373,  369,  366,  363,  685,  419, 1436, 1328, 1794, 1326,
- /*  1340 */   426,  433, 1885,  432,  434,  583, 1921,  438, 1356,  439,
- /*  1350 */   301, 1886, 1888,  603, 1890, 1891,  598, 1905,  593,  186,
- /*  1360 */  1358, 1331, 1332,  441,  361,  587,  443,  444,  452,  455,
- /*  1370 */  1855,  192,  599,  456,  132,  174,  194,  516, 1357,  457,
- /*  1380 */  1359,  528,  458,  197,  199,   75,   76,  464,  460,  203,
- /*  1390 */  1437,  483,  485, 1885,  528,  100, 1689, 1921,  207, 1685,
- /*  1400 */   515,   97, 1886, 1888,  603, 1890, 1891,  598,  311,  593,
- /*  1410 */  2042,  130,  209,  148,  168,  221, 1974,  517, 1833,  276,
- /*  1420 */   342, 1970,  149, 2042, 1687, 2048,  171, 1683,  518,  150,
- /*  1430 */  2043,  572,  151,  172, 1982, 1983,  522, 1987, 2048,  171,
- /*  1440 */   519, 2001,  224, 2043,  572,  525, 1887,  530,  228,  557,
- /*  1450 */   331,  533, 1832,  139, 1804,  536,  140,  333,  539,   84,
- /*  1460 */    33,  346, 1431, 1432, 1433, 1434, 1435, 1439, 1440, 1441,
- /*  1470 */  1442,  540,  277, 1700,   86, 1905, 1355,  553,  560, 2005,
- /*  1480 */  2015,    6,  245,  600,  555,  556,  249,  338, 1855, 2020,
- /*  1490 */   599,  569,  563, 1996, 2019,  554,  552,  551,  259,  339,
- /*  1500 */   580,  577, 1470,  131, 1354,   57,  162,  254, 1955,   88,
- /*  1510 */   256, 1885, 1990, 1887,  605, 1921, 1743, 1670,  257,   97,
- /*  1520 */  1886, 1888,  603, 1890, 1891,  598,  258,  593,  280,  271,
- /*  1530 */   686,  687, 2062,  689, 1974, 1887, 2041,  292,  342, 1970,
- /*  1540 */   262,  306, 1905,   49, 2065,  282,  303,  302, 1993,  284,
- /*  1550 */   600, 1849, 1848,   68, 1847, 1855,   69,  599, 1846, 1843,
- /*  1560 */   367,  368, 1319, 1320, 1905,  177,  372, 1841,  374,  375,
- /*  1570 */   376, 1840,  600,  378, 1839,  380, 1838, 1855, 1885,  599,
- /*  1580 */  1837,  384, 1921,  382, 1295, 1294,   97, 1886, 1888,  603,
- /*  1590 */  1890, 1891,  598, 1887,  593, 1815, 1814,  389,  390, 1949,
- /*  1600 */  1885, 1974, 1813, 1812, 1921,  342, 1970,  134,   97, 1886,
- /*  1610 */  1888,  603, 1890, 1891,  598, 1887,  593, 1787, 1264,  345,
- /*  1620 */   344, 1947, 1905, 1974, 1786, 1784, 1783,  342, 1970, 1341,
- /*  1630 */   600, 1782, 1785,  135, 1781, 1855,  408,  599, 1780, 1779,
- /*  1640 */  1407, 1778, 1334, 1777, 1905, 1776,  409, 1775,  411, 1774,
- /*  1650 */  1773, 1772,  600, 1771, 1770, 1769, 1768, 1855, 1885,  599,
- /*  1660 */  1767, 1766, 1921, 1402, 1765, 1764,   97, 1886, 1888,  603,
- /*  1670 */  1890, 1891,  598, 1763,  593, 1333, 1762, 1761, 1760,  548,
- /*  1680 */  1885, 1974,  136, 1759, 1921,  342, 1970, 1148,   98, 1886,
- /*  1690 */  1888,  603, 1890, 1891,  598, 1758,  593, 1757, 1756, 1755,
- /*  1700 */  1754, 1266, 1753, 1974, 1752, 1617, 1616, 1973, 1970, 1614,
- /*  1710 */  1582,  190,  448,  187,  188,  166,  450, 1065, 1581,  123,
- /*  1720 */   124, 1064, 1887,  589,  191, 1828, 1822, 1811,  196,  198,
- /*  1730 */  1810, 1796, 1678, 1095, 1613, 1611,  465,  466, 1609,  470,
- /*  1740 */  1607,  474, 1605,  478, 1594, 1593,  469,  467, 1578,  473,
- /*  1750 */  1680, 1905,  471, 1679,  475,  477,  479, 1216, 1215,  600,
- /*  1760 */  1603, 1598,   59,  206, 1855,  502,  599,  658, 1139, 1132,
- /*  1770 */  1596,  660, 1138,  327, 1137, 1577, 1134,  328, 1133,  329,
- /*  1780 */  1576, 1131, 1342, 1575, 1337,  511,   99, 1885, 1311,  505,
- /*  1790 */  1887, 1921, 1827,  507,  509,   98, 1886, 1888,  603, 1890,
- /*  1800 */  1891,  598, 1821,  593,   53,  152, 1345, 1347, 1301, 1887,
- /*  1810 */  1974,  520, 1809,   25,  588, 1970, 1807, 2047, 1808, 1905,
- /*  1820 */   591, 1400, 1401, 1403, 1404, 1405, 1406,  597, 1309,  521,
- /*  1830 */   330, 1806, 1855,  225,  599, 1805, 1803, 1795, 1905,  526,
- /*  1840 */    83,  241,  537,   18,  238, 1419,  600,  230,   19,   20,
- /*  1850 */   534, 1855,   15,  599,   10, 1885,  236,  253,   82, 1921,
- /*  1860 */    90, 1876,   85,  300, 1886, 1888,  603, 1890, 1891,  598,
- /*  1870 */   596,  593,  546, 1939, 1885,   27, 1887, 1515, 1921,  246,
- /*  1880 */   244,  248,   98, 1886, 1888,  603, 1890, 1891,  598, 1497,
- /*  1890 */   593,   56, 1499, 1887,  160,  252,   29, 1974,  251,   61,
- /*  1900 */    22,   28, 1971, 1492,   89, 1905,  265, 1530, 1418, 1529,
- /*  1910 */   340, 1534, 1535,  597, 1536, 1533,  341, 1467, 1855, 1466,
- /*  1920 */   599,   55, 1905, 1875,   12,  163, 1343, 1924, 1429,   54,
- /*  1930 */   600,  164,   21, 1397,  592, 1855, 1887,  599, 1395,   35,
- /*  1940 */    14, 1885, 1375,  175, 1394, 1921, 1367,  604,   23,  300,
- /*  1950 */  1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1885, 1940,
- /*  1960 */    24,  606, 1921, 1202,  351, 1905,  158, 1886, 1888,  603,
- /*  1970 */  1890, 1891,  598,  600,  593,  602,  608,  610, 1855, 1199,
- /*  1980 */   599,  611,  613, 1196,  614, 1905, 1190,  616,  617,  619,
- /*  1990 */   347, 1194,  620,  600, 1188, 1179,   91,   92, 1855,  626,
- /*  2000 */   599, 1885, 1211,   67, 1193, 1921,  269, 1887, 2012,  296,
- /*  2010 */  1886, 1888,  603, 1890, 1891,  598,   16,  593, 1192, 1191,
- /*  2020 */  1207, 1885, 1093,  635, 1128, 1921, 1127, 1126, 1125,  301,
- /*  2030 */  1886, 1888,  603, 1890, 1891,  598, 1905,  593, 1124, 1123,
- /*  2040 */  1121,  350, 1119, 1118,  600, 1117, 1146,  647, 1115, 1855,
- /*  2050 */  1114,  599,  270,  568, 1113, 1112, 1111, 1110, 1109, 1108,
- /*  2060 */  1141, 1105, 1143, 1104, 1101, 1100, 1099, 1610, 1098, 1608,
- /*  2070 */   668, 1606, 1885,  672,  669,  670, 1921,  676,  673,  674,
- /*  2080 */   301, 1886, 1888,  603, 1890, 1891,  598, 1887,  593,  678,
- /*  2090 */   677, 1604,  680,  681,  682, 1592,  684, 1055, 1574,  273,
- /*  2100 */   688, 1549, 1329,  281,  691, 1887,  692, 1549, 1549, 1549,
- /*  2110 */  1549, 1549, 1549, 1549, 1549, 1549, 1905, 1549, 1549, 1549,
- /*  2120 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2130 */  1549,  599, 1549, 1549, 1905, 1549, 1549, 1549, 1549, 1549,
- /*  2140 */  1549, 1549,  600, 1549, 1549, 1549, 1549, 1855, 1887,  599,
- /*  2150 */  1549, 1549,  514, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2160 */   294, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1549,
- /*  2170 */  1885, 1549, 1549, 1549, 1921, 1549, 1549, 1905,  286, 1886,
- /*  2180 */  1888,  603, 1890, 1891,  598,  600,  593, 1549, 1549, 1549,
- /*  2190 */  1855, 1887,  599, 1549, 1549, 1549, 1905, 1549, 1549, 1549,
- /*  2200 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2210 */  1549,  599, 1549, 1885, 1549, 1549, 1549, 1921, 1549, 1549,
- /*  2220 */  1905,  287, 1886, 1888,  603, 1890, 1891,  598,  600,  593,
- /*  2230 */  1549, 1549, 1885, 1855, 1887,  599, 1921, 1549, 1549, 1549,
- /*  2240 */   288, 1886, 1888,  603, 1890, 1891,  598, 1549,  593, 1549,
- /*  2250 */  1549, 1887, 1549, 1549, 1549, 1549, 1885, 1549, 1549, 1549,
- /*  2260 */  1921, 1549, 1549, 1905,  295, 1886, 1888,  603, 1890, 1891,
- /*  2270 */   598,  600,  593, 1549, 1549, 1549, 1855, 1887,  599, 1549,
- /*  2280 */  1905, 1549, 1549, 1549, 1549, 1549, 1549, 1549,  600, 1549,
- /*  2290 */  1549, 1549, 1549, 1855, 1887,  599, 1549, 1549, 1549, 1885,
- /*  2300 */  1549, 1549, 1549, 1921, 1549, 1549, 1905,  297, 1886, 1888,
- /*  2310 */   603, 1890, 1891,  598,  600,  593, 1885, 1549, 1549, 1855,
- /*  2320 */  1921,  599, 1549, 1905,  289, 1886, 1888,  603, 1890, 1891,
- /*  2330 */   598,  600,  593, 1549, 1549, 1549, 1855, 1549,  599, 1549,
- /*  2340 */  1549, 1549, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2350 */   298, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1885,
- /*  2360 */  1549, 1549, 1549, 1921, 1549, 1549, 1549,  290, 1886, 1888,
- /*  2370 */   603, 1890, 1891,  598, 1887,  593, 1549, 1549, 1549, 1549,
- /*  2380 */  1549, 1549, 1549, 1549, 1549, 1549, 1905, 1549, 1549, 1549,
- /*  2390 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2400 */  1549,  599, 1549, 1905, 1549, 1549, 1549, 1549, 1549, 1549,
- /*  2410 */  1549,  600, 1549, 1549, 1549, 1549, 1855, 1549,  599, 1549,
- /*  2420 */  1549, 1549, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2430 */   299, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1885,
- /*  2440 */  1549, 1549, 1549, 1921, 1549, 1549, 1549,  291, 1886, 1888,
- /*  2450 */   603, 1890, 1891,  598, 1549,  593, 1549, 1549, 1549, 1549,
- /*  2460 */  1549, 1549, 1549, 1887, 1549, 1549, 1905, 1549, 1549, 1549,
- /*  2470 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2480 */  1549,  599, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549,
- /*  2490 */  1549, 1549, 1905, 1549, 1549, 1549, 1549, 1549, 1549, 1549,
- /*  2500 */   600, 1549, 1885, 1549, 1549, 1855, 1921,  599, 1549, 1549,
- /*  2510 */   304, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1549,
- /*  2520 */  1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1885, 1549,
- /*  2530 */  1549, 1549, 1921, 1549, 1887, 1549,  305, 1886, 1888,  603,
- /*  2540 */  1890, 1891,  598, 1549,  593, 1549, 1905, 1549, 1549, 1549,
- /*  2550 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2560 */  1549,  599, 1549, 1905, 1549, 1549, 1549, 1549, 1549, 1549,
- /*  2570 */  1549,  600, 1549, 1549, 1549, 1549, 1855, 1887,  599, 1549,
- /*  2580 */  1549, 1549, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2590 */  1899, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1885,
- /*  2600 */  1549, 1549, 1549, 1921, 1549, 1549, 1905, 1898, 1886, 1888,
- /*  2610 */   603, 1890, 1891,  598,  600,  593, 1549, 1549, 1549, 1855,
- /*  2620 */  1549,  599, 1549, 1549, 1549, 1549, 1905, 1549, 1549, 1549,
- /*  2630 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2640 */  1887,  599, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2650 */  1897, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1549,
- /*  2660 */  1549, 1549, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1905,
- /*  2670 */   316, 1886, 1888,  603, 1890, 1891,  598,  600,  593, 1549,
- /*  2680 */  1549, 1549, 1855, 1549,  599, 1549, 1905, 1549, 1549, 1549,
- /*  2690 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2700 */  1549,  599, 1549, 1549, 1549, 1885, 1549, 1549, 1549, 1921,
- /*  2710 */  1549, 1549, 1549,  317, 1886, 1888,  603, 1890, 1891,  598,
- /*  2720 */  1887,  593, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2730 */   313, 1886, 1888,  603, 1890, 1891,  598, 1887,  593, 1549,
- /*  2740 */  1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1905,
- /*  2750 */  1549, 1549, 1549, 1549, 1549, 1549, 1549,  600, 1549, 1549,
- /*  2760 */  1549, 1549, 1855, 1549,  599, 1549, 1905, 1549, 1549, 1549,
- /*  2770 */  1549, 1549, 1549, 1549,  600, 1549, 1549, 1549, 1549, 1855,
- /*  2780 */  1549,  599, 1549, 1549, 1549, 1885, 1549, 1549, 1549, 1921,
- /*  2790 */  1549, 1549, 1549,  318, 1886, 1888,  603, 1890, 1891,  598,
- /*  2800 */  1549,  593, 1885, 1549, 1549, 1549, 1921, 1549, 1549, 1549,
- /*  2810 */   293, 1886, 1888,  603, 1890, 1891,  598, 1549,  593,
+ /*     0 */  1885,   34,  267, 1885, 1811, 1064,  452, 1899,  453, 1594,
+ /*    10 */  1699, 1881,   44,   42, 1881,  460,  400,  453, 1594, 1801,
+ /*    20 */   351, 1881, 1336,   43,   41,   40,   39,   38,  356,  592,
+ /*    30 */   179, 1753, 1755, 1416,  592, 1334, 1917, 1877, 1883,  339,
+ /*    40 */  1877, 1883,  345, 1362,  593, 1068, 1069, 1877, 1883, 1867,
+ /*    50 */   599,  605,   30,  599,  310,  156, 1411, 1571,   37,   36,
+ /*    60 */   599,   17,   43,   41,   40,   39,   38, 1899, 1342,   44,
+ /*    70 */    42, 1486, 1897,   40,   39,   38, 1933,  351,  577, 1336,
+ /*    80 */    97, 1898, 1900,  609, 1902, 1903,  604,   77,  599, 2059,
+ /*    90 */  1416,  457, 1334,  169,    1, 1986, 1917, 1359,  592,  344,
+ /*   100 */  1982,  125,   58,   46,  606,  589, 1363, 2054,  469, 1867,
+ /*   110 */  1703,  605,  174, 1411,  451, 1361,  696,  455,   17, 1760,
+ /*   120 */  2012,  551,  576,  172,  157, 1342,  338, 2055,  578, 1663,
+ /*   130 */  1418, 1419,  607,   52,  132, 1758, 1933, 1560,  227,  337,
+ /*   140 */    98,  350, 1900,  609, 1902, 1903,  604,  154,  599, 1917,
+ /*   150 */  1708,    1, 2001, 1228, 1229, 1986, 1710,  571,  110,  314,
+ /*   160 */  1982,  109,  108,  107,  106,  105,  104,  103,  102,  101,
+ /*   170 */  2054,  130,   46,  696,  437, 1337,   58, 1335,   81,  219,
+ /*   180 */  1998, 1545,  393, 1298,  392,  576,  172, 1418, 1419,   58,
+ /*   190 */  2055,  578,  591,  170, 1994, 1995,  570, 1999,  233,  234,
+ /*   200 */  1340, 1341,  391, 1391, 1392, 1394, 1395, 1396, 1397, 1398,
+ /*   210 */  1399, 1400, 1401,  601,  597, 1409, 1410, 1412, 1413, 1414,
+ /*   220 */  1415, 1417, 1420,    3,  205, 1081, 1760, 1080, 1754, 1755,
+ /*   230 */   185,  184, 1337,  355, 1335,   79,  312, 1336,  161,  541,
+ /*   240 */   488,  175, 1758,  486,  482,  478,  474,  204,  266,  175,
+ /*   250 */  1334,   13,   12, 1582,  634, 1082,  312, 1340, 1341,  541,
+ /*   260 */  1391, 1392, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+ /*   270 */   601,  597, 1409, 1410, 1412, 1413, 1414, 1415, 1417, 1420,
+ /*   280 */     3,   44,   42, 1342,   78,  220,  354,  202, 1738,  351,
+ /*   290 */  1886, 1336,   37,   36,  154, 1867,   43,   41,   40,   39,
+ /*   300 */    38, 1881, 1416, 1710, 1334, 1581,  110,  394,  168,  109,
+ /*   310 */   108,  107,  106,  105,  104,  103,  102,  101,  357,  175,
+ /*   320 */    77, 1747,  538,  175,  534, 1411,  154, 1877, 1883,  336,
+ /*   330 */    17,  696, 1808, 1899,  642, 1710,  175, 1342,   44,   42,
+ /*   340 */   599, 1361,   62, 1704, 1760, 1459,  351, 1867, 1336,  201,
+ /*   350 */   195,  319,  200, 2054,  567,  551,  465, 1686,   58, 1416,
+ /*   360 */  1758, 1334, 1917,    1,  551, 1490,  551,  177, 2060,  172,
+ /*   370 */   606, 1361,  193, 2055,  578, 1867,  120,  605,  398, 1522,
+ /*   380 */  1426,   47, 1411,  490, 1708,  696, 1361,   17,  518,  577,
+ /*   390 */  1337,   94, 1335, 1708, 1342, 1708, 2006, 1479, 1897, 1418,
+ /*   400 */  1419,  516, 1933,  514, 1146,  127,   97, 1898, 1900,  609,
+ /*   410 */  1902, 1903,  604, 1700,  599, 1340, 1341,  469, 2054, 2074,
+ /*   420 */     1, 1986, 1363,   37,   36,  344, 1982,   43,   41,   40,
+ /*   430 */    39,   38,   58,  576,  172, 2020, 1559, 1148, 2055,  578,
+ /*   440 */   573,  568,  696, 2001, 1337, 1512, 1335,   37,   36,  500,
+ /*   450 */   499,   43,   41,   40,   39,   38, 1418, 1419,   26, 1364,
+ /*   460 */   119,  118,  117,  116,  115,  114,  113,  112,  111, 1340,
+ /*   470 */  1341, 1997, 1391, 1392, 1394, 1395, 1396, 1397, 1398, 1399,
+ /*   480 */  1400, 1401,  601,  597, 1409, 1410, 1412, 1413, 1414, 1415,
+ /*   490 */  1417, 1420,    3,  232,   11,  564, 1510, 1511, 1513, 1514,
+ /*   500 */  1362, 1337,   87, 1335, 1624,  175, 1186,  631,  630,  629,
+ /*   510 */  1190,  628, 1192, 1193,  627, 1195,  624,  181, 1201,  621,
+ /*   520 */  1203, 1204,  618,  615, 1701, 1393, 1340, 1341,  175, 1391,
+ /*   530 */  1392, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,  601,
+ /*   540 */   597, 1409, 1410, 1412, 1413, 1414, 1415, 1417, 1420,    3,
+ /*   550 */    44,   42, 1311, 1312,   74, 1393,  459,   73,  351,  455,
+ /*   560 */  1336, 1580,  551, 1081,  266, 1080,  551,  504,  503,  502,
+ /*   570 */  1393, 1416,    7, 1334,  358,  126,  498,  386,  120,  175,
+ /*   580 */   504,  503,  502, 1899,  551,  495,  497,  501,  126,  498,
+ /*   590 */  1684, 1708,  496, 1082, 1411, 1708,  399,  388,  384,  497,
+ /*   600 */   501,  243, 1899, 1867, 1361,  496, 1342,   44,   42, 1421,
+ /*   610 */  1483,  551, 1917, 1708,  640,  351,   11, 1336,    9,  553,
+ /*   620 */   606, 1958, 1364,  409, 1579, 1867,  551,  605, 1416, 2059,
+ /*   630 */  1334, 1917,    8,  145,  144,  637,  636,  635,  423,  606,
+ /*   640 */  1708, 1447,  667,  665, 1867,  555,  605, 1958,  607, 1578,
+ /*   650 */   642, 1411, 1933,  551,  696, 1708,  294,  350, 1900,  609,
+ /*   660 */  1902, 1903,  604, 1342,  599,  424, 1867, 1897, 1418, 1419,
+ /*   670 */   537, 1933,  572, 1801, 2059,   97, 1898, 1900,  609, 1902,
+ /*   680 */  1903,  604, 1708,  599,  180, 2059, 2054,  534, 2074,    8,
+ /*   690 */  1986, 1867,   37,   36,  344, 1982,   43,   41,   40,   39,
+ /*   700 */    38,  576,  172, 2054, 2048, 2001, 2055,  578,  538, 1801,
+ /*   710 */  1360,  696,   31, 1337, 2054, 1335, 2054, 1557, 1809, 2058,
+ /*   720 */   183, 1545, 1452, 2055, 2057, 1418, 1419, 1068, 1069, 1577,
+ /*   730 */  2058, 2060,  172, 1996, 2055, 2056, 2055,  578, 1340, 1341,
+ /*   740 */    11, 1391, 1392, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+ /*   750 */  1401,  601,  597, 1409, 1410, 1412, 1413, 1414, 1415, 1417,
+ /*   760 */  1420,    3,  551,  551,  242, 1807,  128,  307,  551, 1957,
+ /*   770 */  1337, 1867, 1335, 1479,  467,  468, 1806,  366,  307,  175,
+ /*   780 */  1705,   37,   36, 1576, 1575,   43,   41,   40,   39,   38,
+ /*   790 */  1574, 1708, 1708, 1573,  534, 1340, 1341, 1708, 1391, 1392,
+ /*   800 */  1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,  601,  597,
+ /*   810 */  1409, 1410, 1412, 1413, 1414, 1415, 1417, 1420,    3,   44,
+ /*   820 */    42,  551,  509, 2054, 1342, 1867, 1867,  351,  638, 1336,
+ /*   830 */  1570, 1751, 1867,  137,  408, 1867,  154,  519, 2060,  172,
+ /*   840 */  1416, 1569, 1334, 2055,  578, 1711,  153,   32, 1482, 1568,
+ /*   850 */  1708,  218, 1899,   37,   36, 2058, 1567,   43,   41,   40,
+ /*   860 */    39,   38, 1566, 1411, 1565,  512,  494,  279, 1502,  506,
+ /*   870 */  1738, 1899, 1867,  551,  217, 1342,   44,   42,  551, 1760,
+ /*   880 */   401, 1917,   72, 1867,  351,  530, 1336,  589,  493,  606,
+ /*   890 */   535, 1867, 1564,  402, 1867, 1759,  605, 1416, 1867, 1334,
+ /*   900 */  1917,    8, 1708,  655, 1867, 1678, 1867, 1708,  606,  327,
+ /*   910 */   551,   64, 1563, 1867,   63,  605,  132, 1897, 1562, 1849,
+ /*   920 */  1411, 1933,  237,  696,  364,  158, 1898, 1900,  609, 1902,
+ /*   930 */  1903,  604, 1342,  599, 1867,  654, 1897, 1418, 1419, 1708,
+ /*   940 */  1933,  534,   48,    4,   97, 1898, 1900,  609, 1902, 1903,
+ /*   950 */   604,  143,  599,  130, 1867, 1854,  581, 2074,    1, 1986,
+ /*   960 */  1867, 1611,  639,  344, 1982, 1751,  556, 2023,  589,  328,
+ /*   970 */  2054,  326,  325, 2005,  492,  171, 1994, 1995,  494, 1999,
+ /*   980 */   696,  584, 1337,  505, 1335, 2060,  172,  363, 1851,  210,
+ /*   990 */  2055,  578,  208,  212, 1418, 1419,  211,  132, 1685,   45,
+ /*  1000 */   493, 1697,  373,   51,  534, 1693,  226, 1340, 1341, 1606,
+ /*  1010 */  1391, 1392, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+ /*  1020 */   601,  597, 1409, 1410, 1412, 1413, 1414, 1415, 1417, 1420,
+ /*  1030 */     3,  507,  551, 2054,  130,  214, 1345,  216,  213, 1337,
+ /*  1040 */   215, 1335,   50,  533,  547,  522,   80,  231, 2060,  172,
+ /*  1050 */   138, 1282, 1344, 2055,  578, 1600,  173, 1994, 1995, 1695,
+ /*  1060 */  1999, 1708,  534,  142, 1340, 1341, 1621, 1391, 1392, 1394,
+ /*  1070 */  1395, 1396, 1397, 1398, 1399, 1400, 1401,  601,  597, 1409,
+ /*  1080 */  1410, 1412, 1413, 1414, 1415, 1417, 1420,    3,  309,  551,
+ /*  1090 */  1359, 2054, 1604, 1554, 1555,   13,   12,  431,  596,  235,
+ /*  1100 */   442,  549,  544,  691,  640, 1691, 2060,  172,  223,  600,
+ /*  1110 */   580, 2055,  578,  381,  510,  239,  633,  416, 1708,  443,
+ /*  1120 */   143,  418,   60,  145,  144,  637,  636,  635,  529,  673,
+ /*  1130 */   672,  671,  670,  361, 1572,  669,  668,  133,  663,  662,
+ /*  1140 */   661,  660,  659,  658,  657,  656,  147,  652,  651,  650,
+ /*  1150 */   360,  359,  647,  646,  645,  644,  643,  155,  551,   93,
+ /*  1160 */    37,   36,  285,  324,   43,   41,   40,   39,   38,   90,
+ /*  1170 */   550,  551, 1179,  582, 1509,  404,  283,   66, 1348,  247,
+ /*  1180 */    65, 2026,  390,  268,   60,   37,   36, 1708,   45,   43,
+ /*  1190 */    41,   40,   39,   38, 1347, 1888,  189,  448,  446,  585,
+ /*  1200 */  1708,   45,  613,  441, 1664, 1899,  436,  435,  434,  433,
+ /*  1210 */   430,  429,  428,  427,  426,  422,  421,  420,  419,  413,
+ /*  1220 */   412,  411,  410, 1683,  406,  405,  323,  261,  565, 1108,
+ /*  1230 */   487,  250,  255,   58, 1917,  142, 1453, 1437,  143,  648,
+ /*  1240 */  1402, 1918,  606, 1890,  122,  649,  362, 1867,  275,  605,
+ /*  1250 */   142,   37,   36,  278, 1207,   43,   41,   40,   39,   38,
+ /*  1260 */  1595, 1128, 1109, 1748,  263, 2016,    2, 1126,  590,  260,
+ /*  1270 */  1897,   96,    5,  367, 1933,  372,  320,  182,   97, 1898,
+ /*  1280 */  1900,  609, 1902, 1903,  604,  403,  599, 1211, 1359,  129,
+ /*  1290 */  1218,  141, 1957, 1986,  407,  425, 1216,  344, 1982,  347,
+ /*  1300 */   346, 1803,  146,  432,  315,  439,   71,   70,  397, 1350,
+ /*  1310 */   438,  166,  440,  444,  445,  186, 1899,  447,  449, 1552,
+ /*  1320 */  1416, 1365, 1343, 1367,  450,  458,  192,  461,  308,  640,
+ /*  1330 */   462,  382,  194, 1366,  379,  375,  371,  368,  365, 1368,
+ /*  1340 */   463,  466, 1899, 1411,  197, 1917, 1445,  464,  145,  144,
+ /*  1350 */   637,  636,  635,  593,  470, 1342,  199,   75, 1867,   76,
+ /*  1360 */   605,  489,  203,  491, 1698,  207,  311, 1694,  209,  100,
+ /*  1370 */   148, 1917,  149, 1842,  521,  523,  276, 1696,  221,  606,
+ /*  1380 */   175, 1897, 1692,  150, 1867, 1933,  605,  151,  524,   97,
+ /*  1390 */  1898, 1900,  609, 1902, 1903,  604,  528,  599,  224,  531,
+ /*  1400 */  1446,  536,  169,  595, 1986,  228,  545, 1897,  344, 1982,
+ /*  1410 */   563, 1933,  333,  525, 1551,   97, 1898, 1900,  609, 1902,
+ /*  1420 */  1903,  604,  139,  599,  539, 1841, 1813,  546, 1961, 2013,
+ /*  1430 */  1986,  542,  140,   84,  344, 1982,  335,   86,  277, 1709,
+ /*  1440 */  1364, 2017,  559, 2027,  245,  566,  561,  562,  249,  340,
+ /*  1450 */   569,  575,    6, 1899,  557,  560,  558,  586, 2077, 1479,
+ /*  1460 */  1363,  583, 1351,  131, 1346,  259,  341, 2008,   57, 2032,
+ /*  1470 */   256,   33,  348, 1440, 1441, 1442, 1443, 1444, 1448, 1449,
+ /*  1480 */  1450, 1451, 1917, 2031,  254,  162,  257, 1354, 1356, 2053,
+ /*  1490 */   606, 2002, 1967,  258,   88, 1867, 1899,  605,  271,  262,
+ /*  1500 */   611,  597, 1409, 1410, 1412, 1413, 1414, 1415, 1752, 1679,
+ /*  1510 */   280,  692,  693,  695,   49,  306,  292,  303, 1897,  282,
+ /*  1520 */  1861,  302, 1933,  284, 1860, 1917,   97, 1898, 1900,  609,
+ /*  1530 */  1902, 1903,  604,  606,  599,   68, 1859, 1858, 1867, 1959,
+ /*  1540 */   605, 1986,   69, 1855,  369,  344, 1982,  370, 1328, 1329,
+ /*  1550 */   178,  374, 1853,  376, 1899,  378,  377, 1850,  380,  321,
+ /*  1560 */  1848, 1897,  383, 1847,  385, 1933,  699, 1846,  387,   97,
+ /*  1570 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599, 1852,  389,
+ /*  1580 */   274,  322,  554, 1917, 1986, 1301, 1300, 1824,  344, 1982,
+ /*  1590 */  1823,  606,  395,  396,  165, 1822, 1867, 1821,  605,  689,
+ /*  1600 */   685,  681,  677,  272, 1270, 1917,  134, 1792, 1791, 1794,
+ /*  1610 */   135, 1790, 1789,  606, 1796, 1795, 1793, 1788, 1867, 1897,
+ /*  1620 */   605, 1787, 1786, 1933, 1785,  414,  415,   98, 1898, 1900,
+ /*  1630 */   609, 1902, 1903,  604, 1784,  599,  417, 1899, 1783, 1782,
+ /*  1640 */    95, 1897, 1986,  240, 1781, 1933, 1985, 1982, 1780,   98,
+ /*  1650 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599, 1779, 1778,
+ /*  1660 */  1777, 1776, 1775, 1774, 1986, 1773, 1917, 1772,  594, 1982,
+ /*  1670 */  1771, 1770,  136, 1769,  603, 1768,  548, 1767, 1766, 1867,
+ /*  1680 */  1765,  605, 1764, 1763, 1762, 1917, 1272, 1761, 1154, 1626,
+ /*  1690 */  1625,  187,  188,  606, 1623, 1591,  190,  454, 1867,  167,
+ /*  1700 */   605,  456, 1897, 1590, 1837,  123, 1933, 1071,  229,  191,
+ /*  1710 */   300, 1898, 1900,  609, 1902, 1903,  604,  602,  599,  552,
+ /*  1720 */  1951, 1897, 1070, 1899,  124, 1933, 1305, 1831,  222,  159,
+ /*  1730 */  1898, 1900,  609, 1902, 1903,  604, 1820,  599,  196,  198,
+ /*  1740 */  1819, 1805, 1687, 1101, 1622, 1620,  589,  472,  471, 1899,
+ /*  1750 */   473, 1618, 1917,  475,  476,  477, 1616,  479,  481, 1614,
+ /*  1760 */   606,  480,  484,  483,  485, 1867, 1222,  605, 1603, 1602,
+ /*  1770 */  1587, 1689, 1221,  206, 1688,  132,  664,   59, 1917, 1138,
+ /*  1780 */   666,  579, 2075,  334, 1145, 1612,  606, 1144, 1897, 1143,
+ /*  1790 */  1140, 1867, 1933,  605, 1607, 1139,   98, 1898, 1900,  609,
+ /*  1800 */  1902, 1903,  604, 1899,  599, 1605,  329, 1137,  330,  331,
+ /*  1810 */   508, 1986,  121,  511, 1897, 1586, 1983,  513, 1933, 1585,
+ /*  1820 */  1584,  517,  301, 1898, 1900,  609, 1902, 1903,  604,   99,
+ /*  1830 */   599,  515, 1917, 1317,  264, 1994,  588,   25,  587, 1836,
+ /*  1840 */   603, 2054, 1307, 1830,  526, 1867, 1899,  605, 1818, 1816,
+ /*  1850 */    53,  225,   18,  527,  152, 2059,  576,  172,  332, 1817,
+ /*  1860 */  1815, 2055,  578, 1814, 1315,  532, 1899, 1812, 1897,  543,
+ /*  1870 */   230,  236, 1933,   82, 1804, 1917,  300, 1898, 1900,  609,
+ /*  1880 */  1902, 1903,  604,  606,  599,  540, 1952,  238, 1867,   83,
+ /*  1890 */   605,   85,   90,  241,   19, 1917,   20,   15,   27,   56,
+ /*  1900 */   252, 1524,  244,  606,  248,   10,  246, 1506, 1867, 1508,
+ /*  1910 */   605, 1897,  160,   29,  253, 1933, 1501,  251,   28,  158,
+ /*  1920 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599, 1888, 1428,
+ /*  1930 */  1427, 1897,   89,   61,   22, 1933, 1544, 1545, 1539,  296,
+ /*  1940 */  1898, 1900,  609, 1902, 1903,  604, 1538,  599, 1899,  342,
+ /*  1950 */  1543, 1542,  343, 1476,  265, 1917, 1475,   12, 1887,  163,
+ /*  1960 */    54, 2024,   21,  606,   55,   16, 1352, 1438, 1867, 1936,
+ /*  1970 */   605, 1406,  598,  164, 1404,   35, 1384, 1917, 1403,   14,
+ /*  1980 */    23,  176,  349,  574,   24,  606,  612, 1376, 1208,  610,
+ /*  1990 */  1867, 1897,  605,  608,  353, 1933,  614,  616,  617,  159,
+ /*  2000 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599,  619,  622,
+ /*  2010 */   625, 1185,  620, 1897, 1205, 1202,  623, 1933, 1196, 1194,
+ /*  2020 */   626,  301, 1898, 1900,  609, 1902, 1903,  604, 1200,  599,
+ /*  2030 */    91,  632, 1899,   92, 1217, 1917,   67,  269, 1213, 1099,
+ /*  2040 */   352,  641, 1134,  606, 1133, 1132, 1199, 1198, 1867, 1197,
+ /*  2050 */   605, 1152, 2076, 1131, 1130, 1129, 1127, 1125, 1124, 1123,
+ /*  2060 */   270, 1917,  653, 1121, 1120, 1119, 1118, 1117, 1116,  606,
+ /*  2070 */  1115, 1897, 1114, 1149, 1867, 1933,  605, 1147, 1619,  301,
+ /*  2080 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599, 1111, 1110,
+ /*  2090 */  1107, 1106, 1105, 1104,  674,  675,  676,  520, 1617,  678,
+ /*  2100 */   680, 1933, 1615, 1899,  682,  294, 1898, 1900,  609, 1902,
+ /*  2110 */  1903,  604,  679,  599,  683, 1917,  684, 1613,  686,  687,
+ /*  2120 */   688, 1601,  690,  606, 1061, 1583,  273,  694, 1867, 1338,
+ /*  2130 */   605,  281, 1917,  697,  698, 1558, 1558, 1558, 1558, 1558,
+ /*  2140 */   606, 1558, 1558, 1558, 1558, 1867, 1899,  605, 1558, 1558,
+ /*  2150 */  1558, 1897, 1558, 1558, 1558, 1933, 1558, 1558, 1558,  286,
+ /*  2160 */  1898, 1900,  609, 1902, 1903,  604, 1899,  599, 1897, 1558,
+ /*  2170 */  1558, 1558, 1933, 1558, 1558, 1917,  287, 1898, 1900,  609,
+ /*  2180 */  1902, 1903,  604,  606,  599, 1558, 1558, 1558, 1867, 1558,
+ /*  2190 */   605, 1558, 1558, 1558, 1558, 1917, 1558, 1558, 1558, 1558,
+ /*  2200 */  1558, 1558, 1558,  606, 1558, 1558, 1558, 1558, 1867, 1899,
+ /*  2210 */   605, 1897, 1558, 1558, 1558, 1933, 1558, 1558, 1558,  288,
+ /*  2220 */  1898, 1900,  609, 1902, 1903,  604, 1558,  599, 1558, 1899,
+ /*  2230 */  1558, 1897, 1558, 1558, 1558, 1933, 1558, 1558, 1917,  295,
+ /*  2240 */  1898, 1900,  609, 1902, 1903,  604,  606,  599, 1558, 1558,
+ /*  2250 */  1558, 1867, 1558,  605, 1558, 1558, 1558, 1558, 1917, 1558,
+ /*  2260 */  1558, 1558, 1558, 1558, 1558, 1558,  606, 1558, 1558, 1558,
+ /*  2270 */  1558, 1867, 1558,  605, 1897, 1558, 1558, 1558, 1933, 1558,
+ /*  2280 */  1558, 1558,  297, 1898, 1900,  609, 1902, 1903,  604, 1899,
+ /*  2290 */   599, 1558, 1558, 1558, 1897, 1558, 1558, 1558, 1933, 1558,
+ /*  2300 */  1558, 1558,  289, 1898, 1900,  609, 1902, 1903,  604, 1558,
+ /*  2310 */   599, 1899, 1558, 1558, 1558, 1558, 1558, 1558, 1917, 1558,
+ /*  2320 */  1558, 1558, 1558, 1558, 1558, 1558,  606, 1558, 1558, 1558,
+ /*  2330 */  1558, 1867, 1558,  605, 1558, 1558, 1558, 1558, 1558, 1558,
+ /*  2340 */  1917, 1558, 1558, 1558, 1558, 1558, 1558, 1558,  606, 1558,
+ /*  2350 */  1558, 1558, 1558, 1867, 1897,  605, 1558, 1558, 1933, 1558,
+ /*  2360 */  1558, 1558,  298, 1898, 1900,  609, 1902, 1903,  604, 1899,
+ /*  2370 */   599, 1558, 1558, 1558, 1558, 1558, 1897, 1558, 1558, 1558,
+ /*  2380 */  1933, 1558, 1558, 1558,  290, 1898, 1900,  609, 1902, 1903,
+ /*  2390 */   604, 1558,  599, 1558, 1558, 1899, 1558, 1558, 1917, 1558,
+ /*  2400 */  1558, 1558, 1558, 1558, 1558, 1558,  606, 1558, 1558, 1558,
+ /*  2410 */  1558, 1867, 1558,  605, 1558, 1558, 1558, 1558, 1558, 1558,
+ /*  2420 */  1558, 1558, 1558, 1558, 1917, 1558, 1558, 1558, 1558, 1558,
+ /*  2430 */  1558, 1558,  606, 1558, 1897, 1558, 1558, 1867, 1933,  605,
+ /*  2440 */  1558, 1558,  299, 1898, 1900,  609, 1902, 1903,  604, 1899,
+ /*  2450 */   599, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558,
+ /*  2460 */  1897, 1558, 1558, 1558, 1933, 1558, 1899, 1558,  291, 1898,
+ /*  2470 */  1900,  609, 1902, 1903,  604, 1558,  599, 1558, 1917, 1558,
+ /*  2480 */  1558, 1558, 1558, 1558, 1558, 1558,  606, 1558, 1558, 1558,
+ /*  2490 */  1558, 1867, 1558,  605, 1558, 1917, 1558, 1558, 1558, 1558,
+ /*  2500 */  1558, 1558, 1558,  606, 1558, 1558, 1558, 1558, 1867, 1899,
+ /*  2510 */   605, 1558, 1558, 1558, 1897, 1558, 1558, 1558, 1933, 1558,
+ /*  2520 */  1558, 1558,  304, 1898, 1900,  609, 1902, 1903,  604, 1899,
+ /*  2530 */   599, 1897, 1558, 1558, 1558, 1933, 1558, 1558, 1917,  305,
+ /*  2540 */  1898, 1900,  609, 1902, 1903,  604,  606,  599, 1558, 1558,
+ /*  2550 */  1558, 1867, 1558,  605, 1558, 1558, 1558, 1558, 1917, 1558,
+ /*  2560 */  1558, 1558, 1558, 1558, 1558, 1558,  606, 1558, 1558, 1558,
+ /*  2570 */  1558, 1867, 1899,  605, 1897, 1558, 1558, 1558, 1933, 1558,
+ /*  2580 */  1558, 1558, 1911, 1898, 1900,  609, 1902, 1903,  604, 1558,
+ /*  2590 */   599, 1558, 1899, 1558, 1897, 1558, 1558, 1558, 1933, 1558,
+ /*  2600 */  1558, 1917, 1910, 1898, 1900,  609, 1902, 1903,  604,  606,
+ /*  2610 */   599, 1558, 1558, 1558, 1867, 1558,  605, 1558, 1558, 1558,
+ /*  2620 */  1558, 1917, 1558, 1558, 1558, 1558, 1558, 1558, 1558,  606,
+ /*  2630 */  1558, 1558, 1558, 1558, 1867, 1558,  605, 1897, 1558, 1558,
+ /*  2640 */  1558, 1933, 1558, 1558, 1558, 1909, 1898, 1900,  609, 1902,
+ /*  2650 */  1903,  604, 1899,  599, 1558, 1558, 1558, 1897, 1558, 1558,
+ /*  2660 */  1558, 1933, 1558, 1558, 1558,  316, 1898, 1900,  609, 1902,
+ /*  2670 */  1903,  604, 1558,  599, 1899, 1558, 1558, 1558, 1558, 1558,
+ /*  2680 */  1558, 1917, 1558, 1558, 1558, 1558, 1558, 1558, 1558,  606,
+ /*  2690 */  1558, 1558, 1558, 1558, 1867, 1558,  605, 1558, 1558, 1558,
+ /*  2700 */  1558, 1558, 1558, 1917, 1558, 1558, 1558, 1558, 1558, 1558,
+ /*  2710 */  1558,  606, 1558, 1558, 1558, 1558, 1867, 1897,  605, 1558,
+ /*  2720 */  1558, 1933, 1558, 1558, 1558,  317, 1898, 1900,  609, 1902,
+ /*  2730 */  1903,  604, 1899,  599, 1558, 1558, 1558, 1558, 1558, 1897,
+ /*  2740 */  1558, 1558, 1558, 1933, 1558, 1558, 1558,  313, 1898, 1900,
+ /*  2750 */   609, 1902, 1903,  604, 1558,  599, 1558, 1558, 1899, 1558,
+ /*  2760 */  1558, 1917, 1558, 1558, 1558, 1558, 1558, 1558, 1558,  606,
+ /*  2770 */  1558, 1558, 1558, 1558, 1867, 1558,  605, 1558, 1558, 1558,
+ /*  2780 */  1558, 1558, 1558, 1558, 1558, 1558, 1558, 1917, 1558, 1558,
+ /*  2790 */  1558, 1558, 1558, 1558, 1558,  606, 1558, 1897, 1558, 1558,
+ /*  2800 */  1867, 1933,  605, 1558, 1558,  318, 1898, 1900,  609, 1902,
+ /*  2810 */  1903,  604, 1558,  599, 1558, 1558, 1558, 1558, 1558, 1558,
+ /*  2820 */  1558, 1558, 1558, 1897, 1558, 1558, 1558, 1933, 1558, 1558,
+ /*  2830 */  1558,  293, 1898, 1900,  609, 1902, 1903,  604, 1558,  599,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */   351,  409,  410,  351,  319,    4,  321,  320,    4,  364,
- /*    10 */   351,  362,   12,   13,  362,  324,  371,  326,  327,  374,
- /*    20 */    20,  362,   22,   12,   13,   14,   15,   16,   20,  333,
- /*    30 */   348,  317,   20,   33,  338,   35,  349,  388,  389,  390,
- /*    40 */   388,  389,  390,  361,  357,   44,   45,  388,  389,  362,
- /*    50 */   401,  364,    2,  401,  325,  320,   56,  328,    8,    9,
+ /*     0 */   351,  409,  410,  351,    0,    4,  324,  320,  326,  327,
+ /*    10 */   351,  362,   12,   13,  362,  324,  328,  326,  327,  357,
+ /*    20 */    20,  362,   22,   12,   13,   14,   15,   16,  360,   20,
+ /*    30 */   368,  363,  364,   33,   20,   35,  349,  388,  389,  390,
+ /*    40 */   388,  389,  390,   20,  357,   44,   45,  388,  389,  362,
+ /*    50 */   401,  364,    2,  401,  366,  319,   56,  321,    8,    9,
  /*    60 */   401,   61,   12,   13,   14,   15,   16,  320,   68,   12,
- /*    70 */    13,   14,  385,  320,    4,   20,  389,   20,  394,   22,
- /*    80 */   393,  394,  395,  396,  397,  398,  399,  332,  401,   19,
- /*    90 */    33,  377,   35,  406,   94,  408,  349,  362,   94,  412,
- /*   100 */   413,  346,   94,   33,  357,  328,   94,  423,  394,  362,
- /*   110 */   355,  364,  425,   56,   60,  362,  116,   47,   61,  320,
- /*   120 */   433,   51,  438,  439,   20,   68,   56,  443,  444,    3,
- /*   130 */   130,  131,  385,  394,  357,  328,  389,  423,  328,  320,
- /*   140 */   393,  394,  395,  396,  397,  398,  399,  324,  401,  326,
- /*   150 */   327,   94,  438,  439,   20,  408,   22,  443,  444,  412,
- /*   160 */   413,  362,  423,   93,  357,    4,   96,   94,   14,   35,
- /*   170 */   423,  394,  341,  116,   20,  175,  366,  177,  439,  126,
- /*   180 */   349,  362,  443,  444,   50,  438,  439,  130,  131,  358,
- /*   190 */   443,  444,  415,  416,  417,  418,   20,  420,   94,  199,
- /*   200 */   200,  394,  202,  203,  204,  205,  206,  207,  208,  209,
+ /*    70 */    13,   14,  385,   14,   15,   16,  389,   20,  394,   22,
+ /*    80 */   393,  394,  395,  396,  397,  398,  399,  332,  401,    3,
+ /*    90 */    33,   14,   35,  406,   94,  408,  349,   20,   20,  412,
+ /*   100 */   413,  346,   94,   94,  357,  328,   20,  423,   60,  362,
+ /*   110 */   355,  364,  425,   56,  325,   20,  116,  328,   61,  349,
+ /*   120 */   433,  328,  438,  439,  333,   68,  356,  443,  444,  338,
+ /*   130 */   130,  131,  385,  340,  357,  365,  389,    0,   56,  341,
+ /*   140 */   393,  394,  395,  396,  397,  398,  399,  349,  401,  349,
+ /*   150 */   357,   94,  391,  130,  131,  408,  358,  357,   21,  412,
+ /*   160 */   413,   24,   25,   26,   27,   28,   29,   30,   31,   32,
+ /*   170 */   423,  394,   94,  116,   78,  175,   94,  177,   96,  126,
+ /*   180 */   419,   95,  174,  173,  176,  438,  439,  130,  131,   94,
+ /*   190 */   443,  444,  415,  416,  417,  418,  396,  420,  125,  126,
+ /*   200 */   200,  201,  192,  203,  204,  205,  206,  207,  208,  209,
  /*   210 */   210,  211,  212,  213,  214,  215,  216,  217,  218,  219,
- /*   220 */   220,  221,  222,  416,  417,  418,    0,  420,  363,  364,
- /*   230 */   423,   14,  175,  170,  177,  182,  183,   20,  377,  186,
- /*   240 */   240,  199,  335,  336,  240,  438,  439,  174,  240,  176,
- /*   250 */   443,  444,  240,  190,  191,  394,  199,  200,   94,  202,
+ /*   220 */   220,  221,  222,  223,   33,   20,  349,   22,  363,  364,
+ /*   230 */   134,  135,  175,  356,  177,  182,  183,   22,   47,  186,
+ /*   240 */    35,  241,  365,   52,   53,   54,   55,   56,  162,  241,
+ /*   250 */    35,    1,    2,  320,  105,   50,  183,  200,  201,  186,
  /*   260 */   203,  204,  205,  206,  207,  208,  209,  210,  211,  212,
  /*   270 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
- /*   280 */    12,   13,   19,   56,  423,  125,  126,  105,   20,  332,
- /*   290 */    22,  249,  250,  251,  252,  253,   33,  328,  320,  438,
- /*   300 */   439,   33,  328,   35,  443,  444,  130,  131,  320,  340,
- /*   310 */    47,  351,  355,  240,  340,   52,   53,   54,   55,   56,
- /*   320 */    93,  347,  362,   96,   56,  342,  357,  349,  345,   61,
- /*   330 */   360,  357,  106,  363,  364,  357,   68,   12,   13,   20,
- /*   340 */   362,   22,  364,  183,   43,   20,  186,   22,  388,  389,
- /*   350 */   362,  125,  126,  127,  128,  129,   93,  203,   33,   96,
- /*   360 */    35,  401,   94,  385,   14,  160,  328,  389,  106,   50,
- /*   370 */    20,  393,  394,  395,  396,  397,  398,  399,  340,  401,
- /*   380 */    94,   56,    0,  257,  116,  347,   61,  125,  126,  127,
- /*   390 */   128,  129,  129,   68,  320,  357,   95,  325,  130,  131,
- /*   400 */   328,  423,  241,   21,  240,   35,   24,   25,   26,   27,
- /*   410 */    28,   29,   30,   31,   32,   20,  438,  439,  391,   94,
- /*   420 */   203,  443,  444,   21,  161,   56,   24,   25,   26,   27,
- /*   430 */    28,   29,   30,   31,   32,  328,  362,  328,   68,   78,
- /*   440 */   328,  116,  179,  175,  181,  177,  419,  340,   20,  340,
- /*   450 */   245,  246,  340,    8,    9,  130,  131,   12,   13,   14,
- /*   460 */    15,   16,  320,   94,  357,   96,  357,  199,  200,  357,
- /*   470 */   202,  203,  204,  205,  206,  207,  208,  209,  210,  211,
- /*   480 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
- /*   490 */   222,  224,  224,  226,   39,  134,  135,   14,   15,   16,
- /*   500 */   175,  405,  177,  407,  362,   37,  107,  108,  109,  110,
- /*   510 */   111,  112,  113,  114,  115,  116,  117,   60,  119,  120,
- /*   520 */   121,  122,  123,  124,  199,  200,  240,  202,  203,  204,
- /*   530 */   205,  206,  207,  208,  209,  210,  211,  212,  213,  214,
- /*   540 */   215,  216,  217,  218,  219,  220,  221,  222,   12,   13,
- /*   550 */   349,  328,  349,   63,   64,   65,   20,  356,   22,    0,
- /*   560 */   357,   71,   72,  340,  328,   97,  365,   99,  100,   33,
- /*   570 */   102,   35,   82,   83,  106,   20,  340,  320,   88,  320,
- /*   580 */   357,  320,   21,   24,   25,   26,   27,   28,   29,   30,
- /*   590 */    31,   32,   56,  357,  341,   34,  128,   36,  203,  396,
- /*   600 */   320,  349,  349,  320,   68,   12,   13,   14,  356,  240,
- /*   610 */   349,  358,  167,   20,    3,   22,  341,  365,  357,  362,
- /*   620 */    20,  362,    0,  362,  349,  364,   33,  349,   35,  349,
- /*   630 */    94,   20,    0,  358,  356,  394,  224,  357,  125,  328,
- /*   640 */     1,    2,  362,  365,  364,  362,  385,  320,    0,   56,
- /*   650 */   389,  340,  116,  377,  393,  394,  395,  396,  397,  398,
- /*   660 */   399,   68,  401,    0,  423,  385,  130,  131,  357,  389,
- /*   670 */   394,  328,  394,  393,  394,  395,  396,  397,  398,  399,
- /*   680 */   439,  401,   60,  340,  443,  444,  406,   94,  408,  362,
- /*   690 */   330,  157,  412,  413,  239,  434,  435,  184,  185,  423,
- /*   700 */   357,  423,  422,   20,  344,  330,   95,  262,   60,  116,
- /*   710 */    47,  175,  352,  177,  438,  439,  438,  439,  364,  443,
- /*   720 */   444,  443,  444,  130,  131,    8,    9,  352,  374,   12,
- /*   730 */    13,   14,   15,   16,   95,  199,  200,   20,  202,  203,
- /*   740 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
- /*   750 */   214,  215,  216,  217,  218,  219,  220,  221,  222,    8,
- /*   760 */     9,  227,  162,   12,   13,   14,   15,   16,  175,    0,
- /*   770 */   177,  237,   20,  162,    8,    9,  240,    2,   12,   13,
- /*   780 */    14,   15,   16,    8,    9,  320,  320,   12,   13,   14,
- /*   790 */    15,   16,  199,  200,  320,  202,  203,  204,  205,  206,
- /*   800 */   207,  208,  209,  210,  211,  212,  213,  214,  215,  216,
- /*   810 */   217,  218,  219,  220,  221,  222,   12,   13,  405,  328,
- /*   820 */   407,  335,  336,  373,   20,  375,   22,  362,  362,  373,
- /*   830 */    22,  375,   63,   64,   65,   68,  362,   33,  328,   35,
- /*   840 */    71,   72,  328,   35,  357,  357,   95,   20,  357,  320,
- /*   850 */   340,   82,   83,  320,  340,  368,  368,   88,    8,    9,
- /*   860 */    56,   95,   12,   13,   14,   15,   16,  357,  320,  357,
- /*   870 */   328,  357,   68,   12,   13,  328,  350,  328,  349,  162,
- /*   880 */   368,   20,  340,   22,  349,  394,  357,  340,  391,  340,
- /*   890 */   328,  362,  349,  364,   33,  362,   35,  349,   94,  357,
- /*   900 */   365,  358,  340,  328,  357,  357,  357,  416,  417,  418,
- /*   910 */   362,  420,  364,   35,  385,  340,  419,   56,  389,  357,
- /*   920 */   116,  320,  393,  394,  395,  396,  397,  398,  399,   68,
- /*   930 */   401,  106,  357,  385,  130,  131,  320,  389,  320,  105,
- /*   940 */   328,  393,  394,  395,  396,  397,  398,  399,  404,  401,
- /*   950 */   349,  407,  340,  128,  406,   94,  408,  391,  357,  328,
- /*   960 */   412,  413,   43,  362,  328,  364,  337,   68,  339,  357,
- /*   970 */   422,  340,  328,   43,  445,  446,  340,  116,  362,  175,
- /*   980 */   362,  177,    0,    0,  340,  419,  385,  153,  357,  162,
- /*   990 */   389,  130,  131,  357,  393,  394,  395,  396,  397,  398,
- /*  1000 */   399,  357,  401,  199,  200,   22,  202,  203,  204,  205,
- /*  1010 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
- /*  1020 */   216,  217,  218,  219,  220,  221,  222,    8,    9,   33,
- /*  1030 */   350,   12,   13,   14,   15,   16,  175,  359,  177,  377,
- /*  1040 */   362,  359,   43,   47,  362,  320,   35,  446,   52,   53,
- /*  1050 */    54,   55,   56,  320,  342,  177,  394,  345,   44,   45,
- /*  1060 */   199,  200,    0,  202,  203,  204,  205,  206,  207,  208,
- /*  1070 */   209,  210,  211,  212,  213,  214,  215,  216,  217,  218,
- /*  1080 */   219,  220,  221,  222,   18,  423,   20,  362,  106,   93,
- /*  1090 */   238,  239,   96,   27,   95,  362,   30,   42,   43,   98,
- /*  1100 */   438,  439,  101,  162,  163,  443,  444,  125,  126,  127,
- /*  1110 */   128,  129,  350,   47,   43,   49,   98,   51,   98,  101,
- /*  1120 */    98,  101,   43,  101,   56,   63,   64,   65,   66,   67,
- /*  1130 */   350,   69,   70,   71,   72,   73,   74,   75,   76,   77,
- /*  1140 */    78,   79,   80,   81,   82,   83,   84,   85,   86,   87,
- /*  1150 */    88,   89,   90,   18,  158,  159,    0,  161,   23,   93,
- /*  1160 */     0,  165,  130,  131,   96,   13,   95,   43,    1,    2,
- /*  1170 */    61,  105,   37,   38,   95,   43,   41,  181,   22,   43,
- /*  1180 */   261,  162,   22,   43,   22,   46,   43,   35,  177,  259,
- /*  1190 */   350,   43,   57,   58,   59,  320,  350,   35,    3,  133,
- /*  1200 */    43,   43,  136,  137,  138,  139,  140,  141,  142,  143,
- /*  1210 */   144,  145,  146,  147,  148,  149,  150,  151,  152,   95,
- /*  1220 */   154,  155,  156,   43,  349,  381,  350,   95,   43,   94,
- /*  1230 */    68,   95,  357,   94,  321,   95,  338,  362,   95,  364,
- /*  1240 */   392,    8,    9,   95,   43,   12,   13,   14,   15,   16,
- /*  1250 */     8,    9,   95,   95,   12,   13,   14,   15,   16,   35,
- /*  1260 */   385,   43,   13,  447,  389,  436,  329,  132,  393,  394,
- /*  1270 */   395,  396,  397,  398,  399,   95,  401,  320,  116,  404,
- /*  1280 */    95,  406,  407,  408,   35,   43,    0,  412,  413,  430,
- /*  1290 */    95,  349,   68,  329,   61,  327,   95,  361,  392,   94,
- /*  1300 */   421,  414,  167,  168,  169,  440,  349,  172,  199,  104,
- /*  1310 */   424,  354,  242,   95,  357,  387,   47,  386,  173,  362,
- /*  1320 */    42,  364,  379,  369,  189,  369,   20,  192,  320,  194,
- /*  1330 */   195,  196,  197,  198,   48,  328,  103,  175,  328,  177,
- /*  1340 */   369,  157,  385,  367,  367,  328,  389,   92,   20,  334,
- /*  1350 */   393,  394,  395,  396,  397,  398,  399,  349,  401,  328,
- /*  1360 */    20,  199,  200,  328,  377,  357,  328,  322,  322,  383,
- /*  1370 */   362,  332,  364,  364,  357,  240,  332,  377,   20,  376,
- /*  1380 */    20,  394,  378,  332,  332,  332,  332,  328,  376,  332,
- /*  1390 */   157,  322,  349,  385,  394,  328,  349,  389,  349,  349,
- /*  1400 */   188,  393,  394,  395,  396,  397,  398,  399,  322,  401,
- /*  1410 */   423,  394,  349,  349,  406,  330,  408,  384,  362,  383,
- /*  1420 */   412,  413,  349,  423,  349,  438,  439,  349,  180,  349,
- /*  1430 */   443,  444,  349,  416,  417,  418,  364,  420,  438,  439,
- /*  1440 */   382,  433,  330,  443,  444,  328,  320,  328,  330,  247,
- /*  1450 */   376,  362,  362,  372,  362,  362,  372,  362,  159,  330,
- /*  1460 */   227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
- /*  1470 */   237,  370,  345,  357,  330,  349,   20,  362,  248,  392,
- /*  1480 */   392,  254,  372,  357,  362,  362,  372,  362,  362,  429,
- /*  1490 */   364,  166,  362,  432,  429,  256,  255,  243,  387,  263,
- /*  1500 */   260,  258,  239,  357,   20,   94,  429,  431,  411,   94,
- /*  1510 */   428,  385,  391,  320,  353,  389,  362,  339,  427,  393,
- /*  1520 */   394,  395,  396,  397,  398,  399,  426,  401,  328,  330,
- /*  1530 */    36,  323,  406,  322,  408,  320,  442,  343,  412,  413,
- /*  1540 */   441,  375,  349,  380,  448,  331,  343,  343,  422,  318,
- /*  1550 */   357,    0,    0,  182,    0,  362,   42,  364,    0,    0,
- /*  1560 */    35,  193,   35,   35,  349,   35,  193,    0,   35,   35,
- /*  1570 */   193,    0,  357,  193,    0,   35,    0,  362,  385,  364,
- /*  1580 */     0,   35,  389,   22,  177,  175,  393,  394,  395,  396,
- /*  1590 */   397,  398,  399,  320,  401,    0,    0,  171,  170,  406,
- /*  1600 */   385,  408,    0,    0,  389,  412,  413,   42,  393,  394,
- /*  1610 */   395,  396,  397,  398,  399,  320,  401,    0,   46,   12,
- /*  1620 */    13,  406,  349,  408,    0,    0,    0,  412,  413,   22,
- /*  1630 */   357,    0,    0,   42,    0,  362,  148,  364,    0,    0,
- /*  1640 */    33,    0,   35,    0,  349,    0,   35,    0,  148,    0,
- /*  1650 */     0,    0,  357,    0,    0,    0,    0,  362,  385,  364,
- /*  1660 */     0,    0,  389,   56,    0,    0,  393,  394,  395,  396,
- /*  1670 */   397,  398,  399,    0,  401,   68,    0,    0,    0,  406,
- /*  1680 */   385,  408,   42,    0,  389,  412,  413,   35,  393,  394,
- /*  1690 */   395,  396,  397,  398,  399,    0,  401,    0,    0,    0,
- /*  1700 */     0,   22,    0,  408,    0,    0,    0,  412,  413,    0,
- /*  1710 */     0,   42,   46,   56,   56,   43,   46,   14,    0,   39,
- /*  1720 */    39,   14,  320,  116,   40,    0,    0,    0,   39,  166,
- /*  1730 */     0,    0,    0,   62,    0,    0,   35,   47,    0,   47,
- /*  1740 */     0,   47,    0,   47,    0,    0,   35,   39,    0,   35,
- /*  1750 */     0,  349,   39,    0,   39,   35,   39,   35,   22,  357,
- /*  1760 */     0,    0,  103,  101,  362,   49,  364,   43,   35,   22,
- /*  1770 */     0,   43,   35,   22,   35,    0,   35,   22,   35,   22,
- /*  1780 */     0,   35,  175,    0,  177,   22,   20,  385,   95,   35,
- /*  1790 */   320,  389,    0,   35,   35,  393,  394,  395,  396,  397,
- /*  1800 */   398,  399,    0,  401,  162,  178,  199,  200,   35,  320,
- /*  1810 */   408,   22,    0,   94,  412,  413,    0,    3,    0,  349,
- /*  1820 */   213,  214,  215,  216,  217,  218,  219,  357,   35,  162,
- /*  1830 */   162,    0,  362,  159,  364,    0,    0,    0,  349,  164,
- /*  1840 */    39,   46,  160,   94,  158,  223,  357,   95,   43,   43,
- /*  1850 */   187,  362,  244,  364,  225,  385,   94,   46,   94,  389,
- /*  1860 */   104,   46,   94,  393,  394,  395,  396,  397,  398,  399,
- /*  1870 */   400,  401,  402,  403,  385,   94,  320,   95,  389,   95,
- /*  1880 */    94,   94,  393,  394,  395,  396,  397,  398,  399,   95,
- /*  1890 */   401,   43,   95,  320,   94,   43,   43,  408,   94,    3,
- /*  1900 */    43,   94,  413,   95,   94,  349,   46,   35,  223,   35,
- /*  1910 */    35,   35,   95,  357,   95,   35,   35,   95,  362,   95,
- /*  1920 */   364,   43,  349,   46,    2,   46,   22,   94,  199,  238,
- /*  1930 */   357,   46,  244,   95,   94,  362,  320,  364,   95,   94,
- /*  1940 */    94,  385,   22,   46,   95,  389,   95,  105,   94,  393,
- /*  1950 */   394,  395,  396,  397,  398,  399,  320,  401,  385,  403,
- /*  1960 */    94,   35,  389,   95,   35,  349,  393,  394,  395,  396,
- /*  1970 */   397,  398,  399,  357,  401,  201,   94,   35,  362,   95,
- /*  1980 */   364,   94,   35,   95,   94,  349,   95,   35,   94,   35,
- /*  1990 */   354,  118,   94,  357,   95,   22,   94,   94,  362,  106,
- /*  2000 */   364,  385,   35,   94,  118,  389,   43,  320,  435,  393,
- /*  2010 */   394,  395,  396,  397,  398,  399,  244,  401,  118,  118,
- /*  2020 */    22,  385,   62,   61,   35,  389,   35,   35,   35,  393,
- /*  2030 */   394,  395,  396,  397,  398,  399,  349,  401,   35,   35,
- /*  2040 */    35,  354,   35,   35,  357,   35,   68,   91,   35,  362,
- /*  2050 */    35,  364,   43,  437,   22,   35,   22,   35,   35,   35,
- /*  2060 */    35,   35,   68,   35,   35,   35,   22,    0,   35,    0,
- /*  2070 */    35,    0,  385,   35,   47,   39,  389,   35,   47,   39,
- /*  2080 */   393,  394,  395,  396,  397,  398,  399,  320,  401,   39,
- /*  2090 */    47,    0,   35,   47,   39,    0,   35,   35,    0,   22,
- /*  2100 */    21,  449,   22,   22,   21,  320,   20,  449,  449,  449,
- /*  2110 */   449,  449,  449,  449,  449,  449,  349,  449,  449,  449,
- /*  2120 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2130 */   449,  364,  449,  449,  349,  449,  449,  449,  449,  449,
- /*  2140 */   449,  449,  357,  449,  449,  449,  449,  362,  320,  364,
- /*  2150 */   449,  449,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2160 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  449,
- /*  2170 */   385,  449,  449,  449,  389,  449,  449,  349,  393,  394,
- /*  2180 */   395,  396,  397,  398,  399,  357,  401,  449,  449,  449,
- /*  2190 */   362,  320,  364,  449,  449,  449,  349,  449,  449,  449,
- /*  2200 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2210 */   449,  364,  449,  385,  449,  449,  449,  389,  449,  449,
- /*  2220 */   349,  393,  394,  395,  396,  397,  398,  399,  357,  401,
- /*  2230 */   449,  449,  385,  362,  320,  364,  389,  449,  449,  449,
- /*  2240 */   393,  394,  395,  396,  397,  398,  399,  449,  401,  449,
- /*  2250 */   449,  320,  449,  449,  449,  449,  385,  449,  449,  449,
- /*  2260 */   389,  449,  449,  349,  393,  394,  395,  396,  397,  398,
- /*  2270 */   399,  357,  401,  449,  449,  449,  362,  320,  364,  449,
- /*  2280 */   349,  449,  449,  449,  449,  449,  449,  449,  357,  449,
- /*  2290 */   449,  449,  449,  362,  320,  364,  449,  449,  449,  385,
- /*  2300 */   449,  449,  449,  389,  449,  449,  349,  393,  394,  395,
- /*  2310 */   396,  397,  398,  399,  357,  401,  385,  449,  449,  362,
- /*  2320 */   389,  364,  449,  349,  393,  394,  395,  396,  397,  398,
- /*  2330 */   399,  357,  401,  449,  449,  449,  362,  449,  364,  449,
- /*  2340 */   449,  449,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2350 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  385,
- /*  2360 */   449,  449,  449,  389,  449,  449,  449,  393,  394,  395,
- /*  2370 */   396,  397,  398,  399,  320,  401,  449,  449,  449,  449,
- /*  2380 */   449,  449,  449,  449,  449,  449,  349,  449,  449,  449,
- /*  2390 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2400 */   449,  364,  449,  349,  449,  449,  449,  449,  449,  449,
- /*  2410 */   449,  357,  449,  449,  449,  449,  362,  449,  364,  449,
- /*  2420 */   449,  449,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2430 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  385,
- /*  2440 */   449,  449,  449,  389,  449,  449,  449,  393,  394,  395,
- /*  2450 */   396,  397,  398,  399,  449,  401,  449,  449,  449,  449,
- /*  2460 */   449,  449,  449,  320,  449,  449,  349,  449,  449,  449,
- /*  2470 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2480 */   449,  364,  449,  449,  449,  449,  449,  449,  449,  449,
- /*  2490 */   449,  449,  349,  449,  449,  449,  449,  449,  449,  449,
- /*  2500 */   357,  449,  385,  449,  449,  362,  389,  364,  449,  449,
- /*  2510 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  449,
- /*  2520 */   449,  449,  449,  449,  449,  449,  449,  449,  385,  449,
- /*  2530 */   449,  449,  389,  449,  320,  449,  393,  394,  395,  396,
- /*  2540 */   397,  398,  399,  449,  401,  449,  349,  449,  449,  449,
- /*  2550 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2560 */   449,  364,  449,  349,  449,  449,  449,  449,  449,  449,
- /*  2570 */   449,  357,  449,  449,  449,  449,  362,  320,  364,  449,
- /*  2580 */   449,  449,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2590 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  385,
- /*  2600 */   449,  449,  449,  389,  449,  449,  349,  393,  394,  395,
- /*  2610 */   396,  397,  398,  399,  357,  401,  449,  449,  449,  362,
- /*  2620 */   449,  364,  449,  449,  449,  449,  349,  449,  449,  449,
- /*  2630 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2640 */   320,  364,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2650 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  449,
- /*  2660 */   449,  449,  385,  449,  449,  449,  389,  449,  449,  349,
- /*  2670 */   393,  394,  395,  396,  397,  398,  399,  357,  401,  449,
- /*  2680 */   449,  449,  362,  449,  364,  449,  349,  449,  449,  449,
- /*  2690 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2700 */   449,  364,  449,  449,  449,  385,  449,  449,  449,  389,
- /*  2710 */   449,  449,  449,  393,  394,  395,  396,  397,  398,  399,
- /*  2720 */   320,  401,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2730 */   393,  394,  395,  396,  397,  398,  399,  320,  401,  449,
- /*  2740 */   449,  449,  449,  449,  449,  449,  449,  449,  449,  349,
- /*  2750 */   449,  449,  449,  449,  449,  449,  449,  357,  449,  449,
- /*  2760 */   449,  449,  362,  449,  364,  449,  349,  449,  449,  449,
- /*  2770 */   449,  449,  449,  449,  357,  449,  449,  449,  449,  362,
- /*  2780 */   449,  364,  449,  449,  449,  385,  449,  449,  449,  389,
- /*  2790 */   449,  449,  449,  393,  394,  395,  396,  397,  398,  399,
- /*  2800 */   449,  401,  385,  449,  449,  449,  389,  449,  449,  449,
- /*  2810 */   393,  394,  395,  396,  397,  398,  399,  449,  401,
+ /*   280 */   223,   12,   13,   68,   93,  342,  341,   96,  345,   20,
+ /*   290 */   351,   22,    8,    9,  349,  362,   12,   13,   14,   15,
+ /*   300 */    16,  362,   33,  358,   35,  320,   21,  377,  348,   24,
+ /*   310 */    25,   26,   27,   28,   29,   30,   31,   32,  341,  241,
+ /*   320 */   332,  361,  364,  241,  394,   56,  349,  388,  389,  371,
+ /*   330 */    61,  116,  374,  320,   60,  358,  241,   68,   12,   13,
+ /*   340 */   401,   20,    4,  355,  349,   95,   20,  362,   22,  158,
+ /*   350 */   159,  356,  161,  423,  160,  328,  165,    0,   94,   33,
+ /*   360 */   365,   35,  349,   94,  328,   14,  328,  340,  438,  439,
+ /*   370 */   357,   20,  181,  443,  444,  362,  340,  364,  340,   95,
+ /*   380 */    14,   94,   56,  347,  357,  116,   20,   61,   21,  394,
+ /*   390 */   175,  330,  177,  357,   68,  357,  239,  240,  385,  130,
+ /*   400 */   131,   34,  389,   36,   35,  344,  393,  394,  395,  396,
+ /*   410 */   397,  398,  399,  352,  401,  200,  201,   60,  423,  406,
+ /*   420 */    94,  408,   20,    8,    9,  412,  413,   12,   13,   14,
+ /*   430 */    15,   16,   94,  438,  439,  422,    0,   68,  443,  444,
+ /*   440 */   246,  247,  116,  391,  175,  200,  177,    8,    9,  335,
+ /*   450 */   336,   12,   13,   14,   15,   16,  130,  131,   43,   20,
+ /*   460 */    24,   25,   26,   27,   28,   29,   30,   31,   32,  200,
+ /*   470 */   201,  419,  203,  204,  205,  206,  207,  208,  209,  210,
+ /*   480 */   211,  212,  213,  214,  215,  216,  217,  218,  219,  220,
+ /*   490 */   221,  222,  223,  125,  225,  250,  251,  252,  253,  254,
+ /*   500 */    20,  175,  330,  177,    0,  241,  107,  108,  109,  110,
+ /*   510 */   111,  112,  113,  114,  115,  116,  117,   56,  119,  120,
+ /*   520 */   121,  122,  123,  124,  352,  204,  200,  201,  241,  203,
+ /*   530 */   204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+ /*   540 */   214,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+ /*   550 */    12,   13,  184,  185,   93,  204,  325,   96,   20,  328,
+ /*   560 */    22,  320,  328,   20,  162,   22,  328,   63,   64,   65,
+ /*   570 */   204,   33,   39,   35,  340,   71,   72,  170,  340,  241,
+ /*   580 */    63,   64,   65,  320,  328,  347,   82,   83,   71,   72,
+ /*   590 */     0,  357,   88,   50,   56,  357,  340,  190,  191,   82,
+ /*   600 */    83,  162,  320,  362,   20,   88,   68,   12,   13,   14,
+ /*   610 */     4,  328,  349,  357,  106,   20,  225,   22,  227,  405,
+ /*   620 */   357,  407,   20,  340,  320,  362,  328,  364,   33,    3,
+ /*   630 */    35,  349,   94,  125,  126,  127,  128,  129,  340,  357,
+ /*   640 */   357,  157,  335,  336,  362,  405,  364,  407,  385,  320,
+ /*   650 */    60,   56,  389,  328,  116,  357,  393,  394,  395,  396,
+ /*   660 */   397,  398,  399,   68,  401,  340,  362,  385,  130,  131,
+ /*   670 */   377,  389,   20,  357,  394,  393,  394,  395,  396,  397,
+ /*   680 */   398,  399,  357,  401,  368,  394,  423,  394,  406,   94,
+ /*   690 */   408,  362,    8,    9,  412,  413,   12,   13,   14,   15,
+ /*   700 */    16,  438,  439,  423,  422,  391,  443,  444,  364,  357,
+ /*   710 */    20,  116,  228,  175,  423,  177,  423,  317,  374,  439,
+ /*   720 */   368,   95,  238,  443,  444,  130,  131,   44,   45,  320,
+ /*   730 */   439,  438,  439,  419,  443,  444,  443,  444,  200,  201,
+ /*   740 */   225,  203,  204,  205,  206,  207,  208,  209,  210,  211,
+ /*   750 */   212,  213,  214,  215,  216,  217,  218,  219,  220,  221,
+ /*   760 */   222,  223,  328,  328,  162,  373,  404,  375,  328,  407,
+ /*   770 */   175,  362,  177,  240,  340,  340,  373,  377,  375,  241,
+ /*   780 */   340,    8,    9,  320,  320,   12,   13,   14,   15,   16,
+ /*   790 */   320,  357,  357,  320,  394,  200,  201,  357,  203,  204,
+ /*   800 */   205,  206,  207,  208,  209,  210,  211,  212,  213,  214,
+ /*   810 */   215,  216,  217,  218,  219,  220,  221,  222,  223,   12,
+ /*   820 */    13,  328,    4,  423,   68,  362,  362,   20,  359,   22,
+ /*   830 */   320,  362,  362,  340,  105,  362,  349,   19,  438,  439,
+ /*   840 */    33,  320,   35,  443,  444,  358,  162,    2,  242,  320,
+ /*   850 */   357,   33,  320,    8,    9,    3,  320,   12,   13,   14,
+ /*   860 */    15,   16,  320,   56,  320,   47,  106,  342,   95,   51,
+ /*   870 */   345,  320,  362,  328,   56,   68,   12,   13,  328,  349,
+ /*   880 */    22,  349,  153,  362,   20,  340,   22,  328,  128,  357,
+ /*   890 */   340,  362,  320,   35,  362,  365,  364,   33,  362,   35,
+ /*   900 */   349,   94,  357,  337,  362,  339,  362,  357,  357,   37,
+ /*   910 */   328,   93,  320,  362,   96,  364,  357,  385,  320,    0,
+ /*   920 */    56,  389,  340,  116,  377,  393,  394,  395,  396,  397,
+ /*   930 */   398,  399,   68,  401,  362,   68,  385,  130,  131,  357,
+ /*   940 */   389,  394,   42,   43,  393,  394,  395,  396,  397,  398,
+ /*   950 */   399,   43,  401,  394,  362,    0,   43,  406,   94,  408,
+ /*   960 */   362,    0,  359,  412,  413,  362,  434,  435,  328,   97,
+ /*   970 */   423,   99,  100,  422,  102,  416,  417,  418,  106,  420,
+ /*   980 */   116,   43,  175,   22,  177,  438,  439,  377,    0,   98,
+ /*   990 */   443,  444,  101,   98,  130,  131,  101,  357,    0,   43,
+ /*  1000 */   128,  350,   47,   95,  394,  350,   56,  200,  201,    0,
+ /*  1010 */   203,  204,  205,  206,  207,  208,  209,  210,  211,  212,
+ /*  1020 */   213,  214,  215,  216,  217,  218,  219,  220,  221,  222,
+ /*  1030 */   223,   22,  328,  423,  394,   98,   35,   98,  101,  175,
+ /*  1040 */   101,  177,  162,  163,  340,  377,   96,   43,  438,  439,
+ /*  1050 */    43,   95,   35,  443,  444,    0,  416,  417,  418,  350,
+ /*  1060 */   420,  357,  394,   43,  200,  201,    0,  203,  204,  205,
+ /*  1070 */   206,  207,  208,  209,  210,  211,  212,  213,  214,  215,
+ /*  1080 */   216,  217,  218,  219,  220,  221,  222,  223,   18,  328,
+ /*  1090 */    20,  423,    0,  130,  131,    1,    2,   27,   61,   95,
+ /*  1100 */    30,  340,   95,   48,  106,  350,  438,  439,  350,  350,
+ /*  1110 */   258,  443,  444,  194,   22,   95,  350,   47,  357,   49,
+ /*  1120 */    43,   51,   43,  125,  126,  127,  128,  129,  381,   63,
+ /*  1130 */    64,   65,   66,   67,  321,   69,   70,   71,   72,   73,
+ /*  1140 */    74,   75,   76,   77,   78,   79,   80,   81,   82,   83,
+ /*  1150 */    84,   85,   86,   87,   88,   89,   90,   18,  328,   94,
+ /*  1160 */     8,    9,   23,   93,   12,   13,   14,   15,   16,  104,
+ /*  1170 */   340,  328,   95,  260,   95,  105,   37,   38,  177,   43,
+ /*  1180 */    41,  392,  194,  340,   43,    8,    9,  357,   43,   12,
+ /*  1190 */    13,   14,   15,   16,  177,   46,   57,   58,   59,  261,
+ /*  1200 */   357,   43,   43,  133,  338,  320,  136,  137,  138,  139,
+ /*  1210 */   140,  141,  142,  143,  144,  145,  146,  147,  148,  149,
+ /*  1220 */   150,  151,  152,    0,  154,  155,  156,  447,  436,   35,
+ /*  1230 */   329,   95,  430,   94,  349,   43,   95,  200,   43,   13,
+ /*  1240 */    95,  349,  357,   94,   43,   13,  329,  362,  379,  364,
+ /*  1250 */    43,    8,    9,   95,   95,   12,   13,   14,   15,   16,
+ /*  1260 */   327,   35,   68,  361,  440,  392,  424,   35,  421,  414,
+ /*  1270 */   385,  132,  243,  387,  389,   47,  386,   42,  393,  394,
+ /*  1280 */   395,  396,  397,  398,  399,  369,  401,   95,   20,  404,
+ /*  1290 */    95,  406,  407,  408,  369,  328,   95,  412,  413,   12,
+ /*  1300 */    13,  328,   95,  369,   61,  157,  167,  168,  169,   22,
+ /*  1310 */   367,  172,  367,   92,  334,  328,  320,  328,  328,  167,
+ /*  1320 */    33,   20,   35,   20,  322,  322,  332,  383,  189,  106,
+ /*  1330 */   364,  192,  332,   20,  195,  196,  197,  198,  199,   20,
+ /*  1340 */   376,  376,  320,   56,  332,  349,  103,  378,  125,  126,
+ /*  1350 */   127,  128,  129,  357,  328,   68,  332,  332,  362,  332,
+ /*  1360 */   364,  322,  332,  349,  349,  349,  322,  349,  349,  328,
+ /*  1370 */   349,  349,  349,  362,  188,  384,  383,  349,  330,  357,
+ /*  1380 */   241,  385,  349,  349,  362,  389,  364,  349,  180,  393,
+ /*  1390 */   394,  395,  396,  397,  398,  399,  364,  401,  330,  328,
+ /*  1400 */   157,  328,  406,  116,  408,  330,  159,  385,  412,  413,
+ /*  1410 */   248,  389,  376,  382,  262,  393,  394,  395,  396,  397,
+ /*  1420 */   398,  399,  372,  401,  362,  362,  362,  370,  406,  433,
+ /*  1430 */   408,  362,  372,  330,  412,  413,  362,  330,  345,  357,
+ /*  1440 */    20,  392,  362,  392,  372,  249,  362,  362,  372,  362,
+ /*  1450 */   362,  166,  255,  320,  244,  257,  256,  194,  448,  240,
+ /*  1460 */    20,  259,  175,  357,  177,  387,  263,  432,   94,  429,
+ /*  1470 */   428,  228,  229,  230,  231,  232,  233,  234,  235,  236,
+ /*  1480 */   237,  238,  349,  429,  431,  429,  427,  200,  201,  442,
+ /*  1490 */   357,  391,  411,  426,   94,  362,  320,  364,  330,  441,
+ /*  1500 */   353,  214,  215,  216,  217,  218,  219,  220,  362,  339,
+ /*  1510 */   328,   36,  323,  322,  380,  375,  343,  343,  385,  331,
+ /*  1520 */     0,  343,  389,  318,    0,  349,  393,  394,  395,  396,
+ /*  1530 */   397,  398,  399,  357,  401,  182,    0,    0,  362,  406,
+ /*  1540 */   364,  408,   42,    0,   35,  412,  413,  193,   35,   35,
+ /*  1550 */    35,  193,    0,   35,  320,  193,   35,    0,   35,  193,
+ /*  1560 */     0,  385,   35,    0,   22,  389,   19,    0,   35,  393,
+ /*  1570 */   394,  395,  396,  397,  398,  399,  320,  401,    0,   35,
+ /*  1580 */    33,  193,  406,  349,  408,  177,  175,    0,  412,  413,
+ /*  1590 */     0,  357,  171,  170,   47,    0,  362,    0,  364,   52,
+ /*  1600 */    53,   54,   55,   56,   46,  349,   42,    0,    0,    0,
+ /*  1610 */    42,    0,    0,  357,    0,    0,    0,    0,  362,  385,
+ /*  1620 */   364,    0,    0,  389,    0,  148,   35,  393,  394,  395,
+ /*  1630 */   396,  397,  398,  399,    0,  401,  148,  320,    0,    0,
+ /*  1640 */    93,  385,  408,   96,    0,  389,  412,  413,    0,  393,
+ /*  1650 */   394,  395,  396,  397,  398,  399,  320,  401,    0,    0,
+ /*  1660 */     0,    0,    0,    0,  408,    0,  349,    0,  412,  413,
+ /*  1670 */     0,    0,   42,    0,  357,    0,  129,    0,    0,  362,
+ /*  1680 */     0,  364,    0,    0,    0,  349,   22,    0,   35,    0,
+ /*  1690 */     0,   56,   56,  357,    0,    0,   42,   46,  362,   43,
+ /*  1700 */   364,   46,  385,    0,    0,   39,  389,   14,  161,   40,
+ /*  1710 */   393,  394,  395,  396,  397,  398,  399,  400,  401,  402,
+ /*  1720 */   403,  385,   14,  320,   39,  389,  179,    0,  181,  393,
+ /*  1730 */   394,  395,  396,  397,  398,  399,    0,  401,   39,  166,
+ /*  1740 */     0,    0,    0,   62,    0,    0,  328,   47,   35,  320,
+ /*  1750 */    39,    0,  349,   35,   47,   39,    0,   35,   39,    0,
+ /*  1760 */   357,   47,   47,   35,   39,  362,   35,  364,    0,    0,
+ /*  1770 */     0,    0,   22,  101,    0,  357,   43,  103,  349,   22,
+ /*  1780 */    43,  445,  446,  354,   35,    0,  357,   35,  385,   35,
+ /*  1790 */    35,  362,  389,  364,    0,   35,  393,  394,  395,  396,
+ /*  1800 */   397,  398,  399,  320,  401,    0,   22,   35,   22,   22,
+ /*  1810 */    49,  408,  394,   35,  385,    0,  413,   35,  389,    0,
+ /*  1820 */     0,   22,  393,  394,  395,  396,  397,  398,  399,   20,
+ /*  1830 */   401,   35,  349,   95,  416,  417,  418,   94,  420,    0,
+ /*  1840 */   357,  423,   35,    0,   22,  362,  320,  364,    0,    0,
+ /*  1850 */   162,  159,   94,  162,  178,    3,  438,  439,  162,    0,
+ /*  1860 */     0,  443,  444,    0,   35,  164,  320,    0,  385,  160,
+ /*  1870 */    95,   94,  389,   94,    0,  349,  393,  394,  395,  396,
+ /*  1880 */   397,  398,  399,  357,  401,  187,  403,  158,  362,   39,
+ /*  1890 */   364,   94,  104,   46,   43,  349,   43,  245,   94,   43,
+ /*  1900 */    43,   95,   94,  357,   94,  226,   95,   95,  362,   95,
+ /*  1910 */   364,  385,   94,   43,   46,  389,   95,   94,   94,  393,
+ /*  1920 */   394,  395,  396,  397,  398,  399,  320,  401,   46,  224,
+ /*  1930 */   224,  385,   94,    3,   43,  389,   95,   95,   35,  393,
+ /*  1940 */   394,  395,  396,  397,  398,  399,   35,  401,  320,   35,
+ /*  1950 */    35,   35,   35,   95,   46,  349,   95,    2,   46,   46,
+ /*  1960 */   239,  435,  245,  357,   43,  245,   22,  200,  362,   94,
+ /*  1970 */   364,   95,   94,   46,   95,   94,   22,  349,   95,   94,
+ /*  1980 */    94,   46,  354,  437,   94,  357,   35,   95,   95,  105,
+ /*  1990 */   362,  385,  364,  202,   35,  389,   94,   35,   94,  393,
+ /*  2000 */   394,  395,  396,  397,  398,  399,  320,  401,   35,   35,
+ /*  2010 */    35,   22,   94,  385,   95,   95,   94,  389,   95,   95,
+ /*  2020 */    94,  393,  394,  395,  396,  397,  398,  399,  118,  401,
+ /*  2030 */    94,  106,  320,   94,   35,  349,   94,   43,   22,   62,
+ /*  2040 */   354,   61,   35,  357,   35,   35,  118,  118,  362,  118,
+ /*  2050 */   364,   68,  446,   35,   35,   35,   35,   35,   35,   35,
+ /*  2060 */    43,  349,   91,   35,   35,   22,   35,   22,   35,  357,
+ /*  2070 */    35,  385,   35,   68,  362,  389,  364,   35,    0,  393,
+ /*  2080 */   394,  395,  396,  397,  398,  399,  320,  401,   35,   35,
+ /*  2090 */    35,   35,   22,   35,   35,   47,   39,  385,    0,   35,
+ /*  2100 */    39,  389,    0,  320,   35,  393,  394,  395,  396,  397,
+ /*  2110 */   398,  399,   47,  401,   47,  349,   39,    0,   35,   47,
+ /*  2120 */    39,    0,   35,  357,   35,    0,   22,   21,  362,   22,
+ /*  2130 */   364,   22,  349,   21,   20,  449,  449,  449,  449,  449,
+ /*  2140 */   357,  449,  449,  449,  449,  362,  320,  364,  449,  449,
+ /*  2150 */   449,  385,  449,  449,  449,  389,  449,  449,  449,  393,
+ /*  2160 */   394,  395,  396,  397,  398,  399,  320,  401,  385,  449,
+ /*  2170 */   449,  449,  389,  449,  449,  349,  393,  394,  395,  396,
+ /*  2180 */   397,  398,  399,  357,  401,  449,  449,  449,  362,  449,
+ /*  2190 */   364,  449,  449,  449,  449,  349,  449,  449,  449,  449,
+ /*  2200 */   449,  449,  449,  357,  449,  449,  449,  449,  362,  320,
+ /*  2210 */   364,  385,  449,  449,  449,  389,  449,  449,  449,  393,
+ /*  2220 */   394,  395,  396,  397,  398,  399,  449,  401,  449,  320,
+ /*  2230 */   449,  385,  449,  449,  449,  389,  449,  449,  349,  393,
+ /*  2240 */   394,  395,  396,  397,  398,  399,  357,  401,  449,  449,
+ /*  2250 */   449,  362,  449,  364,  449,  449,  449,  449,  349,  449,
+ /*  2260 */   449,  449,  449,  449,  449,  449,  357,  449,  449,  449,
+ /*  2270 */   449,  362,  449,  364,  385,  449,  449,  449,  389,  449,
+ /*  2280 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  320,
+ /*  2290 */   401,  449,  449,  449,  385,  449,  449,  449,  389,  449,
+ /*  2300 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  449,
+ /*  2310 */   401,  320,  449,  449,  449,  449,  449,  449,  349,  449,
+ /*  2320 */   449,  449,  449,  449,  449,  449,  357,  449,  449,  449,
+ /*  2330 */   449,  362,  449,  364,  449,  449,  449,  449,  449,  449,
+ /*  2340 */   349,  449,  449,  449,  449,  449,  449,  449,  357,  449,
+ /*  2350 */   449,  449,  449,  362,  385,  364,  449,  449,  389,  449,
+ /*  2360 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  320,
+ /*  2370 */   401,  449,  449,  449,  449,  449,  385,  449,  449,  449,
+ /*  2380 */   389,  449,  449,  449,  393,  394,  395,  396,  397,  398,
+ /*  2390 */   399,  449,  401,  449,  449,  320,  449,  449,  349,  449,
+ /*  2400 */   449,  449,  449,  449,  449,  449,  357,  449,  449,  449,
+ /*  2410 */   449,  362,  449,  364,  449,  449,  449,  449,  449,  449,
+ /*  2420 */   449,  449,  449,  449,  349,  449,  449,  449,  449,  449,
+ /*  2430 */   449,  449,  357,  449,  385,  449,  449,  362,  389,  364,
+ /*  2440 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  320,
+ /*  2450 */   401,  449,  449,  449,  449,  449,  449,  449,  449,  449,
+ /*  2460 */   385,  449,  449,  449,  389,  449,  320,  449,  393,  394,
+ /*  2470 */   395,  396,  397,  398,  399,  449,  401,  449,  349,  449,
+ /*  2480 */   449,  449,  449,  449,  449,  449,  357,  449,  449,  449,
+ /*  2490 */   449,  362,  449,  364,  449,  349,  449,  449,  449,  449,
+ /*  2500 */   449,  449,  449,  357,  449,  449,  449,  449,  362,  320,
+ /*  2510 */   364,  449,  449,  449,  385,  449,  449,  449,  389,  449,
+ /*  2520 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  320,
+ /*  2530 */   401,  385,  449,  449,  449,  389,  449,  449,  349,  393,
+ /*  2540 */   394,  395,  396,  397,  398,  399,  357,  401,  449,  449,
+ /*  2550 */   449,  362,  449,  364,  449,  449,  449,  449,  349,  449,
+ /*  2560 */   449,  449,  449,  449,  449,  449,  357,  449,  449,  449,
+ /*  2570 */   449,  362,  320,  364,  385,  449,  449,  449,  389,  449,
+ /*  2580 */   449,  449,  393,  394,  395,  396,  397,  398,  399,  449,
+ /*  2590 */   401,  449,  320,  449,  385,  449,  449,  449,  389,  449,
+ /*  2600 */   449,  349,  393,  394,  395,  396,  397,  398,  399,  357,
+ /*  2610 */   401,  449,  449,  449,  362,  449,  364,  449,  449,  449,
+ /*  2620 */   449,  349,  449,  449,  449,  449,  449,  449,  449,  357,
+ /*  2630 */   449,  449,  449,  449,  362,  449,  364,  385,  449,  449,
+ /*  2640 */   449,  389,  449,  449,  449,  393,  394,  395,  396,  397,
+ /*  2650 */   398,  399,  320,  401,  449,  449,  449,  385,  449,  449,
+ /*  2660 */   449,  389,  449,  449,  449,  393,  394,  395,  396,  397,
+ /*  2670 */   398,  399,  449,  401,  320,  449,  449,  449,  449,  449,
+ /*  2680 */   449,  349,  449,  449,  449,  449,  449,  449,  449,  357,
+ /*  2690 */   449,  449,  449,  449,  362,  449,  364,  449,  449,  449,
+ /*  2700 */   449,  449,  449,  349,  449,  449,  449,  449,  449,  449,
+ /*  2710 */   449,  357,  449,  449,  449,  449,  362,  385,  364,  449,
+ /*  2720 */   449,  389,  449,  449,  449,  393,  394,  395,  396,  397,
+ /*  2730 */   398,  399,  320,  401,  449,  449,  449,  449,  449,  385,
+ /*  2740 */   449,  449,  449,  389,  449,  449,  449,  393,  394,  395,
+ /*  2750 */   396,  397,  398,  399,  449,  401,  449,  449,  320,  449,
+ /*  2760 */   449,  349,  449,  449,  449,  449,  449,  449,  449,  357,
+ /*  2770 */   449,  449,  449,  449,  362,  449,  364,  449,  449,  449,
+ /*  2780 */   449,  449,  449,  449,  449,  449,  449,  349,  449,  449,
+ /*  2790 */   449,  449,  449,  449,  449,  357,  449,  385,  449,  449,
+ /*  2800 */   362,  389,  364,  449,  449,  393,  394,  395,  396,  397,
+ /*  2810 */   398,  399,  449,  401,  449,  449,  449,  449,  449,  449,
+ /*  2820 */   449,  449,  449,  385,  449,  449,  449,  389,  449,  449,
+ /*  2830 */   449,  393,  394,  395,  396,  397,  398,  399,  449,  401,
 };
-#define YY_SHIFT_COUNT    (693)
+#define YY_SHIFT_COUNT    (699)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (2098)
+#define YY_SHIFT_MAX      (2125)
 static const unsigned short int yy_shift_ofst[] = {
- /*     0 */  1135,    0,   57,  268,   57,  325,  325,  325,  536,  325,
- /*    10 */   325,  325,  325,  325,  593,  804,  804,  861,  804,  804,
- /*    20 */   804,  804,  804,  804,  804,  804,  804,  804,  804,  804,
- /*    30 */   804,  804,  804,  804,  804,  804,  804,  804,  804,  804,
- /*    40 */   804,  804,  804,  804,  804,  804,    8,   12,  104,   73,
- /*    50 */   369,  164,  286,  164,  104,  104, 1607, 1607,  164, 1607,
- /*    60 */  1607,    4,  164,   55,   55,    1,    1,  176,   55,   55,
- /*    70 */    55,   55,   55,   55,   55,   55,   55,   55,   54,   55,
- /*    80 */    55,   55,  428,   55,   55,  555,   55,   55,  555,  683,
- /*    90 */    55,  555,  555,  555,   55,  457, 1066, 1233, 1233,  402,
- /*   100 */   490, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
- /*   110 */  1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
- /*   120 */   468,  611,  176,  350,  350,  622,  370,  648,  267,  267,
- /*   130 */   600,  600,  600,  370,  752,  752,  752,  182,  428,  632,
- /*   140 */   632,  412,  555,  555,  767,  767,  182,  899,  399,  399,
- /*   150 */   399,  399,  399,  399,  399,  263,  382,  769,  717,  445,
- /*   160 */    42,  134,  205,  154,  217,  319, 1014,  825,  827,  852,
- /*   170 */   455,  126,  852, 1055,  161,  395, 1070, 1269, 1145, 1278,
- /*   180 */  1278, 1306, 1306, 1278, 1184, 1184, 1255, 1306, 1306, 1306,
- /*   190 */  1328, 1328, 1340,   54,  428,   54, 1358, 1360,   54, 1358,
- /*   200 */    54,   54,   54, 1306,   54, 1328,  555,  555,  555,  555,
- /*   210 */   555,  555,  555,  555,  555,  555,  555, 1306, 1328,  767,
- /*   220 */  1212, 1340,  457, 1248,  428,  457, 1306, 1306, 1358,  457,
- /*   230 */  1202,  767,  767,  767,  767, 1202,  767, 1299,  457,  182,
- /*   240 */   457,  752, 1456, 1456,  767, 1230, 1202,  767,  767, 1230,
- /*   250 */  1202,  767,  767,  555, 1227, 1325, 1230, 1239, 1241, 1254,
- /*   260 */  1070, 1236, 1240, 1243, 1263,  752, 1484, 1411, 1415,  767,
- /*   270 */   899, 1306,  457, 1494, 1328, 2819, 2819, 2819, 2819, 2819,
- /*   280 */  2819, 2819, 1062,  996,  559,   70,  751, 1242,  766,   50,
- /*   290 */   775, 1019,  226,  850,  850,  850,  850,  850,  850,  850,
- /*   300 */   850,  850,  982,  262,   11,   11,   53,  160,   63,  227,
- /*   310 */   361,  561,  513,  483,  639,  534,  483,  483,  483,  301,
- /*   320 */   663,  808,  834, 1001, 1018, 1020, 1022,  983, 1156, 1160,
- /*   330 */  1068,  941,  999, 1071, 1079, 1124, 1132, 1136, 1140, 1032,
- /*   340 */   930,  919, 1167, 1143,  878, 1011, 1109, 1148, 1195, 1139,
- /*   350 */  1157, 1158, 1180, 1185, 1201, 1218, 1205, 1152, 1249, 1224,
- /*   360 */  1286, 1551, 1552, 1371, 1554, 1558, 1514, 1559, 1525, 1368,
- /*   370 */  1527, 1528, 1530, 1373, 1567, 1533, 1534, 1377, 1571, 1380,
- /*   380 */  1574, 1540, 1576, 1561, 1580, 1546, 1407, 1410, 1595, 1596,
- /*   390 */  1426, 1428, 1602, 1603, 1572, 1617, 1624, 1625, 1565, 1626,
- /*   400 */  1631, 1632, 1591, 1634, 1638, 1639, 1641, 1643, 1645, 1488,
- /*   410 */  1611, 1647, 1500, 1649, 1650, 1651, 1653, 1654, 1655, 1656,
- /*   420 */  1660, 1661, 1664, 1665, 1673, 1676, 1677, 1640, 1678, 1683,
- /*   430 */  1695, 1697, 1698, 1679, 1699, 1700, 1702, 1704, 1652, 1705,
- /*   440 */  1657, 1706, 1658, 1709, 1710, 1669, 1680, 1672, 1703, 1666,
- /*   450 */  1707, 1670, 1718, 1684, 1681, 1725, 1726, 1727, 1689, 1563,
- /*   460 */  1730, 1731, 1732, 1671, 1734, 1735, 1701, 1690, 1708, 1738,
- /*   470 */  1711, 1692, 1713, 1740, 1714, 1694, 1715, 1742, 1720, 1696,
- /*   480 */  1717, 1744, 1745, 1748, 1750, 1659, 1662, 1722, 1736, 1753,
- /*   490 */  1733, 1737, 1739, 1724, 1728, 1741, 1743, 1747, 1746, 1760,
- /*   500 */  1751, 1761, 1755, 1716, 1770, 1757, 1754, 1775, 1758, 1780,
- /*   510 */  1759, 1783, 1763, 1766, 1693, 1719, 1792, 1642, 1773, 1802,
- /*   520 */  1627, 1789, 1667, 1674, 1812, 1816, 1668, 1675, 1814, 1818,
- /*   530 */  1831, 1835, 1749, 1752, 1793, 1663, 1836, 1762, 1682, 1764,
- /*   540 */  1837, 1801, 1686, 1768, 1756, 1795, 1805, 1622, 1629, 1685,
- /*   550 */  1806, 1608, 1781, 1782, 1786, 1784, 1794, 1787, 1848, 1797,
- /*   560 */  1800, 1804, 1807, 1808, 1852, 1811, 1815, 1810, 1853, 1688,
- /*   570 */  1817, 1819, 1896, 1857, 1772, 1872, 1874, 1875, 1876, 1880,
- /*   580 */  1881, 1822, 1824, 1860, 1691, 1878, 1877, 1879, 1922, 1904,
- /*   590 */  1729, 1833, 1838, 1840, 1843, 1845, 1849, 1885, 1846, 1854,
- /*   600 */  1897, 1851, 1920, 1774, 1866, 1842, 1868, 1926, 1929, 1882,
- /*   610 */  1884, 1942, 1887, 1888, 1947, 1890, 1891, 1952, 1894, 1899,
- /*   620 */  1954, 1898, 1873, 1886, 1900, 1901, 1973, 1893, 1902, 1903,
- /*   630 */  1967, 1909, 1963, 1963, 1998, 1960, 1962, 1989, 1991, 1992,
- /*   640 */  1993, 2003, 2004, 2005, 2007, 2008, 2010, 1978, 1956, 2009,
- /*   650 */  2013, 2015, 2032, 2020, 2034, 2022, 2023, 2024, 1994, 1724,
- /*   660 */  2025, 1728, 2026, 2028, 2029, 2030, 2044, 2033, 2067, 2035,
- /*   670 */  2027, 2036, 2069, 2038, 2031, 2040, 2071, 2042, 2043, 2050,
- /*   680 */  2091, 2057, 2046, 2055, 2095, 2061, 2062, 2098, 2077, 2079,
- /*   690 */  2080, 2081, 2083, 2086,
+ /*     0 */  1139,    0,   57,  269,   57,  326,  326,  326,  538,  326,
+ /*    10 */   326,  326,  326,  326,  595,  807,  807,  864,  807,  807,
+ /*    20 */   807,  807,  807,  807,  807,  807,  807,  807,  807,  807,
+ /*    30 */   807,  807,  807,  807,  807,  807,  807,  807,  807,  807,
+ /*    40 */   807,  807,  807,  807,  807,  807,   78,   95,    9,    8,
+ /*    50 */    82,  264,  287,  264,    9,    9, 1287, 1287,  264, 1287,
+ /*    60 */  1287,  338,  264,   14,   14,    1,    1,   23,   14,   14,
+ /*    70 */    14,   14,   14,   14,   14,   14,   14,   14,   48,   14,
+ /*    80 */    14,   14,  480,   14,   14,  584,   14,   14,  584,  652,
+ /*    90 */    14,  584,  584,  584,   14,  274, 1070, 1243, 1243,  285,
+ /*   100 */   517,  215,  215,  215,  215,  215,  215,  215,  215,  215,
+ /*   110 */   215,  215,  215,  215,  215,  215,  215,  215,  215,  215,
+ /*   120 */   872,   86,   23,   77,   77,  357,  369,  590,  391,  391,
+ /*   130 */   402,  402,  402,  369,  690,  690,  690,  149,  480,    4,
+ /*   140 */     4,  515,  584,  584,  756,  756,  149,  867,  399,  399,
+ /*   150 */   399,  399,  399,  399,  399, 1547,  137,  504,  439, 1152,
+ /*   160 */   245,  205,  194,  351,  366,  543,   10,  683,  760,  602,
+ /*   170 */   157,  533,  852,  157,  900,  606,  321, 1029, 1228, 1235,
+ /*   180 */  1235, 1268, 1268, 1235, 1148, 1148, 1221, 1268, 1268, 1268,
+ /*   190 */  1301, 1301, 1303,   48,  480,   48, 1313, 1319,   48, 1313,
+ /*   200 */    48,   48,   48, 1268,   48, 1301,  584,  584,  584,  584,
+ /*   210 */   584,  584,  584,  584,  584,  584,  584, 1268, 1301,  756,
+ /*   220 */  1186, 1303,  274, 1208,  480,  274, 1268, 1268, 1313,  274,
+ /*   230 */  1162,  756,  756,  756,  756, 1162,  756, 1247,  274,  149,
+ /*   240 */   274,  690, 1420, 1420,  756, 1196, 1162,  756,  756, 1196,
+ /*   250 */  1162,  756,  756,  584, 1197, 1285, 1196, 1198, 1200, 1210,
+ /*   260 */  1029, 1203, 1263, 1202, 1219,  690, 1440, 1374, 1400,  756,
+ /*   270 */   867, 1268,  274, 1475, 1301, 2840, 2840, 2840, 2840, 2840,
+ /*   280 */  2840, 2840, 1066,  191,  436,  818,  284,  415,  773,   50,
+ /*   290 */   845,  684,  998, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
+ /*   300 */  1177, 1177, 1223,  508,   11,   11,   53,   73,  407,  461,
+ /*   310 */    96,  367,  368,   59,  250,  484,   59,   59,   59,  908,
+ /*   320 */   955,  919,  988,  858,  729,  891,  895,  937,  939,  961,
+ /*   330 */  1009, 1092,  950,  880,  956, 1004, 1007, 1020, 1077, 1079,
+ /*   340 */  1136,  963,  913,  938, 1094, 1141, 1001, 1017, 1037, 1145,
+ /*   350 */   626, 1149, 1158, 1159, 1192, 1195, 1201, 1207, 1065, 1226,
+ /*   360 */  1232, 1194, 1055, 1520, 1524, 1353, 1536, 1537, 1500, 1543,
+ /*   370 */  1509, 1354, 1513, 1514, 1515, 1358, 1552, 1518, 1521, 1362,
+ /*   380 */  1557, 1523, 1366, 1560, 1527, 1563, 1542, 1567, 1533, 1578,
+ /*   390 */  1544, 1388, 1408, 1411, 1587, 1590, 1421, 1423, 1595, 1597,
+ /*   400 */  1558, 1614, 1615, 1616, 1564, 1607, 1608, 1609, 1568, 1611,
+ /*   410 */  1612, 1617, 1621, 1622, 1624, 1477, 1591, 1634, 1488, 1638,
+ /*   420 */  1639, 1644, 1648, 1658, 1659, 1660, 1661, 1662, 1663, 1665,
+ /*   430 */  1667, 1670, 1671, 1630, 1673, 1675, 1677, 1678, 1680, 1664,
+ /*   440 */  1682, 1683, 1684, 1687, 1653, 1689, 1635, 1690, 1636, 1694,
+ /*   450 */  1695, 1654, 1666, 1656, 1693, 1651, 1708, 1655, 1703, 1669,
+ /*   460 */  1685, 1704, 1727, 1736, 1699, 1573, 1740, 1741, 1742, 1681,
+ /*   470 */  1744, 1745, 1713, 1700, 1711, 1751, 1718, 1707, 1716, 1756,
+ /*   480 */  1722, 1714, 1719, 1759, 1728, 1715, 1725, 1768, 1769, 1770,
+ /*   490 */  1771, 1674, 1672, 1731, 1750, 1774, 1749, 1752, 1754, 1733,
+ /*   500 */  1737, 1755, 1760, 1757, 1772, 1785, 1784, 1794, 1786, 1761,
+ /*   510 */  1805, 1787, 1778, 1815, 1782, 1819, 1796, 1820, 1799, 1809,
+ /*   520 */  1738, 1743, 1839, 1688, 1807, 1843, 1676, 1822, 1691, 1692,
+ /*   530 */  1848, 1849, 1696, 1701, 1852, 1859, 1860, 1863, 1758, 1775,
+ /*   540 */  1829, 1698, 1867, 1777, 1709, 1779, 1874, 1850, 1729, 1797,
+ /*   550 */  1788, 1847, 1851, 1705, 1679, 1706, 1853, 1652, 1804, 1806,
+ /*   560 */  1808, 1811, 1812, 1810, 1856, 1814, 1818, 1823, 1824, 1821,
+ /*   570 */  1857, 1868, 1882, 1838, 1870, 1717, 1841, 1842, 1930, 1891,
+ /*   580 */  1720, 1903, 1911, 1914, 1915, 1916, 1917, 1858, 1861, 1908,
+ /*   590 */  1721, 1921, 1912, 1913, 1955, 1944, 1767, 1875, 1876, 1878,
+ /*   600 */  1879, 1881, 1883, 1927, 1885, 1886, 1935, 1892, 1954, 1791,
+ /*   610 */  1890, 1884, 1893, 1951, 1959, 1902, 1919, 1962, 1904, 1920,
+ /*   620 */  1973, 1918, 1923, 1974, 1922, 1924, 1975, 1926, 1910, 1928,
+ /*   630 */  1929, 1931, 1989, 1925, 1936, 1939, 1999, 1942, 1994, 1994,
+ /*   640 */  2016, 1977, 1980, 2007, 2009, 2010, 2018, 2019, 2020, 2021,
+ /*   650 */  2022, 2023, 2024, 1983, 1971, 2017, 2028, 2029, 2043, 2031,
+ /*   660 */  2045, 2033, 2035, 2037, 2005, 1733, 2042, 1737, 2053, 2054,
+ /*   670 */  2055, 2056, 2070, 2058, 2078, 2059, 2048, 2057, 2098, 2064,
+ /*   680 */  2065, 2061, 2102, 2069, 2067, 2077, 2117, 2083, 2072, 2081,
+ /*   690 */  2121, 2087, 2089, 2125, 2104, 2106, 2107, 2109, 2112, 2114,
 };
 #define YY_REDUCE_COUNT (281)
 #define YY_REDUCE_MIN   (-408)
-#define YY_REDUCE_MAX   (2417)
+#define YY_REDUCE_MAX   (2438)
 static const short yy_reduce_ofst[] = {
- /*     0 */  -286, -253, -313,  875, 1008,  280,  548, 1126,  -22, 1193,
- /*    10 */  1215, 1273, 1295, 1402, 1470,  261,  529, 1489,  957, 1556,
- /*    20 */  1573, 1616,  601, 1636, 1687, 1767, 1785, 1828, 1847, 1871,
- /*    30 */  1914, 1931, 1957, 1974, 2037, 2054, 2117, 2143, 2197, 2214,
- /*    40 */  2257, 2277, 2320, 2337, 2400, 2417, -193,  278, -223, -139,
- /*    50 */   276,  662,  987, 1000,  491, 1017, -351, -348, -316, -341,
- /*    60 */   -40, -261,  241,  -26,   38, -309, -177,  -30,  -31,  107,
- /*    70 */   109,  112,  223,  236,  311,  343,  510,  514, -245,  542,
- /*    80 */   547,  549, -355,  562,  575, -169,  631,  636,  201,  203,
- /*    90 */   644,  253,  252,  275,  612,  360, -190, -408, -408, -315,
- /*   100 */  -304, -265, -247, -201, -181,  -12,   74,  142,  257,  259,
- /*   110 */   283,  327,  465,  466,  474,  533,  616,  618,  725,  733,
- /*   120 */  -318,   27, -135, -271,   72,  -43,  -93,  375,   96,  413,
- /*   130 */    27,  497,  566,  486,  487,  488,  512,  -17,  354,  450,
- /*   140 */   456,  544,  543,  535,  678,  682,  712,  629,  526,  680,
- /*   150 */   762,  780,  840,  846,  876,  844,  913,  898,  848,  816,
- /*   160 */   829,  937,  859,  942,  942,  964,  968,  936,  906,  879,
- /*   170 */   879,  865,  879,  887,  886,  942,  928,  931,  943,  954,
- /*   180 */   956, 1007, 1010,  971,  976,  977, 1015, 1031, 1035, 1038,
- /*   190 */  1045, 1046,  986, 1039, 1009, 1044, 1003, 1004, 1051, 1012,
- /*   200 */  1052, 1053, 1054, 1059, 1057, 1069, 1043, 1047, 1049, 1050,
- /*   210 */  1063, 1064, 1073, 1075, 1078, 1080, 1083, 1067, 1086, 1056,
- /*   220 */  1033, 1036, 1085, 1058, 1072, 1112, 1117, 1119, 1074, 1118,
- /*   230 */  1081, 1089, 1090, 1092, 1093, 1084, 1095, 1101, 1129, 1127,
- /*   240 */  1144, 1116, 1087, 1088, 1115, 1060, 1110, 1122, 1123, 1065,
- /*   250 */  1114, 1125, 1130,  942, 1061, 1076, 1077, 1082, 1091, 1100,
- /*   260 */  1111, 1096, 1094, 1099,  879, 1146, 1121, 1097, 1161, 1154,
- /*   270 */  1178, 1200, 1199, 1208, 1211, 1163, 1166, 1194, 1203, 1204,
- /*   280 */  1214, 1231,
+ /*     0 */   400, -253, -313,  885,  996,   13,  282,  551,  263, 1022,
+ /*    10 */  1133, 1176, 1234, 1256, 1317,  532, 1336, 1403, 1429, 1483,
+ /*    20 */  1526, 1546, 1606, 1628, 1686, 1712, 1766, 1783, 1826, 1846,
+ /*    30 */  1889, 1909, 1969, 1991, 2049, 2075, 2129, 2146, 2189, 2209,
+ /*    40 */  2252, 2272, 2332, 2354, 2412, 2438, 1418,   -5, -223,  -70,
+ /*    50 */   293,  547,  610,  668,  559,  640, -351, -348, -316, -341,
+ /*    60 */   -61,  280,  291,   36,  238, -318, -309, -332, -207,   27,
+ /*    70 */    38,  256,  283,  298,  325,  434,  435,  440, -245,  493,
+ /*    80 */   545,  550,  -42,  582,  704, -202,  761,  830, -230, -200,
+ /*    90 */   843,  -55, -123,  -23,  234,   61, -312, -408, -408, -264,
+ /*   100 */  -209,  -67,  -15,  241,  304,  329,  409,  463,  464,  470,
+ /*   110 */   473,  510,  521,  529,  536,  542,  544,  572,  592,  598,
+ /*   120 */   -40, -239, -135, -211,  231,  -12,  114,  172,  214,  240,
+ /*   130 */  -239,   52,  314,  307, -338,  316,  352,  -57,  344,  392,
+ /*   140 */   403,  362,  487,  530,  469,  603,  525,  566,  651,  655,
+ /*   150 */   709,  755,  758,  759,  766,  747,  813,  866,  789,  780,
+ /*   160 */   792,  901,  802,  892,  892,  917,  869,  933,  902,  873,
+ /*   170 */   847,  847,  824,  847,  855,  842,  892,  886,  890,  916,
+ /*   180 */   925,  967,  973,  934,  943,  945,  980,  987,  989,  990,
+ /*   190 */  1002, 1003,  944,  994,  966, 1000,  964,  969, 1012,  965,
+ /*   200 */  1024, 1025, 1027, 1026, 1030, 1039, 1014, 1015, 1016, 1018,
+ /*   210 */  1019, 1021, 1023, 1028, 1033, 1034, 1038, 1041, 1044, 1011,
+ /*   220 */   991,  993, 1048, 1031, 1032, 1068, 1071, 1073, 1036, 1075,
+ /*   230 */  1050, 1062, 1063, 1064, 1069, 1060, 1074, 1057, 1103, 1093,
+ /*   240 */  1107, 1082, 1049, 1051, 1080, 1040, 1072, 1084, 1085, 1054,
+ /*   250 */  1076, 1087, 1088,  892, 1035, 1053, 1056, 1042, 1059, 1067,
+ /*   260 */  1078, 1010, 1047, 1058,  847, 1106, 1100, 1081, 1147, 1146,
+ /*   270 */  1170, 1182, 1168, 1189, 1191, 1134, 1140, 1173, 1174, 1178,
+ /*   280 */  1188, 1205,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    10 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    20 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    30 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    40 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    50 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    60 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    70 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1621, 1547,
- /*    80 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*    90 */  1547, 1547, 1547, 1547, 1547, 1619, 1788, 1976, 1547, 1547,
- /*   100 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   110 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   120 */  1547, 1988, 1547, 1547, 1547, 1621, 1547, 1619, 1948, 1948,
- /*   130 */  1988, 1988, 1988, 1547, 1547, 1547, 1547, 1728, 1547, 1829,
- /*   140 */  1829, 1547, 1547, 1547, 1547, 1547, 1728, 1547, 1547, 1547,
- /*   150 */  1547, 1547, 1547, 1547, 1547, 1823, 1547, 1547, 2013, 2066,
- /*   160 */  1547, 1547, 2016, 1547, 1547, 1547, 1547, 1681, 2003, 1980,
- /*   170 */  1994, 2050, 1981, 1978, 1997, 1547, 2007, 1547, 1816, 1793,
- /*   180 */  1793, 1547, 1547, 1793, 1790, 1790, 1672, 1547, 1547, 1547,
- /*   190 */  1547, 1547, 1547, 1621, 1547, 1621, 1547, 1547, 1621, 1547,
- /*   200 */  1621, 1621, 1621, 1547, 1621, 1547, 1547, 1547, 1547, 1547,
- /*   210 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   220 */  1835, 1547, 1619, 1825, 1547, 1619, 1547, 1547, 1547, 1619,
- /*   230 */  2021, 1547, 1547, 1547, 1547, 2021, 1547, 1547, 1619, 1547,
- /*   240 */  1619, 1547, 1547, 1547, 1547, 2023, 2021, 1547, 1547, 2023,
- /*   250 */  2021, 1547, 1547, 1547, 2035, 2031, 2023, 2039, 2037, 2009,
- /*   260 */  2007, 2069, 2056, 2052, 1994, 1547, 1547, 1547, 1697, 1547,
- /*   270 */  1547, 1547, 1619, 1579, 1547, 1818, 1829, 1731, 1731, 1731,
- /*   280 */  1622, 1552, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   290 */  1547, 1547, 1547, 1904, 1547, 2034, 2033, 1952, 1951, 1950,
- /*   300 */  1941, 1903, 1547, 1693, 1902, 1901, 1547, 1547, 1547, 1547,
- /*   310 */  1547, 1547, 1547, 1895, 1547, 1547, 1896, 1894, 1893, 1547,
- /*   320 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   330 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   340 */  2053, 2057, 1977, 1547, 1547, 1547, 1547, 1547, 1886, 1877,
- /*   350 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   360 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   370 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   380 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   390 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   400 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   410 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   420 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   430 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   440 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1584, 1547, 1547,
- /*   450 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   460 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   470 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   480 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   490 */  1547, 1547, 1547, 1661, 1660, 1547, 1547, 1547, 1547, 1547,
- /*   500 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   510 */  1547, 1547, 1547, 1547, 1885, 1547, 1547, 1547, 1547, 1547,
- /*   520 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 2049, 1547,
- /*   530 */  1547, 1547, 1547, 1547, 1547, 1547, 1833, 1547, 1547, 1547,
- /*   540 */  1547, 1547, 1547, 1547, 1547, 1547, 1938, 1547, 1547, 1547,
- /*   550 */  2010, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   560 */  1547, 1547, 1547, 1547, 1547, 1547, 1877, 1547, 2032, 1547,
- /*   570 */  1547, 2047, 1547, 2051, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   580 */  1547, 1987, 1983, 1547, 1547, 1979, 1876, 1547, 1972, 1547,
- /*   590 */  1547, 1923, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   600 */  1547, 1885, 1547, 1889, 1547, 1547, 1547, 1547, 1547, 1725,
- /*   610 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   620 */  1547, 1547, 1710, 1708, 1707, 1706, 1547, 1703, 1547, 1547,
- /*   630 */  1547, 1547, 1734, 1733, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   640 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1641,
- /*   650 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1632,
- /*   660 */  1547, 1631, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   670 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   680 */  1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
- /*   690 */  1547, 1547, 1547, 1547,
+ /*     0 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    10 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    20 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    30 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    40 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    50 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    60 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    70 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1630, 1556,
+ /*    80 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*    90 */  1556, 1556, 1556, 1556, 1556, 1628, 1797, 1988, 1556, 1556,
+ /*   100 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   110 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   120 */  1556, 2000, 1556, 1556, 1556, 1630, 1556, 1628, 1960, 1960,
+ /*   130 */  2000, 2000, 2000, 1556, 1556, 1556, 1556, 1737, 1556, 1838,
+ /*   140 */  1838, 1556, 1556, 1556, 1556, 1556, 1737, 1556, 1556, 1556,
+ /*   150 */  1556, 1556, 1556, 1556, 1556, 1832, 1556, 1556, 2025, 2078,
+ /*   160 */  1556, 1556, 2028, 1556, 1556, 1556, 1825, 1556, 1690, 2015,
+ /*   170 */  1992, 2006, 2062, 1993, 1990, 2009, 1556, 2019, 1556, 1802,
+ /*   180 */  1802, 1556, 1556, 1802, 1799, 1799, 1681, 1556, 1556, 1556,
+ /*   190 */  1556, 1556, 1556, 1630, 1556, 1630, 1556, 1556, 1630, 1556,
+ /*   200 */  1630, 1630, 1630, 1556, 1630, 1556, 1556, 1556, 1556, 1556,
+ /*   210 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   220 */  1844, 1556, 1628, 1834, 1556, 1628, 1556, 1556, 1556, 1628,
+ /*   230 */  2033, 1556, 1556, 1556, 1556, 2033, 1556, 1556, 1628, 1556,
+ /*   240 */  1628, 1556, 1556, 1556, 1556, 2035, 2033, 1556, 1556, 2035,
+ /*   250 */  2033, 1556, 1556, 1556, 2047, 2043, 2035, 2051, 2049, 2021,
+ /*   260 */  2019, 2081, 2068, 2064, 2006, 1556, 1556, 1556, 1706, 1556,
+ /*   270 */  1556, 1556, 1628, 1588, 1556, 1827, 1838, 1740, 1740, 1740,
+ /*   280 */  1631, 1561, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   290 */  1556, 1556, 1556, 1916, 1556, 2046, 2045, 1964, 1963, 1962,
+ /*   300 */  1953, 1915, 1556, 1702, 1914, 1913, 1556, 1556, 1556, 1556,
+ /*   310 */  1556, 1556, 1556, 1907, 1556, 1556, 1908, 1906, 1905, 1556,
+ /*   320 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   330 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   340 */  1556, 1556, 2065, 2069, 1989, 1556, 1556, 1556, 1556, 1556,
+ /*   350 */  1898, 1889, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   360 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   370 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   380 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   390 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   400 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   410 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   420 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   430 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   440 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   450 */  1556, 1556, 1556, 1593, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   460 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   470 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   480 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   490 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1670,
+ /*   500 */  1669, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   510 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   520 */  1897, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   530 */  1556, 1556, 1556, 1556, 2061, 1556, 1556, 1556, 1556, 1556,
+ /*   540 */  1556, 1556, 1842, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   550 */  1556, 1556, 1950, 1556, 1556, 1556, 2022, 1556, 1556, 1556,
+ /*   560 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   570 */  1556, 1556, 1889, 1556, 2044, 1556, 1556, 2059, 1556, 2063,
+ /*   580 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1999, 1995, 1556,
+ /*   590 */  1556, 1991, 1888, 1556, 1984, 1556, 1556, 1935, 1556, 1556,
+ /*   600 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1897, 1556, 1901,
+ /*   610 */  1556, 1556, 1556, 1556, 1556, 1734, 1556, 1556, 1556, 1556,
+ /*   620 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1719, 1717,
+ /*   630 */  1716, 1715, 1556, 1712, 1556, 1556, 1556, 1556, 1743, 1742,
+ /*   640 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   650 */  1556, 1556, 1556, 1556, 1556, 1650, 1556, 1556, 1556, 1556,
+ /*   660 */  1556, 1556, 1556, 1556, 1556, 1641, 1556, 1640, 1556, 1556,
+ /*   670 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   680 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+ /*   690 */  1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -1178,6 +1182,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /* TRANSACTION => nothing */
     0,  /*    BALANCE => nothing */
     0,  /*     VGROUP => nothing */
+    0,  /*      LIMIT => nothing */
     0,  /*      MERGE => nothing */
     0,  /* REDISTRIBUTE => nothing */
     0,  /*      SPLIT => nothing */
@@ -1244,7 +1249,6 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*      ORDER => nothing */
     0,  /*     SLIMIT => nothing */
     0,  /*    SOFFSET => nothing */
-    0,  /*      LIMIT => nothing */
     0,  /*     OFFSET => nothing */
     0,  /*        ASC => nothing */
     0,  /*      NULLS => nothing */
@@ -1582,73 +1586,73 @@ static const char *const yyTokenName[] = {
   /*  191 */ "TRANSACTION",
   /*  192 */ "BALANCE",
   /*  193 */ "VGROUP",
-  /*  194 */ "MERGE",
-  /*  195 */ "REDISTRIBUTE",
-  /*  196 */ "SPLIT",
-  /*  197 */ "DELETE",
-  /*  198 */ "INSERT",
-  /*  199 */ "NULL",
-  /*  200 */ "NK_QUESTION",
-  /*  201 */ "NK_ARROW",
-  /*  202 */ "ROWTS",
-  /*  203 */ "TBNAME",
-  /*  204 */ "QSTART",
-  /*  205 */ "QEND",
-  /*  206 */ "QDURATION",
-  /*  207 */ "WSTART",
-  /*  208 */ "WEND",
-  /*  209 */ "WDURATION",
-  /*  210 */ "IROWTS",
-  /*  211 */ "QTAGS",
-  /*  212 */ "CAST",
-  /*  213 */ "NOW",
-  /*  214 */ "TODAY",
-  /*  215 */ "TIMEZONE",
-  /*  216 */ "CLIENT_VERSION",
-  /*  217 */ "SERVER_VERSION",
-  /*  218 */ "SERVER_STATUS",
-  /*  219 */ "CURRENT_USER",
-  /*  220 */ "COUNT",
-  /*  221 */ "LAST_ROW",
-  /*  222 */ "CASE",
-  /*  223 */ "END",
-  /*  224 */ "WHEN",
-  /*  225 */ "THEN",
-  /*  226 */ "ELSE",
-  /*  227 */ "BETWEEN",
-  /*  228 */ "IS",
-  /*  229 */ "NK_LT",
-  /*  230 */ "NK_GT",
-  /*  231 */ "NK_LE",
-  /*  232 */ "NK_GE",
-  /*  233 */ "NK_NE",
-  /*  234 */ "MATCH",
-  /*  235 */ "NMATCH",
-  /*  236 */ "CONTAINS",
-  /*  237 */ "IN",
-  /*  238 */ "JOIN",
-  /*  239 */ "INNER",
-  /*  240 */ "SELECT",
-  /*  241 */ "DISTINCT",
-  /*  242 */ "WHERE",
-  /*  243 */ "PARTITION",
-  /*  244 */ "BY",
-  /*  245 */ "SESSION",
-  /*  246 */ "STATE_WINDOW",
-  /*  247 */ "SLIDING",
-  /*  248 */ "FILL",
-  /*  249 */ "VALUE",
-  /*  250 */ "NONE",
-  /*  251 */ "PREV",
-  /*  252 */ "LINEAR",
-  /*  253 */ "NEXT",
-  /*  254 */ "HAVING",
-  /*  255 */ "RANGE",
-  /*  256 */ "EVERY",
-  /*  257 */ "ORDER",
-  /*  258 */ "SLIMIT",
-  /*  259 */ "SOFFSET",
-  /*  260 */ "LIMIT",
+  /*  194 */ "LIMIT",
+  /*  195 */ "MERGE",
+  /*  196 */ "REDISTRIBUTE",
+  /*  197 */ "SPLIT",
+  /*  198 */ "DELETE",
+  /*  199 */ "INSERT",
+  /*  200 */ "NULL",
+  /*  201 */ "NK_QUESTION",
+  /*  202 */ "NK_ARROW",
+  /*  203 */ "ROWTS",
+  /*  204 */ "TBNAME",
+  /*  205 */ "QSTART",
+  /*  206 */ "QEND",
+  /*  207 */ "QDURATION",
+  /*  208 */ "WSTART",
+  /*  209 */ "WEND",
+  /*  210 */ "WDURATION",
+  /*  211 */ "IROWTS",
+  /*  212 */ "QTAGS",
+  /*  213 */ "CAST",
+  /*  214 */ "NOW",
+  /*  215 */ "TODAY",
+  /*  216 */ "TIMEZONE",
+  /*  217 */ "CLIENT_VERSION",
+  /*  218 */ "SERVER_VERSION",
+  /*  219 */ "SERVER_STATUS",
+  /*  220 */ "CURRENT_USER",
+  /*  221 */ "COUNT",
+  /*  222 */ "LAST_ROW",
+  /*  223 */ "CASE",
+  /*  224 */ "END",
+  /*  225 */ "WHEN",
+  /*  226 */ "THEN",
+  /*  227 */ "ELSE",
+  /*  228 */ "BETWEEN",
+  /*  229 */ "IS",
+  /*  230 */ "NK_LT",
+  /*  231 */ "NK_GT",
+  /*  232 */ "NK_LE",
+  /*  233 */ "NK_GE",
+  /*  234 */ "NK_NE",
+  /*  235 */ "MATCH",
+  /*  236 */ "NMATCH",
+  /*  237 */ "CONTAINS",
+  /*  238 */ "IN",
+  /*  239 */ "JOIN",
+  /*  240 */ "INNER",
+  /*  241 */ "SELECT",
+  /*  242 */ "DISTINCT",
+  /*  243 */ "WHERE",
+  /*  244 */ "PARTITION",
+  /*  245 */ "BY",
+  /*  246 */ "SESSION",
+  /*  247 */ "STATE_WINDOW",
+  /*  248 */ "SLIDING",
+  /*  249 */ "FILL",
+  /*  250 */ "VALUE",
+  /*  251 */ "NONE",
+  /*  252 */ "PREV",
+  /*  253 */ "LINEAR",
+  /*  254 */ "NEXT",
+  /*  255 */ "HAVING",
+  /*  256 */ "RANGE",
+  /*  257 */ "EVERY",
+  /*  258 */ "ORDER",
+  /*  259 */ "SLIMIT",
+  /*  260 */ "SOFFSET",
   /*  261 */ "OFFSET",
   /*  262 */ "ASC",
   /*  263 */ "NULLS",
@@ -2135,237 +2139,240 @@ static const char *const yyRuleName[] = {
  /* 288 */ "cmd ::= KILL QUERY NK_STRING",
  /* 289 */ "cmd ::= KILL TRANSACTION NK_INTEGER",
  /* 290 */ "cmd ::= BALANCE VGROUP",
- /* 291 */ "cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER",
- /* 292 */ "cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list",
- /* 293 */ "cmd ::= SPLIT VGROUP NK_INTEGER",
- /* 294 */ "dnode_list ::= DNODE NK_INTEGER",
- /* 295 */ "dnode_list ::= dnode_list DNODE NK_INTEGER",
- /* 296 */ "cmd ::= DELETE FROM full_table_name where_clause_opt",
- /* 297 */ "cmd ::= query_or_subquery",
- /* 298 */ "cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery",
- /* 299 */ "cmd ::= INSERT INTO full_table_name query_or_subquery",
- /* 300 */ "literal ::= NK_INTEGER",
- /* 301 */ "literal ::= NK_FLOAT",
- /* 302 */ "literal ::= NK_STRING",
- /* 303 */ "literal ::= NK_BOOL",
- /* 304 */ "literal ::= TIMESTAMP NK_STRING",
- /* 305 */ "literal ::= duration_literal",
- /* 306 */ "literal ::= NULL",
- /* 307 */ "literal ::= NK_QUESTION",
- /* 308 */ "duration_literal ::= NK_VARIABLE",
- /* 309 */ "signed ::= NK_INTEGER",
- /* 310 */ "signed ::= NK_PLUS NK_INTEGER",
- /* 311 */ "signed ::= NK_MINUS NK_INTEGER",
- /* 312 */ "signed ::= NK_FLOAT",
- /* 313 */ "signed ::= NK_PLUS NK_FLOAT",
- /* 314 */ "signed ::= NK_MINUS NK_FLOAT",
- /* 315 */ "signed_literal ::= signed",
- /* 316 */ "signed_literal ::= NK_STRING",
- /* 317 */ "signed_literal ::= NK_BOOL",
- /* 318 */ "signed_literal ::= TIMESTAMP NK_STRING",
- /* 319 */ "signed_literal ::= duration_literal",
- /* 320 */ "signed_literal ::= NULL",
- /* 321 */ "signed_literal ::= literal_func",
- /* 322 */ "signed_literal ::= NK_QUESTION",
- /* 323 */ "literal_list ::= signed_literal",
- /* 324 */ "literal_list ::= literal_list NK_COMMA signed_literal",
- /* 325 */ "db_name ::= NK_ID",
- /* 326 */ "table_name ::= NK_ID",
- /* 327 */ "column_name ::= NK_ID",
- /* 328 */ "function_name ::= NK_ID",
- /* 329 */ "table_alias ::= NK_ID",
- /* 330 */ "column_alias ::= NK_ID",
- /* 331 */ "user_name ::= NK_ID",
- /* 332 */ "topic_name ::= NK_ID",
- /* 333 */ "stream_name ::= NK_ID",
- /* 334 */ "cgroup_name ::= NK_ID",
- /* 335 */ "expr_or_subquery ::= expression",
- /* 336 */ "expr_or_subquery ::= subquery",
- /* 337 */ "expression ::= literal",
- /* 338 */ "expression ::= pseudo_column",
- /* 339 */ "expression ::= column_reference",
- /* 340 */ "expression ::= function_expression",
- /* 341 */ "expression ::= case_when_expression",
- /* 342 */ "expression ::= NK_LP expression NK_RP",
- /* 343 */ "expression ::= NK_PLUS expr_or_subquery",
- /* 344 */ "expression ::= NK_MINUS expr_or_subquery",
- /* 345 */ "expression ::= expr_or_subquery NK_PLUS expr_or_subquery",
- /* 346 */ "expression ::= expr_or_subquery NK_MINUS expr_or_subquery",
- /* 347 */ "expression ::= expr_or_subquery NK_STAR expr_or_subquery",
- /* 348 */ "expression ::= expr_or_subquery NK_SLASH expr_or_subquery",
- /* 349 */ "expression ::= expr_or_subquery NK_REM expr_or_subquery",
- /* 350 */ "expression ::= column_reference NK_ARROW NK_STRING",
- /* 351 */ "expression ::= expr_or_subquery NK_BITAND expr_or_subquery",
- /* 352 */ "expression ::= expr_or_subquery NK_BITOR expr_or_subquery",
- /* 353 */ "expression_list ::= expr_or_subquery",
- /* 354 */ "expression_list ::= expression_list NK_COMMA expr_or_subquery",
- /* 355 */ "column_reference ::= column_name",
- /* 356 */ "column_reference ::= table_name NK_DOT column_name",
- /* 357 */ "pseudo_column ::= ROWTS",
- /* 358 */ "pseudo_column ::= TBNAME",
- /* 359 */ "pseudo_column ::= table_name NK_DOT TBNAME",
- /* 360 */ "pseudo_column ::= QSTART",
- /* 361 */ "pseudo_column ::= QEND",
- /* 362 */ "pseudo_column ::= QDURATION",
- /* 363 */ "pseudo_column ::= WSTART",
- /* 364 */ "pseudo_column ::= WEND",
- /* 365 */ "pseudo_column ::= WDURATION",
- /* 366 */ "pseudo_column ::= IROWTS",
- /* 367 */ "pseudo_column ::= QTAGS",
- /* 368 */ "function_expression ::= function_name NK_LP expression_list NK_RP",
- /* 369 */ "function_expression ::= star_func NK_LP star_func_para_list NK_RP",
- /* 370 */ "function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP",
- /* 371 */ "function_expression ::= literal_func",
- /* 372 */ "literal_func ::= noarg_func NK_LP NK_RP",
- /* 373 */ "literal_func ::= NOW",
- /* 374 */ "noarg_func ::= NOW",
- /* 375 */ "noarg_func ::= TODAY",
- /* 376 */ "noarg_func ::= TIMEZONE",
- /* 377 */ "noarg_func ::= DATABASE",
- /* 378 */ "noarg_func ::= CLIENT_VERSION",
- /* 379 */ "noarg_func ::= SERVER_VERSION",
- /* 380 */ "noarg_func ::= SERVER_STATUS",
- /* 381 */ "noarg_func ::= CURRENT_USER",
- /* 382 */ "noarg_func ::= USER",
- /* 383 */ "star_func ::= COUNT",
- /* 384 */ "star_func ::= FIRST",
- /* 385 */ "star_func ::= LAST",
- /* 386 */ "star_func ::= LAST_ROW",
- /* 387 */ "star_func_para_list ::= NK_STAR",
- /* 388 */ "star_func_para_list ::= other_para_list",
- /* 389 */ "other_para_list ::= star_func_para",
- /* 390 */ "other_para_list ::= other_para_list NK_COMMA star_func_para",
- /* 391 */ "star_func_para ::= expr_or_subquery",
- /* 392 */ "star_func_para ::= table_name NK_DOT NK_STAR",
- /* 393 */ "case_when_expression ::= CASE when_then_list case_when_else_opt END",
- /* 394 */ "case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END",
- /* 395 */ "when_then_list ::= when_then_expr",
- /* 396 */ "when_then_list ::= when_then_list when_then_expr",
- /* 397 */ "when_then_expr ::= WHEN common_expression THEN common_expression",
- /* 398 */ "case_when_else_opt ::=",
- /* 399 */ "case_when_else_opt ::= ELSE common_expression",
- /* 400 */ "predicate ::= expr_or_subquery compare_op expr_or_subquery",
- /* 401 */ "predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery",
- /* 402 */ "predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery",
- /* 403 */ "predicate ::= expr_or_subquery IS NULL",
- /* 404 */ "predicate ::= expr_or_subquery IS NOT NULL",
- /* 405 */ "predicate ::= expr_or_subquery in_op in_predicate_value",
- /* 406 */ "compare_op ::= NK_LT",
- /* 407 */ "compare_op ::= NK_GT",
- /* 408 */ "compare_op ::= NK_LE",
- /* 409 */ "compare_op ::= NK_GE",
- /* 410 */ "compare_op ::= NK_NE",
- /* 411 */ "compare_op ::= NK_EQ",
- /* 412 */ "compare_op ::= LIKE",
- /* 413 */ "compare_op ::= NOT LIKE",
- /* 414 */ "compare_op ::= MATCH",
- /* 415 */ "compare_op ::= NMATCH",
- /* 416 */ "compare_op ::= CONTAINS",
- /* 417 */ "in_op ::= IN",
- /* 418 */ "in_op ::= NOT IN",
- /* 419 */ "in_predicate_value ::= NK_LP literal_list NK_RP",
- /* 420 */ "boolean_value_expression ::= boolean_primary",
- /* 421 */ "boolean_value_expression ::= NOT boolean_primary",
- /* 422 */ "boolean_value_expression ::= boolean_value_expression OR boolean_value_expression",
- /* 423 */ "boolean_value_expression ::= boolean_value_expression AND boolean_value_expression",
- /* 424 */ "boolean_primary ::= predicate",
- /* 425 */ "boolean_primary ::= NK_LP boolean_value_expression NK_RP",
- /* 426 */ "common_expression ::= expr_or_subquery",
- /* 427 */ "common_expression ::= boolean_value_expression",
- /* 428 */ "from_clause_opt ::=",
- /* 429 */ "from_clause_opt ::= FROM table_reference_list",
- /* 430 */ "table_reference_list ::= table_reference",
- /* 431 */ "table_reference_list ::= table_reference_list NK_COMMA table_reference",
- /* 432 */ "table_reference ::= table_primary",
- /* 433 */ "table_reference ::= joined_table",
- /* 434 */ "table_primary ::= table_name alias_opt",
- /* 435 */ "table_primary ::= db_name NK_DOT table_name alias_opt",
- /* 436 */ "table_primary ::= subquery alias_opt",
- /* 437 */ "table_primary ::= parenthesized_joined_table",
- /* 438 */ "alias_opt ::=",
- /* 439 */ "alias_opt ::= table_alias",
- /* 440 */ "alias_opt ::= AS table_alias",
- /* 441 */ "parenthesized_joined_table ::= NK_LP joined_table NK_RP",
- /* 442 */ "parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP",
- /* 443 */ "joined_table ::= table_reference join_type JOIN table_reference ON search_condition",
- /* 444 */ "join_type ::=",
- /* 445 */ "join_type ::= INNER",
- /* 446 */ "query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
- /* 447 */ "set_quantifier_opt ::=",
- /* 448 */ "set_quantifier_opt ::= DISTINCT",
- /* 449 */ "set_quantifier_opt ::= ALL",
- /* 450 */ "select_list ::= select_item",
- /* 451 */ "select_list ::= select_list NK_COMMA select_item",
- /* 452 */ "select_item ::= NK_STAR",
- /* 453 */ "select_item ::= common_expression",
- /* 454 */ "select_item ::= common_expression column_alias",
- /* 455 */ "select_item ::= common_expression AS column_alias",
- /* 456 */ "select_item ::= table_name NK_DOT NK_STAR",
- /* 457 */ "where_clause_opt ::=",
- /* 458 */ "where_clause_opt ::= WHERE search_condition",
- /* 459 */ "partition_by_clause_opt ::=",
- /* 460 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
- /* 461 */ "partition_list ::= partition_item",
- /* 462 */ "partition_list ::= partition_list NK_COMMA partition_item",
- /* 463 */ "partition_item ::= expr_or_subquery",
- /* 464 */ "partition_item ::= expr_or_subquery column_alias",
- /* 465 */ "partition_item ::= expr_or_subquery AS column_alias",
- /* 466 */ "twindow_clause_opt ::=",
- /* 467 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP",
- /* 468 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
- /* 469 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt",
- /* 470 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt",
- /* 471 */ "sliding_opt ::=",
- /* 472 */ "sliding_opt ::= SLIDING NK_LP duration_literal NK_RP",
- /* 473 */ "fill_opt ::=",
- /* 474 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
- /* 475 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP",
- /* 476 */ "fill_mode ::= NONE",
- /* 477 */ "fill_mode ::= PREV",
- /* 478 */ "fill_mode ::= NULL",
- /* 479 */ "fill_mode ::= LINEAR",
- /* 480 */ "fill_mode ::= NEXT",
- /* 481 */ "group_by_clause_opt ::=",
- /* 482 */ "group_by_clause_opt ::= GROUP BY group_by_list",
- /* 483 */ "group_by_list ::= expr_or_subquery",
- /* 484 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
- /* 485 */ "having_clause_opt ::=",
- /* 486 */ "having_clause_opt ::= HAVING search_condition",
- /* 487 */ "range_opt ::=",
- /* 488 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
- /* 489 */ "every_opt ::=",
- /* 490 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
- /* 491 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
- /* 492 */ "query_simple ::= query_specification",
- /* 493 */ "query_simple ::= union_query_expression",
- /* 494 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
- /* 495 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
- /* 496 */ "query_simple_or_subquery ::= query_simple",
- /* 497 */ "query_simple_or_subquery ::= subquery",
- /* 498 */ "query_or_subquery ::= query_expression",
- /* 499 */ "query_or_subquery ::= subquery",
- /* 500 */ "order_by_clause_opt ::=",
- /* 501 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
- /* 502 */ "slimit_clause_opt ::=",
- /* 503 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
- /* 504 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
- /* 505 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 506 */ "limit_clause_opt ::=",
- /* 507 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
- /* 508 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
- /* 509 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 510 */ "subquery ::= NK_LP query_expression NK_RP",
- /* 511 */ "subquery ::= NK_LP subquery NK_RP",
- /* 512 */ "search_condition ::= common_expression",
- /* 513 */ "sort_specification_list ::= sort_specification",
- /* 514 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
- /* 515 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
- /* 516 */ "ordering_specification_opt ::=",
- /* 517 */ "ordering_specification_opt ::= ASC",
- /* 518 */ "ordering_specification_opt ::= DESC",
- /* 519 */ "null_ordering_opt ::=",
- /* 520 */ "null_ordering_opt ::= NULLS FIRST",
- /* 521 */ "null_ordering_opt ::= NULLS LAST",
+ /* 291 */ "cmd ::= BALANCE VGROUP LIMIT NK_INTEGER",
+ /* 292 */ "cmd ::= EXPLAIN BALANCE VGROUP",
+ /* 293 */ "cmd ::= EXPLAIN BALANCE VGROUP LIMIT NK_INTEGER",
+ /* 294 */ "cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER",
+ /* 295 */ "cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list",
+ /* 296 */ "cmd ::= SPLIT VGROUP NK_INTEGER",
+ /* 297 */ "dnode_list ::= DNODE NK_INTEGER",
+ /* 298 */ "dnode_list ::= dnode_list DNODE NK_INTEGER",
+ /* 299 */ "cmd ::= DELETE FROM full_table_name where_clause_opt",
+ /* 300 */ "cmd ::= query_or_subquery",
+ /* 301 */ "cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery",
+ /* 302 */ "cmd ::= INSERT INTO full_table_name query_or_subquery",
+ /* 303 */ "literal ::= NK_INTEGER",
+ /* 304 */ "literal ::= NK_FLOAT",
+ /* 305 */ "literal ::= NK_STRING",
+ /* 306 */ "literal ::= NK_BOOL",
+ /* 307 */ "literal ::= TIMESTAMP NK_STRING",
+ /* 308 */ "literal ::= duration_literal",
+ /* 309 */ "literal ::= NULL",
+ /* 310 */ "literal ::= NK_QUESTION",
+ /* 311 */ "duration_literal ::= NK_VARIABLE",
+ /* 312 */ "signed ::= NK_INTEGER",
+ /* 313 */ "signed ::= NK_PLUS NK_INTEGER",
+ /* 314 */ "signed ::= NK_MINUS NK_INTEGER",
+ /* 315 */ "signed ::= NK_FLOAT",
+ /* 316 */ "signed ::= NK_PLUS NK_FLOAT",
+ /* 317 */ "signed ::= NK_MINUS NK_FLOAT",
+ /* 318 */ "signed_literal ::= signed",
+ /* 319 */ "signed_literal ::= NK_STRING",
+ /* 320 */ "signed_literal ::= NK_BOOL",
+ /* 321 */ "signed_literal ::= TIMESTAMP NK_STRING",
+ /* 322 */ "signed_literal ::= duration_literal",
+ /* 323 */ "signed_literal ::= NULL",
+ /* 324 */ "signed_literal ::= literal_func",
+ /* 325 */ "signed_literal ::= NK_QUESTION",
+ /* 326 */ "literal_list ::= signed_literal",
+ /* 327 */ "literal_list ::= literal_list NK_COMMA signed_literal",
+ /* 328 */ "db_name ::= NK_ID",
+ /* 329 */ "table_name ::= NK_ID",
+ /* 330 */ "column_name ::= NK_ID",
+ /* 331 */ "function_name ::= NK_ID",
+ /* 332 */ "table_alias ::= NK_ID",
+ /* 333 */ "column_alias ::= NK_ID",
+ /* 334 */ "user_name ::= NK_ID",
+ /* 335 */ "topic_name ::= NK_ID",
+ /* 336 */ "stream_name ::= NK_ID",
+ /* 337 */ "cgroup_name ::= NK_ID",
+ /* 338 */ "expr_or_subquery ::= expression",
+ /* 339 */ "expr_or_subquery ::= subquery",
+ /* 340 */ "expression ::= literal",
+ /* 341 */ "expression ::= pseudo_column",
+ /* 342 */ "expression ::= column_reference",
+ /* 343 */ "expression ::= function_expression",
+ /* 344 */ "expression ::= case_when_expression",
+ /* 345 */ "expression ::= NK_LP expression NK_RP",
+ /* 346 */ "expression ::= NK_PLUS expr_or_subquery",
+ /* 347 */ "expression ::= NK_MINUS expr_or_subquery",
+ /* 348 */ "expression ::= expr_or_subquery NK_PLUS expr_or_subquery",
+ /* 349 */ "expression ::= expr_or_subquery NK_MINUS expr_or_subquery",
+ /* 350 */ "expression ::= expr_or_subquery NK_STAR expr_or_subquery",
+ /* 351 */ "expression ::= expr_or_subquery NK_SLASH expr_or_subquery",
+ /* 352 */ "expression ::= expr_or_subquery NK_REM expr_or_subquery",
+ /* 353 */ "expression ::= column_reference NK_ARROW NK_STRING",
+ /* 354 */ "expression ::= expr_or_subquery NK_BITAND expr_or_subquery",
+ /* 355 */ "expression ::= expr_or_subquery NK_BITOR expr_or_subquery",
+ /* 356 */ "expression_list ::= expr_or_subquery",
+ /* 357 */ "expression_list ::= expression_list NK_COMMA expr_or_subquery",
+ /* 358 */ "column_reference ::= column_name",
+ /* 359 */ "column_reference ::= table_name NK_DOT column_name",
+ /* 360 */ "pseudo_column ::= ROWTS",
+ /* 361 */ "pseudo_column ::= TBNAME",
+ /* 362 */ "pseudo_column ::= table_name NK_DOT TBNAME",
+ /* 363 */ "pseudo_column ::= QSTART",
+ /* 364 */ "pseudo_column ::= QEND",
+ /* 365 */ "pseudo_column ::= QDURATION",
+ /* 366 */ "pseudo_column ::= WSTART",
+ /* 367 */ "pseudo_column ::= WEND",
+ /* 368 */ "pseudo_column ::= WDURATION",
+ /* 369 */ "pseudo_column ::= IROWTS",
+ /* 370 */ "pseudo_column ::= QTAGS",
+ /* 371 */ "function_expression ::= function_name NK_LP expression_list NK_RP",
+ /* 372 */ "function_expression ::= star_func NK_LP star_func_para_list NK_RP",
+ /* 373 */ "function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP",
+ /* 374 */ "function_expression ::= literal_func",
+ /* 375 */ "literal_func ::= noarg_func NK_LP NK_RP",
+ /* 376 */ "literal_func ::= NOW",
+ /* 377 */ "noarg_func ::= NOW",
+ /* 378 */ "noarg_func ::= TODAY",
+ /* 379 */ "noarg_func ::= TIMEZONE",
+ /* 380 */ "noarg_func ::= DATABASE",
+ /* 381 */ "noarg_func ::= CLIENT_VERSION",
+ /* 382 */ "noarg_func ::= SERVER_VERSION",
+ /* 383 */ "noarg_func ::= SERVER_STATUS",
+ /* 384 */ "noarg_func ::= CURRENT_USER",
+ /* 385 */ "noarg_func ::= USER",
+ /* 386 */ "star_func ::= COUNT",
+ /* 387 */ "star_func ::= FIRST",
+ /* 388 */ "star_func ::= LAST",
+ /* 389 */ "star_func ::= LAST_ROW",
+ /* 390 */ "star_func_para_list ::= NK_STAR",
+ /* 391 */ "star_func_para_list ::= other_para_list",
+ /* 392 */ "other_para_list ::= star_func_para",
+ /* 393 */ "other_para_list ::= other_para_list NK_COMMA star_func_para",
+ /* 394 */ "star_func_para ::= expr_or_subquery",
+ /* 395 */ "star_func_para ::= table_name NK_DOT NK_STAR",
+ /* 396 */ "case_when_expression ::= CASE when_then_list case_when_else_opt END",
+ /* 397 */ "case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END",
+ /* 398 */ "when_then_list ::= when_then_expr",
+ /* 399 */ "when_then_list ::= when_then_list when_then_expr",
+ /* 400 */ "when_then_expr ::= WHEN common_expression THEN common_expression",
+ /* 401 */ "case_when_else_opt ::=",
+ /* 402 */ "case_when_else_opt ::= ELSE common_expression",
+ /* 403 */ "predicate ::= expr_or_subquery compare_op expr_or_subquery",
+ /* 404 */ "predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery",
+ /* 405 */ "predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery",
+ /* 406 */ "predicate ::= expr_or_subquery IS NULL",
+ /* 407 */ "predicate ::= expr_or_subquery IS NOT NULL",
+ /* 408 */ "predicate ::= expr_or_subquery in_op in_predicate_value",
+ /* 409 */ "compare_op ::= NK_LT",
+ /* 410 */ "compare_op ::= NK_GT",
+ /* 411 */ "compare_op ::= NK_LE",
+ /* 412 */ "compare_op ::= NK_GE",
+ /* 413 */ "compare_op ::= NK_NE",
+ /* 414 */ "compare_op ::= NK_EQ",
+ /* 415 */ "compare_op ::= LIKE",
+ /* 416 */ "compare_op ::= NOT LIKE",
+ /* 417 */ "compare_op ::= MATCH",
+ /* 418 */ "compare_op ::= NMATCH",
+ /* 419 */ "compare_op ::= CONTAINS",
+ /* 420 */ "in_op ::= IN",
+ /* 421 */ "in_op ::= NOT IN",
+ /* 422 */ "in_predicate_value ::= NK_LP literal_list NK_RP",
+ /* 423 */ "boolean_value_expression ::= boolean_primary",
+ /* 424 */ "boolean_value_expression ::= NOT boolean_primary",
+ /* 425 */ "boolean_value_expression ::= boolean_value_expression OR boolean_value_expression",
+ /* 426 */ "boolean_value_expression ::= boolean_value_expression AND boolean_value_expression",
+ /* 427 */ "boolean_primary ::= predicate",
+ /* 428 */ "boolean_primary ::= NK_LP boolean_value_expression NK_RP",
+ /* 429 */ "common_expression ::= expr_or_subquery",
+ /* 430 */ "common_expression ::= boolean_value_expression",
+ /* 431 */ "from_clause_opt ::=",
+ /* 432 */ "from_clause_opt ::= FROM table_reference_list",
+ /* 433 */ "table_reference_list ::= table_reference",
+ /* 434 */ "table_reference_list ::= table_reference_list NK_COMMA table_reference",
+ /* 435 */ "table_reference ::= table_primary",
+ /* 436 */ "table_reference ::= joined_table",
+ /* 437 */ "table_primary ::= table_name alias_opt",
+ /* 438 */ "table_primary ::= db_name NK_DOT table_name alias_opt",
+ /* 439 */ "table_primary ::= subquery alias_opt",
+ /* 440 */ "table_primary ::= parenthesized_joined_table",
+ /* 441 */ "alias_opt ::=",
+ /* 442 */ "alias_opt ::= table_alias",
+ /* 443 */ "alias_opt ::= AS table_alias",
+ /* 444 */ "parenthesized_joined_table ::= NK_LP joined_table NK_RP",
+ /* 445 */ "parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP",
+ /* 446 */ "joined_table ::= table_reference join_type JOIN table_reference ON search_condition",
+ /* 447 */ "join_type ::=",
+ /* 448 */ "join_type ::= INNER",
+ /* 449 */ "query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
+ /* 450 */ "set_quantifier_opt ::=",
+ /* 451 */ "set_quantifier_opt ::= DISTINCT",
+ /* 452 */ "set_quantifier_opt ::= ALL",
+ /* 453 */ "select_list ::= select_item",
+ /* 454 */ "select_list ::= select_list NK_COMMA select_item",
+ /* 455 */ "select_item ::= NK_STAR",
+ /* 456 */ "select_item ::= common_expression",
+ /* 457 */ "select_item ::= common_expression column_alias",
+ /* 458 */ "select_item ::= common_expression AS column_alias",
+ /* 459 */ "select_item ::= table_name NK_DOT NK_STAR",
+ /* 460 */ "where_clause_opt ::=",
+ /* 461 */ "where_clause_opt ::= WHERE search_condition",
+ /* 462 */ "partition_by_clause_opt ::=",
+ /* 463 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
+ /* 464 */ "partition_list ::= partition_item",
+ /* 465 */ "partition_list ::= partition_list NK_COMMA partition_item",
+ /* 466 */ "partition_item ::= expr_or_subquery",
+ /* 467 */ "partition_item ::= expr_or_subquery column_alias",
+ /* 468 */ "partition_item ::= expr_or_subquery AS column_alias",
+ /* 469 */ "twindow_clause_opt ::=",
+ /* 470 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP",
+ /* 471 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
+ /* 472 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt",
+ /* 473 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt",
+ /* 474 */ "sliding_opt ::=",
+ /* 475 */ "sliding_opt ::= SLIDING NK_LP duration_literal NK_RP",
+ /* 476 */ "fill_opt ::=",
+ /* 477 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
+ /* 478 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP",
+ /* 479 */ "fill_mode ::= NONE",
+ /* 480 */ "fill_mode ::= PREV",
+ /* 481 */ "fill_mode ::= NULL",
+ /* 482 */ "fill_mode ::= LINEAR",
+ /* 483 */ "fill_mode ::= NEXT",
+ /* 484 */ "group_by_clause_opt ::=",
+ /* 485 */ "group_by_clause_opt ::= GROUP BY group_by_list",
+ /* 486 */ "group_by_list ::= expr_or_subquery",
+ /* 487 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
+ /* 488 */ "having_clause_opt ::=",
+ /* 489 */ "having_clause_opt ::= HAVING search_condition",
+ /* 490 */ "range_opt ::=",
+ /* 491 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
+ /* 492 */ "every_opt ::=",
+ /* 493 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
+ /* 494 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
+ /* 495 */ "query_simple ::= query_specification",
+ /* 496 */ "query_simple ::= union_query_expression",
+ /* 497 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
+ /* 498 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
+ /* 499 */ "query_simple_or_subquery ::= query_simple",
+ /* 500 */ "query_simple_or_subquery ::= subquery",
+ /* 501 */ "query_or_subquery ::= query_expression",
+ /* 502 */ "query_or_subquery ::= subquery",
+ /* 503 */ "order_by_clause_opt ::=",
+ /* 504 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
+ /* 505 */ "slimit_clause_opt ::=",
+ /* 506 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
+ /* 507 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
+ /* 508 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 509 */ "limit_clause_opt ::=",
+ /* 510 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
+ /* 511 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
+ /* 512 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 513 */ "subquery ::= NK_LP query_expression NK_RP",
+ /* 514 */ "subquery ::= NK_LP subquery NK_RP",
+ /* 515 */ "search_condition ::= common_expression",
+ /* 516 */ "sort_specification_list ::= sort_specification",
+ /* 517 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
+ /* 518 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
+ /* 519 */ "ordering_specification_opt ::=",
+ /* 520 */ "ordering_specification_opt ::= ASC",
+ /* 521 */ "ordering_specification_opt ::= DESC",
+ /* 522 */ "null_ordering_opt ::=",
+ /* 523 */ "null_ordering_opt ::= NULLS FIRST",
+ /* 524 */ "null_ordering_opt ::= NULLS LAST",
 };
 #endif /* NDEBUG */
 
@@ -3265,237 +3272,240 @@ static const struct {
   {  317,   -3 }, /* (288) cmd ::= KILL QUERY NK_STRING */
   {  317,   -3 }, /* (289) cmd ::= KILL TRANSACTION NK_INTEGER */
   {  317,   -2 }, /* (290) cmd ::= BALANCE VGROUP */
-  {  317,   -4 }, /* (291) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
-  {  317,   -4 }, /* (292) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-  {  317,   -3 }, /* (293) cmd ::= SPLIT VGROUP NK_INTEGER */
-  {  386,   -2 }, /* (294) dnode_list ::= DNODE NK_INTEGER */
-  {  386,   -3 }, /* (295) dnode_list ::= dnode_list DNODE NK_INTEGER */
-  {  317,   -4 }, /* (296) cmd ::= DELETE FROM full_table_name where_clause_opt */
-  {  317,   -1 }, /* (297) cmd ::= query_or_subquery */
-  {  317,   -7 }, /* (298) cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-  {  317,   -4 }, /* (299) cmd ::= INSERT INTO full_table_name query_or_subquery */
-  {  320,   -1 }, /* (300) literal ::= NK_INTEGER */
-  {  320,   -1 }, /* (301) literal ::= NK_FLOAT */
-  {  320,   -1 }, /* (302) literal ::= NK_STRING */
-  {  320,   -1 }, /* (303) literal ::= NK_BOOL */
-  {  320,   -2 }, /* (304) literal ::= TIMESTAMP NK_STRING */
-  {  320,   -1 }, /* (305) literal ::= duration_literal */
-  {  320,   -1 }, /* (306) literal ::= NULL */
-  {  320,   -1 }, /* (307) literal ::= NK_QUESTION */
-  {  362,   -1 }, /* (308) duration_literal ::= NK_VARIABLE */
-  {  388,   -1 }, /* (309) signed ::= NK_INTEGER */
-  {  388,   -2 }, /* (310) signed ::= NK_PLUS NK_INTEGER */
-  {  388,   -2 }, /* (311) signed ::= NK_MINUS NK_INTEGER */
-  {  388,   -1 }, /* (312) signed ::= NK_FLOAT */
-  {  388,   -2 }, /* (313) signed ::= NK_PLUS NK_FLOAT */
-  {  388,   -2 }, /* (314) signed ::= NK_MINUS NK_FLOAT */
-  {  351,   -1 }, /* (315) signed_literal ::= signed */
-  {  351,   -1 }, /* (316) signed_literal ::= NK_STRING */
-  {  351,   -1 }, /* (317) signed_literal ::= NK_BOOL */
-  {  351,   -2 }, /* (318) signed_literal ::= TIMESTAMP NK_STRING */
-  {  351,   -1 }, /* (319) signed_literal ::= duration_literal */
-  {  351,   -1 }, /* (320) signed_literal ::= NULL */
-  {  351,   -1 }, /* (321) signed_literal ::= literal_func */
-  {  351,   -1 }, /* (322) signed_literal ::= NK_QUESTION */
-  {  390,   -1 }, /* (323) literal_list ::= signed_literal */
-  {  390,   -3 }, /* (324) literal_list ::= literal_list NK_COMMA signed_literal */
-  {  328,   -1 }, /* (325) db_name ::= NK_ID */
-  {  357,   -1 }, /* (326) table_name ::= NK_ID */
-  {  349,   -1 }, /* (327) column_name ::= NK_ID */
-  {  364,   -1 }, /* (328) function_name ::= NK_ID */
-  {  391,   -1 }, /* (329) table_alias ::= NK_ID */
-  {  392,   -1 }, /* (330) column_alias ::= NK_ID */
-  {  322,   -1 }, /* (331) user_name ::= NK_ID */
-  {  376,   -1 }, /* (332) topic_name ::= NK_ID */
-  {  383,   -1 }, /* (333) stream_name ::= NK_ID */
-  {  378,   -1 }, /* (334) cgroup_name ::= NK_ID */
-  {  393,   -1 }, /* (335) expr_or_subquery ::= expression */
-  {  393,   -1 }, /* (336) expr_or_subquery ::= subquery */
-  {  385,   -1 }, /* (337) expression ::= literal */
-  {  385,   -1 }, /* (338) expression ::= pseudo_column */
-  {  385,   -1 }, /* (339) expression ::= column_reference */
-  {  385,   -1 }, /* (340) expression ::= function_expression */
-  {  385,   -1 }, /* (341) expression ::= case_when_expression */
-  {  385,   -3 }, /* (342) expression ::= NK_LP expression NK_RP */
-  {  385,   -2 }, /* (343) expression ::= NK_PLUS expr_or_subquery */
-  {  385,   -2 }, /* (344) expression ::= NK_MINUS expr_or_subquery */
-  {  385,   -3 }, /* (345) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
-  {  385,   -3 }, /* (346) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
-  {  385,   -3 }, /* (347) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
-  {  385,   -3 }, /* (348) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
-  {  385,   -3 }, /* (349) expression ::= expr_or_subquery NK_REM expr_or_subquery */
-  {  385,   -3 }, /* (350) expression ::= column_reference NK_ARROW NK_STRING */
-  {  385,   -3 }, /* (351) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
-  {  385,   -3 }, /* (352) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
-  {  354,   -1 }, /* (353) expression_list ::= expr_or_subquery */
-  {  354,   -3 }, /* (354) expression_list ::= expression_list NK_COMMA expr_or_subquery */
-  {  396,   -1 }, /* (355) column_reference ::= column_name */
-  {  396,   -3 }, /* (356) column_reference ::= table_name NK_DOT column_name */
-  {  395,   -1 }, /* (357) pseudo_column ::= ROWTS */
-  {  395,   -1 }, /* (358) pseudo_column ::= TBNAME */
-  {  395,   -3 }, /* (359) pseudo_column ::= table_name NK_DOT TBNAME */
-  {  395,   -1 }, /* (360) pseudo_column ::= QSTART */
-  {  395,   -1 }, /* (361) pseudo_column ::= QEND */
-  {  395,   -1 }, /* (362) pseudo_column ::= QDURATION */
-  {  395,   -1 }, /* (363) pseudo_column ::= WSTART */
-  {  395,   -1 }, /* (364) pseudo_column ::= WEND */
-  {  395,   -1 }, /* (365) pseudo_column ::= WDURATION */
-  {  395,   -1 }, /* (366) pseudo_column ::= IROWTS */
-  {  395,   -1 }, /* (367) pseudo_column ::= QTAGS */
-  {  397,   -4 }, /* (368) function_expression ::= function_name NK_LP expression_list NK_RP */
-  {  397,   -4 }, /* (369) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
-  {  397,   -6 }, /* (370) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-  {  397,   -1 }, /* (371) function_expression ::= literal_func */
-  {  389,   -3 }, /* (372) literal_func ::= noarg_func NK_LP NK_RP */
-  {  389,   -1 }, /* (373) literal_func ::= NOW */
-  {  401,   -1 }, /* (374) noarg_func ::= NOW */
-  {  401,   -1 }, /* (375) noarg_func ::= TODAY */
-  {  401,   -1 }, /* (376) noarg_func ::= TIMEZONE */
-  {  401,   -1 }, /* (377) noarg_func ::= DATABASE */
-  {  401,   -1 }, /* (378) noarg_func ::= CLIENT_VERSION */
-  {  401,   -1 }, /* (379) noarg_func ::= SERVER_VERSION */
-  {  401,   -1 }, /* (380) noarg_func ::= SERVER_STATUS */
-  {  401,   -1 }, /* (381) noarg_func ::= CURRENT_USER */
-  {  401,   -1 }, /* (382) noarg_func ::= USER */
-  {  399,   -1 }, /* (383) star_func ::= COUNT */
-  {  399,   -1 }, /* (384) star_func ::= FIRST */
-  {  399,   -1 }, /* (385) star_func ::= LAST */
-  {  399,   -1 }, /* (386) star_func ::= LAST_ROW */
-  {  400,   -1 }, /* (387) star_func_para_list ::= NK_STAR */
-  {  400,   -1 }, /* (388) star_func_para_list ::= other_para_list */
-  {  402,   -1 }, /* (389) other_para_list ::= star_func_para */
-  {  402,   -3 }, /* (390) other_para_list ::= other_para_list NK_COMMA star_func_para */
-  {  403,   -1 }, /* (391) star_func_para ::= expr_or_subquery */
-  {  403,   -3 }, /* (392) star_func_para ::= table_name NK_DOT NK_STAR */
-  {  398,   -4 }, /* (393) case_when_expression ::= CASE when_then_list case_when_else_opt END */
-  {  398,   -5 }, /* (394) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-  {  404,   -1 }, /* (395) when_then_list ::= when_then_expr */
-  {  404,   -2 }, /* (396) when_then_list ::= when_then_list when_then_expr */
-  {  407,   -4 }, /* (397) when_then_expr ::= WHEN common_expression THEN common_expression */
-  {  405,    0 }, /* (398) case_when_else_opt ::= */
-  {  405,   -2 }, /* (399) case_when_else_opt ::= ELSE common_expression */
-  {  408,   -3 }, /* (400) predicate ::= expr_or_subquery compare_op expr_or_subquery */
-  {  408,   -5 }, /* (401) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
-  {  408,   -6 }, /* (402) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
-  {  408,   -3 }, /* (403) predicate ::= expr_or_subquery IS NULL */
-  {  408,   -4 }, /* (404) predicate ::= expr_or_subquery IS NOT NULL */
-  {  408,   -3 }, /* (405) predicate ::= expr_or_subquery in_op in_predicate_value */
-  {  409,   -1 }, /* (406) compare_op ::= NK_LT */
-  {  409,   -1 }, /* (407) compare_op ::= NK_GT */
-  {  409,   -1 }, /* (408) compare_op ::= NK_LE */
-  {  409,   -1 }, /* (409) compare_op ::= NK_GE */
-  {  409,   -1 }, /* (410) compare_op ::= NK_NE */
-  {  409,   -1 }, /* (411) compare_op ::= NK_EQ */
-  {  409,   -1 }, /* (412) compare_op ::= LIKE */
-  {  409,   -2 }, /* (413) compare_op ::= NOT LIKE */
-  {  409,   -1 }, /* (414) compare_op ::= MATCH */
-  {  409,   -1 }, /* (415) compare_op ::= NMATCH */
-  {  409,   -1 }, /* (416) compare_op ::= CONTAINS */
-  {  410,   -1 }, /* (417) in_op ::= IN */
-  {  410,   -2 }, /* (418) in_op ::= NOT IN */
-  {  411,   -3 }, /* (419) in_predicate_value ::= NK_LP literal_list NK_RP */
-  {  412,   -1 }, /* (420) boolean_value_expression ::= boolean_primary */
-  {  412,   -2 }, /* (421) boolean_value_expression ::= NOT boolean_primary */
-  {  412,   -3 }, /* (422) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
-  {  412,   -3 }, /* (423) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
-  {  413,   -1 }, /* (424) boolean_primary ::= predicate */
-  {  413,   -3 }, /* (425) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
-  {  406,   -1 }, /* (426) common_expression ::= expr_or_subquery */
-  {  406,   -1 }, /* (427) common_expression ::= boolean_value_expression */
-  {  414,    0 }, /* (428) from_clause_opt ::= */
-  {  414,   -2 }, /* (429) from_clause_opt ::= FROM table_reference_list */
-  {  415,   -1 }, /* (430) table_reference_list ::= table_reference */
-  {  415,   -3 }, /* (431) table_reference_list ::= table_reference_list NK_COMMA table_reference */
-  {  416,   -1 }, /* (432) table_reference ::= table_primary */
-  {  416,   -1 }, /* (433) table_reference ::= joined_table */
-  {  417,   -2 }, /* (434) table_primary ::= table_name alias_opt */
-  {  417,   -4 }, /* (435) table_primary ::= db_name NK_DOT table_name alias_opt */
-  {  417,   -2 }, /* (436) table_primary ::= subquery alias_opt */
-  {  417,   -1 }, /* (437) table_primary ::= parenthesized_joined_table */
-  {  419,    0 }, /* (438) alias_opt ::= */
-  {  419,   -1 }, /* (439) alias_opt ::= table_alias */
-  {  419,   -2 }, /* (440) alias_opt ::= AS table_alias */
-  {  420,   -3 }, /* (441) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-  {  420,   -3 }, /* (442) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
-  {  418,   -6 }, /* (443) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-  {  421,    0 }, /* (444) join_type ::= */
-  {  421,   -1 }, /* (445) join_type ::= INNER */
-  {  423,  -12 }, /* (446) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-  {  424,    0 }, /* (447) set_quantifier_opt ::= */
-  {  424,   -1 }, /* (448) set_quantifier_opt ::= DISTINCT */
-  {  424,   -1 }, /* (449) set_quantifier_opt ::= ALL */
-  {  425,   -1 }, /* (450) select_list ::= select_item */
-  {  425,   -3 }, /* (451) select_list ::= select_list NK_COMMA select_item */
-  {  433,   -1 }, /* (452) select_item ::= NK_STAR */
-  {  433,   -1 }, /* (453) select_item ::= common_expression */
-  {  433,   -2 }, /* (454) select_item ::= common_expression column_alias */
-  {  433,   -3 }, /* (455) select_item ::= common_expression AS column_alias */
-  {  433,   -3 }, /* (456) select_item ::= table_name NK_DOT NK_STAR */
-  {  387,    0 }, /* (457) where_clause_opt ::= */
-  {  387,   -2 }, /* (458) where_clause_opt ::= WHERE search_condition */
-  {  426,    0 }, /* (459) partition_by_clause_opt ::= */
-  {  426,   -3 }, /* (460) partition_by_clause_opt ::= PARTITION BY partition_list */
-  {  434,   -1 }, /* (461) partition_list ::= partition_item */
-  {  434,   -3 }, /* (462) partition_list ::= partition_list NK_COMMA partition_item */
-  {  435,   -1 }, /* (463) partition_item ::= expr_or_subquery */
-  {  435,   -2 }, /* (464) partition_item ::= expr_or_subquery column_alias */
-  {  435,   -3 }, /* (465) partition_item ::= expr_or_subquery AS column_alias */
-  {  430,    0 }, /* (466) twindow_clause_opt ::= */
-  {  430,   -6 }, /* (467) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
-  {  430,   -4 }, /* (468) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-  {  430,   -6 }, /* (469) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
-  {  430,   -8 }, /* (470) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
-  {  372,    0 }, /* (471) sliding_opt ::= */
-  {  372,   -4 }, /* (472) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
-  {  429,    0 }, /* (473) fill_opt ::= */
-  {  429,   -4 }, /* (474) fill_opt ::= FILL NK_LP fill_mode NK_RP */
-  {  429,   -6 }, /* (475) fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP */
-  {  436,   -1 }, /* (476) fill_mode ::= NONE */
-  {  436,   -1 }, /* (477) fill_mode ::= PREV */
-  {  436,   -1 }, /* (478) fill_mode ::= NULL */
-  {  436,   -1 }, /* (479) fill_mode ::= LINEAR */
-  {  436,   -1 }, /* (480) fill_mode ::= NEXT */
-  {  431,    0 }, /* (481) group_by_clause_opt ::= */
-  {  431,   -3 }, /* (482) group_by_clause_opt ::= GROUP BY group_by_list */
-  {  437,   -1 }, /* (483) group_by_list ::= expr_or_subquery */
-  {  437,   -3 }, /* (484) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-  {  432,    0 }, /* (485) having_clause_opt ::= */
-  {  432,   -2 }, /* (486) having_clause_opt ::= HAVING search_condition */
-  {  427,    0 }, /* (487) range_opt ::= */
-  {  427,   -6 }, /* (488) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-  {  428,    0 }, /* (489) every_opt ::= */
-  {  428,   -4 }, /* (490) every_opt ::= EVERY NK_LP duration_literal NK_RP */
-  {  438,   -4 }, /* (491) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-  {  439,   -1 }, /* (492) query_simple ::= query_specification */
-  {  439,   -1 }, /* (493) query_simple ::= union_query_expression */
-  {  443,   -4 }, /* (494) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-  {  443,   -3 }, /* (495) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-  {  444,   -1 }, /* (496) query_simple_or_subquery ::= query_simple */
-  {  444,   -1 }, /* (497) query_simple_or_subquery ::= subquery */
-  {  377,   -1 }, /* (498) query_or_subquery ::= query_expression */
-  {  377,   -1 }, /* (499) query_or_subquery ::= subquery */
-  {  440,    0 }, /* (500) order_by_clause_opt ::= */
-  {  440,   -3 }, /* (501) order_by_clause_opt ::= ORDER BY sort_specification_list */
-  {  441,    0 }, /* (502) slimit_clause_opt ::= */
-  {  441,   -2 }, /* (503) slimit_clause_opt ::= SLIMIT NK_INTEGER */
-  {  441,   -4 }, /* (504) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-  {  441,   -4 }, /* (505) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-  {  442,    0 }, /* (506) limit_clause_opt ::= */
-  {  442,   -2 }, /* (507) limit_clause_opt ::= LIMIT NK_INTEGER */
-  {  442,   -4 }, /* (508) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
-  {  442,   -4 }, /* (509) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-  {  394,   -3 }, /* (510) subquery ::= NK_LP query_expression NK_RP */
-  {  394,   -3 }, /* (511) subquery ::= NK_LP subquery NK_RP */
-  {  422,   -1 }, /* (512) search_condition ::= common_expression */
-  {  445,   -1 }, /* (513) sort_specification_list ::= sort_specification */
-  {  445,   -3 }, /* (514) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
-  {  446,   -3 }, /* (515) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-  {  447,    0 }, /* (516) ordering_specification_opt ::= */
-  {  447,   -1 }, /* (517) ordering_specification_opt ::= ASC */
-  {  447,   -1 }, /* (518) ordering_specification_opt ::= DESC */
-  {  448,    0 }, /* (519) null_ordering_opt ::= */
-  {  448,   -2 }, /* (520) null_ordering_opt ::= NULLS FIRST */
-  {  448,   -2 }, /* (521) null_ordering_opt ::= NULLS LAST */
+  {  317,   -4 }, /* (291) cmd ::= BALANCE VGROUP LIMIT NK_INTEGER */
+  {  317,   -3 }, /* (292) cmd ::= EXPLAIN BALANCE VGROUP */
+  {  317,   -5 }, /* (293) cmd ::= EXPLAIN BALANCE VGROUP LIMIT NK_INTEGER */
+  {  317,   -4 }, /* (294) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+  {  317,   -4 }, /* (295) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+  {  317,   -3 }, /* (296) cmd ::= SPLIT VGROUP NK_INTEGER */
+  {  386,   -2 }, /* (297) dnode_list ::= DNODE NK_INTEGER */
+  {  386,   -3 }, /* (298) dnode_list ::= dnode_list DNODE NK_INTEGER */
+  {  317,   -4 }, /* (299) cmd ::= DELETE FROM full_table_name where_clause_opt */
+  {  317,   -1 }, /* (300) cmd ::= query_or_subquery */
+  {  317,   -7 }, /* (301) cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+  {  317,   -4 }, /* (302) cmd ::= INSERT INTO full_table_name query_or_subquery */
+  {  320,   -1 }, /* (303) literal ::= NK_INTEGER */
+  {  320,   -1 }, /* (304) literal ::= NK_FLOAT */
+  {  320,   -1 }, /* (305) literal ::= NK_STRING */
+  {  320,   -1 }, /* (306) literal ::= NK_BOOL */
+  {  320,   -2 }, /* (307) literal ::= TIMESTAMP NK_STRING */
+  {  320,   -1 }, /* (308) literal ::= duration_literal */
+  {  320,   -1 }, /* (309) literal ::= NULL */
+  {  320,   -1 }, /* (310) literal ::= NK_QUESTION */
+  {  362,   -1 }, /* (311) duration_literal ::= NK_VARIABLE */
+  {  388,   -1 }, /* (312) signed ::= NK_INTEGER */
+  {  388,   -2 }, /* (313) signed ::= NK_PLUS NK_INTEGER */
+  {  388,   -2 }, /* (314) signed ::= NK_MINUS NK_INTEGER */
+  {  388,   -1 }, /* (315) signed ::= NK_FLOAT */
+  {  388,   -2 }, /* (316) signed ::= NK_PLUS NK_FLOAT */
+  {  388,   -2 }, /* (317) signed ::= NK_MINUS NK_FLOAT */
+  {  351,   -1 }, /* (318) signed_literal ::= signed */
+  {  351,   -1 }, /* (319) signed_literal ::= NK_STRING */
+  {  351,   -1 }, /* (320) signed_literal ::= NK_BOOL */
+  {  351,   -2 }, /* (321) signed_literal ::= TIMESTAMP NK_STRING */
+  {  351,   -1 }, /* (322) signed_literal ::= duration_literal */
+  {  351,   -1 }, /* (323) signed_literal ::= NULL */
+  {  351,   -1 }, /* (324) signed_literal ::= literal_func */
+  {  351,   -1 }, /* (325) signed_literal ::= NK_QUESTION */
+  {  390,   -1 }, /* (326) literal_list ::= signed_literal */
+  {  390,   -3 }, /* (327) literal_list ::= literal_list NK_COMMA signed_literal */
+  {  328,   -1 }, /* (328) db_name ::= NK_ID */
+  {  357,   -1 }, /* (329) table_name ::= NK_ID */
+  {  349,   -1 }, /* (330) column_name ::= NK_ID */
+  {  364,   -1 }, /* (331) function_name ::= NK_ID */
+  {  391,   -1 }, /* (332) table_alias ::= NK_ID */
+  {  392,   -1 }, /* (333) column_alias ::= NK_ID */
+  {  322,   -1 }, /* (334) user_name ::= NK_ID */
+  {  376,   -1 }, /* (335) topic_name ::= NK_ID */
+  {  383,   -1 }, /* (336) stream_name ::= NK_ID */
+  {  378,   -1 }, /* (337) cgroup_name ::= NK_ID */
+  {  393,   -1 }, /* (338) expr_or_subquery ::= expression */
+  {  393,   -1 }, /* (339) expr_or_subquery ::= subquery */
+  {  385,   -1 }, /* (340) expression ::= literal */
+  {  385,   -1 }, /* (341) expression ::= pseudo_column */
+  {  385,   -1 }, /* (342) expression ::= column_reference */
+  {  385,   -1 }, /* (343) expression ::= function_expression */
+  {  385,   -1 }, /* (344) expression ::= case_when_expression */
+  {  385,   -3 }, /* (345) expression ::= NK_LP expression NK_RP */
+  {  385,   -2 }, /* (346) expression ::= NK_PLUS expr_or_subquery */
+  {  385,   -2 }, /* (347) expression ::= NK_MINUS expr_or_subquery */
+  {  385,   -3 }, /* (348) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+  {  385,   -3 }, /* (349) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+  {  385,   -3 }, /* (350) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+  {  385,   -3 }, /* (351) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+  {  385,   -3 }, /* (352) expression ::= expr_or_subquery NK_REM expr_or_subquery */
+  {  385,   -3 }, /* (353) expression ::= column_reference NK_ARROW NK_STRING */
+  {  385,   -3 }, /* (354) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+  {  385,   -3 }, /* (355) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+  {  354,   -1 }, /* (356) expression_list ::= expr_or_subquery */
+  {  354,   -3 }, /* (357) expression_list ::= expression_list NK_COMMA expr_or_subquery */
+  {  396,   -1 }, /* (358) column_reference ::= column_name */
+  {  396,   -3 }, /* (359) column_reference ::= table_name NK_DOT column_name */
+  {  395,   -1 }, /* (360) pseudo_column ::= ROWTS */
+  {  395,   -1 }, /* (361) pseudo_column ::= TBNAME */
+  {  395,   -3 }, /* (362) pseudo_column ::= table_name NK_DOT TBNAME */
+  {  395,   -1 }, /* (363) pseudo_column ::= QSTART */
+  {  395,   -1 }, /* (364) pseudo_column ::= QEND */
+  {  395,   -1 }, /* (365) pseudo_column ::= QDURATION */
+  {  395,   -1 }, /* (366) pseudo_column ::= WSTART */
+  {  395,   -1 }, /* (367) pseudo_column ::= WEND */
+  {  395,   -1 }, /* (368) pseudo_column ::= WDURATION */
+  {  395,   -1 }, /* (369) pseudo_column ::= IROWTS */
+  {  395,   -1 }, /* (370) pseudo_column ::= QTAGS */
+  {  397,   -4 }, /* (371) function_expression ::= function_name NK_LP expression_list NK_RP */
+  {  397,   -4 }, /* (372) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
+  {  397,   -6 }, /* (373) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+  {  397,   -1 }, /* (374) function_expression ::= literal_func */
+  {  389,   -3 }, /* (375) literal_func ::= noarg_func NK_LP NK_RP */
+  {  389,   -1 }, /* (376) literal_func ::= NOW */
+  {  401,   -1 }, /* (377) noarg_func ::= NOW */
+  {  401,   -1 }, /* (378) noarg_func ::= TODAY */
+  {  401,   -1 }, /* (379) noarg_func ::= TIMEZONE */
+  {  401,   -1 }, /* (380) noarg_func ::= DATABASE */
+  {  401,   -1 }, /* (381) noarg_func ::= CLIENT_VERSION */
+  {  401,   -1 }, /* (382) noarg_func ::= SERVER_VERSION */
+  {  401,   -1 }, /* (383) noarg_func ::= SERVER_STATUS */
+  {  401,   -1 }, /* (384) noarg_func ::= CURRENT_USER */
+  {  401,   -1 }, /* (385) noarg_func ::= USER */
+  {  399,   -1 }, /* (386) star_func ::= COUNT */
+  {  399,   -1 }, /* (387) star_func ::= FIRST */
+  {  399,   -1 }, /* (388) star_func ::= LAST */
+  {  399,   -1 }, /* (389) star_func ::= LAST_ROW */
+  {  400,   -1 }, /* (390) star_func_para_list ::= NK_STAR */
+  {  400,   -1 }, /* (391) star_func_para_list ::= other_para_list */
+  {  402,   -1 }, /* (392) other_para_list ::= star_func_para */
+  {  402,   -3 }, /* (393) other_para_list ::= other_para_list NK_COMMA star_func_para */
+  {  403,   -1 }, /* (394) star_func_para ::= expr_or_subquery */
+  {  403,   -3 }, /* (395) star_func_para ::= table_name NK_DOT NK_STAR */
+  {  398,   -4 }, /* (396) case_when_expression ::= CASE when_then_list case_when_else_opt END */
+  {  398,   -5 }, /* (397) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+  {  404,   -1 }, /* (398) when_then_list ::= when_then_expr */
+  {  404,   -2 }, /* (399) when_then_list ::= when_then_list when_then_expr */
+  {  407,   -4 }, /* (400) when_then_expr ::= WHEN common_expression THEN common_expression */
+  {  405,    0 }, /* (401) case_when_else_opt ::= */
+  {  405,   -2 }, /* (402) case_when_else_opt ::= ELSE common_expression */
+  {  408,   -3 }, /* (403) predicate ::= expr_or_subquery compare_op expr_or_subquery */
+  {  408,   -5 }, /* (404) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+  {  408,   -6 }, /* (405) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+  {  408,   -3 }, /* (406) predicate ::= expr_or_subquery IS NULL */
+  {  408,   -4 }, /* (407) predicate ::= expr_or_subquery IS NOT NULL */
+  {  408,   -3 }, /* (408) predicate ::= expr_or_subquery in_op in_predicate_value */
+  {  409,   -1 }, /* (409) compare_op ::= NK_LT */
+  {  409,   -1 }, /* (410) compare_op ::= NK_GT */
+  {  409,   -1 }, /* (411) compare_op ::= NK_LE */
+  {  409,   -1 }, /* (412) compare_op ::= NK_GE */
+  {  409,   -1 }, /* (413) compare_op ::= NK_NE */
+  {  409,   -1 }, /* (414) compare_op ::= NK_EQ */
+  {  409,   -1 }, /* (415) compare_op ::= LIKE */
+  {  409,   -2 }, /* (416) compare_op ::= NOT LIKE */
+  {  409,   -1 }, /* (417) compare_op ::= MATCH */
+  {  409,   -1 }, /* (418) compare_op ::= NMATCH */
+  {  409,   -1 }, /* (419) compare_op ::= CONTAINS */
+  {  410,   -1 }, /* (420) in_op ::= IN */
+  {  410,   -2 }, /* (421) in_op ::= NOT IN */
+  {  411,   -3 }, /* (422) in_predicate_value ::= NK_LP literal_list NK_RP */
+  {  412,   -1 }, /* (423) boolean_value_expression ::= boolean_primary */
+  {  412,   -2 }, /* (424) boolean_value_expression ::= NOT boolean_primary */
+  {  412,   -3 }, /* (425) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+  {  412,   -3 }, /* (426) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+  {  413,   -1 }, /* (427) boolean_primary ::= predicate */
+  {  413,   -3 }, /* (428) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
+  {  406,   -1 }, /* (429) common_expression ::= expr_or_subquery */
+  {  406,   -1 }, /* (430) common_expression ::= boolean_value_expression */
+  {  414,    0 }, /* (431) from_clause_opt ::= */
+  {  414,   -2 }, /* (432) from_clause_opt ::= FROM table_reference_list */
+  {  415,   -1 }, /* (433) table_reference_list ::= table_reference */
+  {  415,   -3 }, /* (434) table_reference_list ::= table_reference_list NK_COMMA table_reference */
+  {  416,   -1 }, /* (435) table_reference ::= table_primary */
+  {  416,   -1 }, /* (436) table_reference ::= joined_table */
+  {  417,   -2 }, /* (437) table_primary ::= table_name alias_opt */
+  {  417,   -4 }, /* (438) table_primary ::= db_name NK_DOT table_name alias_opt */
+  {  417,   -2 }, /* (439) table_primary ::= subquery alias_opt */
+  {  417,   -1 }, /* (440) table_primary ::= parenthesized_joined_table */
+  {  419,    0 }, /* (441) alias_opt ::= */
+  {  419,   -1 }, /* (442) alias_opt ::= table_alias */
+  {  419,   -2 }, /* (443) alias_opt ::= AS table_alias */
+  {  420,   -3 }, /* (444) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+  {  420,   -3 }, /* (445) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
+  {  418,   -6 }, /* (446) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+  {  421,    0 }, /* (447) join_type ::= */
+  {  421,   -1 }, /* (448) join_type ::= INNER */
+  {  423,  -12 }, /* (449) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+  {  424,    0 }, /* (450) set_quantifier_opt ::= */
+  {  424,   -1 }, /* (451) set_quantifier_opt ::= DISTINCT */
+  {  424,   -1 }, /* (452) set_quantifier_opt ::= ALL */
+  {  425,   -1 }, /* (453) select_list ::= select_item */
+  {  425,   -3 }, /* (454) select_list ::= select_list NK_COMMA select_item */
+  {  433,   -1 }, /* (455) select_item ::= NK_STAR */
+  {  433,   -1 }, /* (456) select_item ::= common_expression */
+  {  433,   -2 }, /* (457) select_item ::= common_expression column_alias */
+  {  433,   -3 }, /* (458) select_item ::= common_expression AS column_alias */
+  {  433,   -3 }, /* (459) select_item ::= table_name NK_DOT NK_STAR */
+  {  387,    0 }, /* (460) where_clause_opt ::= */
+  {  387,   -2 }, /* (461) where_clause_opt ::= WHERE search_condition */
+  {  426,    0 }, /* (462) partition_by_clause_opt ::= */
+  {  426,   -3 }, /* (463) partition_by_clause_opt ::= PARTITION BY partition_list */
+  {  434,   -1 }, /* (464) partition_list ::= partition_item */
+  {  434,   -3 }, /* (465) partition_list ::= partition_list NK_COMMA partition_item */
+  {  435,   -1 }, /* (466) partition_item ::= expr_or_subquery */
+  {  435,   -2 }, /* (467) partition_item ::= expr_or_subquery column_alias */
+  {  435,   -3 }, /* (468) partition_item ::= expr_or_subquery AS column_alias */
+  {  430,    0 }, /* (469) twindow_clause_opt ::= */
+  {  430,   -6 }, /* (470) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
+  {  430,   -4 }, /* (471) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+  {  430,   -6 }, /* (472) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
+  {  430,   -8 }, /* (473) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
+  {  372,    0 }, /* (474) sliding_opt ::= */
+  {  372,   -4 }, /* (475) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
+  {  429,    0 }, /* (476) fill_opt ::= */
+  {  429,   -4 }, /* (477) fill_opt ::= FILL NK_LP fill_mode NK_RP */
+  {  429,   -6 }, /* (478) fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP */
+  {  436,   -1 }, /* (479) fill_mode ::= NONE */
+  {  436,   -1 }, /* (480) fill_mode ::= PREV */
+  {  436,   -1 }, /* (481) fill_mode ::= NULL */
+  {  436,   -1 }, /* (482) fill_mode ::= LINEAR */
+  {  436,   -1 }, /* (483) fill_mode ::= NEXT */
+  {  431,    0 }, /* (484) group_by_clause_opt ::= */
+  {  431,   -3 }, /* (485) group_by_clause_opt ::= GROUP BY group_by_list */
+  {  437,   -1 }, /* (486) group_by_list ::= expr_or_subquery */
+  {  437,   -3 }, /* (487) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+  {  432,    0 }, /* (488) having_clause_opt ::= */
+  {  432,   -2 }, /* (489) having_clause_opt ::= HAVING search_condition */
+  {  427,    0 }, /* (490) range_opt ::= */
+  {  427,   -6 }, /* (491) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+  {  428,    0 }, /* (492) every_opt ::= */
+  {  428,   -4 }, /* (493) every_opt ::= EVERY NK_LP duration_literal NK_RP */
+  {  438,   -4 }, /* (494) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+  {  439,   -1 }, /* (495) query_simple ::= query_specification */
+  {  439,   -1 }, /* (496) query_simple ::= union_query_expression */
+  {  443,   -4 }, /* (497) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+  {  443,   -3 }, /* (498) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+  {  444,   -1 }, /* (499) query_simple_or_subquery ::= query_simple */
+  {  444,   -1 }, /* (500) query_simple_or_subquery ::= subquery */
+  {  377,   -1 }, /* (501) query_or_subquery ::= query_expression */
+  {  377,   -1 }, /* (502) query_or_subquery ::= subquery */
+  {  440,    0 }, /* (503) order_by_clause_opt ::= */
+  {  440,   -3 }, /* (504) order_by_clause_opt ::= ORDER BY sort_specification_list */
+  {  441,    0 }, /* (505) slimit_clause_opt ::= */
+  {  441,   -2 }, /* (506) slimit_clause_opt ::= SLIMIT NK_INTEGER */
+  {  441,   -4 }, /* (507) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+  {  441,   -4 }, /* (508) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+  {  442,    0 }, /* (509) limit_clause_opt ::= */
+  {  442,   -2 }, /* (510) limit_clause_opt ::= LIMIT NK_INTEGER */
+  {  442,   -4 }, /* (511) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
+  {  442,   -4 }, /* (512) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+  {  394,   -3 }, /* (513) subquery ::= NK_LP query_expression NK_RP */
+  {  394,   -3 }, /* (514) subquery ::= NK_LP subquery NK_RP */
+  {  422,   -1 }, /* (515) search_condition ::= common_expression */
+  {  445,   -1 }, /* (516) sort_specification_list ::= sort_specification */
+  {  445,   -3 }, /* (517) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
+  {  446,   -3 }, /* (518) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+  {  447,    0 }, /* (519) ordering_specification_opt ::= */
+  {  447,   -1 }, /* (520) ordering_specification_opt ::= ASC */
+  {  447,   -1 }, /* (521) ordering_specification_opt ::= DESC */
+  {  448,    0 }, /* (522) null_ordering_opt ::= */
+  {  448,   -2 }, /* (523) null_ordering_opt ::= NULLS FIRST */
+  {  448,   -2 }, /* (524) null_ordering_opt ::= NULLS LAST */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -3711,29 +3721,29 @@ static YYACTIONTYPE yy_reduce(
       case 49: /* dnode_endpoint ::= NK_STRING */
       case 50: /* dnode_endpoint ::= NK_ID */ yytestcase(yyruleno==50);
       case 51: /* dnode_endpoint ::= NK_IPTOKEN */ yytestcase(yyruleno==51);
-      case 325: /* db_name ::= NK_ID */ yytestcase(yyruleno==325);
-      case 326: /* table_name ::= NK_ID */ yytestcase(yyruleno==326);
-      case 327: /* column_name ::= NK_ID */ yytestcase(yyruleno==327);
-      case 328: /* function_name ::= NK_ID */ yytestcase(yyruleno==328);
-      case 329: /* table_alias ::= NK_ID */ yytestcase(yyruleno==329);
-      case 330: /* column_alias ::= NK_ID */ yytestcase(yyruleno==330);
-      case 331: /* user_name ::= NK_ID */ yytestcase(yyruleno==331);
-      case 332: /* topic_name ::= NK_ID */ yytestcase(yyruleno==332);
-      case 333: /* stream_name ::= NK_ID */ yytestcase(yyruleno==333);
-      case 334: /* cgroup_name ::= NK_ID */ yytestcase(yyruleno==334);
-      case 374: /* noarg_func ::= NOW */ yytestcase(yyruleno==374);
-      case 375: /* noarg_func ::= TODAY */ yytestcase(yyruleno==375);
-      case 376: /* noarg_func ::= TIMEZONE */ yytestcase(yyruleno==376);
-      case 377: /* noarg_func ::= DATABASE */ yytestcase(yyruleno==377);
-      case 378: /* noarg_func ::= CLIENT_VERSION */ yytestcase(yyruleno==378);
-      case 379: /* noarg_func ::= SERVER_VERSION */ yytestcase(yyruleno==379);
-      case 380: /* noarg_func ::= SERVER_STATUS */ yytestcase(yyruleno==380);
-      case 381: /* noarg_func ::= CURRENT_USER */ yytestcase(yyruleno==381);
-      case 382: /* noarg_func ::= USER */ yytestcase(yyruleno==382);
-      case 383: /* star_func ::= COUNT */ yytestcase(yyruleno==383);
-      case 384: /* star_func ::= FIRST */ yytestcase(yyruleno==384);
-      case 385: /* star_func ::= LAST */ yytestcase(yyruleno==385);
-      case 386: /* star_func ::= LAST_ROW */ yytestcase(yyruleno==386);
+      case 328: /* db_name ::= NK_ID */ yytestcase(yyruleno==328);
+      case 329: /* table_name ::= NK_ID */ yytestcase(yyruleno==329);
+      case 330: /* column_name ::= NK_ID */ yytestcase(yyruleno==330);
+      case 331: /* function_name ::= NK_ID */ yytestcase(yyruleno==331);
+      case 332: /* table_alias ::= NK_ID */ yytestcase(yyruleno==332);
+      case 333: /* column_alias ::= NK_ID */ yytestcase(yyruleno==333);
+      case 334: /* user_name ::= NK_ID */ yytestcase(yyruleno==334);
+      case 335: /* topic_name ::= NK_ID */ yytestcase(yyruleno==335);
+      case 336: /* stream_name ::= NK_ID */ yytestcase(yyruleno==336);
+      case 337: /* cgroup_name ::= NK_ID */ yytestcase(yyruleno==337);
+      case 377: /* noarg_func ::= NOW */ yytestcase(yyruleno==377);
+      case 378: /* noarg_func ::= TODAY */ yytestcase(yyruleno==378);
+      case 379: /* noarg_func ::= TIMEZONE */ yytestcase(yyruleno==379);
+      case 380: /* noarg_func ::= DATABASE */ yytestcase(yyruleno==380);
+      case 381: /* noarg_func ::= CLIENT_VERSION */ yytestcase(yyruleno==381);
+      case 382: /* noarg_func ::= SERVER_VERSION */ yytestcase(yyruleno==382);
+      case 383: /* noarg_func ::= SERVER_STATUS */ yytestcase(yyruleno==383);
+      case 384: /* noarg_func ::= CURRENT_USER */ yytestcase(yyruleno==384);
+      case 385: /* noarg_func ::= USER */ yytestcase(yyruleno==385);
+      case 386: /* star_func ::= COUNT */ yytestcase(yyruleno==386);
+      case 387: /* star_func ::= FIRST */ yytestcase(yyruleno==387);
+      case 388: /* star_func ::= LAST */ yytestcase(yyruleno==388);
+      case 389: /* star_func ::= LAST_ROW */ yytestcase(yyruleno==389);
 { yylhsminor.yy181 = yymsp[0].minor.yy0; }
   yymsp[0].minor.yy181 = yylhsminor.yy181;
         break;
@@ -3792,7 +3802,7 @@ static YYACTIONTYPE yy_reduce(
       case 71: /* exists_opt ::= */ yytestcase(yyruleno==71);
       case 266: /* analyze_opt ::= */ yytestcase(yyruleno==266);
       case 273: /* agg_func_opt ::= */ yytestcase(yyruleno==273);
-      case 447: /* set_quantifier_opt ::= */ yytestcase(yyruleno==447);
+      case 450: /* set_quantifier_opt ::= */ yytestcase(yyruleno==450);
 { yymsp[1].minor.yy39 = false; }
         break;
       case 70: /* exists_opt ::= IF EXISTS */
@@ -3965,7 +3975,7 @@ static YYACTIONTYPE yy_reduce(
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
       case 116: /* integer_list ::= integer_list NK_COMMA NK_INTEGER */
-      case 295: /* dnode_list ::= dnode_list DNODE NK_INTEGER */ yytestcase(yyruleno==295);
+      case 298: /* dnode_list ::= dnode_list DNODE NK_INTEGER */ yytestcase(yyruleno==298);
 { yylhsminor.yy282 = addNodeToList(pCxt, yymsp[-2].minor.yy282, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
   yymsp[-2].minor.yy282 = yylhsminor.yy282;
         break;
@@ -3984,12 +3994,12 @@ static YYACTIONTYPE yy_reduce(
       case 194: /* rollup_func_list ::= rollup_func_name */ yytestcase(yyruleno==194);
       case 199: /* col_name_list ::= col_name */ yytestcase(yyruleno==199);
       case 249: /* func_list ::= func */ yytestcase(yyruleno==249);
-      case 323: /* literal_list ::= signed_literal */ yytestcase(yyruleno==323);
-      case 389: /* other_para_list ::= star_func_para */ yytestcase(yyruleno==389);
-      case 395: /* when_then_list ::= when_then_expr */ yytestcase(yyruleno==395);
-      case 450: /* select_list ::= select_item */ yytestcase(yyruleno==450);
-      case 461: /* partition_list ::= partition_item */ yytestcase(yyruleno==461);
-      case 513: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==513);
+      case 326: /* literal_list ::= signed_literal */ yytestcase(yyruleno==326);
+      case 392: /* other_para_list ::= star_func_para */ yytestcase(yyruleno==392);
+      case 398: /* when_then_list ::= when_then_expr */ yytestcase(yyruleno==398);
+      case 453: /* select_list ::= select_item */ yytestcase(yyruleno==453);
+      case 464: /* partition_list ::= partition_item */ yytestcase(yyruleno==464);
+      case 516: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==516);
 { yylhsminor.yy282 = createNodeList(pCxt, yymsp[0].minor.yy778); }
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
@@ -3998,11 +4008,11 @@ static YYACTIONTYPE yy_reduce(
       case 195: /* rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */ yytestcase(yyruleno==195);
       case 200: /* col_name_list ::= col_name_list NK_COMMA col_name */ yytestcase(yyruleno==200);
       case 250: /* func_list ::= func_list NK_COMMA func */ yytestcase(yyruleno==250);
-      case 324: /* literal_list ::= literal_list NK_COMMA signed_literal */ yytestcase(yyruleno==324);
-      case 390: /* other_para_list ::= other_para_list NK_COMMA star_func_para */ yytestcase(yyruleno==390);
-      case 451: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==451);
-      case 462: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==462);
-      case 514: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==514);
+      case 327: /* literal_list ::= literal_list NK_COMMA signed_literal */ yytestcase(yyruleno==327);
+      case 393: /* other_para_list ::= other_para_list NK_COMMA star_func_para */ yytestcase(yyruleno==393);
+      case 454: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==454);
+      case 465: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==465);
+      case 517: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==517);
 { yylhsminor.yy282 = addNodeToList(pCxt, yymsp[-2].minor.yy282, yymsp[0].minor.yy778); }
   yymsp[-2].minor.yy282 = yylhsminor.yy282;
         break;
@@ -4032,7 +4042,7 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createDropSuperTableStmt(pCxt, yymsp[-1].minor.yy39, yymsp[0].minor.yy778); }
         break;
       case 129: /* cmd ::= ALTER TABLE alter_table_clause */
-      case 297: /* cmd ::= query_or_subquery */ yytestcase(yyruleno==297);
+      case 300: /* cmd ::= query_or_subquery */ yytestcase(yyruleno==300);
 { pCxt->pRootNode = yymsp[0].minor.yy778; }
         break;
       case 130: /* cmd ::= ALTER STABLE alter_table_clause */
@@ -4080,7 +4090,7 @@ static YYACTIONTYPE yy_reduce(
         break;
       case 142: /* multi_create_clause ::= multi_create_clause create_subtable_clause */
       case 145: /* multi_drop_clause ::= multi_drop_clause drop_table_clause */ yytestcase(yyruleno==145);
-      case 396: /* when_then_list ::= when_then_list when_then_expr */ yytestcase(yyruleno==396);
+      case 399: /* when_then_list ::= when_then_list when_then_expr */ yytestcase(yyruleno==399);
 { yylhsminor.yy282 = addNodeToList(pCxt, yymsp[-1].minor.yy282, yymsp[0].minor.yy778); }
   yymsp[-1].minor.yy282 = yylhsminor.yy282;
         break;
@@ -4094,9 +4104,9 @@ static YYACTIONTYPE yy_reduce(
         break;
       case 147: /* specific_cols_opt ::= */
       case 178: /* tags_def_opt ::= */ yytestcase(yyruleno==178);
-      case 459: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==459);
-      case 481: /* group_by_clause_opt ::= */ yytestcase(yyruleno==481);
-      case 500: /* order_by_clause_opt ::= */ yytestcase(yyruleno==500);
+      case 462: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==462);
+      case 484: /* group_by_clause_opt ::= */ yytestcase(yyruleno==484);
+      case 503: /* order_by_clause_opt ::= */ yytestcase(yyruleno==503);
 { yymsp[1].minor.yy282 = NULL; }
         break;
       case 148: /* specific_cols_opt ::= NK_LP col_name_list NK_RP */
@@ -4186,7 +4196,7 @@ static YYACTIONTYPE yy_reduce(
 { yymsp[-5].minor.yy380 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
         break;
       case 179: /* tags_def_opt ::= tags_def */
-      case 388: /* star_func_para_list ::= other_para_list */ yytestcase(yyruleno==388);
+      case 391: /* star_func_para_list ::= other_para_list */ yytestcase(yyruleno==391);
 { yylhsminor.yy282 = yymsp[0].minor.yy282; }
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
@@ -4235,12 +4245,12 @@ static YYACTIONTYPE yy_reduce(
 { yymsp[-1].minor.yy645.type = TABLE_OPTION_TTL; yymsp[-1].minor.yy645.val = yymsp[0].minor.yy0; }
         break;
       case 192: /* duration_list ::= duration_literal */
-      case 353: /* expression_list ::= expr_or_subquery */ yytestcase(yyruleno==353);
+      case 356: /* expression_list ::= expr_or_subquery */ yytestcase(yyruleno==356);
 { yylhsminor.yy282 = createNodeList(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy778)); }
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
       case 193: /* duration_list ::= duration_list NK_COMMA duration_literal */
-      case 354: /* expression_list ::= expression_list NK_COMMA expr_or_subquery */ yytestcase(yyruleno==354);
+      case 357: /* expression_list ::= expression_list NK_COMMA expr_or_subquery */ yytestcase(yyruleno==357);
 { yylhsminor.yy282 = addNodeToList(pCxt, yymsp[-2].minor.yy282, releaseRawExprNode(pCxt, yymsp[0].minor.yy778)); }
   yymsp[-2].minor.yy282 = yylhsminor.yy282;
         break;
@@ -4373,17 +4383,17 @@ static YYACTIONTYPE yy_reduce(
         break;
       case 240: /* like_pattern_opt ::= */
       case 285: /* subtable_opt ::= */ yytestcase(yyruleno==285);
-      case 398: /* case_when_else_opt ::= */ yytestcase(yyruleno==398);
-      case 428: /* from_clause_opt ::= */ yytestcase(yyruleno==428);
-      case 457: /* where_clause_opt ::= */ yytestcase(yyruleno==457);
-      case 466: /* twindow_clause_opt ::= */ yytestcase(yyruleno==466);
-      case 471: /* sliding_opt ::= */ yytestcase(yyruleno==471);
-      case 473: /* fill_opt ::= */ yytestcase(yyruleno==473);
-      case 485: /* having_clause_opt ::= */ yytestcase(yyruleno==485);
-      case 487: /* range_opt ::= */ yytestcase(yyruleno==487);
-      case 489: /* every_opt ::= */ yytestcase(yyruleno==489);
-      case 502: /* slimit_clause_opt ::= */ yytestcase(yyruleno==502);
-      case 506: /* limit_clause_opt ::= */ yytestcase(yyruleno==506);
+      case 401: /* case_when_else_opt ::= */ yytestcase(yyruleno==401);
+      case 431: /* from_clause_opt ::= */ yytestcase(yyruleno==431);
+      case 460: /* where_clause_opt ::= */ yytestcase(yyruleno==460);
+      case 469: /* twindow_clause_opt ::= */ yytestcase(yyruleno==469);
+      case 474: /* sliding_opt ::= */ yytestcase(yyruleno==474);
+      case 476: /* fill_opt ::= */ yytestcase(yyruleno==476);
+      case 488: /* having_clause_opt ::= */ yytestcase(yyruleno==488);
+      case 490: /* range_opt ::= */ yytestcase(yyruleno==490);
+      case 492: /* every_opt ::= */ yytestcase(yyruleno==492);
+      case 505: /* slimit_clause_opt ::= */ yytestcase(yyruleno==505);
+      case 509: /* limit_clause_opt ::= */ yytestcase(yyruleno==509);
 { yymsp[1].minor.yy778 = NULL; }
         break;
       case 241: /* like_pattern_opt ::= LIKE NK_STRING */
@@ -4458,7 +4468,7 @@ static YYACTIONTYPE yy_reduce(
         break;
       case 267: /* analyze_opt ::= ANALYZE */
       case 274: /* agg_func_opt ::= AGGREGATE */ yytestcase(yyruleno==274);
-      case 448: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==448);
+      case 451: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==451);
 { yymsp[0].minor.yy39 = true; }
         break;
       case 268: /* explain_options ::= */
@@ -4501,8 +4511,8 @@ static YYACTIONTYPE yy_reduce(
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
       case 286: /* subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-      case 472: /* sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */ yytestcase(yyruleno==472);
-      case 490: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==490);
+      case 475: /* sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */ yytestcase(yyruleno==475);
+      case 493: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==493);
 { yymsp[-3].minor.yy778 = releaseRawExprNode(pCxt, yymsp[-1].minor.yy778); }
         break;
       case 287: /* cmd ::= KILL CONNECTION NK_INTEGER */
@@ -4515,94 +4525,103 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_TRANSACTION_STMT, &yymsp[0].minor.yy0); }
         break;
       case 290: /* cmd ::= BALANCE VGROUP */
-{ pCxt->pRootNode = createBalanceVgroupStmt(pCxt); }
+{ pCxt->pRootNode = createBalanceVgroupStmt(pCxt, false, NULL); }
+        break;
+      case 291: /* cmd ::= BALANCE VGROUP LIMIT NK_INTEGER */
+{ pCxt->pRootNode = createBalanceVgroupStmt(pCxt, false, &yymsp[0].minor.yy0); }
+        break;
+      case 292: /* cmd ::= EXPLAIN BALANCE VGROUP */
+{ pCxt->pRootNode = createBalanceVgroupStmt(pCxt, true, NULL); }
+        break;
+      case 293: /* cmd ::= EXPLAIN BALANCE VGROUP LIMIT NK_INTEGER */
+{ pCxt->pRootNode = createBalanceVgroupStmt(pCxt, true, &yymsp[0].minor.yy0); }
         break;
-      case 291: /* cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+      case 294: /* cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
 { pCxt->pRootNode = createMergeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
         break;
-      case 292: /* cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+      case 295: /* cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
 { pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy282); }
         break;
-      case 293: /* cmd ::= SPLIT VGROUP NK_INTEGER */
+      case 296: /* cmd ::= SPLIT VGROUP NK_INTEGER */
 { pCxt->pRootNode = createSplitVgroupStmt(pCxt, &yymsp[0].minor.yy0); }
         break;
-      case 294: /* dnode_list ::= DNODE NK_INTEGER */
+      case 297: /* dnode_list ::= DNODE NK_INTEGER */
 { yymsp[-1].minor.yy282 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
         break;
-      case 296: /* cmd ::= DELETE FROM full_table_name where_clause_opt */
+      case 299: /* cmd ::= DELETE FROM full_table_name where_clause_opt */
 { pCxt->pRootNode = createDeleteStmt(pCxt, yymsp[-1].minor.yy778, yymsp[0].minor.yy778); }
         break;
-      case 298: /* cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+      case 301: /* cmd ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
 { pCxt->pRootNode = createInsertStmt(pCxt, yymsp[-4].minor.yy778, yymsp[-2].minor.yy282, yymsp[0].minor.yy778); }
         break;
-      case 299: /* cmd ::= INSERT INTO full_table_name query_or_subquery */
+      case 302: /* cmd ::= INSERT INTO full_table_name query_or_subquery */
 { pCxt->pRootNode = createInsertStmt(pCxt, yymsp[-1].minor.yy778, NULL, yymsp[0].minor.yy778); }
         break;
-      case 300: /* literal ::= NK_INTEGER */
+      case 303: /* literal ::= NK_INTEGER */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 301: /* literal ::= NK_FLOAT */
+      case 304: /* literal ::= NK_FLOAT */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 302: /* literal ::= NK_STRING */
+      case 305: /* literal ::= NK_STRING */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 303: /* literal ::= NK_BOOL */
+      case 306: /* literal ::= NK_BOOL */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 304: /* literal ::= TIMESTAMP NK_STRING */
+      case 307: /* literal ::= TIMESTAMP NK_STRING */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0)); }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 305: /* literal ::= duration_literal */
-      case 315: /* signed_literal ::= signed */ yytestcase(yyruleno==315);
-      case 335: /* expr_or_subquery ::= expression */ yytestcase(yyruleno==335);
-      case 336: /* expr_or_subquery ::= subquery */ yytestcase(yyruleno==336);
-      case 337: /* expression ::= literal */ yytestcase(yyruleno==337);
-      case 338: /* expression ::= pseudo_column */ yytestcase(yyruleno==338);
-      case 339: /* expression ::= column_reference */ yytestcase(yyruleno==339);
-      case 340: /* expression ::= function_expression */ yytestcase(yyruleno==340);
-      case 341: /* expression ::= case_when_expression */ yytestcase(yyruleno==341);
-      case 371: /* function_expression ::= literal_func */ yytestcase(yyruleno==371);
-      case 420: /* boolean_value_expression ::= boolean_primary */ yytestcase(yyruleno==420);
-      case 424: /* boolean_primary ::= predicate */ yytestcase(yyruleno==424);
-      case 426: /* common_expression ::= expr_or_subquery */ yytestcase(yyruleno==426);
-      case 427: /* common_expression ::= boolean_value_expression */ yytestcase(yyruleno==427);
-      case 430: /* table_reference_list ::= table_reference */ yytestcase(yyruleno==430);
-      case 432: /* table_reference ::= table_primary */ yytestcase(yyruleno==432);
-      case 433: /* table_reference ::= joined_table */ yytestcase(yyruleno==433);
-      case 437: /* table_primary ::= parenthesized_joined_table */ yytestcase(yyruleno==437);
-      case 492: /* query_simple ::= query_specification */ yytestcase(yyruleno==492);
-      case 493: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==493);
-      case 496: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==496);
-      case 498: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==498);
+      case 308: /* literal ::= duration_literal */
+      case 318: /* signed_literal ::= signed */ yytestcase(yyruleno==318);
+      case 338: /* expr_or_subquery ::= expression */ yytestcase(yyruleno==338);
+      case 339: /* expr_or_subquery ::= subquery */ yytestcase(yyruleno==339);
+      case 340: /* expression ::= literal */ yytestcase(yyruleno==340);
+      case 341: /* expression ::= pseudo_column */ yytestcase(yyruleno==341);
+      case 342: /* expression ::= column_reference */ yytestcase(yyruleno==342);
+      case 343: /* expression ::= function_expression */ yytestcase(yyruleno==343);
+      case 344: /* expression ::= case_when_expression */ yytestcase(yyruleno==344);
+      case 374: /* function_expression ::= literal_func */ yytestcase(yyruleno==374);
+      case 423: /* boolean_value_expression ::= boolean_primary */ yytestcase(yyruleno==423);
+      case 427: /* boolean_primary ::= predicate */ yytestcase(yyruleno==427);
+      case 429: /* common_expression ::= expr_or_subquery */ yytestcase(yyruleno==429);
+      case 430: /* common_expression ::= boolean_value_expression */ yytestcase(yyruleno==430);
+      case 433: /* table_reference_list ::= table_reference */ yytestcase(yyruleno==433);
+      case 435: /* table_reference ::= table_primary */ yytestcase(yyruleno==435);
+      case 436: /* table_reference ::= joined_table */ yytestcase(yyruleno==436);
+      case 440: /* table_primary ::= parenthesized_joined_table */ yytestcase(yyruleno==440);
+      case 495: /* query_simple ::= query_specification */ yytestcase(yyruleno==495);
+      case 496: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==496);
+      case 499: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==499);
+      case 501: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==501);
 { yylhsminor.yy778 = yymsp[0].minor.yy778; }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 306: /* literal ::= NULL */
+      case 309: /* literal ::= NULL */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 307: /* literal ::= NK_QUESTION */
+      case 310: /* literal ::= NK_QUESTION */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 308: /* duration_literal ::= NK_VARIABLE */
+      case 311: /* duration_literal ::= NK_VARIABLE */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 309: /* signed ::= NK_INTEGER */
+      case 312: /* signed ::= NK_INTEGER */
 { yylhsminor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 310: /* signed ::= NK_PLUS NK_INTEGER */
+      case 313: /* signed ::= NK_PLUS NK_INTEGER */
 { yymsp[-1].minor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
         break;
-      case 311: /* signed ::= NK_MINUS NK_INTEGER */
+      case 314: /* signed ::= NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
@@ -4610,14 +4629,14 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 312: /* signed ::= NK_FLOAT */
+      case 315: /* signed ::= NK_FLOAT */
 { yylhsminor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 313: /* signed ::= NK_PLUS NK_FLOAT */
+      case 316: /* signed ::= NK_PLUS NK_FLOAT */
 { yymsp[-1].minor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
         break;
-      case 314: /* signed ::= NK_MINUS NK_FLOAT */
+      case 317: /* signed ::= NK_MINUS NK_FLOAT */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
@@ -4625,57 +4644,57 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 316: /* signed_literal ::= NK_STRING */
+      case 319: /* signed_literal ::= NK_STRING */
 { yylhsminor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 317: /* signed_literal ::= NK_BOOL */
+      case 320: /* signed_literal ::= NK_BOOL */
 { yylhsminor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 318: /* signed_literal ::= TIMESTAMP NK_STRING */
+      case 321: /* signed_literal ::= TIMESTAMP NK_STRING */
 { yymsp[-1].minor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
         break;
-      case 319: /* signed_literal ::= duration_literal */
-      case 321: /* signed_literal ::= literal_func */ yytestcase(yyruleno==321);
-      case 391: /* star_func_para ::= expr_or_subquery */ yytestcase(yyruleno==391);
-      case 453: /* select_item ::= common_expression */ yytestcase(yyruleno==453);
-      case 463: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==463);
-      case 497: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==497);
-      case 499: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==499);
-      case 512: /* search_condition ::= common_expression */ yytestcase(yyruleno==512);
+      case 322: /* signed_literal ::= duration_literal */
+      case 324: /* signed_literal ::= literal_func */ yytestcase(yyruleno==324);
+      case 394: /* star_func_para ::= expr_or_subquery */ yytestcase(yyruleno==394);
+      case 456: /* select_item ::= common_expression */ yytestcase(yyruleno==456);
+      case 466: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==466);
+      case 500: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==500);
+      case 502: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==502);
+      case 515: /* search_condition ::= common_expression */ yytestcase(yyruleno==515);
 { yylhsminor.yy778 = releaseRawExprNode(pCxt, yymsp[0].minor.yy778); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 320: /* signed_literal ::= NULL */
+      case 323: /* signed_literal ::= NULL */
 { yylhsminor.yy778 = createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 322: /* signed_literal ::= NK_QUESTION */
+      case 325: /* signed_literal ::= NK_QUESTION */
 { yylhsminor.yy778 = createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 342: /* expression ::= NK_LP expression NK_RP */
-      case 425: /* boolean_primary ::= NK_LP boolean_value_expression NK_RP */ yytestcase(yyruleno==425);
-      case 511: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==511);
+      case 345: /* expression ::= NK_LP expression NK_RP */
+      case 428: /* boolean_primary ::= NK_LP boolean_value_expression NK_RP */ yytestcase(yyruleno==428);
+      case 514: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==514);
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, releaseRawExprNode(pCxt, yymsp[-1].minor.yy778)); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 343: /* expression ::= NK_PLUS expr_or_subquery */
+      case 346: /* expression ::= NK_PLUS expr_or_subquery */
 {
                                                                                     SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, releaseRawExprNode(pCxt, yymsp[0].minor.yy778));
                                                                                   }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 344: /* expression ::= NK_MINUS expr_or_subquery */
+      case 347: /* expression ::= NK_MINUS expr_or_subquery */
 {
                                                                                     SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, createOperatorNode(pCxt, OP_TYPE_MINUS, releaseRawExprNode(pCxt, yymsp[0].minor.yy778), NULL));
                                                                                   }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 345: /* expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+      case 348: /* expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4683,7 +4702,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 346: /* expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+      case 349: /* expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4691,7 +4710,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 347: /* expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+      case 350: /* expression ::= expr_or_subquery NK_STAR expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4699,7 +4718,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 348: /* expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+      case 351: /* expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4707,7 +4726,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 349: /* expression ::= expr_or_subquery NK_REM expr_or_subquery */
+      case 352: /* expression ::= expr_or_subquery NK_REM expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4715,14 +4734,14 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 350: /* expression ::= column_reference NK_ARROW NK_STRING */
+      case 353: /* expression ::= column_reference NK_ARROW NK_STRING */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_JSON_GET_VALUE, releaseRawExprNode(pCxt, yymsp[-2].minor.yy778), createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0))); 
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 351: /* expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+      case 354: /* expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4730,7 +4749,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 352: /* expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+      case 355: /* expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4738,70 +4757,70 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 355: /* column_reference ::= column_name */
+      case 358: /* column_reference ::= column_name */
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy181, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy181)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 356: /* column_reference ::= table_name NK_DOT column_name */
+      case 359: /* column_reference ::= table_name NK_DOT column_name */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy181, &yymsp[0].minor.yy181, createColumnNode(pCxt, &yymsp[-2].minor.yy181, &yymsp[0].minor.yy181)); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 357: /* pseudo_column ::= ROWTS */
-      case 358: /* pseudo_column ::= TBNAME */ yytestcase(yyruleno==358);
-      case 360: /* pseudo_column ::= QSTART */ yytestcase(yyruleno==360);
-      case 361: /* pseudo_column ::= QEND */ yytestcase(yyruleno==361);
-      case 362: /* pseudo_column ::= QDURATION */ yytestcase(yyruleno==362);
-      case 363: /* pseudo_column ::= WSTART */ yytestcase(yyruleno==363);
-      case 364: /* pseudo_column ::= WEND */ yytestcase(yyruleno==364);
-      case 365: /* pseudo_column ::= WDURATION */ yytestcase(yyruleno==365);
-      case 366: /* pseudo_column ::= IROWTS */ yytestcase(yyruleno==366);
-      case 367: /* pseudo_column ::= QTAGS */ yytestcase(yyruleno==367);
-      case 373: /* literal_func ::= NOW */ yytestcase(yyruleno==373);
+      case 360: /* pseudo_column ::= ROWTS */
+      case 361: /* pseudo_column ::= TBNAME */ yytestcase(yyruleno==361);
+      case 363: /* pseudo_column ::= QSTART */ yytestcase(yyruleno==363);
+      case 364: /* pseudo_column ::= QEND */ yytestcase(yyruleno==364);
+      case 365: /* pseudo_column ::= QDURATION */ yytestcase(yyruleno==365);
+      case 366: /* pseudo_column ::= WSTART */ yytestcase(yyruleno==366);
+      case 367: /* pseudo_column ::= WEND */ yytestcase(yyruleno==367);
+      case 368: /* pseudo_column ::= WDURATION */ yytestcase(yyruleno==368);
+      case 369: /* pseudo_column ::= IROWTS */ yytestcase(yyruleno==369);
+      case 370: /* pseudo_column ::= QTAGS */ yytestcase(yyruleno==370);
+      case 376: /* literal_func ::= NOW */ yytestcase(yyruleno==376);
 { yylhsminor.yy778 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL)); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 359: /* pseudo_column ::= table_name NK_DOT TBNAME */
+      case 362: /* pseudo_column ::= table_name NK_DOT TBNAME */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy181, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[-2].minor.yy181)))); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 368: /* function_expression ::= function_name NK_LP expression_list NK_RP */
-      case 369: /* function_expression ::= star_func NK_LP star_func_para_list NK_RP */ yytestcase(yyruleno==369);
+      case 371: /* function_expression ::= function_name NK_LP expression_list NK_RP */
+      case 372: /* function_expression ::= star_func NK_LP star_func_para_list NK_RP */ yytestcase(yyruleno==372);
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy181, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-3].minor.yy181, yymsp[-1].minor.yy282)); }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 370: /* function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+      case 373: /* function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-5].minor.yy0, &yymsp[0].minor.yy0, createCastFunctionNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), yymsp[-1].minor.yy380)); }
   yymsp[-5].minor.yy778 = yylhsminor.yy778;
         break;
-      case 372: /* literal_func ::= noarg_func NK_LP NK_RP */
+      case 375: /* literal_func ::= noarg_func NK_LP NK_RP */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy181, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-2].minor.yy181, NULL)); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 387: /* star_func_para_list ::= NK_STAR */
+      case 390: /* star_func_para_list ::= NK_STAR */
 { yylhsminor.yy282 = createNodeList(pCxt, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
-      case 392: /* star_func_para ::= table_name NK_DOT NK_STAR */
-      case 456: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==456);
+      case 395: /* star_func_para ::= table_name NK_DOT NK_STAR */
+      case 459: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==459);
 { yylhsminor.yy778 = createColumnNode(pCxt, &yymsp[-2].minor.yy181, &yymsp[0].minor.yy0); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 393: /* case_when_expression ::= CASE when_then_list case_when_else_opt END */
+      case 396: /* case_when_expression ::= CASE when_then_list case_when_else_opt END */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, NULL, yymsp[-2].minor.yy282, yymsp[-1].minor.yy778)); }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 394: /* case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+      case 397: /* case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-4].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), yymsp[-2].minor.yy282, yymsp[-1].minor.yy778)); }
   yymsp[-4].minor.yy778 = yylhsminor.yy778;
         break;
-      case 397: /* when_then_expr ::= WHEN common_expression THEN common_expression */
+      case 400: /* when_then_expr ::= WHEN common_expression THEN common_expression */
 { yymsp[-3].minor.yy778 = createWhenThenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy778), releaseRawExprNode(pCxt, yymsp[0].minor.yy778)); }
         break;
-      case 399: /* case_when_else_opt ::= ELSE common_expression */
+      case 402: /* case_when_else_opt ::= ELSE common_expression */
 { yymsp[-1].minor.yy778 = releaseRawExprNode(pCxt, yymsp[0].minor.yy778); }
         break;
-      case 400: /* predicate ::= expr_or_subquery compare_op expr_or_subquery */
-      case 405: /* predicate ::= expr_or_subquery in_op in_predicate_value */ yytestcase(yyruleno==405);
+      case 403: /* predicate ::= expr_or_subquery compare_op expr_or_subquery */
+      case 408: /* predicate ::= expr_or_subquery in_op in_predicate_value */ yytestcase(yyruleno==408);
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4809,7 +4828,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 401: /* predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+      case 404: /* predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-4].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4817,7 +4836,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-4].minor.yy778 = yylhsminor.yy778;
         break;
-      case 402: /* predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+      case 405: /* predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-5].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4825,71 +4844,71 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-5].minor.yy778 = yylhsminor.yy778;
         break;
-      case 403: /* predicate ::= expr_or_subquery IS NULL */
+      case 406: /* predicate ::= expr_or_subquery IS NULL */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NULL, releaseRawExprNode(pCxt, yymsp[-2].minor.yy778), NULL));
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 404: /* predicate ::= expr_or_subquery IS NOT NULL */
+      case 407: /* predicate ::= expr_or_subquery IS NOT NULL */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-3].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NOT_NULL, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), NULL));
                                                                                   }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 406: /* compare_op ::= NK_LT */
+      case 409: /* compare_op ::= NK_LT */
 { yymsp[0].minor.yy682 = OP_TYPE_LOWER_THAN; }
         break;
-      case 407: /* compare_op ::= NK_GT */
+      case 410: /* compare_op ::= NK_GT */
 { yymsp[0].minor.yy682 = OP_TYPE_GREATER_THAN; }
         break;
-      case 408: /* compare_op ::= NK_LE */
+      case 411: /* compare_op ::= NK_LE */
 { yymsp[0].minor.yy682 = OP_TYPE_LOWER_EQUAL; }
         break;
-      case 409: /* compare_op ::= NK_GE */
+      case 412: /* compare_op ::= NK_GE */
 { yymsp[0].minor.yy682 = OP_TYPE_GREATER_EQUAL; }
         break;
-      case 410: /* compare_op ::= NK_NE */
+      case 413: /* compare_op ::= NK_NE */
 { yymsp[0].minor.yy682 = OP_TYPE_NOT_EQUAL; }
         break;
-      case 411: /* compare_op ::= NK_EQ */
+      case 414: /* compare_op ::= NK_EQ */
 { yymsp[0].minor.yy682 = OP_TYPE_EQUAL; }
         break;
-      case 412: /* compare_op ::= LIKE */
+      case 415: /* compare_op ::= LIKE */
 { yymsp[0].minor.yy682 = OP_TYPE_LIKE; }
         break;
-      case 413: /* compare_op ::= NOT LIKE */
+      case 416: /* compare_op ::= NOT LIKE */
 { yymsp[-1].minor.yy682 = OP_TYPE_NOT_LIKE; }
         break;
-      case 414: /* compare_op ::= MATCH */
+      case 417: /* compare_op ::= MATCH */
 { yymsp[0].minor.yy682 = OP_TYPE_MATCH; }
         break;
-      case 415: /* compare_op ::= NMATCH */
+      case 418: /* compare_op ::= NMATCH */
 { yymsp[0].minor.yy682 = OP_TYPE_NMATCH; }
         break;
-      case 416: /* compare_op ::= CONTAINS */
+      case 419: /* compare_op ::= CONTAINS */
 { yymsp[0].minor.yy682 = OP_TYPE_JSON_CONTAINS; }
         break;
-      case 417: /* in_op ::= IN */
+      case 420: /* in_op ::= IN */
 { yymsp[0].minor.yy682 = OP_TYPE_IN; }
         break;
-      case 418: /* in_op ::= NOT IN */
+      case 421: /* in_op ::= NOT IN */
 { yymsp[-1].minor.yy682 = OP_TYPE_NOT_IN; }
         break;
-      case 419: /* in_predicate_value ::= NK_LP literal_list NK_RP */
+      case 422: /* in_predicate_value ::= NK_LP literal_list NK_RP */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, createNodeListNode(pCxt, yymsp[-1].minor.yy282)); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 421: /* boolean_value_expression ::= NOT boolean_primary */
+      case 424: /* boolean_value_expression ::= NOT boolean_primary */
 {
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
                                                                                     yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_NOT, releaseRawExprNode(pCxt, yymsp[0].minor.yy778), NULL));
                                                                                   }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 422: /* boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+      case 425: /* boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4897,7 +4916,7 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 423: /* boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+      case 426: /* boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
 {
                                                                                     SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy778);
                                                                                     SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy778);
@@ -4905,52 +4924,52 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 429: /* from_clause_opt ::= FROM table_reference_list */
-      case 458: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==458);
-      case 486: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==486);
+      case 432: /* from_clause_opt ::= FROM table_reference_list */
+      case 461: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==461);
+      case 489: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==489);
 { yymsp[-1].minor.yy778 = yymsp[0].minor.yy778; }
         break;
-      case 431: /* table_reference_list ::= table_reference_list NK_COMMA table_reference */
+      case 434: /* table_reference_list ::= table_reference_list NK_COMMA table_reference */
 { yylhsminor.yy778 = createJoinTableNode(pCxt, JOIN_TYPE_INNER, yymsp[-2].minor.yy778, yymsp[0].minor.yy778, NULL); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 434: /* table_primary ::= table_name alias_opt */
+      case 437: /* table_primary ::= table_name alias_opt */
 { yylhsminor.yy778 = createRealTableNode(pCxt, NULL, &yymsp[-1].minor.yy181, &yymsp[0].minor.yy181); }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 435: /* table_primary ::= db_name NK_DOT table_name alias_opt */
+      case 438: /* table_primary ::= db_name NK_DOT table_name alias_opt */
 { yylhsminor.yy778 = createRealTableNode(pCxt, &yymsp[-3].minor.yy181, &yymsp[-1].minor.yy181, &yymsp[0].minor.yy181); }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 436: /* table_primary ::= subquery alias_opt */
+      case 439: /* table_primary ::= subquery alias_opt */
 { yylhsminor.yy778 = createTempTableNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy778), &yymsp[0].minor.yy181); }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 438: /* alias_opt ::= */
+      case 441: /* alias_opt ::= */
 { yymsp[1].minor.yy181 = nil_token;  }
         break;
-      case 439: /* alias_opt ::= table_alias */
+      case 442: /* alias_opt ::= table_alias */
 { yylhsminor.yy181 = yymsp[0].minor.yy181; }
   yymsp[0].minor.yy181 = yylhsminor.yy181;
         break;
-      case 440: /* alias_opt ::= AS table_alias */
+      case 443: /* alias_opt ::= AS table_alias */
 { yymsp[-1].minor.yy181 = yymsp[0].minor.yy181; }
         break;
-      case 441: /* parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-      case 442: /* parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */ yytestcase(yyruleno==442);
+      case 444: /* parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+      case 445: /* parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */ yytestcase(yyruleno==445);
 { yymsp[-2].minor.yy778 = yymsp[-1].minor.yy778; }
         break;
-      case 443: /* joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+      case 446: /* joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
 { yylhsminor.yy778 = createJoinTableNode(pCxt, yymsp[-4].minor.yy202, yymsp[-5].minor.yy778, yymsp[-2].minor.yy778, yymsp[0].minor.yy778); }
   yymsp[-5].minor.yy778 = yylhsminor.yy778;
         break;
-      case 444: /* join_type ::= */
+      case 447: /* join_type ::= */
 { yymsp[1].minor.yy202 = JOIN_TYPE_INNER; }
         break;
-      case 445: /* join_type ::= INNER */
+      case 448: /* join_type ::= INNER */
 { yymsp[0].minor.yy202 = JOIN_TYPE_INNER; }
         break;
-      case 446: /* query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+      case 449: /* query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
 { 
                                                                                     yymsp[-11].minor.yy778 = createSelectStmt(pCxt, yymsp[-10].minor.yy39, yymsp[-9].minor.yy282, yymsp[-8].minor.yy778);
                                                                                     yymsp[-11].minor.yy778 = addWhereClause(pCxt, yymsp[-11].minor.yy778, yymsp[-7].minor.yy778);
@@ -4963,73 +4982,73 @@ static YYACTIONTYPE yy_reduce(
                                                                                     yymsp[-11].minor.yy778 = addFillClause(pCxt, yymsp[-11].minor.yy778, yymsp[-3].minor.yy778);
                                                                                   }
         break;
-      case 449: /* set_quantifier_opt ::= ALL */
+      case 452: /* set_quantifier_opt ::= ALL */
 { yymsp[0].minor.yy39 = false; }
         break;
-      case 452: /* select_item ::= NK_STAR */
+      case 455: /* select_item ::= NK_STAR */
 { yylhsminor.yy778 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0); }
   yymsp[0].minor.yy778 = yylhsminor.yy778;
         break;
-      case 454: /* select_item ::= common_expression column_alias */
-      case 464: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==464);
+      case 457: /* select_item ::= common_expression column_alias */
+      case 467: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==467);
 { yylhsminor.yy778 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy778), &yymsp[0].minor.yy181); }
   yymsp[-1].minor.yy778 = yylhsminor.yy778;
         break;
-      case 455: /* select_item ::= common_expression AS column_alias */
-      case 465: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==465);
+      case 458: /* select_item ::= common_expression AS column_alias */
+      case 468: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==468);
 { yylhsminor.yy778 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy778), &yymsp[0].minor.yy181); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 460: /* partition_by_clause_opt ::= PARTITION BY partition_list */
-      case 482: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==482);
-      case 501: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==501);
+      case 463: /* partition_by_clause_opt ::= PARTITION BY partition_list */
+      case 485: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==485);
+      case 504: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==504);
 { yymsp[-2].minor.yy282 = yymsp[0].minor.yy282; }
         break;
-      case 467: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
+      case 470: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
 { yymsp[-5].minor.yy778 = createSessionWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), releaseRawExprNode(pCxt, yymsp[-1].minor.yy778)); }
         break;
-      case 468: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+      case 471: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
 { yymsp[-3].minor.yy778 = createStateWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy778)); }
         break;
-      case 469: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
+      case 472: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
 { yymsp[-5].minor.yy778 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), NULL, yymsp[-1].minor.yy778, yymsp[0].minor.yy778); }
         break;
-      case 470: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
+      case 473: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
 { yymsp[-7].minor.yy778 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy778), releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), yymsp[-1].minor.yy778, yymsp[0].minor.yy778); }
         break;
-      case 474: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
+      case 477: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
 { yymsp[-3].minor.yy778 = createFillNode(pCxt, yymsp[-1].minor.yy381, NULL); }
         break;
-      case 475: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP */
+      case 478: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA literal_list NK_RP */
 { yymsp[-5].minor.yy778 = createFillNode(pCxt, FILL_MODE_VALUE, createNodeListNode(pCxt, yymsp[-1].minor.yy282)); }
         break;
-      case 476: /* fill_mode ::= NONE */
+      case 479: /* fill_mode ::= NONE */
 { yymsp[0].minor.yy381 = FILL_MODE_NONE; }
         break;
-      case 477: /* fill_mode ::= PREV */
+      case 480: /* fill_mode ::= PREV */
 { yymsp[0].minor.yy381 = FILL_MODE_PREV; }
         break;
-      case 478: /* fill_mode ::= NULL */
+      case 481: /* fill_mode ::= NULL */
 { yymsp[0].minor.yy381 = FILL_MODE_NULL; }
         break;
-      case 479: /* fill_mode ::= LINEAR */
+      case 482: /* fill_mode ::= LINEAR */
 { yymsp[0].minor.yy381 = FILL_MODE_LINEAR; }
         break;
-      case 480: /* fill_mode ::= NEXT */
+      case 483: /* fill_mode ::= NEXT */
 { yymsp[0].minor.yy381 = FILL_MODE_NEXT; }
         break;
-      case 483: /* group_by_list ::= expr_or_subquery */
+      case 486: /* group_by_list ::= expr_or_subquery */
 { yylhsminor.yy282 = createNodeList(pCxt, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy778))); }
   yymsp[0].minor.yy282 = yylhsminor.yy282;
         break;
-      case 484: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+      case 487: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
 { yylhsminor.yy282 = addNodeToList(pCxt, yymsp[-2].minor.yy282, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy778))); }
   yymsp[-2].minor.yy282 = yylhsminor.yy282;
         break;
-      case 488: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+      case 491: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
 { yymsp[-5].minor.yy778 = createInterpTimeRange(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy778), releaseRawExprNode(pCxt, yymsp[-1].minor.yy778)); }
         break;
-      case 491: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+      case 494: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
 {
                                                                                     yylhsminor.yy778 = addOrderByClause(pCxt, yymsp[-3].minor.yy778, yymsp[-2].minor.yy282);
                                                                                     yylhsminor.yy778 = addSlimitClause(pCxt, yylhsminor.yy778, yymsp[-1].minor.yy778);
@@ -5037,50 +5056,50 @@ static YYACTIONTYPE yy_reduce(
                                                                                   }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 494: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+      case 497: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
 { yylhsminor.yy778 = createSetOperator(pCxt, SET_OP_TYPE_UNION_ALL, yymsp[-3].minor.yy778, yymsp[0].minor.yy778); }
   yymsp[-3].minor.yy778 = yylhsminor.yy778;
         break;
-      case 495: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+      case 498: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
 { yylhsminor.yy778 = createSetOperator(pCxt, SET_OP_TYPE_UNION, yymsp[-2].minor.yy778, yymsp[0].minor.yy778); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 503: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
-      case 507: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==507);
+      case 506: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
+      case 510: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==510);
 { yymsp[-1].minor.yy778 = createLimitNode(pCxt, &yymsp[0].minor.yy0, NULL); }
         break;
-      case 504: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-      case 508: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==508);
+      case 507: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+      case 511: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==511);
 { yymsp[-3].minor.yy778 = createLimitNode(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0); }
         break;
-      case 505: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-      case 509: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==509);
+      case 508: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+      case 512: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==512);
 { yymsp[-3].minor.yy778 = createLimitNode(pCxt, &yymsp[0].minor.yy0, &yymsp[-2].minor.yy0); }
         break;
-      case 510: /* subquery ::= NK_LP query_expression NK_RP */
+      case 513: /* subquery ::= NK_LP query_expression NK_RP */
 { yylhsminor.yy778 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, yymsp[-1].minor.yy778); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 515: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+      case 518: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
 { yylhsminor.yy778 = createOrderByExprNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy778), yymsp[-1].minor.yy14, yymsp[0].minor.yy305); }
   yymsp[-2].minor.yy778 = yylhsminor.yy778;
         break;
-      case 516: /* ordering_specification_opt ::= */
+      case 519: /* ordering_specification_opt ::= */
 { yymsp[1].minor.yy14 = ORDER_ASC; }
         break;
-      case 517: /* ordering_specification_opt ::= ASC */
+      case 520: /* ordering_specification_opt ::= ASC */
 { yymsp[0].minor.yy14 = ORDER_ASC; }
         break;
-      case 518: /* ordering_specification_opt ::= DESC */
+      case 521: /* ordering_specification_opt ::= DESC */
 { yymsp[0].minor.yy14 = ORDER_DESC; }
         break;
-      case 519: /* null_ordering_opt ::= */
+      case 522: /* null_ordering_opt ::= */
 { yymsp[1].minor.yy305 = NULL_ORDER_DEFAULT; }
         break;
-      case 520: /* null_ordering_opt ::= NULLS FIRST */
+      case 523: /* null_ordering_opt ::= NULLS FIRST */
 { yymsp[-1].minor.yy305 = NULL_ORDER_FIRST; }
         break;
-      case 521: /* null_ordering_opt ::= NULLS LAST */
+      case 524: /* null_ordering_opt ::= NULLS LAST */
 { yymsp[-1].minor.yy305 = NULL_ORDER_LAST; }
         break;
       default:
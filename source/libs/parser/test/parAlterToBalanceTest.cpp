@@ -649,14 +649,34 @@ TEST_F(ParserInitialATest, alterUser) {
 TEST_F(ParserInitialATest, balanceVgroup) {
   useDb("root", "test");
 
+  SBalanceVgroupReq expect = {0};
+
+  auto setBalanceVgroupReq = [&](int8_t dryRun, int32_t maxMoves) {
+    expect.dryRun = dryRun;
+    expect.maxMoves = maxMoves;
+  };
+
   setCheckDdlFunc([&](const SQuery* pQuery, ParserStage stage) {
     ASSERT_EQ(nodeType(pQuery->pRoot), QUERY_NODE_BALANCE_VGROUP_STMT);
     ASSERT_EQ(pQuery->pCmdMsg->msgType, TDMT_MND_BALANCE_VGROUP);
+    ASSERT_EQ(pQuery->haveResultSet, (bool)expect.dryRun);
     SBalanceVgroupReq req = {0};
     ASSERT_EQ(tDeserializeSBalanceVgroupReq(pQuery->pCmdMsg->pMsg, pQuery->pCmdMsg->msgLen, &req), TSDB_CODE_SUCCESS);
+    ASSERT_EQ(req.dryRun, expect.dryRun);
+    ASSERT_EQ(req.maxMoves, expect.maxMoves);
   });
 
+  setBalanceVgroupReq(0, 0);
   run("BALANCE VGROUP");
+
+  setBalanceVgroupReq(0, 3);
+  run("BALANCE VGROUP LIMIT 3");
+
+  setBalanceVgroupReq(1, 0);
+  run("EXPLAIN BALANCE VGROUP");
+
+  setBalanceVgroupReq(1, 5);
+  run("EXPLAIN BALANCE VGROUP LIMIT 5");
 }
 
 }  // namespace ParserTest
\ No newline at end of file
@@ -209,6 +209,10 @@ static int32_t scanPathOptGetRelatedFuncs(SScanLogicNode* pScan, SNodeList** pSd
   FOREACH(pNode, pAllFuncs) {
     SFunctionNode* pFunc = (SFunctionNode*)pNode;
     int32_t        code = TSDB_CODE_SUCCESS;
+    if (fmIsWindowPseudoColumnFunc(pFunc->funcId)) {
+      // _wstart, _wend and _wduration are computed from the window itself
+      continue;
+    }
     if (scanPathOptNeedOptimizeDataRequire(pFunc)) {
       code = nodesListMakeStrictAppend(&pTmpSdrFuncs, nodesCloneNode(pNode));
     } else if (scanPathOptNeedDynOptimize(pFunc)) {
@@ -352,6 +356,10 @@ static int32_t scanPathOptimize(SOptimizeContext* pCxt, SLogicSubplan* pLogicSub
   }
   if (TSDB_CODE_SUCCESS == code && (NULL != info.pDsoFuncs || NULL != info.pSdrFuncs)) {
     info.pScan->dataRequired = scanPathOptGetDataRequired(info.pSdrFuncs);
+    // the partition operator needs the rows to calculate the partition keys
+    if (QUERY_NODE_LOGIC_PLAN_PARTITION == nodeType(info.pScan->node.pParent)) {
+      info.pScan->dataRequired = FUNC_DATA_REQUIRED_DATA_LOAD;
+    }
     info.pScan->pDynamicScanFuncs = info.pDsoFuncs;
   }
   if (TSDB_CODE_SUCCESS == code && info.pScan) {
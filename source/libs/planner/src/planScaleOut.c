@@ -64,19 +64,58 @@ static int32_t setScanVgroup(SLogicNode* pNode, const SVgroupInfo* pVgroup) {
   return doSetScanVgroup(pNode, pVgroup, &found);
 }
 
-static int32_t scaleOutByVgroups(SScaleOutContext* pCxt, SLogicSubplan* pSubplan, int32_t level, SNodeList* pGroup) {
+static int32_t findScanNodes(SLogicNode* pNode, SScanLogicNode** ppScan) {
+  if (QUERY_NODE_LOGIC_PLAN_SCAN == nodeType(pNode)) {
+    *ppScan = (SScanLogicNode*)pNode;
+    return 1;
+  }
+  int32_t num = 0;
+  SNode*  pChild = NULL;
+  FOREACH(pChild, pNode->pChildren) { num += findScanNodes((SLogicNode*)pChild, ppScan); }
+  return num;
+}
+
+static void setScanSlice(SLogicNode* pNode, int32_t numOfSlices, int32_t sliceIdx) {
+  SScanLogicNode* pScan = NULL;
+  if (1 == findScanNodes(pNode, &pScan)) {
+    pScan->numOfSlices = numOfSlices;
+    pScan->sliceIdx = sliceIdx;
+  }
+}
+
+static int32_t getScanSlices(SScaleOutContext* pCxt, SLogicSubplan* pSubplan, int32_t level) {
+  // the slices of a vnode must be merged by the parent subplan
+  if (0 == level || pCxt->pPlanCxt->scanParallelism <= 1) {
+    return 1;
+  }
+  // slicing the tables of a join would lose the rows matched across slices
+  SScanLogicNode* pScan = NULL;
+  if (1 != findScanNodes(pSubplan->pNode, &pScan) || SCAN_TYPE_TABLE != pScan->scanType ||
+      TSDB_SUPER_TABLE != pScan->tableType) {
+    return 1;
+  }
+  return pCxt->pPlanCxt->scanParallelism;
+}
+
+static int32_t scaleOutByVgroups(SScaleOutContext* pCxt, SLogicSubplan* pSubplan, int32_t level, SNodeList* pGroup,
+                                 int32_t numOfSlices) {
   int32_t code = TSDB_CODE_SUCCESS;
   for (int32_t i = 0; i < pSubplan->pVgroupList->numOfVgroups; ++i) {
-    SLogicSubplan* pNewSubplan = singleCloneSubLogicPlan(pCxt, pSubplan, level);
-    if (NULL == pNewSubplan) {
-      return TSDB_CODE_OUT_OF_MEMORY;
-    }
-    code = setScanVgroup(pNewSubplan->pNode, pSubplan->pVgroupList->vgroups + i);
-    if (TSDB_CODE_SUCCESS == code) {
-      code = nodesListStrictAppend(pGroup, (SNode*)pNewSubplan);
-    }
-    if (TSDB_CODE_SUCCESS != code) {
-      break;
+    for (int32_t j = 0; j < numOfSlices; ++j) {
+      SLogicSubplan* pNewSubplan = singleCloneSubLogicPlan(pCxt, pSubplan, level);
+      if (NULL == pNewSubplan) {
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+      code = setScanVgroup(pNewSubplan->pNode, pSubplan->pVgroupList->vgroups + i);
+      if (TSDB_CODE_SUCCESS == code && numOfSlices > 1) {
+        setScanSlice(pNewSubplan->pNode, numOfSlices, j);
+      }
+      if (TSDB_CODE_SUCCESS == code) {
+        code = nodesListStrictAppend(pGroup, (SNode*)pNewSubplan);
+      }
+      if (TSDB_CODE_SUCCESS != code) {
+        return code;
+      }
     }
   }
   return code;
@@ -114,14 +153,14 @@ static int32_t scaleOutForInsert(SScaleOutContext* pCxt, SLogicSubplan* pSubplan
 static int32_t scaleOutForModify(SScaleOutContext* pCxt, SLogicSubplan* pSubplan, int32_t level, SNodeList* pGroup) {
   SVnodeModifyLogicNode* pNode = (SVnodeModifyLogicNode*)pSubplan->pNode;
   if (MODIFY_TABLE_TYPE_DELETE == pNode->modifyType) {
-    return scaleOutByVgroups(pCxt, pSubplan, level, pGroup);
+    return scaleOutByVgroups(pCxt, pSubplan, level, pGroup, 1);
   }
   return scaleOutForInsert(pCxt, pSubplan, level, pGroup);
 }
 
 static int32_t scaleOutForScan(SScaleOutContext* pCxt, SLogicSubplan* pSubplan, int32_t level, SNodeList* pGroup) {
   if (pSubplan->pVgroupList && !pCxt->pPlanCxt->streamQuery) {
-    return scaleOutByVgroups(pCxt, pSubplan, level, pGroup);
+    return scaleOutByVgroups(pCxt, pSubplan, level, pGroup, getScanSlices(pCxt, pSubplan, level));
   } else {
     return scaleOutForMerge(pCxt, pSubplan, level, pGroup);
   }
@@ -37,6 +37,12 @@ TEST_F(PlanOptimizeTest, scanPath) {
       "FILL(LINEAR)");
 
   run("SELECT COUNT(TBNAME) FROM t1");
+
+  run("SELECT _WSTART, _WEND, _WDURATION, COUNT(*), SUM(c1) FROM t1 INTERVAL(10s)");
+
+  run("SELECT _WSTART, COUNT(*), MAX(c1) FROM t1 INTERVAL(10s) SLIDING(4s)");
+
+  run("SELECT _WSTART, COUNT(*), MAX(c1) FROM st1 PARTITION BY TBNAME INTERVAL(10s)");
 }
 
 TEST_F(PlanOptimizeTest, pushDownCondition) {
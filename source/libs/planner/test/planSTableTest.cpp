@@ -14,10 +14,121 @@
  */
 
 #include "planTestUtil.h"
+#include "tglobal.h"
+
+#include <regex>
+#include <set>
 
 using namespace std;
 
-class PlanSuperTableTest : public PlannerTestBase {};
+class PlanSuperTableTest : public PlannerTestBase {
+ protected:
+  struct SSubplanDesc {
+    int32_t level;
+    int32_t vgId;
+    int32_t numOfSlices;
+    int32_t sliceIdx;
+    string  plan;  // without the slice of the scan, so the slices of a vgroup are alike
+  };
+
+  // data block ids are numbered per plan and generated aliases hash pointers, neither changes what a subplan computes
+  static string normalizePlan(const string& plan) {
+    static const regex blockId("\"DataBlockId\":\"[0-9]+\"");
+    static const regex alias("0x[0-9a-f]+");
+    return regex_replace(regex_replace(plan, blockId, "\"DataBlockId\":\"\""), alias, "0x");
+  }
+
+  static SScanPhysiNode* findTableScan(SNode* pNode) {
+    if (QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN == nodeType(pNode) ||
+        QUERY_NODE_PHYSICAL_PLAN_TABLE_MERGE_SCAN == nodeType(pNode)) {
+      return (SScanPhysiNode*)pNode;
+    }
+    SNode* pChild = NULL;
+    FOREACH(pChild, ((SPhysiNode*)pNode)->pChildren) {
+      SScanPhysiNode* pScan = findTableScan(pChild);
+      if (NULL != pScan) {
+        return pScan;
+      }
+    }
+    return NULL;
+  }
+
+  vector<SSubplanDesc> getSubplans(const string& sql, int32_t parallelism) {
+    tsQueryScanParallelism = parallelism;
+    run(sql);
+    tsQueryScanParallelism = 1;
+
+    vector<SSubplanDesc> subplans;
+    for (const auto& str : getPhysiSubplans()) {
+      SSubplan* pSubplan = NULL;
+      EXPECT_EQ(nodesStringToNode(str.c_str(), (SNode**)&pSubplan), TSDB_CODE_SUCCESS);
+      if (NULL == pSubplan) {
+        break;
+      }
+
+      SSubplanDesc desc = {pSubplan->level, pSubplan->execNode.nodeId, 0, 0};
+      SScanPhysiNode* pScan = findTableScan((SNode*)pSubplan->pNode);
+      if (NULL != pScan) {
+        desc.numOfSlices = pScan->numOfSlices;
+        desc.sliceIdx = pScan->sliceIdx;
+        pScan->numOfSlices = 0;
+        pScan->sliceIdx = 0;
+      }
+
+      char*   pStr = NULL;
+      int32_t len = 0;
+      EXPECT_EQ(nodesNodeToString((SNode*)pSubplan->pNode, false, &pStr, &len), TSDB_CODE_SUCCESS);
+      desc.plan = normalizePlan(pStr);
+      taosMemoryFree(pStr);
+      nodesDestroyNode((SNode*)pSubplan);
+      subplans.push_back(desc);
+    }
+    return subplans;
+  }
+
+  // each scan subplan of a vgroup is replaced by its slices, which are the same plan on a subset of the tables, and
+  // the subplans which merge them are unchanged, so the sliced query returns what the serial one does
+  void checkParallelScan(const string& sql, int32_t parallelism) {
+    vector<SSubplanDesc> serial = getSubplans(sql, 1);
+    vector<SSubplanDesc> sliced = getSubplans(sql, parallelism);
+
+    int32_t numOfScans = 0;
+    for (const auto& desc : serial) {
+      if (0 == desc.level) {
+        continue;
+      }
+      ++numOfScans;
+      ASSERT_EQ(desc.numOfSlices, 0) << sql;
+
+      set<int32_t> slices;
+      for (const auto& slice : sliced) {
+        if (slice.level == desc.level && slice.vgId == desc.vgId) {
+          ASSERT_EQ(slice.numOfSlices, parallelism) << sql;
+          ASSERT_EQ(slice.plan, desc.plan) << sql;
+          slices.insert(slice.sliceIdx);
+        }
+      }
+      ASSERT_EQ(slices.size(), parallelism) << sql;
+      ASSERT_EQ(*slices.begin(), 0) << sql;
+      ASSERT_EQ(*slices.rbegin(), parallelism - 1) << sql;
+    }
+    ASSERT_GT(numOfScans, 1) << sql;
+    ASSERT_EQ(sliced.size(), serial.size() + numOfScans * (parallelism - 1)) << sql;
+
+    for (int32_t i = 0; i < serial.size(); ++i) {
+      if (0 == serial[i].level) {
+        ASSERT_EQ(sliced[i].level, 0) << sql;
+        ASSERT_EQ(sliced[i].plan, serial[i].plan) << sql;
+      }
+    }
+  }
+
+  void checkSerialScan(const string& sql, int32_t parallelism) {
+    for (const auto& desc : getSubplans(sql, parallelism)) {
+      ASSERT_EQ(desc.numOfSlices, 0) << sql;
+    }
+  }
+};
 
 TEST_F(PlanSuperTableTest, pseudoCol) {
   useDb("root", "test");
@@ -40,3 +151,44 @@ TEST_F(PlanSuperTableTest, orderBy) {
 
   run("SELECT -1 * c1, c1 FROM st1 ORDER BY -1 * c1");
 }
+
+TEST_F(PlanSuperTableTest, parallelScan) {
+  useDb("root", "test");
+
+  // aggregate
+  checkParallelScan("SELECT COUNT(*), SUM(c1), MAX(c1), MIN(c1) FROM st1", 4);
+
+  checkParallelScan("SELECT LAST_ROW(c1), FIRST(c2) FROM st1", 4);
+
+  checkParallelScan("SELECT _WSTART, AVG(c1) FROM st1 INTERVAL(10s)", 4);
+
+  checkParallelScan("SELECT tag1, COUNT(*) FROM st1 GROUP BY tag1", 3);
+
+  // projection
+  checkParallelScan("SELECT TBNAME, c1 FROM st1 WHERE c1 > 10", 4);
+
+  // order
+  checkParallelScan("SELECT c1, ts FROM st1 ORDER BY c1 DESC", 2);
+
+  checkParallelScan("SELECT c1, c2 FROM st1 ORDER BY c2, c1", 4);
+
+  // limit
+  checkParallelScan("SELECT * FROM st1 LIMIT 10", 4);
+
+  checkParallelScan("SELECT c1 FROM st1 ORDER BY c1 LIMIT 10 OFFSET 5", 4);
+
+  checkParallelScan("SELECT SUM(c1) FROM st1 PARTITION BY TBNAME SLIMIT 1 LIMIT 2", 2);
+}
+
+TEST_F(PlanSuperTableTest, parallelScanNotSliced) {
+  useDb("root", "test");
+
+  checkSerialScan("SELECT * FROM st1s1", 4);
+
+  checkSerialScan("SELECT * FROM st1 t1, st2 t2 WHERE t1.ts = t2.ts", 4);
+
+  // a merge scan returns the rows of its vnode in timestamp order
+  checkSerialScan("SELECT * FROM st1 ORDER BY ts", 4);
+
+  checkSerialScan("SELECT * FROM st1 ORDER BY ts LIMIT 10 OFFSET 5", 4);
+}
@@ -175,6 +175,8 @@ class PlannerTestBaseImpl {
     nodesDestroyAllocator(allocatorId);
   }
 
+  const vector<string>& getPhysiSubplans() const { return res_.physiSubplans_; }
+
   void prepare(const string& sql) {
     if (caseEnv_.numOfSkipSql_ > 0) {
       return;
@@ -432,6 +434,7 @@ class PlannerTestBaseImpl {
   void setPlanContext(SQuery* pQuery, SPlanContext* pCxt) {
     pCxt->queryId = 1;
     pCxt->pUser = caseEnv_.user_.c_str();
+    pCxt->scanParallelism = tsQueryScanParallelism;
     if (QUERY_NODE_CREATE_TOPIC_STMT == nodeType(pQuery->pRoot)) {
       SCreateTopicStmt* pStmt = (SCreateTopicStmt*)pQuery->pRoot;
       pCxt->pAstRoot = pStmt->pQuery;
@@ -512,6 +515,8 @@ void PlannerTestBase::useDb(const std::string& user, const std::string& db) { im
 
 void PlannerTestBase::run(const std::string& sql) { return impl_->run(sql); }
 
+const std::vector<std::string>& PlannerTestBase::getPhysiSubplans() const { return impl_->getPhysiSubplans(); }
+
 void PlannerTestBase::prepare(const std::string& sql) { return impl_->prepare(sql); }
 
 void PlannerTestBase::bindParams(TAOS_MULTI_BIND* pParams, int32_t colIdx) {
@@ -17,6 +17,8 @@
 #define PLAN_TEST_UTIL_H
 
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
 #define ALLOW_FORBID_FUNC
 
@@ -32,6 +34,8 @@ class PlannerTestBase : public testing::Test {
 
   void useDb(const std::string& user, const std::string& db);
   void run(const std::string& sql);
+  // the subplans of the last sql run, level by level
+  const std::vector<std::string>& getPhysiSubplans() const;
   // stmt mode APIs
   void prepare(const std::string& sql);
   void bindParams(TAOS_MULTI_BIND* pParams, int32_t colIdx);
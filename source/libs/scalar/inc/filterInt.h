@@ -309,6 +309,8 @@ struct SFilterInfo {
   } while (0)
 #define FILTER_GREATER(cr, sflag, eflag) \
   ((cr > 0) || ((cr == 0) && (FILTER_GET_FLAG(sflag, RANGE_FLG_EXCLUDE) || FILTER_GET_FLAG(eflag, RANGE_FLG_EXCLUDE))))
+// two equal bounds joined by AND: excluded if either one is, unbounded only if both are
+#define FILTER_AND_BOUND_FLAG(f1, f2) ((((f1) | (f2)) & ~RANGE_FLG_NULL) | ((f1) & (f2) & RANGE_FLG_NULL))
 #define FILTER_COPY_RA(dst, src) \
   do {                           \
     (dst)->sflag = (src)->sflag; \
@@ -484,6 +486,11 @@ extern bool          filterDoCompare(__compar_fn_t func, uint8_t optr, void *lef
 extern __compar_fn_t filterGetCompFunc(int32_t type, int32_t optr);
 extern __compar_fn_t filterGetCompFuncEx(int32_t lType, int32_t rType, int32_t optr);
 
+extern bool filterExecuteImplRange(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SColumnDataAgg *statis,
+                                   int16_t numOfCols, int32_t *numOfQualified);
+extern bool filterExecuteImplRangeFixed(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes,
+                                        SColumnDataAgg *statis, int16_t numOfCols, int32_t *numOfQualified);
+
 #ifdef __cplusplus
 }
 #endif
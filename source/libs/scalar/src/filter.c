@@ -592,13 +592,13 @@ int32_t filterAddRangeImpl(void *h, SFilterRange *ra, int32_t optr) {
       cr = ctx->pCompareFunc(&ra->s, &r->ra.s);
       if (FILTER_GREATER(cr, ra->sflag, r->ra.sflag)) {
         SIMPLE_COPY_VALUES((char *)&r->ra.s, &ra->s);
-        cr == 0 ? (r->ra.sflag |= ra->sflag) : (r->ra.sflag = ra->sflag);
+        cr == 0 ? (r->ra.sflag = FILTER_AND_BOUND_FLAG(r->ra.sflag, ra->sflag)) : (r->ra.sflag = ra->sflag);
       }
 
       cr = ctx->pCompareFunc(&r->ra.e, &ra->e);
       if (FILTER_GREATER(cr, r->ra.eflag, ra->eflag)) {
         SIMPLE_COPY_VALUES((char *)&r->ra.e, &ra->e);
-        cr == 0 ? (r->ra.eflag |= ra->eflag) : (r->ra.eflag = ra->eflag);
+        cr == 0 ? (r->ra.eflag = FILTER_AND_BOUND_FLAG(r->ra.eflag, ra->eflag)) : (r->ra.eflag = ra->eflag);
         break;
       }
 
@@ -3127,6 +3127,84 @@ static FORCE_INLINE bool filterExecuteImplNotNull(void *pinfo, int32_t numOfRows
   return all;
 }
 
+// Range units on fixed width integer columns are evaluated by typed kernels instead of calling the generic compare
+// function per row. The fused lower/upper bounds are normalized to an inclusive [lo, hi] range first, so the inner
+// loop is a branch-free pair of comparisons over a plain array. There are no intrinsics, the loop is left to the
+// compiler, which vectorizes it at -O3 only. The result is a per row flag as before, it is not a selection vector.
+#define FLT_RANGE_LOWER_EXCLUDE(_rfunc) ((_rfunc) == 0 || (_rfunc) == 1 || (_rfunc) == 4)
+#define FLT_RANGE_HAS_LOWER(_rfunc)     ((_rfunc) >= 0 && (_rfunc) <= 5)
+#define FLT_RANGE_UPPER_EXCLUDE(_rfunc) ((_rfunc) == 0 || (_rfunc) == 2 || (_rfunc) == 6)
+#define FLT_RANGE_HAS_UPPER(_rfunc)     (((_rfunc) >= 0 && (_rfunc) <= 3) || (_rfunc) == 6 || (_rfunc) == 7)
+
+#define FLT_DEFINE_RANGE_KERNEL(_name, _type, _min, _max)                                 \
+  static int32_t _name(SFilterComUnit *cunit, int32_t numOfRows, int8_t *p) {             \
+    const _type *d = (const _type *)((SColumnInfoData *)cunit->colData)->pData;           \
+    _type        lo = (_min), hi = (_max);                                                \
+    if (FLT_RANGE_HAS_LOWER(cunit->rfunc)) {                                              \
+      lo = *(const _type *)cunit->valData;                                                \
+      if (FLT_RANGE_LOWER_EXCLUDE(cunit->rfunc)) {                                        \
+        if (lo == (_max)) {                                                               \
+          memset(p, 0, numOfRows);                                                        \
+          return 0;                                                                       \
+        }                                                                                 \
+        ++lo;                                                                             \
+      }                                                                                   \
+    }                                                                                     \
+    if (FLT_RANGE_HAS_UPPER(cunit->rfunc)) {                                              \
+      hi = *(const _type *)cunit->valData2;                                               \
+      if (FLT_RANGE_UPPER_EXCLUDE(cunit->rfunc)) {                                        \
+        if (hi == (_min)) {                                                               \
+          memset(p, 0, numOfRows);                                                        \
+          return 0;                                                                       \
+        }                                                                                 \
+        --hi;                                                                             \
+      }                                                                                   \
+    }                                                                                     \
+    int32_t num = 0;                                                                      \
+    for (int32_t i = 0; i < numOfRows; ++i) {                                            \
+      p[i] = (d[i] >= lo) & (d[i] <= hi);                                                 \
+      num += p[i];                                                                        \
+    }                                                                                     \
+    return num;                                                                           \
+  }
+
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelInt8, int8_t, INT8_MIN, INT8_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelInt16, int16_t, INT16_MIN, INT16_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelInt32, int32_t, INT32_MIN, INT32_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelInt64, int64_t, INT64_MIN, INT64_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelUint8, uint8_t, 0, UINT8_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelUint16, uint16_t, 0, UINT16_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelUint32, uint32_t, 0, UINT32_MAX)
+FLT_DEFINE_RANGE_KERNEL(filterRangeKernelUint64, uint64_t, 0, UINT64_MAX)
+
+typedef int32_t (*filterRangeKernel)(SFilterComUnit *cunit, int32_t numOfRows, int8_t *p);
+
+static filterRangeKernel filterGetRangeKernel(uint8_t type) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TINYINT:
+      return filterRangeKernelInt8;
+    case TSDB_DATA_TYPE_SMALLINT:
+      return filterRangeKernelInt16;
+    case TSDB_DATA_TYPE_INT:
+      return filterRangeKernelInt32;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      return filterRangeKernelInt64;
+    case TSDB_DATA_TYPE_UTINYINT:
+      return filterRangeKernelUint8;
+    case TSDB_DATA_TYPE_USMALLINT:
+      return filterRangeKernelUint16;
+    case TSDB_DATA_TYPE_UINT:
+      return filterRangeKernelUint32;
+    case TSDB_DATA_TYPE_UBIGINT:
+      return filterRangeKernelUint64;
+    default:
+      break;
+  }
+
+  return NULL;
+}
+
 bool filterExecuteImplRange(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SColumnDataAgg *statis,
                             int16_t numOfCols, int32_t *numOfQualified) {
   SFilterInfo  *info = (SFilterInfo *)pinfo;
@@ -3164,6 +3242,46 @@ bool filterExecuteImplRange(void *pinfo, int32_t numOfRows, SColumnInfoData *pRe
   return all;
 }
 
+bool filterExecuteImplRangeFixed(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SColumnDataAgg *statis,
+                                 int16_t numOfCols, int32_t *numOfQualified) {
+  SFilterInfo     *info = (SFilterInfo *)pinfo;
+  SFilterComUnit  *cunit = &info->cunits[0];
+  SColumnInfoData *pData = cunit->colData;
+  bool             all = true;
+
+  if (filterExecuteBasedOnStatis(info, numOfRows, pRes, statis, numOfCols, &all) == 0) {
+    return all;
+  }
+
+  if (pData->info.type != cunit->dataType || pData->pData == NULL) {
+    return filterExecuteImplRange(pinfo, numOfRows, pRes, statis, numOfCols, numOfQualified);
+  }
+
+  int8_t *p = (int8_t *)pRes->pData;
+  int32_t num = (*filterGetRangeKernel(cunit->dataType))(cunit, numOfRows, p);
+
+  // null rows are cleared a bitmap byte at a time, rows in all-valid bytes are not touched again
+  if (pData->nullbitmap != NULL) {
+    int32_t len = BitmapLen(numOfRows);
+    for (int32_t b = 0; b < len; ++b) {
+      if (pData->nullbitmap[b] == 0) {
+        continue;
+      }
+
+      int32_t end = TMIN((b + 1) << NBIT, numOfRows);
+      for (int32_t i = b << NBIT; i < end; ++i) {
+        if (colDataIsNull_f(pData->nullbitmap, i) && p[i]) {
+          p[i] = 0;
+          --num;
+        }
+      }
+    }
+  }
+
+  *numOfQualified += num;
+  return num == numOfRows;
+}
+
 bool filterExecuteImplMisc(void *pinfo, int32_t numOfRows, SColumnInfoData *pRes, SColumnDataAgg *statis,
                            int16_t numOfCols, int32_t *numOfQualified) {
   SFilterInfo *info = (SFilterInfo *)pinfo;
@@ -3316,7 +3434,7 @@ int32_t filterSetExecFunc(SFilterInfo *info) {
   }
 
   if (info->cunits[0].rfunc >= 0) {
-    info->func = filterExecuteImplRange;
+    info->func = filterGetRangeKernel(info->cunits[0].dataType) ? filterExecuteImplRangeFixed : filterExecuteImplRange;
     return TSDB_CODE_SUCCESS;
   }
 
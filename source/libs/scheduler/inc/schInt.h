@@ -56,6 +56,7 @@ typedef enum {
 #define SCHEDULE_DEFAULT_MAX_NODE_TABLE_NUM 200  // unit is TSDB_TABLE_NUM_UNIT
 #define SCHEDULE_DEFAULT_POLICY             SCH_LOAD_SEQ
 #define SCHEDULE_DEFAULT_MAX_NODE_NUM       20
+#define SCHEDULE_TASK_LOAD_WEIGHT           1  // weight of one running task against one queued msg reported by the node
 
 #define SCH_DEFAULT_TASK_TIMEOUT_USEC 10000000
 #define SCH_MAX_TASK_TIMEOUT_USEC     60000000
@@ -145,6 +146,7 @@ typedef struct SSchedulerMgmt {
   bool          exit;
   int32_t       jobRef;
   int32_t       jobNum;
+  SHashObj     *nodeLoad;  // "fqdn:port" -> int32_t, tasks of this scheduler running on the node
   SSchStat      stat;
   SRWLatch      hbLock;
   SHashObj     *hbConnections;
@@ -228,6 +230,8 @@ typedef struct SSchTask {
   SArray         *parents;         // the data destination tasks, get data from current task, element is SQueryTask*
   void           *handle;          // task send handle
   bool            registerdHb;     // registered in hb
+  bool            loadCounted;     // counted in the load of loadEp
+  SEp             loadEp;          // node the task is counted on
 } SSchTask;
 
 typedef struct SSchJobAttr {
@@ -558,6 +562,8 @@ int32_t  schLaunchLevelTasks(SSchJob *pJob, SSchLevel *level);
 int32_t  schGetTaskFromList(SHashObj *pTaskList, uint64_t taskId, SSchTask **pTask);
 int32_t  schInitTask(SSchJob *pJob, SSchTask *pTask, SSubplan *pPlan, SSchLevel *pLevel);
 int32_t  schSwitchTaskCandidateAddr(SSchJob *pJob, SSchTask *pTask);
+void     schAddTaskNodeLoad(SSchJob *pJob, SSchTask *pTask);
+void     schRemoveTaskNodeLoad(SSchJob *pJob, SSchTask *pTask);
 void     schDirectPostJobRes(SSchedulerReq *pReq, int32_t errCode);
 int32_t  schHandleJobFailure(SSchJob *pJob, int32_t errCode);
 int32_t  schHandleJobDrop(SSchJob *pJob, int32_t errCode);
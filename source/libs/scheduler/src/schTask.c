@@ -25,6 +25,7 @@
 
 void schFreeTask(SSchJob *pJob, SSchTask *pTask) {
   schDeregisterTaskHb(pJob, pTask);
+  schRemoveTaskNodeLoad(pJob, pTask);
 
   if (pTask->candidateAddrs) {
     taosArrayDestroy(pTask->candidateAddrs);
@@ -199,6 +200,8 @@ int32_t schProcessOnTaskFailure(SSchJob *pJob, SSchTask *pTask, int32_t errCode)
     SCH_LOG_TASK_END_TS(pTask);
   }
 
+  schRemoveTaskNodeLoad(pJob, pTask);
+
   bool    needRetry = false;
   bool    moved = false;
   int32_t taskDone = 0;
@@ -244,6 +247,8 @@ int32_t schProcessOnTaskSuccess(SSchJob *pJob, SSchTask *pTask) {
 
   SCH_LOG_TASK_END_TS(pTask);
 
+  schRemoveTaskNodeLoad(pJob, pTask);
+
   SCH_SET_TASK_STATUS(pTask, JOB_TASK_STATUS_PART_SUCC);
 
   SCH_ERR_RET(schRecordTaskSucceedNode(pJob, pTask));
@@ -360,6 +365,7 @@ int32_t schDoTaskRedirect(SSchJob *pJob, SSchTask *pTask, SDataBuf *pData, int32
   taosHashClear(pTask->execNodes);
   schRemoveTaskFromExecList(pJob, pTask);
   schDeregisterTaskHb(pJob, pTask);
+  schRemoveTaskNodeLoad(pJob, pTask);
   atomic_sub_fetch_32(&pTask->level->taskLaunchedNum, 1);
   taosMemoryFreeClear(pTask->msg);
   pTask->msgLen = 0;
@@ -614,6 +620,7 @@ int32_t schHandleTaskRetry(SSchJob *pJob, SSchTask *pTask) {
   }
 
   schDeregisterTaskHb(pJob, pTask);
+  schRemoveTaskNodeLoad(pJob, pTask);
 
   if (SCH_IS_DATA_BIND_TASK(pTask)) {
     SQueryNodeAddr *addr = taosArrayGet(pTask->candidateAddrs, pTask->candidateIdx);
@@ -627,6 +634,91 @@ int32_t schHandleTaskRetry(SSchJob *pJob, SSchTask *pTask) {
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t schGetNodeLoadKey(SQueryNodeAddr *addr, char *key, int32_t keySize) {
+  SEp *pEp = SCH_GET_CUR_EP(addr);
+  return snprintf(key, keySize, "%s:%d", pEp->fqdn, pEp->port);
+}
+
+static int32_t schGetNodeRunningTasks(SQueryNodeAddr *addr) {
+  char    key[TSDB_FQDN_LEN + 16];
+  int32_t keyLen = schGetNodeLoadKey(addr, key, sizeof(key));
+
+  int32_t *pNum = taosHashGet(schMgmt.nodeLoad, key, keyLen);
+  return pNum ? atomic_load_32(pNum) : 0;
+}
+
+// The load reported by mnode is the msg queue depth of the node when the client last refreshed its node list, the
+// tasks this scheduler has put on the node since then are added to it.
+static uint64_t schGetNodeLoad(SSchJob *pJob, SQueryNodeAddr *addr) {
+  uint64_t load = 0;
+  SEp     *pEp = SCH_GET_CUR_EP(addr);
+  int32_t  nodeNum = taosArrayGetSize(pJob->nodeList);
+  for (int32_t i = 0; i < nodeNum; ++i) {
+    SQueryNodeLoad *nload = taosArrayGet(pJob->nodeList, i);
+    SEp            *pLoadEp = SCH_GET_CUR_EP(&nload->addr);
+    if (nload->addr.nodeId == addr->nodeId && pLoadEp->port == pEp->port && 0 == strcmp(pLoadEp->fqdn, pEp->fqdn)) {
+      load = nload->load;
+      break;
+    }
+  }
+
+  return load + (uint64_t)schGetNodeRunningTasks(addr) * SCHEDULE_TASK_LOAD_WEIGHT;
+}
+
+void schAddTaskNodeLoad(SSchJob *pJob, SSchTask *pTask) {
+  SQueryNodeAddr *addr = taosArrayGet(pTask->candidateAddrs, pTask->candidateIdx);
+  if (NULL == addr || pTask->loadCounted || NULL == schMgmt.nodeLoad) {
+    return;
+  }
+
+  char    key[TSDB_FQDN_LEN + 16];
+  int32_t keyLen = schGetNodeLoadKey(addr, key, sizeof(key));
+
+  int32_t *pNum = taosHashGet(schMgmt.nodeLoad, key, keyLen);
+  if (NULL == pNum) {
+    int32_t num = 0;
+    taosHashPut(schMgmt.nodeLoad, key, keyLen, &num, sizeof(num));  // may fail on a concurrent put, get it again
+    pNum = taosHashGet(schMgmt.nodeLoad, key, keyLen);
+    if (NULL == pNum) {
+      return;
+    }
+  }
+
+  atomic_add_fetch_32(pNum, 1);
+  pTask->loadEp = *SCH_GET_CUR_EP(addr);
+  pTask->loadCounted = true;
+}
+
+void schRemoveTaskNodeLoad(SSchJob *pJob, SSchTask *pTask) {
+  if (!pTask->loadCounted || NULL == schMgmt.nodeLoad) {
+    return;
+  }
+
+  char    key[TSDB_FQDN_LEN + 16];
+  int32_t keyLen = snprintf(key, sizeof(key), "%s:%d", pTask->loadEp.fqdn, pTask->loadEp.port);
+
+  int32_t *pNum = taosHashGet(schMgmt.nodeLoad, key, keyLen);
+  if (pNum) {
+    atomic_sub_fetch_32(pNum, 1);
+  }
+  pTask->loadCounted = false;
+}
+
+typedef struct SSchCandidateLoad {
+  SQueryNodeAddr *addr;
+  uint64_t        load;
+  int32_t         order;
+} SSchCandidateLoad;
+
+static int32_t schCompareCandidateLoad(const void *p1, const void *p2) {
+  const SSchCandidateLoad *c1 = p1;
+  const SSchCandidateLoad *c2 = p2;
+  if (c1->load != c2->load) {
+    return c1->load < c2->load ? -1 : 1;
+  }
+  return c1->order - c2->order;
+}
+
 int32_t schSetAddrsFromNodeList(SSchJob *pJob, SSchTask *pTask) {
   int32_t addNum = 0;
   int32_t nodeNum = 0;
@@ -634,21 +726,42 @@ int32_t schSetAddrsFromNodeList(SSchJob *pJob, SSchTask *pTask) {
   if (pJob->nodeList) {
     nodeNum = taosArrayGetSize(pJob->nodeList);
 
+    SArray *pCandidates = taosArrayInit(nodeNum, sizeof(SSchCandidateLoad));
+    if (NULL == pCandidates) {
+      SCH_ERR_RET(TSDB_CODE_QRY_OUT_OF_MEMORY);
+    }
+
+    // least loaded node first, nodes with the same load are taken in a random order so that they share the tasks
+    int32_t offset = nodeNum > 0 ? taosRand() % nodeNum : 0;
     for (int32_t i = 0; i < nodeNum; ++i) {
-      SQueryNodeLoad *nload = taosArrayGet(pJob->nodeList, i);
-      SQueryNodeAddr *naddr = &nload->addr;
+      SQueryNodeLoad   *nload = taosArrayGet(pJob->nodeList, i);
+      SSchCandidateLoad candidate = {.addr = &nload->addr, .order = i};
+      if (SCH_LOAD_SEQ == schMgmt.cfg.schPolicy) {
+        candidate.load = schGetNodeLoad(pJob, &nload->addr);
+        candidate.order = (i + nodeNum - offset) % nodeNum;
+      }
+      taosArrayPush(pCandidates, &candidate);
+    }
+    taosArraySort(pCandidates, schCompareCandidateLoad);
+
+    for (int32_t i = 0; i < nodeNum; ++i) {
+      SSchCandidateLoad *pCandidate = taosArrayGet(pCandidates, i);
+      SQueryNodeAddr    *naddr = pCandidate->addr;
 
       if (NULL == taosArrayPush(pTask->candidateAddrs, naddr)) {
         SCH_TASK_ELOG("taosArrayPush execNode to candidate addrs failed, addNum:%d, errno:%d", addNum, errno);
+        taosArrayDestroy(pCandidates);
         SCH_ERR_RET(TSDB_CODE_QRY_OUT_OF_MEMORY);
       }
 
-      SCH_TASK_TLOG("set %dth candidate addr, id %d, inUse:%d/%d, fqdn:%s, port:%d", i, naddr->nodeId,
-                    naddr->epSet.inUse, naddr->epSet.numOfEps, SCH_GET_CUR_EP(naddr)->fqdn,
-                    SCH_GET_CUR_EP(naddr)->port);
+      SCH_TASK_TLOG("set %dth candidate addr, id %d, load:%" PRIu64 ", inUse:%d/%d, fqdn:%s, port:%d", i,
+                    naddr->nodeId, pCandidate->load, naddr->epSet.inUse, naddr->epSet.numOfEps,
+                    SCH_GET_CUR_EP(naddr)->fqdn, SCH_GET_CUR_EP(naddr)->port);
 
       ++addNum;
     }
+
+    taosArrayDestroy(pCandidates);
   }
 
   if (addNum <= 0) {
@@ -727,7 +840,35 @@ int32_t schSwitchTaskCandidateAddr(SSchJob *pJob, SSchTask *pTask) {
   }
 
   switch (schMgmt.cfg.schPolicy) {
-    case SCH_LOAD_SEQ:
+    case SCH_LOAD_SEQ: {
+      // retry on the least loaded candidate not tried yet, start over from the whole list once all are tried
+      int32_t startIdx = pTask->candidateIdx + 1;
+      if (startIdx >= candidateNum) {
+        startIdx = 0;
+      }
+
+      int32_t  bestIdx = -1;
+      uint64_t bestLoad = UINT64_MAX;
+      for (int32_t i = startIdx; i < candidateNum; ++i) {
+        if (i == pTask->candidateIdx) {
+          continue;
+        }
+
+        uint64_t load = schGetNodeLoad(pJob, taosArrayGet(pTask->candidateAddrs, i));
+        if (load < bestLoad) {
+          bestLoad = load;
+          bestIdx = i;
+        }
+      }
+
+      if (bestIdx >= 0 && bestIdx != startIdx) {
+        SQueryNodeAddr tmp = *(SQueryNodeAddr *)taosArrayGet(pTask->candidateAddrs, startIdx);
+        taosArraySet(pTask->candidateAddrs, startIdx, taosArrayGet(pTask->candidateAddrs, bestIdx));
+        taosArraySet(pTask->candidateAddrs, bestIdx, &tmp);
+      }
+      pTask->candidateIdx = startIdx;
+      break;
+    }
     case SCH_ALL:
     default:
       if (++pTask->candidateIdx >= candidateNum) {
@@ -917,6 +1058,8 @@ int32_t schLaunchRemoteTask(SSchJob *pJob, SSchTask *pTask) {
 //    SCH_ERR_RET(schEnsureHbConnection(pJob, pTask));
   }
 
+  schAddTaskNodeLoad(pJob, pTask);
+
   SCH_RET(schBuildAndSendMsg(pJob, pTask, NULL, plan->msgType));
 }
 
@@ -600,6 +600,44 @@ void *schtRunJobThread(void *aa) {
   return NULL;
 }
 
+bool schtChkKill(void *param) { return false; }
+
+// tasks of this scheduler currently counted on the node
+int32_t schtGetNodeTaskNum(const char *fqdn, uint16_t port) {
+  char    key[TSDB_FQDN_LEN + 16];
+  int32_t keyLen = snprintf(key, sizeof(key), "%s:%d", fqdn, port);
+
+  int32_t *pNum = (int32_t *)taosHashGet(schMgmt.nodeLoad, key, keyLen);
+  return pNum ? *pNum : 0;
+}
+
+SArray *schtBuildQnodeLoadList(uint64_t *loads, int32_t num) {
+  SArray *qnodeList = taosArrayInit(num, sizeof(SQueryNodeLoad));
+  for (int32_t i = 0; i < num; ++i) {
+    SQueryNodeLoad nload = {0};
+    char           fqdn[TSDB_FQDN_LEN];
+    snprintf(fqdn, sizeof(fqdn), "qnode%d.ep", i);
+    nload.addr.nodeId = i + 1;
+    addEpIntoEpSet(&nload.addr.epSet, fqdn, 6031);
+    nload.load = loads[i];
+    taosArrayPush(qnodeList, &nload);
+  }
+  return qnodeList;
+}
+
+SSchTask *schtGetExecTask(SSchJob *pJob, ESubplanType type) {
+  SSchTask *pTask = NULL;
+  void     *pIter = taosHashIterate(pJob->execTasks, NULL);
+  while (pIter) {
+    SSchTask *task = *(SSchTask **)pIter;
+    if (task->plan->subplanType == type) {
+      pTask = task;
+    }
+    pIter = taosHashIterate(pJob->execTasks, pIter);
+  }
+  return pTask;
+}
+
 void *schtFreeJobThread(void *aa) {
   while (!schtTestStop) {
     taosUsleep(taosRand() % 100);
@@ -931,6 +969,85 @@ TEST(queryTest, flowCtrlCase) {
   schedulerDestroy();
 }
 
+TEST(queryTest, nodeLoadCase) {
+  void      *mockPointer = (void *)0x1;
+  int64_t    job = 0;
+  SQueryPlan dag;
+
+  memset(&dag, 0, sizeof(dag));
+
+  uint64_t loads[] = {5, 0, 2};
+  SArray  *qnodeList = schtBuildQnodeLoadList(loads, 3);
+
+  int32_t code = schedulerInit();
+  ASSERT_EQ(code, 0);
+
+  schtBuildQueryDag(&dag);
+
+  schtSetPlanToString();
+  schtSetExecNode();
+  schtSetAsyncSendMsgToServer();
+
+  int32_t queryDone = 0;
+
+  SRequestConnInfo conn = {0};
+  conn.pTrans = mockPointer;
+  SSchedulerReq req = {0};
+  req.pConn = &conn;
+  req.pNodeList = qnodeList;
+  req.pDag = &dag;
+  req.sql = "select * from tb";
+  req.execFp = schtQueryCb;
+  req.cbParam = &queryDone;
+  req.chkKillFp = schtChkKill;
+
+  code = schedulerExecJob(&req, &job);
+  ASSERT_EQ(code, 0);
+
+  SSchJob *pJob = schAcquireJob(job);
+
+  // the scan task is counted on its vnode until it succeeds
+  SSchTask *scanTask = schtGetExecTask(pJob, SUBPLAN_TYPE_SCAN);
+  ASSERT_TRUE(scanTask != NULL);
+  ASSERT_EQ(schtGetNodeTaskNum("ep0", 6030), 1);
+
+  code = schProcessOnTaskSuccess(pJob, scanTask);
+  ASSERT_EQ(code, 0);
+  ASSERT_EQ(schtGetNodeTaskNum("ep0", 6030), 0);
+
+  // the merge task goes to the least loaded qnode first
+  SSchTask *mergeTask = schtGetExecTask(pJob, SUBPLAN_TYPE_MERGE);
+  ASSERT_TRUE(mergeTask != NULL);
+  ASSERT_EQ(taosArrayGetSize(mergeTask->candidateAddrs), 3);
+  ASSERT_EQ(((SQueryNodeAddr *)taosArrayGet(mergeTask->candidateAddrs, 0))->nodeId, 2);
+  ASSERT_EQ(((SQueryNodeAddr *)taosArrayGet(mergeTask->candidateAddrs, 1))->nodeId, 3);
+  ASSERT_EQ(((SQueryNodeAddr *)taosArrayGet(mergeTask->candidateAddrs, 2))->nodeId, 1);
+  ASSERT_EQ(mergeTask->candidateIdx, 0);
+  ASSERT_EQ(schtGetNodeTaskNum("qnode1.ep", 6031), 1);
+
+  // a retry releases the node and moves to the next least loaded one
+  code = schProcessOnTaskFailure(pJob, mergeTask, TSDB_CODE_SCH_TIMEOUT_ERROR);
+  ASSERT_EQ(code, 0);
+  ASSERT_EQ(((SQueryNodeAddr *)taosArrayGet(mergeTask->candidateAddrs, mergeTask->candidateIdx))->nodeId, 3);
+  ASSERT_EQ(schtGetNodeTaskNum("qnode1.ep", 6031), 0);
+  ASSERT_EQ(schtGetNodeTaskNum("qnode2.ep", 6031), 1);
+
+  // a failed task does not keep its node loaded until the job is freed
+  code = schProcessOnTaskFailure(pJob, mergeTask, TSDB_CODE_QRY_INVALID_INPUT);
+  ASSERT_NE(code, 0);
+  ASSERT_EQ(schtGetNodeTaskNum("qnode2.ep", 6031), 0);
+  ASSERT_EQ(schtGetNodeTaskNum("qnode0.ep", 6031), 0);
+
+  schReleaseJob(job);
+
+  schedulerFreeJob(&job, 0);
+
+  taosArrayDestroy(qnodeList);
+  schtFreeQueryDag(&dag);
+
+  schedulerDestroy();
+}
+
 TEST(insertTest, normalCase) {
   void       *mockPointer = (void *)0x1;
   char       *clusterId = "cluster1";
@@ -17,6 +17,7 @@
 #define _STREAM_INC_H_
 
 #include "executor.h"
+#include "tglobal.h"
 #include "tref.h"
 #include "tstream.h"
 
@@ -180,14 +180,16 @@ CLEAR:
 }
 
 static int32_t streamAddBlockToDispatchMsg(const SSDataBlock* pBlock, SStreamDispatchReq* pReq) {
-  int32_t dataStrLen = sizeof(SRetrieveTableRsp) + blockGetEncodeSize(pBlock);
-  void*   buf = taosMemoryCalloc(1, dataStrLen);
+  int8_t  compressed = (tsStreamDispatchCompress && pBlock->info.rows > 0) ? ONE_STAGE_COMP : 0;
+  int32_t dataStrLen =
+      sizeof(SRetrieveTableRsp) + (compressed ? blockGetCompressedEncodeSize(pBlock) : blockGetEncodeSize(pBlock));
+  void* buf = taosMemoryCalloc(1, dataStrLen);
   if (buf == NULL) return -1;
 
   SRetrieveTableRsp* pRetrieve = (SRetrieveTableRsp*)buf;
   pRetrieve->useconds = 0;
   pRetrieve->precision = TSDB_DEFAULT_PRECISION;
-  pRetrieve->compressed = 0;
+  pRetrieve->compressed = compressed;
   pRetrieve->completed = 1;
   pRetrieve->streamBlockType = pBlock->info.type;
   pRetrieve->numOfRows = htonl(pBlock->info.rows);
@@ -201,7 +203,7 @@ static int32_t streamAddBlockToDispatchMsg(const SSDataBlock* pBlock, SStreamDis
   pRetrieve->numOfCols = htonl(numOfCols);
 
   int32_t actualLen = 0;
-  blockEncode(pBlock, pRetrieve->data, &actualLen, numOfCols, false);
+  blockEncode(pBlock, pRetrieve->data, &actualLen, numOfCols, compressed);
   actualLen += sizeof(SRetrieveTableRsp);
   ASSERT(actualLen <= dataStrLen);
   taosArrayPush(pReq->dataLen, &actualLen);
@@ -407,6 +409,52 @@ int32_t streamDispatchAllBlocks(SStreamTask* pTask, const SStreamDataBlock* pDat
   return 0;
 }
 
+/*
+ * Coalesce the output already queued behind pBlock into the same dispatch, so that each downstream task receives one
+ * message carrying all of them. It never waits for more output, and stops once the batch reaches
+ * tsStreamDispatchBatchSize.
+ */
+static void streamMergeQueuedOutput(SStreamTask* pTask, SStreamDataBlock* pBlock) {
+  int64_t limit = tsStreamDispatchBatchSize * 1024L;
+  int64_t size = 0;
+  for (int32_t i = 0; i < taosArrayGetSize(pBlock->blocks); ++i) {
+    size += blockGetEncodeSize(taosArrayGet(pBlock->blocks, i));
+  }
+
+  SStreamQueue* pQueue = pTask->outputQueue;
+  int32_t       numOfMerged = 0;
+  while (size < limit) {
+    SStreamDataBlock* pNext = NULL;
+    taosGetQitem(pQueue->qall, (void**)&pNext);
+    if (pNext == NULL) {
+      taosReadAllQitems(pQueue->queue, pQueue->qall);
+      taosGetQitem(pQueue->qall, (void**)&pNext);
+      if (pNext == NULL) {
+        break;
+      }
+    }
+
+    ASSERT(pNext->type == STREAM_INPUT__DATA_BLOCK);
+    for (int32_t i = 0; i < taosArrayGetSize(pNext->blocks); ++i) {
+      size += blockGetEncodeSize(taosArrayGet(pNext->blocks, i));
+    }
+
+    // the dispatch carries the output up to the latest version of the merged items
+    pBlock->sourceVer = TMAX(pBlock->sourceVer, pNext->sourceVer);
+
+    // the column data is owned by pBlock->blocks from now on
+    taosArrayAddAll(pBlock->blocks, pNext->blocks);
+    taosArrayDestroy(pNext->blocks);
+    taosFreeQitem(pNext);
+    numOfMerged += 1;
+  }
+
+  if (numOfMerged > 0) {
+    qDebug("task %d merge %d queued outputs into one dispatch, blocks:%d, size:%" PRId64, pTask->taskId, numOfMerged,
+           (int32_t)taosArrayGetSize(pBlock->blocks), size);
+  }
+}
+
 int32_t streamDispatch(SStreamTask* pTask) {
   ASSERT(pTask->outputType == TASK_OUTPUT__FIXED_DISPATCH || pTask->outputType == TASK_OUTPUT__SHUFFLE_DISPATCH);
 
@@ -424,6 +472,10 @@ int32_t streamDispatch(SStreamTask* pTask) {
   }
   ASSERT(pBlock->type == STREAM_INPUT__DATA_BLOCK);
 
+  if (tsStreamDispatchBatchSize > 0) {
+    streamMergeQueuedOutput(pTask, pBlock);
+  }
+
   qDebug("stream dispatching: task %d", pTask->taskId);
 
   int32_t code = 0;
@@ -105,6 +105,10 @@ typedef struct SSyncNode {
   SSyncIndexMgr* pNextIndex;
   SSyncIndexMgr* pMatchIndex;
 
+  // pipelined replication, last index sent to each peer, SYNC_INDEX_INVALID if not pipelining
+  SSyncIndexMgr* pSendIndex;
+  int32_t        pipelineWindow;
+
   // tla+ log vars
   SSyncLogStore* pLogStore;
   SyncIndex      commitIndex;
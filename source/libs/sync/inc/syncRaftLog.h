@@ -28,12 +28,24 @@ extern "C" {
 #include "taosdef.h"
 #include "wal.h"
 
+#define SYNC_READ_AHEAD_COUNT 128
+#define SYNC_READ_AHEAD_BYTES (8 * 1024 * 1024)
+
+// entries read sequentially from wal ahead of replication, entries[i] holds beginIndex + i
+typedef struct SSyncLogReadAhead {
+  SSyncRaftEntry* entries[SYNC_READ_AHEAD_COUNT];
+  SyncIndex       beginIndex;
+  int32_t         count;
+  int64_t         bytes;
+} SSyncLogReadAhead;
+
 typedef struct SSyncLogStoreData {
   SSyncNode* pSyncNode;
   SWal*      pWal;
 
-  TdThreadMutex mutex;
-  SWalReader*   pWalHandle;
+  TdThreadMutex     mutex;
+  SWalReader*       pWalHandle;
+  SSyncLogReadAhead readAhead;
 
   // SyncIndex       beginIndex;  // valid begin index, default 0, may be set beginIndex > 0
 } SSyncLogStoreData;
@@ -49,6 +61,9 @@ SyncIndex logStoreFirstIndex(SSyncLogStore* pLogStore);
 
 SyncIndex logStoreWalCommitVer(SSyncLogStore* pLogStore);
 
+int32_t logStoreReadAhead(SSyncLogStore* pLogStore, SyncIndex beginIndex, int32_t count);
+void    logStoreClearReadAhead(SSyncLogStore* pLogStore);
+
 // for debug
 void logStorePrint(SSyncLogStore* pLogStore);
 void logStorePrint2(char* s, SSyncLogStore* pLogStore);
@@ -57,6 +57,12 @@ int32_t syncNodeAppendEntriesPeersSnapshot2(SSyncNode* pSyncNode);
 
 int32_t syncNodeAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, SyncIndex nextIndex);
 
+// pipelined replication
+int32_t syncNodeAppendEntriesPipeline(SSyncNode* pSyncNode, SRaftId* pDestId);
+void    syncNodeStartPipeline(SSyncNode* pSyncNode, const SRaftId* pDestId, SyncIndex matchIndex);
+void    syncNodeStopPipeline(SSyncNode* pSyncNode, const SRaftId* pDestId, const char* reason);
+void    syncNodeResetPipeline(SSyncNode* pSyncNode);
+
 int32_t syncNodeReplicate(SSyncNode* pSyncNode, bool isTimer);
 int32_t syncNodeAppendEntries(SSyncNode* pSyncNode, const SRaftId* destRaftId, const SyncAppendEntries* pMsg);
 int32_t syncNodeAppendEntriesBatch(SSyncNode* pSyncNode, const SRaftId* destRaftId, const SyncAppendEntriesBatch* pMsg);
@@ -479,6 +479,27 @@ static bool syncNodeOnAppendEntriesBatchLogOK(SSyncNode* pSyncNode, SyncAppendEn
 
 // really pre log match
 // prevLogIndex == -1
+// A batch resent or reordered by a pipelining leader may already be in the local log. Rolling back the entries after
+// it would throw away what the leader has already counted as matched, so it is only acknowledged.
+static bool syncNodeOnAppendEntriesBatchInLog(SSyncNode* pSyncNode, SyncAppendEntriesBatch* pMsg) {
+  SOffsetAndContLen* metaTableArr = syncAppendEntriesBatchMetaTableArray(pMsg);
+  for (int32_t i = 0; i < pMsg->dataCount; ++i) {
+    SSyncRaftEntry* pAppendEntry = (SSyncRaftEntry*)(pMsg->data + metaTableArr[i].offset);
+    SSyncRaftEntry* pLocalEntry = NULL;
+    if (pSyncNode->pLogStore->syncLogGetEntry(pSyncNode->pLogStore, pAppendEntry->index, &pLocalEntry) != 0) {
+      return false;
+    }
+
+    bool same = (pLocalEntry->term == pAppendEntry->term);
+    syncEntryDestory(pLocalEntry);
+    if (!same) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 static bool syncNodeOnAppendEntriesLogOK(SSyncNode* pSyncNode, SyncAppendEntries* pMsg) {
   if (pMsg->prevLogIndex == SYNC_INDEX_INVALID) {
     return true;
@@ -694,6 +715,12 @@ int32_t syncNodeOnAppendEntriesSnapshot2Cb(SSyncNode* ths, SyncAppendEntriesBatc
 
       int32_t pass = 0;
 
+      if (hasExtraEntries && hasAppendEntries && syncNodeOnAppendEntriesBatchInLog(ths, pMsg)) {
+        // already appended, nothing to roll back or write
+        hasExtraEntries = false;
+        pass = 1;
+      }
+
       if (hasExtraEntries) {
         // make log same, rollback deleted entries
         pass = syncNodeDoMakeLogSame(ths, pMsg->prevLogIndex + 1);
@@ -20,6 +20,7 @@
 #include "syncRaftCfg.h"
 #include "syncRaftLog.h"
 #include "syncRaftStore.h"
+#include "syncReplication.h"
 #include "syncSnapshot.h"
 #include "syncUtil.h"
 #include "syncVoteMgr.h"
@@ -185,6 +186,13 @@ int32_t syncNodeOnAppendEntriesReplySnapshot2Cb(SSyncNode* ths, SyncAppendEntrie
     SyncIndex newNextIndex = pMsg->matchIndex + 1;
     SyncIndex newMatchIndex = pMsg->matchIndex;
 
+    // with batches pipelined, the reply of an older batch must not move the peer backward
+    SyncIndex sendIndex = syncIndexMgrGetIndex(ths->pSendIndex, &(pMsg->srcId));
+    if (sendIndex != SYNC_INDEX_INVALID && newMatchIndex < beforeMatchIndex) {
+      syncLogRecvAppendEntriesReply(ths, pMsg, "drop stale pipeline response");
+      return 0;
+    }
+
     bool needStartSnapshot = false;
     if (newMatchIndex >= SYNC_INDEX_BEGIN && !ths->pLogStore->syncLogExist(ths->pLogStore, newMatchIndex)) {
       needStartSnapshot = true;
@@ -200,7 +208,16 @@ int32_t syncNodeOnAppendEntriesReplySnapshot2Cb(SSyncNode* ths, SyncAppendEntrie
         syncMaybeAdvanceCommitIndex(ths);
       }
 
+      // keep the pipeline full instead of waiting for the next heartbeat
+      syncNodeStartPipeline(ths, &(pMsg->srcId), newMatchIndex);
+      if (ths->state == TAOS_SYNC_STATE_LEADER && ths->pipelineWindow > 1 &&
+          newNextIndex <= syncNodeGetLastIndex(ths)) {
+        syncNodeAppendEntriesPipeline(ths, &(pMsg->srcId));
+      }
+
     } else {
+      syncNodeStopPipeline(ths, &(pMsg->srcId), "start snapshot");
+
       // start snapshot <match+1, old snapshot.end>
       SSnapshot oldSnapshot;
       ths->pFsm->FpGetSnapshotInfo(ths->pFsm, &oldSnapshot);
@@ -227,6 +244,9 @@ int32_t syncNodeOnAppendEntriesReplySnapshot2Cb(SSyncNode* ths, SyncAppendEntrie
     } while (0);
 
   } else {
+    // back off to one batch at a time until the peer accepts again
+    syncNodeStopPipeline(ths, &(pMsg->srcId), "batch rejected");
+
     SyncIndex nextIndex = syncIndexMgrGetIndex(ths->pNextIndex, &(pMsg->srcId));
 
     if (nextIndex > SYNC_INDEX_BEGIN) {
@@ -981,6 +981,7 @@ SSyncNode* syncNodeOpen(SSyncInfo* pSyncInfo) {
   pSyncNode->msgcb = pSyncInfo->msgcb;
   pSyncNode->FpSendMsg = pSyncInfo->FpSendMsg;
   pSyncNode->FpEqMsg = pSyncInfo->FpEqMsg;
+  pSyncNode->pipelineWindow = TMIN(pSyncInfo->pipelineWindow, SYNC_MAX_PIPELINE_WINDOW);
 
   // init raft config
   pSyncNode->pRaftCfg = raftCfgOpen(pSyncNode->configPath);
@@ -1084,6 +1085,12 @@ SSyncNode* syncNodeOpen(SSyncInfo* pSyncInfo) {
     sError("failed to create SyncIndexMgr. vgId:%d", pSyncNode->vgId);
     goto _error;
   }
+  pSyncNode->pSendIndex = syncIndexMgrCreate(pSyncNode);
+  if (pSyncNode->pSendIndex == NULL) {
+    sError("failed to create SyncIndexMgr. vgId:%d", pSyncNode->vgId);
+    goto _error;
+  }
+  syncNodeResetPipeline(pSyncNode);
 
   // init TLA+ log vars
   pSyncNode->pLogStore = logStoreCreate(pSyncNode);
@@ -1274,6 +1281,8 @@ void syncNodeClose(SSyncNode* pSyncNode) {
   pSyncNode->pNextIndex = NULL;
   syncIndexMgrDestroy(pSyncNode->pMatchIndex);
   pSyncNode->pMatchIndex = NULL;
+  syncIndexMgrDestroy(pSyncNode->pSendIndex);
+  pSyncNode->pSendIndex = NULL;
   logStoreDestory(pSyncNode->pLogStore);
   pSyncNode->pLogStore = NULL;
   raftCfgClose(pSyncNode->pRaftCfg);
@@ -1995,6 +2004,8 @@ void syncNodeDoConfigChange(SSyncNode* pSyncNode, SSyncCfg* pNewConfig, SyncInde
 
     syncIndexMgrUpdate(pSyncNode->pNextIndex, pSyncNode);
     syncIndexMgrUpdate(pSyncNode->pMatchIndex, pSyncNode);
+    syncIndexMgrUpdate(pSyncNode->pSendIndex, pSyncNode);
+    syncNodeResetPipeline(pSyncNode);
     voteGrantedUpdate(pSyncNode->pVotesGranted, pSyncNode);
     votesRespondUpdate(pSyncNode->pVotesRespond, pSyncNode);
 
@@ -2237,6 +2248,9 @@ void syncNodeBecomeLeader(SSyncNode* pSyncNode, const char* debugStr) {
     pSyncNode->pMatchIndex->index[i] = SYNC_INDEX_INVALID;
   }
 
+  // start every peer in one-batch-at-a-time mode, pipelining is turned on by the first accepted batch
+  syncNodeResetPipeline(pSyncNode);
+
   // update sender private term
   SSyncSnapshotSender* pMySender = syncNodeGetSnapshotSender(pSyncNode, &(pSyncNode->myRaftId));
   if (pMySender != NULL) {
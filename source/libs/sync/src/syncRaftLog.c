@@ -33,6 +33,7 @@ static int32_t   raftLogAppendEntry(struct SSyncLogStore* pLogStore, SSyncRaftEn
 static int32_t   raftLogGetEntry(struct SSyncLogStore* pLogStore, SyncIndex index, SSyncRaftEntry** ppEntry);
 static int32_t   raftLogTruncate(struct SSyncLogStore* pLogStore, SyncIndex fromIndex);
 static bool      raftLogExist(struct SSyncLogStore* pLogStore, SyncIndex index);
+static void      raftLogClearReadAhead(SSyncLogStoreData* pData);
 
 // private function
 static int32_t raftLogGetLastEntry(SSyncLogStore* pLogStore, SSyncRaftEntry** ppLastEntry);
@@ -74,6 +75,9 @@ SSyncLogStore* logStoreCreate(SSyncNode* pSyncNode) {
   pData->pWalHandle = walOpenReader(pData->pWal, NULL);
   ASSERT(pData->pWalHandle != NULL);
 
+  memset(&pData->readAhead, 0, sizeof(pData->readAhead));
+  pData->readAhead.beginIndex = SYNC_INDEX_INVALID;
+
   pLogStore->appendEntry = logStoreAppendEntry;
   pLogStore->getEntry = logStoreGetEntry;
   pLogStore->truncate = logStoreTruncate;
@@ -107,6 +111,7 @@ void logStoreDestory(SSyncLogStore* pLogStore) {
       walCloseReader(pData->pWalHandle);
       pData->pWalHandle = NULL;
     }
+    raftLogClearReadAhead(pData);
     taosThreadMutexUnlock(&(pData->mutex));
     taosThreadMutexDestroy(&(pData->mutex));
 
@@ -126,7 +131,12 @@ static int32_t raftLogRestoreFromSnapshot(struct SSyncLogStore* pLogStore, SyncI
 
   SSyncLogStoreData* pData = pLogStore->data;
   SWal*              pWal = pData->pWal;
-  int32_t            code = walRestoreFromSnapshot(pWal, snapshotIndex);
+
+  taosThreadMutexLock(&(pData->mutex));
+  raftLogClearReadAhead(pData);
+  taosThreadMutexUnlock(&(pData->mutex));
+
+  int32_t code = walRestoreFromSnapshot(pWal, snapshotIndex);
   if (code != 0) {
     int32_t     err = terrno;
     const char* errStr = tstrerror(err);
@@ -251,23 +261,22 @@ static int32_t raftLogAppendEntry(struct SSyncLogStore* pLogStore, SSyncRaftEntr
 // entry found, return 0
 // entry not found, return -1, terrno = TSDB_CODE_WAL_LOG_NOT_EXIST
 // other error, return -1
-static int32_t raftLogGetEntry(struct SSyncLogStore* pLogStore, SyncIndex index, SSyncRaftEntry** ppEntry) {
-  SSyncLogStoreData* pData = pLogStore->data;
-  SWal*              pWal = pData->pWal;
-  int32_t            code = 0;
-
-  *ppEntry = NULL;
-
-  // SWalReadHandle* pWalHandle = walOpenReadHandle(pWal);
-  SWalReader* pWalHandle = pData->pWalHandle;
-  if (pWalHandle == NULL) {
-    terrno = TSDB_CODE_SYN_INTERNAL_ERROR;
-    return -1;
+// caller should hold pData->mutex
+static void raftLogClearReadAhead(SSyncLogStoreData* pData) {
+  SSyncLogReadAhead* pAhead = &pData->readAhead;
+  for (int32_t i = 0; i < pAhead->count; ++i) {
+    syncEntryDestory(pAhead->entries[i]);
+    pAhead->entries[i] = NULL;
   }
+  pAhead->beginIndex = SYNC_INDEX_INVALID;
+  pAhead->count = 0;
+  pAhead->bytes = 0;
+}
 
-  taosThreadMutexLock(&(pData->mutex));
-
-  code = walReadVer(pWalHandle, index);
+// caller should hold pData->mutex
+static int32_t raftLogReadEntry(SSyncLogStoreData* pData, SyncIndex index, SSyncRaftEntry** ppEntry) {
+  SWalReader* pWalHandle = pData->pWalHandle;
+  int32_t     code = walReadVer(pWalHandle, index);
   // code = walReadVerCached(pWalHandle, index);
   if (code != 0) {
     int32_t     err = terrno;
@@ -286,13 +295,6 @@ static int32_t raftLogGetEntry(struct SSyncLogStore* pLogStore, SyncIndex index,
       }
     } while (0);
 
-    /*
-        int32_t saveErr = terrno;
-        walCloseReadHandle(pWalHandle);
-        terrno = saveErr;
-    */
-
-    taosThreadMutexUnlock(&(pData->mutex));
     return code;
   }
 
@@ -307,16 +309,91 @@ static int32_t raftLogGetEntry(struct SSyncLogStore* pLogStore, SyncIndex index,
   ASSERT((*ppEntry)->dataLen == pWalHandle->pHead->head.bodyLen);
   memcpy((*ppEntry)->data, pWalHandle->pHead->head.body, pWalHandle->pHead->head.bodyLen);
 
-  /*
-    int32_t saveErr = terrno;
-    walCloseReadHandle(pWalHandle);
-    terrno = saveErr;
-  */
+  return code;
+}
+
+static int32_t raftLogGetEntry(struct SSyncLogStore* pLogStore, SyncIndex index, SSyncRaftEntry** ppEntry) {
+  SSyncLogStoreData* pData = pLogStore->data;
+  int32_t            code = 0;
+
+  *ppEntry = NULL;
+
+  // SWalReadHandle* pWalHandle = walOpenReadHandle(pWal);
+  if (pData->pWalHandle == NULL) {
+    terrno = TSDB_CODE_SYN_INTERNAL_ERROR;
+    return -1;
+  }
+
+  taosThreadMutexLock(&(pData->mutex));
+
+  SSyncLogReadAhead* pAhead = &pData->readAhead;
+  if (pAhead->count > 0 && index >= pAhead->beginIndex && index < pAhead->beginIndex + pAhead->count) {
+    SSyncRaftEntry* pEntry = pAhead->entries[index - pAhead->beginIndex];
+    *ppEntry = taosMemoryMalloc(pEntry->bytes);
+    ASSERT(*ppEntry != NULL);
+    memcpy(*ppEntry, pEntry, pEntry->bytes);
+  } else {
+    code = raftLogReadEntry(pData, index, ppEntry);
+  }
 
   taosThreadMutexUnlock(&(pData->mutex));
   return code;
 }
 
+// Read [beginIndex, beginIndex + count) from wal in one sequential pass, so that building the batches for a lagging
+// peer does not seek back and forth in the wal file for every entry and its pre-term. Entries already read ahead are
+// kept, return the number of entries available from beginIndex.
+int32_t logStoreReadAhead(SSyncLogStore* pLogStore, SyncIndex beginIndex, int32_t count) {
+  SSyncLogStoreData* pData = pLogStore->data;
+  SSyncLogReadAhead* pAhead = &pData->readAhead;
+
+  if (pData->pWalHandle == NULL || beginIndex < SYNC_INDEX_BEGIN) {
+    return 0;
+  }
+  count = TMIN(count, SYNC_READ_AHEAD_COUNT);
+
+  taosThreadMutexLock(&(pData->mutex));
+
+  if (pAhead->count > 0 && beginIndex >= pAhead->beginIndex && beginIndex < pAhead->beginIndex + pAhead->count) {
+    // drop the entries before beginIndex and move the rest to the front
+    int32_t skip = beginIndex - pAhead->beginIndex;
+    for (int32_t i = 0; i < skip; ++i) {
+      pAhead->bytes -= pAhead->entries[i]->bytes;
+      syncEntryDestory(pAhead->entries[i]);
+    }
+    memmove(pAhead->entries, pAhead->entries + skip, sizeof(SSyncRaftEntry*) * (pAhead->count - skip));
+    memset(pAhead->entries + pAhead->count - skip, 0, sizeof(SSyncRaftEntry*) * skip);
+    pAhead->count -= skip;
+    pAhead->beginIndex = beginIndex;
+  } else {
+    raftLogClearReadAhead(pData);
+    pAhead->beginIndex = beginIndex;
+  }
+
+  while (pAhead->count < count && pAhead->bytes < SYNC_READ_AHEAD_BYTES) {
+    SSyncRaftEntry* pEntry = NULL;
+    if (raftLogReadEntry(pData, pAhead->beginIndex + pAhead->count, &pEntry) != 0) {
+      break;
+    }
+
+    pAhead->entries[pAhead->count++] = pEntry;
+    pAhead->bytes += pEntry->bytes;
+  }
+
+  int32_t num = pAhead->count;
+  taosThreadMutexUnlock(&(pData->mutex));
+  return num;
+}
+
+// The entries read ahead are only kept while the batches are built, so an idle vnode holds no copy of its wal.
+void logStoreClearReadAhead(SSyncLogStore* pLogStore) {
+  SSyncLogStoreData* pData = pLogStore->data;
+
+  taosThreadMutexLock(&(pData->mutex));
+  raftLogClearReadAhead(pData);
+  taosThreadMutexUnlock(&(pData->mutex));
+}
+
 // truncate semantic
 static int32_t raftLogTruncate(struct SSyncLogStore* pLogStore, SyncIndex fromIndex) {
   SSyncLogStoreData* pData = pLogStore->data;
@@ -328,6 +405,10 @@ static int32_t raftLogTruncate(struct SSyncLogStore* pLogStore, SyncIndex fromIn
     return 0;
   }
 
+  taosThreadMutexLock(&(pData->mutex));
+  raftLogClearReadAhead(pData);
+  taosThreadMutexUnlock(&(pData->mutex));
+
   int32_t code = walRollback(pWal, fromIndex);
   if (code != 0) {
     int32_t     err = terrno;
@@ -482,6 +563,10 @@ SSyncRaftEntry* logStoreGetEntry(SSyncLogStore* pLogStore, SyncIndex index) {
 int32_t logStoreTruncate(SSyncLogStore* pLogStore, SyncIndex fromIndex) {
   SSyncLogStoreData* pData = pLogStore->data;
   SWal*              pWal = pData->pWal;
+  taosThreadMutexLock(&(pData->mutex));
+  raftLogClearReadAhead(pData);
+  taosThreadMutexUnlock(&(pData->mutex));
+
   // ASSERT(walRollback(pWal, fromIndex) == 0);
   int32_t code = walRollback(pWal, fromIndex);
   if (code != 0) {
@@ -116,7 +116,8 @@ int32_t syncNodeAppendEntriesPeers(SSyncNode* pSyncNode) {
   return ret;
 }
 
-int32_t syncNodeAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, SyncIndex nextIndex) {
+static int32_t syncNodeDoAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, SyncIndex nextIndex,
+                                              int32_t* pCount) {
   int32_t ret = 0;
 
   // pre index, pre term
@@ -190,6 +191,9 @@ int32_t syncNodeAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, Syn
 
   // send msg
   syncNodeAppendEntriesBatch(pSyncNode, pDestId, pMsg);
+  if (pCount != NULL) {
+    *pCount = getCount;
+  }
 
   // speed up
   if (pMsg->dataCount > 0 && pSyncNode->commitIndex - pMsg->prevLogIndex > SYNC_SLOW_DOWN_RANGE) {
@@ -212,6 +216,102 @@ int32_t syncNodeAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, Syn
   return ret;
 }
 
+int32_t syncNodeAppendEntriesOnePeer(SSyncNode* pSyncNode, SRaftId* pDestId, SyncIndex nextIndex) {
+  return syncNodeDoAppendEntriesOnePeer(pSyncNode, pDestId, nextIndex, NULL);
+}
+
+// Pipelined replication: once a peer has accepted a batch, up to pipelineWindow batches are sent to it without
+// waiting for the replies, each one starting right after the last index sent. A rejected batch or a peer that stays
+// silent puts it back to the one batch per reply mode, which restarts from its next-index.
+void syncNodeResetPipeline(SSyncNode* pSyncNode) {
+  for (int i = 0; i < TSDB_MAX_REPLICA; ++i) {
+    pSyncNode->pSendIndex->index[i] = SYNC_INDEX_INVALID;
+  }
+}
+
+void syncNodeStartPipeline(SSyncNode* pSyncNode, const SRaftId* pDestId, SyncIndex matchIndex) {
+  if (pSyncNode->pipelineWindow <= 1) {
+    return;
+  }
+
+  SyncIndex sendIndex = syncIndexMgrGetIndex(pSyncNode->pSendIndex, pDestId);
+  if (sendIndex < matchIndex) {
+    syncIndexMgrSetIndex(pSyncNode->pSendIndex, pDestId, matchIndex);
+  }
+}
+
+void syncNodeStopPipeline(SSyncNode* pSyncNode, const SRaftId* pDestId, const char* reason) {
+  SyncIndex sendIndex = syncIndexMgrGetIndex(pSyncNode->pSendIndex, pDestId);
+  if (sendIndex == SYNC_INDEX_INVALID) {
+    return;
+  }
+
+  syncIndexMgrSetIndex(pSyncNode->pSendIndex, pDestId, SYNC_INDEX_INVALID);
+
+  do {
+    char     logBuf[128];
+    char     host[64];
+    uint16_t port;
+    syncUtilU642Addr(pDestId->addr, host, sizeof(host), &port);
+    snprintf(logBuf, sizeof(logBuf), "stop pipeline for %s:%d, send-index:%" PRId64 ", since %s", host, port,
+             sendIndex, reason);
+    syncNodeEventLog(pSyncNode, logBuf);
+  } while (0);
+}
+
+int32_t syncNodeAppendEntriesPipeline(SSyncNode* pSyncNode, SRaftId* pDestId) {
+  SyncIndex nextIndex = syncIndexMgrGetIndex(pSyncNode->pNextIndex, pDestId);
+  SyncIndex sendIndex = syncIndexMgrGetIndex(pSyncNode->pSendIndex, pDestId);
+
+  // batches in flight but no reply for a long time, some of them may be lost
+  if (sendIndex >= nextIndex) {
+    int64_t recvTime = syncIndexMgrGetRecvTime(pSyncNode->pNextIndex, pDestId);
+    if (taosGetTimestampMs() - recvTime > SYNC_PIPELINE_TIMEOUT_MS) {
+      syncNodeStopPipeline(pSyncNode, pDestId, "reply timeout");
+      sendIndex = SYNC_INDEX_INVALID;
+    }
+  }
+
+  if (sendIndex == SYNC_INDEX_INVALID) {
+    return syncNodeAppendEntriesOnePeer(pSyncNode, pDestId, nextIndex);
+  }
+
+  SyncIndex lastIndex = syncNodeGetLastIndex(pSyncNode);
+  SyncIndex fromIndex = TMAX(nextIndex, sendIndex + 1);
+  int32_t   batchSize = TMAX(pSyncNode->pRaftCfg->batchSize, 1);
+  SyncIndex endIndex = TMIN(lastIndex, nextIndex + (SyncIndex)pSyncNode->pipelineWindow * batchSize - 1);
+
+  if (fromIndex > endIndex) {
+    if (sendIndex < nextIndex) {
+      // nothing in flight and nothing new, keep the peer alive as before
+      return syncNodeAppendEntriesOnePeer(pSyncNode, pDestId, nextIndex);
+    }
+
+    // window is full, the replies of the batches in flight will move it forward
+    return 0;
+  }
+
+  // the pre-term of the first batch is read ahead as well
+  logStoreReadAhead(pSyncNode->pLogStore, fromIndex - 1, (int32_t)(endIndex - fromIndex + 2));
+
+  int32_t ret = 0;
+  while (fromIndex <= endIndex) {
+    int32_t count = 0;
+    int32_t code = syncNodeDoAppendEntriesOnePeer(pSyncNode, pDestId, fromIndex, &count);
+    if (code < 0 || count <= 0) {
+      break;
+    }
+
+    ret = TMAX(ret, code);
+    fromIndex += count;
+    syncIndexMgrSetIndex(pSyncNode->pSendIndex, pDestId, fromIndex - 1);
+  }
+
+  // the window has been sent, the next call starts after it and would not hit the buffered entries
+  logStoreClearReadAhead(pSyncNode->pLogStore);
+  return ret;
+}
+
 int32_t syncNodeAppendEntriesPeersSnapshot2(SSyncNode* pSyncNode) {
   if (pSyncNode->state != TAOS_SYNC_STATE_LEADER) {
     return -1;
@@ -221,9 +321,13 @@ int32_t syncNodeAppendEntriesPeersSnapshot2(SSyncNode* pSyncNode) {
   for (int i = 0; i < pSyncNode->peersNum; ++i) {
     SRaftId* pDestId = &(pSyncNode->peersId[i]);
 
-    // next index
-    SyncIndex nextIndex = syncIndexMgrGetIndex(pSyncNode->pNextIndex, pDestId);
-    ret = syncNodeAppendEntriesOnePeer(pSyncNode, pDestId, nextIndex);
+    if (pSyncNode->pipelineWindow > 1) {
+      ret = syncNodeAppendEntriesPipeline(pSyncNode, pDestId);
+    } else {
+      // next index
+      SyncIndex nextIndex = syncIndexMgrGetIndex(pSyncNode->pNextIndex, pDestId);
+      ret = syncNodeAppendEntriesOnePeer(pSyncNode, pDestId, nextIndex);
+    }
   }
 
   return ret;
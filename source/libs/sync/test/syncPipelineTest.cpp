@@ -0,0 +1,430 @@
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <vector>
+#include "syncEnv.h"
+#include "syncIO.h"
+#include "syncIndexMgr.h"
+#include "syncInt.h"
+#include "syncRaftCfg.h"
+#include "syncRaftLog.h"
+#include "syncRaftStore.h"
+#include "syncReplication.h"
+#include "syncSnapshot.h"
+#include "syncUtil.h"
+#include "wal.h"
+
+void logTest() {
+  sTrace("--- sync log test: trace");
+  sDebug("--- sync log test: debug");
+  sInfo("--- sync log test: info");
+  sWarn("--- sync log test: warn");
+  sError("--- sync log test: error");
+  sFatal("--- sync log test: fatal");
+}
+
+const char* pWalPath = "./syncPipelineTest_wal";
+SWal*       pWal;
+SSyncNode*  pSyncNode;
+SyncTerm    gTerm = 100;
+
+// what the node sent, in order
+typedef struct SSentMsg {
+  tmsg_t    msgType;
+  SyncIndex prevLogIndex;
+  int32_t   dataCount;
+  bool      success;
+  SyncIndex matchIndex;
+} SSentMsg;
+
+std::vector<SSentMsg> gSent;
+
+int32_t GetSnapshotCb(struct SSyncFSM* pFsm, SSnapshot* pSnapshot) {
+  pSnapshot->data = NULL;
+  pSnapshot->lastApplyIndex = SYNC_INDEX_INVALID;
+  pSnapshot->lastApplyTerm = 0;
+  pSnapshot->lastConfigIndex = SYNC_INDEX_INVALID;
+  return 0;
+}
+
+int32_t SendMsgCb(const SEpSet* pEpSet, SRpcMsg* pMsg) {
+  syncUtilMsgNtoH(pMsg->pCont);
+
+  SSentMsg sent = {.msgType = pMsg->msgType};
+  if (pMsg->msgType == TDMT_SYNC_APPEND_ENTRIES_BATCH) {
+    SyncAppendEntriesBatch* pBatch = syncAppendEntriesBatchFromRpcMsg2(pMsg);
+    sent.prevLogIndex = pBatch->prevLogIndex;
+    sent.dataCount = pBatch->dataCount;
+    syncAppendEntriesBatchDestroy(pBatch);
+  } else if (pMsg->msgType == TDMT_SYNC_APPEND_ENTRIES_REPLY) {
+    SyncAppendEntriesReply* pReply = syncAppendEntriesReplyFromRpcMsg2(pMsg);
+    sent.success = pReply->success;
+    sent.matchIndex = pReply->matchIndex;
+    syncAppendEntriesReplyDestroy(pReply);
+  }
+
+  gSent.push_back(sent);
+  rpcFreeCont(pMsg->pCont);
+  return 0;
+}
+
+SSyncRaftEntry* createEntry(SyncIndex index, SyncTerm term) {
+  int32_t         dataLen = 20;
+  SSyncRaftEntry* pEntry = syncEntryBuild(dataLen);
+  assert(pEntry != NULL);
+  pEntry->msgType = TDMT_SYNC_CLIENT_REQUEST;
+  pEntry->originalRpcType = TDMT_VND_SUBMIT;
+  pEntry->seqNum = index;
+  pEntry->isWeak = true;
+  pEntry->term = term;
+  pEntry->index = index;
+  snprintf(pEntry->data, dataLen, "value%" PRId64, index);
+  return pEntry;
+}
+
+void appendEntries(int32_t count, SyncTerm term) {
+  SSyncLogStore* pLogStore = pSyncNode->pLogStore;
+  for (int32_t i = 0; i < count; ++i) {
+    SSyncRaftEntry* pEntry = createEntry(pLogStore->syncLogWriteIndex(pLogStore), term);
+    int32_t         code = pLogStore->syncLogAppendEntry(pLogStore, pEntry);
+    assert(code == 0);
+    syncEntryDestory(pEntry);
+  }
+}
+
+// three replicas with quorum 3, the second peer never replies, so nothing gets committed
+void init(ESyncState state) {
+  taosRemoveDir(pWalPath);
+
+  walInit();
+  SWalCfg walCfg;
+  memset(&walCfg, 0, sizeof(SWalCfg));
+  walCfg.vgId = 1000;
+  walCfg.fsyncPeriod = 1000;
+  walCfg.retentionPeriod = 1000;
+  walCfg.rollPeriod = 1000;
+  walCfg.retentionSize = 1000;
+  walCfg.segSize = 1000;
+  walCfg.level = TAOS_WAL_FSYNC;
+  pWal = walOpen(pWalPath, &walCfg);
+  assert(pWal != NULL);
+
+  pSyncNode = (SSyncNode*)taosMemoryCalloc(1, sizeof(SSyncNode));
+  pSyncNode->vgId = 1000;
+  pSyncNode->pWal = pWal;
+  pSyncNode->state = state;
+  pSyncNode->commitIndex = SYNC_INDEX_INVALID;
+  pSyncNode->FpSendMsg = SendMsgCb;
+  pSyncNode->pipelineWindow = 4;
+  pSyncNode->electBaseLine = 500;
+
+  pSyncNode->replicaNum = 3;
+  pSyncNode->quorum = 3;
+  pSyncNode->peersNum = 2;
+  for (int32_t i = 0; i < pSyncNode->replicaNum; ++i) {
+    pSyncNode->replicasId[i].addr = syncUtilAddr2U64("127.0.0.1", 7010 + i);
+    pSyncNode->replicasId[i].vgId = 1000;
+  }
+  pSyncNode->myRaftId = pSyncNode->replicasId[0];
+  pSyncNode->peersId[0] = pSyncNode->replicasId[1];
+  pSyncNode->peersId[1] = pSyncNode->replicasId[2];
+
+  pSyncNode->pFsm = (SSyncFSM*)taosMemoryCalloc(1, sizeof(SSyncFSM));
+  pSyncNode->pFsm->FpGetSnapshotInfo = GetSnapshotCb;
+  pSyncNode->pRaftCfg = (SRaftCfg*)taosMemoryCalloc(1, sizeof(SRaftCfg));
+  pSyncNode->pRaftCfg->batchSize = 1;
+  pSyncNode->pRaftStore = (SRaftStore*)taosMemoryCalloc(1, sizeof(SRaftStore));
+  pSyncNode->pRaftStore->currentTerm = gTerm;
+  pSyncNode->pNewNodeReceiver = (SSyncSnapshotReceiver*)taosMemoryCalloc(1, sizeof(SSyncSnapshotReceiver));
+
+  pSyncNode->pNextIndex = syncIndexMgrCreate(pSyncNode);
+  pSyncNode->pMatchIndex = syncIndexMgrCreate(pSyncNode);
+  pSyncNode->pSendIndex = syncIndexMgrCreate(pSyncNode);
+  for (int32_t i = 0; i < pSyncNode->replicaNum; ++i) {
+    pSyncNode->pMatchIndex->index[i] = SYNC_INDEX_INVALID;
+  }
+  syncNodeResetPipeline(pSyncNode);
+
+  pSyncNode->pLogStore = logStoreCreate(pSyncNode);
+  assert(pSyncNode->pLogStore != NULL);
+
+  gSent.clear();
+}
+
+void cleanup() {
+  logStoreDestory(pSyncNode->pLogStore);
+  syncIndexMgrDestroy(pSyncNode->pNextIndex);
+  syncIndexMgrDestroy(pSyncNode->pMatchIndex);
+  syncIndexMgrDestroy(pSyncNode->pSendIndex);
+  taosMemoryFree(pSyncNode->pNewNodeReceiver);
+  taosMemoryFree(pSyncNode->pRaftStore);
+  taosMemoryFree(pSyncNode->pRaftCfg);
+  taosMemoryFree(pSyncNode->pFsm);
+  taosMemoryFree(pSyncNode);
+  pSyncNode = NULL;
+
+  walClose(pWal);
+  walCleanUp();
+  taosRemoveDir(pWalPath);
+}
+
+void recvReply(SRaftId* pPeer, bool success, SyncIndex matchIndex) {
+  SyncAppendEntriesReply* pReply = syncAppendEntriesReplyBuild(pSyncNode->vgId);
+  pReply->srcId = *pPeer;
+  pReply->destId = pSyncNode->myRaftId;
+  pReply->term = gTerm;
+  pReply->success = success;
+  pReply->matchIndex = matchIndex;
+  pReply->startTime = pSyncNode->startTime;
+  syncNodeOnAppendEntriesReplySnapshot2Cb(pSyncNode, pReply);
+  syncAppendEntriesReplyDestroy(pReply);
+}
+
+// the batches sent since the last check must be exactly [beginIndex, endIndex], one entry each
+void checkSentBatches(SyncIndex beginIndex, SyncIndex endIndex) {
+  assert(gSent.size() == endIndex - beginIndex + 1);
+  for (SyncIndex index = beginIndex; index <= endIndex; ++index) {
+    SSentMsg* pSent = &gSent[index - beginIndex];
+    assert(pSent->msgType == TDMT_SYNC_APPEND_ENTRIES_BATCH);
+    assert(pSent->prevLogIndex == index - 1);
+    assert(pSent->dataCount == 1);
+  }
+  gSent.clear();
+}
+
+void checkEntry(SyncIndex index) {
+  SSyncRaftEntry* pEntry = NULL;
+  int32_t         code = pSyncNode->pLogStore->syncLogGetEntry(pSyncNode->pLogStore, index, &pEntry);
+  assert(code == 0);
+  assert(pEntry->index == index);
+  assert(pEntry->term == gTerm);
+
+  char value[20];
+  snprintf(value, sizeof(value), "value%" PRId64, index);
+  assert(strcmp(pEntry->data, value) == 0);
+  syncEntryDestory(pEntry);
+}
+
+void test1() {
+  // read ahead
+  init(TAOS_SYNC_STATE_FOLLOWER);
+  appendEntries(SYNC_READ_AHEAD_COUNT + 72, gTerm);
+
+  SSyncLogStoreData* pData = (SSyncLogStoreData*)pSyncNode->pLogStore->data;
+  SSyncLogReadAhead* pAhead = &pData->readAhead;
+
+  int32_t num = logStoreReadAhead(pSyncNode->pLogStore, 3, 5);
+  assert(num == 5);
+  assert(pAhead->beginIndex == 3);
+  for (SyncIndex index = 3; index < 8; ++index) {
+    checkEntry(index);
+  }
+
+  // slide forward, the overlapped entries are kept and the rest read from wal
+  num = logStoreReadAhead(pSyncNode->pLogStore, 5, 5);
+  assert(num == 5);
+  assert(pAhead->beginIndex == 5);
+  for (SyncIndex index = 5; index < 10; ++index) {
+    checkEntry(index);
+  }
+
+  // out of the buffered range, read again from the new position
+  num = logStoreReadAhead(pSyncNode->pLogStore, 100, 3);
+  assert(num == 3);
+  assert(pAhead->beginIndex == 100);
+  checkEntry(4);
+
+  // bounded by the buffer size and by the end of log
+  num = logStoreReadAhead(pSyncNode->pLogStore, 0, SYNC_READ_AHEAD_COUNT * 2);
+  assert(num == SYNC_READ_AHEAD_COUNT);
+  num = logStoreReadAhead(pSyncNode->pLogStore, SYNC_READ_AHEAD_COUNT + 70, 10);
+  assert(num == 2);
+  num = logStoreReadAhead(pSyncNode->pLogStore, SYNC_READ_AHEAD_COUNT + 72, 10);
+  assert(num == 0);
+
+  // truncate drops the buffer, the removed entries are not served any more
+  num = logStoreReadAhead(pSyncNode->pLogStore, 150, 20);
+  assert(num == 20);
+  int32_t code = pSyncNode->pLogStore->syncLogTruncate(pSyncNode->pLogStore, 160);
+  assert(code == 0);
+  assert(pAhead->count == 0);
+
+  SSyncRaftEntry* pEntry = NULL;
+  code = pSyncNode->pLogStore->syncLogGetEntry(pSyncNode->pLogStore, 165, &pEntry);
+  assert(code != 0);
+  num = logStoreReadAhead(pSyncNode->pLogStore, 150, 20);
+  assert(num == 10);
+
+  cleanup();
+}
+
+void test2() {
+  // pipelined batches with replies in order, out of order, and at the end of log
+  init(TAOS_SYNC_STATE_LEADER);
+  appendEntries(20, gTerm);
+  SRaftId* pPeer = &pSyncNode->peersId[0];
+
+  // not pipelining yet, one batch per reply
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  checkSentBatches(0, 0);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == SYNC_INDEX_INVALID);
+
+  // the first accepted batch fills the window
+  recvReply(pPeer, true, 0);
+  checkSentBatches(1, 4);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == 4);
+
+  // the entries read ahead for the window are released once it is sent
+  SSyncLogStoreData* pData = (SSyncLogStoreData*)pSyncNode->pLogStore->data;
+  assert(pData->readAhead.count == 0);
+  assert(pData->readAhead.beginIndex == SYNC_INDEX_INVALID);
+
+  // window full, nothing more until a reply
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  assert(gSent.size() == 0);
+
+  // a later batch is acknowledged first
+  recvReply(pPeer, true, 2);
+  checkSentBatches(5, 6);
+  assert(syncIndexMgrGetIndex(pSyncNode->pNextIndex, pPeer) == 3);
+  assert(syncIndexMgrGetIndex(pSyncNode->pMatchIndex, pPeer) == 2);
+
+  // the reply of the older batch must not move the peer backward
+  recvReply(pPeer, true, 1);
+  assert(gSent.size() == 0);
+  assert(syncIndexMgrGetIndex(pSyncNode->pNextIndex, pPeer) == 3);
+  assert(syncIndexMgrGetIndex(pSyncNode->pMatchIndex, pPeer) == 2);
+
+  recvReply(pPeer, true, 6);
+  checkSentBatches(7, 10);
+  recvReply(pPeer, true, 10);
+  checkSentBatches(11, 14);
+  recvReply(pPeer, true, 14);
+  checkSentBatches(15, 18);
+
+  // the window is cut at the last index
+  recvReply(pPeer, true, 18);
+  checkSentBatches(19, 19);
+  recvReply(pPeer, true, 19);
+  assert(gSent.size() == 0);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == 19);
+
+  // caught up, the heartbeat path still sends an empty batch
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  assert(gSent.size() == 1);
+  assert(gSent[0].prevLogIndex == 19);
+  assert(gSent[0].dataCount == 0);
+  gSent.clear();
+
+  // new entries go out as a window from next-index
+  appendEntries(10, gTerm);
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  checkSentBatches(20, 23);
+
+  // nothing is committed without the other peer
+  assert(pSyncNode->commitIndex == SYNC_INDEX_INVALID);
+
+  cleanup();
+}
+
+void test3() {
+  // rejected batches and lost replies fall back to one batch per reply
+  init(TAOS_SYNC_STATE_LEADER);
+  appendEntries(20, gTerm);
+  SRaftId* pPeer = &pSyncNode->peersId[0];
+
+  syncIndexMgrSetIndex(pSyncNode->pNextIndex, pPeer, 5);
+  recvReply(pPeer, true, 4);
+  checkSentBatches(5, 8);
+
+  // a batch in the window is rejected
+  recvReply(pPeer, false, 4);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == SYNC_INDEX_INVALID);
+  assert(gSent.size() == 0);
+
+  SyncIndex nextIndex = syncIndexMgrGetIndex(pSyncNode->pNextIndex, pPeer);
+  assert(nextIndex == 4);
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  checkSentBatches(nextIndex, nextIndex);
+
+  // accepted again, back to pipelining
+  recvReply(pPeer, true, 4);
+  checkSentBatches(5, 8);
+
+  // the replies of the window are lost
+  syncIndexMgrSetRecvTime(pSyncNode->pNextIndex, pPeer, taosGetTimestampMs() - SYNC_PIPELINE_TIMEOUT_MS - 1);
+  syncNodeAppendEntriesPipeline(pSyncNode, pPeer);
+  checkSentBatches(5, 5);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == SYNC_INDEX_INVALID);
+
+  // window of one is the old behavior
+  pSyncNode->pipelineWindow = 1;
+  recvReply(pPeer, true, 5);
+  assert(gSent.size() == 0);
+  assert(syncIndexMgrGetIndex(pSyncNode->pSendIndex, pPeer) == SYNC_INDEX_INVALID);
+
+  cleanup();
+}
+
+SyncAppendEntriesBatch* createBatch(SyncIndex index, SyncTerm entryTerm, SyncTerm prevLogTerm) {
+  SSyncRaftEntry*         pEntry = createEntry(index, entryTerm);
+  SyncAppendEntriesBatch* pMsg = syncAppendEntriesBatchBuild(&pEntry, 1, pSyncNode->vgId);
+  syncEntryDestory(pEntry);
+
+  pMsg->srcId = pSyncNode->replicasId[1];
+  pMsg->destId = pSyncNode->myRaftId;
+  pMsg->term = pSyncNode->pRaftStore->currentTerm;
+  pMsg->prevLogIndex = index - 1;
+  pMsg->prevLogTerm = prevLogTerm;
+  pMsg->commitIndex = SYNC_INDEX_INVALID;
+  pMsg->privateTerm = 0;
+  pMsg->dataCount = 1;
+  return pMsg;
+}
+
+void test4() {
+  // follower receives a resent or reordered batch
+  init(TAOS_SYNC_STATE_FOLLOWER);
+  appendEntries(10, gTerm);
+
+  // already in the log with the same term, acknowledged without rolling back the entries after it
+  SyncAppendEntriesBatch* pMsg = createBatch(5, gTerm, gTerm);
+  syncNodeOnAppendEntriesSnapshot2Cb(pSyncNode, pMsg);
+  syncAppendEntriesBatchDestroy(pMsg);
+
+  assert(syncNodeGetLastIndex(pSyncNode) == 9);
+  assert(gSent.size() == 1);
+  assert(gSent[0].msgType == TDMT_SYNC_APPEND_ENTRIES_REPLY);
+  assert(gSent[0].success);
+  assert(gSent[0].matchIndex == 5);
+  gSent.clear();
+  for (SyncIndex index = 0; index <= 9; ++index) {
+    checkEntry(index);
+  }
+
+  // a conflicting entry from a newer leader still rolls the log back
+  pSyncNode->pRaftStore->currentTerm = gTerm + 1;
+  pMsg = createBatch(5, gTerm + 1, gTerm);
+  syncNodeOnAppendEntriesSnapshot2Cb(pSyncNode, pMsg);
+  syncAppendEntriesBatchDestroy(pMsg);
+
+  assert(syncNodeGetLastIndex(pSyncNode) == 5);
+  assert(syncNodeGetLastTerm(pSyncNode) == gTerm + 1);
+  assert(gSent.size() == 1);
+  assert(gSent[0].success);
+  assert(gSent[0].matchIndex == 5);
+
+  cleanup();
+}
+
+int main(int argc, char** argv) {
+  tsAsyncLog = 0;
+  sDebugFlag = DEBUG_TRACE + DEBUG_INFO + DEBUG_SCREEN + DEBUG_FILE;
+  gRaftDetailLog = true;
+
+  test1();
+  test2();
+  test3();
+  test4();
+
+  return 0;
+}
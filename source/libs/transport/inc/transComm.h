@@ -104,6 +104,17 @@ typedef void* queue[2];
 
 #define TRANS_NOVALID_PACKET(src) ((src) != TRANS_MAGIC_NUM ? 1 : 0)
 
+// msgs queued on a conn while a write is in flight are coalesced into one vectored write
+#define TRANS_WRITE_BATCH_NUM  32
+#define TRANS_WRITE_BATCH_SIZE (64 * 1024)
+
+// compression algorithm recorded in STransMsgHead.comp
+#define TRANS_COMP_NONE    0
+#define TRANS_COMP_LZ4     1
+#define TRANS_COMP_DEFLATE 2
+
+#define TRANS_LZ4_FAST_ACCELERATION 8
+
 #define TRANS_PACKET_LIMIT 1024 * 1024 * 512
 
 #define TRANS_MAGIC_NUM 0x5f375a86
@@ -153,7 +164,7 @@ typedef struct {
 
 typedef struct {
   char version : 4;  // RPC version
-  char comp : 2;     // compression algorithm, 0:no compression 1:lz4
+  char comp : 2;     // compression algorithm, 0:no compression 1:lz4 2:deflate
   char noResp : 2;   // noResp bits, 0: resp, 1: resp
   char persist : 2;  // persist handle,0: no persit, 1: persist handle
   char release : 2;
@@ -414,7 +425,7 @@ void transInit();
 void transCleanup();
 
 void    transFreeMsg(void* msg);
-int32_t transCompressMsg(char* msg, int32_t len);
+int32_t transCompressMsg(char* msg, int32_t len, int8_t compType);
 int32_t transDecompressMsg(char** msg, int32_t len);
 
 int32_t transOpenRefMgt(int size, void (*func)(void*));
@@ -714,21 +714,25 @@ static void cliDestroy(uv_handle_t* handle) {
 }
 static bool cliHandleNoResp(SCliConn* conn) {
   bool res = false;
-  if (!transQueueEmpty(&conn->cliMsgs)) {
+  // one write may carry several no-resp msgs, release all of them
+  while (!transQueueEmpty(&conn->cliMsgs)) {
     SCliMsg* pMsg = transQueueGet(&conn->cliMsgs, 0);
-    if (REQUEST_NO_RESP(&pMsg->msg)) {
-      transQueuePop(&conn->cliMsgs);
-      destroyCmsg(pMsg);
-      res = true;
+    if (pMsg->sent == 0 || !REQUEST_NO_RESP(&pMsg->msg)) {
+      break;
     }
-    if (res == true) {
-      if (cliMaySendCachedMsg(conn) == false) {
+    transQueuePop(&conn->cliMsgs);
+    destroyCmsg(pMsg);
+    res = true;
+  }
+  if (res == true) {
+    if (cliMaySendCachedMsg(conn) == false) {
+      if (transQueueEmpty(&conn->cliMsgs)) {
         SCliThrd* thrd = conn->hostThrd;
         addConnToPool(thrd->pool, conn);
-        res = false;
-      } else {
-        res = true;
       }
+      res = false;
+    } else {
+      res = true;
     }
   }
   return res;
@@ -748,14 +752,14 @@ static void cliSendCb(uv_write_t* req, int status) {
     tTrace("%s conn %p no resp required", CONN_GET_INST_LABEL(pConn), pConn);
     return;
   }
+  // flush the msgs queued while the write was in flight
+  if (!transQueueEmpty(&pConn->cliMsgs)) {
+    cliSend(pConn);
+  }
   uv_read_start((uv_stream_t*)pConn->stream, cliAllocRecvBufferCb, cliRecvCb);
 }
 
-void cliSend(SCliConn* pConn) {
-  assert(!transQueueEmpty(&pConn->cliMsgs));
-
-  SCliMsg* pCliMsg = NULL;
-  CONN_GET_NEXT_SENDMSG(pConn);
+static void cliPrepareSendData(SCliConn* pConn, SCliMsg* pCliMsg, uv_buf_t* wb) {
   pCliMsg->sent = 1;
 
   STransConnCtx* pCtx = pCliMsg->ctx;
@@ -786,7 +790,7 @@ void cliSend(SCliConn* pConn) {
 
   STraceId* trace = &pMsg->info.traceId;
 
-  if (pTransInst->startTimer != NULL && pTransInst->startTimer(0, pMsg->msgType)) {
+  if (pConn->timer == NULL && pTransInst->startTimer != NULL && pTransInst->startTimer(0, pMsg->msgType)) {
     uv_timer_t* timer = taosArrayGetSize(pThrd->timerList) > 0 ? *(uv_timer_t**)taosArrayPop(pThrd->timerList) : NULL;
     if (timer == NULL) {
       timer = taosMemoryCalloc(1, sizeof(uv_timer_t));
@@ -801,19 +805,45 @@ void cliSend(SCliConn* pConn) {
   }
 
   if (pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
-    msgLen = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
+    int8_t compType = pTransInst->compType != NULL ? pTransInst->compType(pMsg->msgType) : RPC_COMP_LZ4;
+    msgLen = transCompressMsg(pMsg->pCont, pMsg->contLen, compType) + sizeof(STransMsgHead);
     pHead->msgLen = (int32_t)htonl((uint32_t)msgLen);
   }
   tGDebug("%s conn %p %s is sent to %s, local info %s, len:%d", CONN_GET_INST_LABEL(pConn), pConn,
           TMSG_INFO(pHead->msgType), pConn->dst, pConn->src, msgLen);
 
-  uv_buf_t    wb = uv_buf_init((char*)pHead, msgLen);
+  *wb = uv_buf_init((char*)pHead, msgLen);
+}
+
+void cliSend(SCliConn* pConn) {
+  assert(!transQueueEmpty(&pConn->cliMsgs));
+
+  SCliMsg* pCliMsg = NULL;
+  CONN_GET_NEXT_SENDMSG(pConn);
+
+  // all the unsent msgs of the conn go out with one vectored write
+  uv_buf_t wb[TRANS_WRITE_BATCH_NUM];
+  int32_t  nBuf = 0;
+  int32_t  size = 0;
+  for (int32_t i = 0; i < transQueueSize(&pConn->cliMsgs) && nBuf < TRANS_WRITE_BATCH_NUM; i++) {
+    pCliMsg = transQueueGet(&pConn->cliMsgs, i);
+    if (pCliMsg->sent == 1) {
+      continue;
+    }
+    if (nBuf > 0 && size + transMsgLenFromCont(pCliMsg->msg.contLen) > TRANS_WRITE_BATCH_SIZE) {
+      break;
+    }
+    cliPrepareSendData(pConn, pCliMsg, &wb[nBuf]);
+    size += wb[nBuf].len;
+    nBuf++;
+  }
+
   uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
 
-  int status = uv_write(req, (uv_stream_t*)pConn->stream, &wb, 1, cliSendCb);
+  int status = uv_write(req, (uv_stream_t*)pConn->stream, wb, nBuf, cliSendCb);
   if (status != 0) {
-    tGError("%s conn %p failed to sent msg:%s, errmsg:%s", CONN_GET_INST_LABEL(pConn), pConn, TMSG_INFO(pMsg->msgType),
-            uv_err_name(status));
+    tError("%s conn %p failed to sent %d msgs, errmsg:%s", CONN_GET_INST_LABEL(pConn), pConn, nBuf,
+           uv_err_name(status));
     cliHandleExcept(pConn);
   }
   return;
@@ -989,7 +1019,10 @@ void cliHandleReq(SCliMsg* pMsg, SCliThrd* pThrd) {
   if (conn != NULL) {
     transCtxMerge(&conn->ctx, &pCtx->appCtx);
     transQueuePush(&conn->cliMsgs, pMsg);
-    cliSend(conn);
+    // a write is in flight, the msg is coalesced with others and sent after it finished
+    if (QUEUE_IS_EMPTY(&conn->wreqQueue)) {
+      cliSend(conn);
+    }
   } else {
     conn = cliCreateConn(pThrd);
 
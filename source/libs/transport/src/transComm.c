@@ -15,6 +15,7 @@
 #ifdef USE_UV
 
 #include "transComm.h"
+#include "zlib.h"
 
 #define BUFFER_CAP 4096
 
@@ -23,7 +24,7 @@ static TdThreadOnce transModuleInit = PTHREAD_ONCE_INIT;
 static int32_t refMgt;
 static int32_t instMgt;
 
-int32_t transCompressMsg(char* msg, int32_t len) {
+int32_t transCompressMsg(char* msg, int32_t len, int8_t compType) {
   int32_t        ret = 0;
   int            compHdr = sizeof(STransCompMsg);
   STransMsgHead* pHead = transHeadFromCont(msg);
@@ -35,7 +36,17 @@ int32_t transCompressMsg(char* msg, int32_t len) {
     return ret;
   }
 
-  int32_t clen = LZ4_compress_default(msg, buf, len, len + compHdr);
+  int32_t clen = 0;
+  int8_t  comp = TRANS_COMP_LZ4;
+  if (compType == RPC_COMP_DEFLATE) {
+    uLongf dstLen = len + compHdr;
+    clen = (compress2((Bytef*)buf, &dstLen, (const Bytef*)msg, len, Z_DEFAULT_COMPRESSION) == Z_OK) ? dstLen : 0;
+    comp = TRANS_COMP_DEFLATE;
+  } else if (compType == RPC_COMP_LZ4_FAST) {
+    clen = LZ4_compress_fast(msg, buf, len, len + compHdr, TRANS_LZ4_FAST_ACCELERATION);
+  } else {
+    clen = LZ4_compress_default(msg, buf, len, len + compHdr);
+  }
   /*
    * only the compressed size is less than the value of contLen - overhead, the compression is applied
    * The first four bytes is set to 0, the second four bytes are utilized to keep the original length of message
@@ -46,19 +57,20 @@ int32_t transCompressMsg(char* msg, int32_t len) {
     pComp->contLen = htonl(len);
     memcpy(msg + compHdr, buf, clen);
 
-    tDebug("compress rpc msg, before:%d, after:%d", len, clen);
+    tDebug("compress rpc msg, before:%d, after:%d, comp:%d", len, clen, comp);
     ret = clen + compHdr;
-    pHead->comp = 1;
+    pHead->comp = comp;
   } else {
     ret = len;
-    pHead->comp = 0;
+    pHead->comp = TRANS_COMP_NONE;
   }
   taosMemoryFree(buf);
   return ret;
 }
 int32_t transDecompressMsg(char** msg, int32_t len) {
   STransMsgHead* pHead = (STransMsgHead*)(*msg);
-  if (pHead->comp == 0) return 0;
+  int8_t         comp = pHead->comp & 0x3;
+  if (comp == TRANS_COMP_NONE) return 0;
 
   char*          pCont = transContFromHead(pHead);
   STransCompMsg* pComp = (STransCompMsg*)pCont;
@@ -67,8 +79,16 @@ int32_t transDecompressMsg(char** msg, int32_t len) {
   char*          buf = taosMemoryCalloc(1, oriLen + sizeof(STransMsgHead));
   STransMsgHead* pNewHead = (STransMsgHead*)buf;
 
-  int32_t decompLen = LZ4_decompress_safe(pCont + sizeof(STransCompMsg), pNewHead->content,
-                                          len - sizeof(STransMsgHead) - sizeof(STransCompMsg), oriLen);
+  int32_t compLen = len - sizeof(STransMsgHead) - sizeof(STransCompMsg);
+  int32_t decompLen = -1;
+  if (comp == TRANS_COMP_DEFLATE) {
+    uLongf dstLen = oriLen;
+    if (uncompress((Bytef*)pNewHead->content, &dstLen, (const Bytef*)pCont + sizeof(STransCompMsg), compLen) == Z_OK) {
+      decompLen = dstLen;
+    }
+  } else {
+    decompLen = LZ4_decompress_safe(pCont + sizeof(STransCompMsg), (char*)pNewHead->content, compLen, oriLen);
+  }
   memcpy((char*)pNewHead, (char*)pHead, sizeof(STransMsgHead));
 
   pNewHead->msgLen = htonl(oriLen + sizeof(STransMsgHead));
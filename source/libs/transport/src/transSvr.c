@@ -39,6 +39,7 @@ typedef struct SSvrConn {
   void*       ahandle;     //
   void*       hostThrd;
   STransQueue srvMsgs;
+  int32_t     sendCnt;  // num of srvMsgs coalesced into the write in flight
 
   SSvrRegArg regArg;
   bool       broken;  // conn broken;
@@ -332,11 +333,15 @@ void uvOnSendCb(uv_write_t* req, int status) {
   if (status == 0) {
     tTrace("conn %p data already was written on stream", conn);
     if (!transQueueEmpty(&conn->srvMsgs)) {
-      SSvrMsg*  msg = transQueuePop(&conn->srvMsgs);
-      STraceId* trace = &msg->msg.info.traceId;
-      tGDebug("conn %p write data out", conn);
+      SSvrMsg* msg = NULL;
+      for (int32_t i = 0; i < TMAX(conn->sendCnt, 1) && !transQueueEmpty(&conn->srvMsgs); i++) {
+        msg = transQueuePop(&conn->srvMsgs);
+        STraceId* trace = &msg->msg.info.traceId;
+        tGDebug("conn %p write data out", conn);
 
-      destroySmsg(msg);
+        destroySmsg(msg);
+      }
+      conn->sendCnt = 0;
       // send cached data
       if (!transQueueEmpty(&conn->srvMsgs)) {
         msg = (SSvrMsg*)transQueueGet(&conn->srvMsgs, 0);
@@ -415,7 +420,8 @@ static void uvPrepareSendData(SSvrMsg* smsg, uv_buf_t* wb) {
 
   STrans* pTransInst = pConn->pTransInst;
   if (pTransInst->compressSize != -1 && pTransInst->compressSize < pMsg->contLen) {
-    len = transCompressMsg(pMsg->pCont, pMsg->contLen) + sizeof(STransMsgHead);
+    int8_t compType = pTransInst->compType != NULL ? pTransInst->compType(pHead->msgType) : RPC_COMP_LZ4;
+    len = transCompressMsg(pMsg->pCont, pMsg->contLen, compType) + sizeof(STransMsgHead);
     pHead->msgLen = (int32_t)htonl((uint32_t)len);
   }
 
@@ -433,12 +439,27 @@ static FORCE_INLINE void uvStartSendRespImpl(SSvrMsg* smsg) {
     return;
   }
 
-  uv_buf_t wb;
-  uvPrepareSendData(smsg, &wb);
+  uv_buf_t wb[TRANS_WRITE_BATCH_NUM];
+  int32_t  nBuf = 0;
+  int32_t  size = 0;
+  uvPrepareSendData(smsg, &wb[nBuf]);
+  size += wb[nBuf++].len;
+
+  // normal resps queued behind the head while the last write was in flight go out together
+  for (int32_t i = 1; smsg->type == Normal && i < transQueueSize(&pConn->srvMsgs) && nBuf < TRANS_WRITE_BATCH_NUM;
+       i++) {
+    SSvrMsg* pNext = transQueueGet(&pConn->srvMsgs, i);
+    if (pNext->type != Normal || size + transMsgLenFromCont(pNext->msg.contLen) > TRANS_WRITE_BATCH_SIZE) {
+      break;
+    }
+    uvPrepareSendData(pNext, &wb[nBuf]);
+    size += wb[nBuf++].len;
+  }
+  pConn->sendCnt = nBuf;
 
   transRefSrvHandle(pConn);
   uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
-  uv_write(req, (uv_stream_t*)pConn->pTcp, &wb, 1, uvOnSendCb);
+  uv_write(req, (uv_stream_t*)pConn->pTcp, wb, nBuf, uvOnSendCb);
 }
 static void uvStartSendResp(SSvrMsg* smsg) {
   // impl
@@ -38,8 +38,10 @@ static void processContinueSend(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 static void processReleaseHandleCb(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 static void processRegisterFailure(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 static void processReq(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
+static void processEchoReq(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 // client process;
 static void processResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
+static void processEchoResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 class Client {
  public:
   void Init(int nThread) {
@@ -80,6 +82,13 @@ class Client {
     SemWait();
     *resp = this->resp;
   }
+  void SendAsync(SRpcMsg *req) {
+    SEpSet epSet = {0};
+    epSet.inUse = 0;
+    addEpIntoEpSet(&epSet, "127.0.0.1", 7000);
+
+    rpcSendRequest(this->transCli, &epSet, req, NULL);
+  }
   void SendAndRecvNoHandle(SRpcMsg *req, SRpcMsg *resp) {
     if (req->info.handle != NULL) {
       rpcReleaseHandle(req->info.handle, TAOS_CONN_CLIENT);
@@ -195,6 +204,25 @@ static void processRegisterFailure(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet)
   rpcMsg.code = 0;
   rpcSendResponse(&rpcMsg);
 }
+// the resp carries the content of the req back, or counts the no-resp req
+static int32_t numOfNoRespReq = 0;
+static void    processEchoReq(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet) {
+  // the server marks a no-resp req by refId -1
+  if (pMsg->info.refId == -1) {
+    atomic_add_fetch_32(&numOfNoRespReq, 1);
+    rpcFreeCont(pMsg->pCont);
+    return;
+  }
+
+  SRpcMsg rpcMsg = {0};
+  rpcMsg.pCont = rpcMallocCont(pMsg->contLen);
+  rpcMsg.contLen = pMsg->contLen;
+  memcpy(rpcMsg.pCont, pMsg->pCont, pMsg->contLen);
+  rpcMsg.info = pMsg->info;
+  rpcMsg.code = 0;
+  rpcFreeCont(pMsg->pCont);
+  rpcSendResponse(&rpcMsg);
+}
 // client process;
 static void processResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet) {
   Client *client = (Client *)parent;
@@ -202,6 +230,25 @@ static void processResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet) {
   client->SemPost();
   tDebug("received resp");
 }
+// the req content is filled with the low byte of its ahandle, the resp must carry it back to the same ahandle
+static int32_t numOfEchoResp = 0;
+static int32_t numOfEchoMismatch = 0;
+static void    processEchoResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet) {
+  Client *client = (Client *)parent;
+
+  char expect = (char)(int64_t)pMsg->info.ahandle;
+  bool match = (pMsg->code == 0);
+  for (int32_t i = 0; i < pMsg->contLen && match; i++) {
+    match = (((char *)pMsg->pCont)[i] == expect);
+  }
+  if (!match) {
+    atomic_add_fetch_32(&numOfEchoMismatch, 1);
+  }
+  atomic_add_fetch_32(&numOfEchoResp, 1);
+
+  client->SetResp(pMsg);
+  client->SemPost();
+}
 
 static void initEnv() {
   dDebugFlag = 143;
@@ -259,6 +306,8 @@ class TransObj {
   }
   void cliSendAndRecv(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecv(req, resp); }
   void cliSendAndRecvNoHandle(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecvNoHandle(req, resp); }
+  void cliSendAsync(SRpcMsg *req) { cli->SendAsync(req); }
+  void cliSemWait() { cli->SemWait(); }
 
   ~TransObj() {
     delete cli;
@@ -498,3 +547,91 @@ TEST_F(TransEnv, noResp) {
 
   // no resp
 }
+
+static void buildEchoReq(SRpcMsg *req, void *handle, int64_t ahandle, int32_t contLen) {
+  memset(req, 0, sizeof(SRpcMsg));
+  req->msgType = 1;
+  req->info.handle = handle;
+  req->info.ahandle = (void *)ahandle;
+  req->pCont = rpcMallocCont(contLen);
+  req->contLen = contLen;
+  memset(req->pCont, (char)ahandle, contLen);
+}
+
+TEST_F(TransEnv, batchSendOnPersistHandle) {
+  tr->SetSrvContinueSend(processEchoReq);
+  tr->RestartCli(processEchoResp);
+
+  SRpcMsg req = {0}, resp = {0};
+  buildEchoReq(&req, NULL, 1, 10);
+  req.info.persistHandle = 1;
+  tr->cliSendAndRecv(&req, &resp);
+  ASSERT_EQ(resp.code, 0);
+  void *handle = resp.info.handle;
+  ASSERT_TRUE(handle != NULL);
+
+  // the reqs on one conn are queued while the first write is in flight and sent together, more than
+  // TRANS_WRITE_BATCH_NUM of them and larger than TRANS_WRITE_BATCH_SIZE in total, and the server writes the resps
+  // queued on the conn in batches as well
+  atomic_store_32(&numOfEchoResp, 0);
+  atomic_store_32(&numOfEchoMismatch, 0);
+  const int32_t numOfReqs = 200;
+  for (int32_t i = 0; i < numOfReqs; i++) {
+    buildEchoReq(&req, handle, i + 2, (i * 7919) % 20000 + 1);
+    tr->cliSendAsync(&req);
+  }
+  for (int32_t i = 0; i < numOfReqs; i++) {
+    tr->cliSemWait();
+  }
+  EXPECT_EQ(atomic_load_32(&numOfEchoResp), numOfReqs);
+  EXPECT_EQ(atomic_load_32(&numOfEchoMismatch), 0);
+
+  rpcReleaseHandle(handle, TAOS_CONN_CLIENT);
+  taosMsleep(100);
+}
+
+TEST_F(TransEnv, batchSendNoResp) {
+  tr->SetSrvContinueSend(processEchoReq);
+  tr->RestartCli(processEchoResp);
+
+  SRpcMsg req = {0}, resp = {0};
+  buildEchoReq(&req, NULL, 1, 10);
+  req.info.persistHandle = 1;
+  tr->cliSendAndRecv(&req, &resp);
+  ASSERT_EQ(resp.code, 0);
+  void *handle = resp.info.handle;
+
+  // the no-resp reqs coalesced into one write are all released once it is finished, and the reqs behind them are
+  // sent out
+  atomic_store_32(&numOfNoRespReq, 0);
+  atomic_store_32(&numOfEchoResp, 0);
+  atomic_store_32(&numOfEchoMismatch, 0);
+  const int32_t numOfNoResp = 50;
+  for (int32_t i = 0; i < numOfNoResp; i++) {
+    buildEchoReq(&req, handle, i + 2, 100);
+    req.info.noResp = 1;
+    tr->cliSendAsync(&req);
+  }
+  for (int32_t i = 0; i < 10; i++) {
+    buildEchoReq(&req, handle, numOfNoResp + i + 2, 100);
+    tr->cliSendAsync(&req);
+  }
+  for (int32_t i = 0; i < 10; i++) {
+    tr->cliSemWait();
+  }
+  EXPECT_EQ(atomic_load_32(&numOfEchoResp), 10);
+  EXPECT_EQ(atomic_load_32(&numOfEchoMismatch), 0);
+
+  for (int32_t i = 0; i < 100 && atomic_load_32(&numOfNoRespReq) < numOfNoResp; i++) {
+    taosMsleep(10);
+  }
+  EXPECT_EQ(atomic_load_32(&numOfNoRespReq), numOfNoResp);
+
+  // the conn is still usable
+  buildEchoReq(&req, handle, 1, 10);
+  tr->cliSendAndRecv(&req, &resp);
+  EXPECT_EQ(resp.code, 0);
+
+  rpcReleaseHandle(handle, TAOS_CONN_CLIENT);
+  taosMsleep(100);
+}
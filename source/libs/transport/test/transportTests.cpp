@@ -136,6 +136,38 @@ TEST_F(QueueEnv, testIter) {
   assert(result.size() == vals.size());
 }
 
+TEST(TransCompTest, compressAndDecompress) {
+  const int32_t len = 64 * 1024;
+  for (int8_t compType = RPC_COMP_LZ4; compType <= RPC_COMP_DEFLATE; compType++) {
+    char          *msg = (char *)taosMemoryCalloc(1, sizeof(STransMsgHead) + len);
+    STransMsgHead *pHead = (STransMsgHead *)msg;
+    for (int32_t i = 0; i < len; i++) {
+      pHead->content[i] = 'a' + (i / 17) % 26;
+    }
+    std::string expect((char *)pHead->content, len);
+
+    int32_t msgLen = transCompressMsg((char *)pHead->content, len, compType) + sizeof(STransMsgHead);
+    EXPECT_LT(msgLen, len);
+    EXPECT_EQ(pHead->comp & 0x3, compType == RPC_COMP_DEFLATE ? TRANS_COMP_DEFLATE : TRANS_COMP_LZ4);
+
+    EXPECT_EQ(transDecompressMsg(&msg, msgLen), 0);
+    pHead = (STransMsgHead *)msg;
+    EXPECT_EQ(htonl(pHead->msgLen), len + sizeof(STransMsgHead));
+    EXPECT_EQ(memcmp(pHead->content, expect.c_str(), len), 0);
+    taosMemoryFree(msg);
+  }
+
+  // incompressible data is sent as it is
+  char          *msg = (char *)taosMemoryCalloc(1, sizeof(STransMsgHead) + 16);
+  STransMsgHead *pHead = (STransMsgHead *)msg;
+  for (int32_t i = 0; i < 16; i++) {
+    pHead->content[i] = (char)(i * 37);
+  }
+  EXPECT_EQ(transCompressMsg((char *)pHead->content, 16, RPC_COMP_DEFLATE), 16);
+  EXPECT_EQ(pHead->comp, TRANS_COMP_NONE);
+  taosMemoryFree(msg);
+}
+
 class TransCtxEnv : public ::testing::Test {
  protected:
   virtual void SetUp() {
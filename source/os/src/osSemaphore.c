@@ -230,10 +230,12 @@ int32_t tsem_wait(tsem_t* sem) {
 int32_t tsem_timewait(tsem_t* sem, int64_t nanosecs) {
   int ret = 0;
 
-  struct timespec tv = {
-      .tv_sec = 0,
-      .tv_nsec = nanosecs,
-  };
+  // sem_timedwait takes an absolute time
+  struct timespec tv = {0};
+  clock_gettime(CLOCK_REALTIME, &tv);
+  nanosecs += tv.tv_nsec;
+  tv.tv_sec += nanosecs / 1000000000;
+  tv.tv_nsec = nanosecs % 1000000000;
 
   while ((ret = sem_timedwait(sem, &tv)) == -1 && errno == EINTR) continue;
 
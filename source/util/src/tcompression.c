@@ -51,6 +51,7 @@
 #include "tcompression.h"
 #include "lz4.h"
 #include "tRealloc.h"
+#include "tencode.h"
 #include "tlog.h"
 
 #ifdef TD_TSZ
@@ -2401,3 +2402,699 @@ int32_t tsDecompressBigint(void *pIn, int32_t nIn, int32_t nEle, void *pOut, int
     return -1;
   }
 }
+
+/*************************************************************************
+ *                  ADAPTIVE COMPRESSION
+ *************************************************************************/
+// Values are handled as order preserving uint64: signed integers are sign extended and get the sign bit
+// flipped, unsigned integers and float bit patterns are zero extended.
+#define CODEC_SIGN_BIT       ((uint64_t)1 << 63)
+#define CODEC_SAMPLE_ROWS    1024
+#define CODEC_SAMPLE_CHUNK   128
+#define CODEC_MIN_GAIN       97  // a more expensive codec must save at least 3% to be chosen
+#define CODEC_CHIMP_MIN_GAIN 90  // chimp must save at least 10% over the xor codec
+#define CODEC_BIT_MASK(nBit) ((nBit) >= 64 ? UINT64_MAX : ((((uint64_t)1) << (nBit)) - 1))
+
+typedef struct {
+  uint8_t *p;
+  int32_t  n;
+  uint64_t acc;
+  int32_t  nAcc;
+} SCodecBitWriter;
+
+typedef struct {
+  const uint8_t *p;
+  int32_t        n;
+  int32_t        pos;
+  uint64_t       acc;
+  int32_t        nAcc;
+} SCodecBitReader;
+
+static int32_t tCodecTypeInfo(int8_t type, int32_t *bytes, bool *isSigned, bool *isFloat) {
+  *isFloat = false;
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+      *bytes = CHAR_BYTES;
+      *isSigned = true;
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      *bytes = SHORT_BYTES;
+      *isSigned = true;
+      break;
+    case TSDB_DATA_TYPE_INT:
+      *bytes = INT_BYTES;
+      *isSigned = true;
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      *bytes = LONG_BYTES;
+      *isSigned = true;
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      *bytes = CHAR_BYTES;
+      *isSigned = false;
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      *bytes = SHORT_BYTES;
+      *isSigned = false;
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      *bytes = INT_BYTES;
+      *isSigned = false;
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      *bytes = LONG_BYTES;
+      *isSigned = false;
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      *bytes = FLOAT_BYTES;
+      *isSigned = false;
+      *isFloat = true;
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      *bytes = DOUBLE_BYTES;
+      *isSigned = false;
+      *isFloat = true;
+      break;
+    default:
+      return -1;
+  }
+  return 0;
+}
+
+static FORCE_INLINE uint64_t tCodecGet(const char *p, int32_t i, int32_t bytes, bool isSigned) {
+  switch (bytes) {
+    case CHAR_BYTES:
+      return isSigned ? ((uint64_t)(int64_t)((int8_t *)p)[i] ^ CODEC_SIGN_BIT) : ((uint8_t *)p)[i];
+    case SHORT_BYTES:
+      return isSigned ? ((uint64_t)(int64_t)((int16_t *)p)[i] ^ CODEC_SIGN_BIT) : ((uint16_t *)p)[i];
+    case INT_BYTES:
+      return isSigned ? ((uint64_t)(int64_t)((int32_t *)p)[i] ^ CODEC_SIGN_BIT) : ((uint32_t *)p)[i];
+    default:
+      return isSigned ? (((uint64_t *)p)[i] ^ CODEC_SIGN_BIT) : ((uint64_t *)p)[i];
+  }
+}
+
+static FORCE_INLINE void tCodecSet(char *p, int32_t i, int32_t bytes, bool isSigned, uint64_t v) {
+  if (isSigned) v ^= CODEC_SIGN_BIT;
+  switch (bytes) {
+    case CHAR_BYTES:
+      ((uint8_t *)p)[i] = (uint8_t)v;
+      break;
+    case SHORT_BYTES:
+      ((uint16_t *)p)[i] = (uint16_t)v;
+      break;
+    case INT_BYTES:
+      ((uint32_t *)p)[i] = (uint32_t)v;
+      break;
+    default:
+      ((uint64_t *)p)[i] = v;
+      break;
+  }
+}
+
+static FORCE_INLINE int32_t tCodecBitWidth(uint64_t v) { return v ? (LONG_BYTES * BITS_PER_BYTE) - BUILDIN_CLZL(v) : 0; }
+
+static FORCE_INLINE void tCodecBitWrite(SCodecBitWriter *pWriter, uint64_t v, int32_t nBit) {
+  if (nBit == 0) return;
+
+  v &= CODEC_BIT_MASK(nBit);
+  if (pWriter->nAcc < 64) pWriter->acc |= (v << pWriter->nAcc);
+  if (pWriter->nAcc + nBit >= 64) {
+    memcpy(pWriter->p + pWriter->n, &pWriter->acc, sizeof(uint64_t));
+    pWriter->n += sizeof(uint64_t);
+    pWriter->acc = pWriter->nAcc ? (v >> (64 - pWriter->nAcc)) : 0;
+    pWriter->nAcc = pWriter->nAcc + nBit - 64;
+  } else {
+    pWriter->nAcc += nBit;
+  }
+}
+
+static FORCE_INLINE int32_t tCodecBitFlush(SCodecBitWriter *pWriter) {
+  int32_t nByte = (pWriter->nAcc + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+  memcpy(pWriter->p + pWriter->n, &pWriter->acc, nByte);
+  pWriter->n += nByte;
+  pWriter->acc = 0;
+  pWriter->nAcc = 0;
+  return pWriter->n;
+}
+
+static FORCE_INLINE uint64_t tCodecBitRead(SCodecBitReader *pReader, int32_t nBit) {
+  if (nBit == 0) return 0;
+
+  uint64_t v;
+  if (pReader->nAcc >= nBit) {
+    v = pReader->acc & CODEC_BIT_MASK(nBit);
+    pReader->acc = (nBit < 64) ? (pReader->acc >> nBit) : 0;
+    pReader->nAcc -= nBit;
+    return v;
+  }
+
+  uint64_t next = 0;
+  int32_t  nByte = TMIN(pReader->n - pReader->pos, (int32_t)sizeof(uint64_t));
+  if (nByte > 0) {
+    memcpy(&next, pReader->p + pReader->pos, nByte);
+    pReader->pos += nByte;
+  }
+
+  int32_t nUsed = nBit - pReader->nAcc;
+  v = (pReader->acc | (next << pReader->nAcc)) & CODEC_BIT_MASK(nBit);
+  pReader->acc = (nUsed < 64) ? (next >> nUsed) : 0;
+  pReader->nAcc = 64 - nUsed;
+  return v;
+}
+
+// CODEC_FOR: min(8) | nBit(1) | (v - min) * nEle
+static int32_t tsCompressFORImp(const char *input, int32_t nEle, char *output, int32_t outSize, int32_t bytes,
+                                bool isSigned) {
+  uint64_t min = UINT64_MAX, max = 0;
+  for (int32_t i = 0; i < nEle; i++) {
+    uint64_t v = tCodecGet(input, i, bytes, isSigned);
+    if (v < min) min = v;
+    if (v > max) max = v;
+  }
+
+  int32_t nBit = tCodecBitWidth(max - min);
+  int64_t size = sizeof(uint64_t) + sizeof(uint8_t) + ((int64_t)nEle * nBit + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+  if (size > outSize) return -1;
+
+  memcpy(output, &min, sizeof(uint64_t));
+  output[sizeof(uint64_t)] = (char)nBit;
+
+  SCodecBitWriter writer = {.p = (uint8_t *)output, .n = sizeof(uint64_t) + sizeof(uint8_t)};
+  for (int32_t i = 0; i < nEle; i++) {
+    tCodecBitWrite(&writer, tCodecGet(input, i, bytes, isSigned) - min, nBit);
+  }
+  return tCodecBitFlush(&writer);
+}
+
+static int32_t tsDecompressFORImp(const char *input, int32_t inSize, int32_t nEle, char *output, int32_t bytes,
+                                  bool isSigned) {
+  if (inSize < sizeof(uint64_t) + sizeof(uint8_t)) return -1;
+
+  uint64_t min;
+  memcpy(&min, input, sizeof(uint64_t));
+  int32_t nBit = (uint8_t)input[sizeof(uint64_t)];
+  if (nBit > 64 || inSize < sizeof(uint64_t) + sizeof(uint8_t) + ((int64_t)nEle * nBit + 7) / BITS_PER_BYTE) {
+    return -1;
+  }
+
+  SCodecBitReader reader = {.p = (const uint8_t *)input, .n = inSize, .pos = sizeof(uint64_t) + sizeof(uint8_t)};
+  for (int32_t i = 0; i < nEle; i++) {
+    tCodecSet(output, i, bytes, isSigned, min + tCodecBitRead(&reader, nBit));
+  }
+  return nEle * bytes;
+}
+
+// CODEC_DELTA: first(8) | minDelta(8) | nBit(1) | (delta - minDelta) * (nEle - 1), all modulo 2^64
+static int32_t tsCompressDeltaImp(const char *input, int32_t nEle, char *output, int32_t outSize, int32_t bytes,
+                                  bool isSigned) {
+  if (nEle <= 0) return -1;
+
+  uint64_t first = tCodecGet(input, 0, bytes, isSigned);
+  int64_t  minDelta = 0, maxDelta = 0;
+  uint64_t prev = first;
+  for (int32_t i = 1; i < nEle; i++) {
+    uint64_t v = tCodecGet(input, i, bytes, isSigned);
+    int64_t  delta = (int64_t)(v - prev);
+    if (i == 1 || delta < minDelta) minDelta = delta;
+    if (i == 1 || delta > maxDelta) maxDelta = delta;
+    prev = v;
+  }
+
+  int32_t nBit = tCodecBitWidth((uint64_t)maxDelta - (uint64_t)minDelta);
+  int64_t size =
+      sizeof(uint64_t) * 2 + sizeof(uint8_t) + ((int64_t)(nEle - 1) * nBit + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+  if (size > outSize) return -1;
+
+  memcpy(output, &first, sizeof(uint64_t));
+  memcpy(output + sizeof(uint64_t), &minDelta, sizeof(int64_t));
+  output[sizeof(uint64_t) * 2] = (char)nBit;
+
+  SCodecBitWriter writer = {.p = (uint8_t *)output, .n = sizeof(uint64_t) * 2 + sizeof(uint8_t)};
+  prev = first;
+  for (int32_t i = 1; i < nEle; i++) {
+    uint64_t v = tCodecGet(input, i, bytes, isSigned);
+    tCodecBitWrite(&writer, (v - prev) - (uint64_t)minDelta, nBit);
+    prev = v;
+  }
+  return tCodecBitFlush(&writer);
+}
+
+static int32_t tsDecompressDeltaImp(const char *input, int32_t inSize, int32_t nEle, char *output, int32_t bytes,
+                                    bool isSigned) {
+  if (nEle <= 0 || inSize < sizeof(uint64_t) * 2 + sizeof(uint8_t)) return -1;
+
+  uint64_t first, minDelta;
+  memcpy(&first, input, sizeof(uint64_t));
+  memcpy(&minDelta, input + sizeof(uint64_t), sizeof(uint64_t));
+  int32_t nBit = (uint8_t)input[sizeof(uint64_t) * 2];
+  if (nBit > 64 ||
+      inSize < sizeof(uint64_t) * 2 + sizeof(uint8_t) + ((int64_t)(nEle - 1) * nBit + 7) / BITS_PER_BYTE) {
+    return -1;
+  }
+
+  SCodecBitReader reader = {.p = (const uint8_t *)input, .n = inSize, .pos = sizeof(uint64_t) * 2 + sizeof(uint8_t)};
+  uint64_t        v = first;
+  tCodecSet(output, 0, bytes, isSigned, v);
+  for (int32_t i = 1; i < nEle; i++) {
+    v += minDelta + tCodecBitRead(&reader, nBit);
+    tCodecSet(output, i, bytes, isSigned, v);
+  }
+  return nEle * bytes;
+}
+
+// CODEC_CHIMP: Chimp128, each value is XORed with the previous one or with one of the last 128 values that
+// shares its low bits, so that the XOR has many trailing zeros. After the first value, each record is one of
+//   00 | index(7)                                           equal to a value in the ring
+//   01 | index(7) | leading(3) | nSignificant(6) | bits     XOR with a value in the ring
+//   10 | bits                                               XOR with the previous value, same leading zeros
+//   11 | leading(3) | bits                                  XOR with the previous value
+#define CHIMP_RING_LOG2   7
+#define CHIMP_RING_SIZE   (1 << CHIMP_RING_LOG2)
+#define CHIMP_THRESHOLD   (6 + CHIMP_RING_LOG2)
+#define CHIMP_KEY_BITS    (CHIMP_THRESHOLD + 1)
+#define CHIMP_INDEX_LOG2  (CHIMP_RING_LOG2 + 1)
+#define CHIMP_RECORD_BITS (2 + 3 + 64)
+
+static const uint8_t chimpLeadingRound[] = {0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  12, 12, 12, 12, 16,
+                                            16, 18, 18, 20, 20, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+                                            24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+                                            24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24};
+static const uint8_t chimpLeadingCode[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3,
+                                           0, 4, 0, 5, 0, 6, 0, 7};
+static const uint8_t chimpLeadingValue[] = {0, 8, 12, 16, 18, 20, 22, 24};
+
+static FORCE_INLINE uint64_t tChimpGet(const char *p, int32_t i, int32_t nBit) {
+  return (nBit == 64) ? ((uint64_t *)p)[i] : ((uint32_t *)p)[i];
+}
+
+static FORCE_INLINE void tChimpSet(char *p, int32_t i, int32_t nBit, uint64_t v) {
+  if (nBit == 64) {
+    ((uint64_t *)p)[i] = v;
+  } else {
+    ((uint32_t *)p)[i] = (uint32_t)v;
+  }
+}
+
+// the low bits of a value are hashed to the last position they were seen at. The table only needs to cover the
+// ring, a collision merely misses a match, which the trailing zeros of the XOR tell.
+static FORCE_INLINE uint32_t tChimpIndexSlot(uint64_t v) {
+  return ((uint32_t)(v & INT64MASK(CHIMP_KEY_BITS)) * 2654435761u) >> (32 - CHIMP_INDEX_LOG2);
+}
+
+static int32_t tsCompressChimpImp(const char *input, int32_t nEle, char *output, int32_t outSize, int32_t bytes) {
+  int32_t  nBit = bytes * BITS_PER_BYTE;
+  uint64_t ring[CHIMP_RING_SIZE];
+  int32_t  aIndex[1 << CHIMP_INDEX_LOG2] = {0};
+
+  SCodecBitWriter writer = {.p = (uint8_t *)output};
+  int32_t         storedLeading = INT32_MAX;
+
+  if (nEle <= 0 || outSize < bytes + sizeof(uint64_t)) return -1;
+
+  ring[0] = tChimpGet(input, 0, nBit);
+  tCodecBitWrite(&writer, ring[0], nBit);
+
+  for (int32_t i = 1; i < nEle; i++) {
+    // a record takes at most three flushes of the writer
+    if (writer.n + (int32_t)sizeof(uint64_t) * 3 > outSize) return -1;
+
+    uint64_t v = tChimpGet(input, i, nBit);
+    uint32_t key = tChimpIndexSlot(v);
+    int32_t  iPrev = (i - 1) % CHIMP_RING_SIZE;
+    int32_t  iMatch = aIndex[key];
+    uint64_t xor;
+    int32_t  trailing = 0;
+
+    if (i - iMatch < CHIMP_RING_SIZE) {
+      xor = ring[iMatch % CHIMP_RING_SIZE] ^ v;
+      trailing = xor ? BUILDIN_CTZL(xor) : nBit;
+      if (trailing > CHIMP_THRESHOLD) {
+        iPrev = iMatch % CHIMP_RING_SIZE;
+      } else {
+        xor = ring[iPrev] ^ v;
+        trailing = xor ? BUILDIN_CTZL(xor) : nBit;
+      }
+    } else {
+      xor = ring[iPrev] ^ v;
+      trailing = xor ? BUILDIN_CTZL(xor) : nBit;
+    }
+
+    if (xor == 0) {
+      tCodecBitWrite(&writer, 0 | ((uint64_t)iPrev << 2), 2 + CHIMP_RING_LOG2);
+      storedLeading = INT32_MAX;
+    } else {
+      int32_t leading = chimpLeadingRound[BUILDIN_CLZL(xor) - (64 - nBit)];
+      if (trailing > CHIMP_THRESHOLD) {
+        int32_t nSignificant = nBit - leading - trailing;
+        tCodecBitWrite(&writer,
+                       1 | ((uint64_t)iPrev << 2) | ((uint64_t)chimpLeadingCode[leading] << (2 + CHIMP_RING_LOG2)) |
+                           ((uint64_t)nSignificant << (5 + CHIMP_RING_LOG2)),
+                       2 + CHIMP_RING_LOG2 + 3 + 6);
+        tCodecBitWrite(&writer, xor >> trailing, nSignificant);
+        storedLeading = INT32_MAX;
+      } else if (leading == storedLeading) {
+        tCodecBitWrite(&writer, 2, 2);
+        tCodecBitWrite(&writer, xor, nBit - leading);
+      } else {
+        storedLeading = leading;
+        tCodecBitWrite(&writer, 3 | ((uint64_t)chimpLeadingCode[leading] << 2), 2 + 3);
+        tCodecBitWrite(&writer, xor, nBit - leading);
+      }
+    }
+
+    ring[i % CHIMP_RING_SIZE] = v;
+    aIndex[key] = i;
+  }
+
+  if (writer.n + (int32_t)sizeof(uint64_t) > outSize) return -1;
+  return tCodecBitFlush(&writer);
+}
+
+// inlined with a constant nBit, so that the width tests drop out of the loop
+static FORCE_INLINE int32_t tsDecompressChimpLoop(const char *input, int32_t inSize, int32_t nEle, char *output,
+                                                  int32_t nBit) {
+  uint64_t ring[CHIMP_RING_SIZE];
+  int32_t  storedLeading = 0;
+
+  SCodecBitReader reader = {.p = (const uint8_t *)input, .n = inSize};
+  uint64_t        prev = tCodecBitRead(&reader, nBit);
+  ring[0] = prev;
+  tChimpSet(output, 0, nBit, prev);
+
+  for (uint32_t i = 1; i < (uint32_t)nEle; i++) {
+    uint64_t v;
+
+    switch (tCodecBitRead(&reader, 2)) {
+      case 0:
+        v = ring[tCodecBitRead(&reader, CHIMP_RING_LOG2)];
+        break;
+      case 1: {
+        uint64_t head = tCodecBitRead(&reader, CHIMP_RING_LOG2 + 3 + 6);
+        int32_t  leading = chimpLeadingValue[(head >> CHIMP_RING_LOG2) & INT64MASK(3)];
+        int32_t  nSignificant = (int32_t)(head >> (CHIMP_RING_LOG2 + 3));
+        int32_t  trailing = nBit - leading - nSignificant;
+        if (trailing < 0 || trailing >= 64) return -1;
+        v = ring[head & INT64MASK(CHIMP_RING_LOG2)] ^ (tCodecBitRead(&reader, nSignificant) << trailing);
+      } break;
+      case 2:
+        v = prev ^ tCodecBitRead(&reader, nBit - storedLeading);
+        break;
+      default:
+        storedLeading = chimpLeadingValue[tCodecBitRead(&reader, 3)];
+        v = prev ^ tCodecBitRead(&reader, nBit - storedLeading);
+        break;
+    }
+
+    ring[i % CHIMP_RING_SIZE] = v;
+    tChimpSet(output, i, nBit, v);
+    prev = v;
+  }
+
+  return nEle * (nBit / BITS_PER_BYTE);
+}
+
+static int32_t tsDecompressChimpImp(const char *input, int32_t inSize, int32_t nEle, char *output, int32_t bytes) {
+  if (nEle <= 0 || inSize < bytes) return -1;
+  if (bytes == sizeof(double)) return tsDecompressChimpLoop(input, inSize, nEle, output, 64);
+  return tsDecompressChimpLoop(input, inSize, nEle, output, 32);
+}
+
+// CODEC_RLE: (value(bytes) | run length(u32v)) * nRun
+static int32_t tsCompressRLEImp(const char *input, int32_t nEle, char *output, int32_t outSize, int32_t bytes) {
+  int32_t n = 0;
+  for (int32_t i = 0; i < nEle;) {
+    int32_t j = i + 1;
+    while (j < nEle && memcmp(input + (int64_t)j * bytes, input + (int64_t)i * bytes, bytes) == 0) j++;
+
+    if (n + bytes + tPutU32v(NULL, j - i) > outSize) return -1;
+    memcpy(output + n, input + (int64_t)i * bytes, bytes);
+    n += bytes;
+    n += tPutU32v((uint8_t *)output + n, j - i);
+    i = j;
+  }
+  return n;
+}
+
+static int32_t tsDecompressRLEImp(const char *input, int32_t inSize, int32_t nEle, char *output, int32_t bytes) {
+  int32_t n = 0;
+  int32_t iEle = 0;
+  while (n < inSize) {
+    uint32_t nRun;
+    if (n + bytes >= inSize) return -1;
+    const char *pValue = input + n;
+    n += bytes;
+    n += tGetU32v((uint8_t *)input + n, &nRun);
+    if (n > inSize || nRun > nEle - iEle) return -1;
+
+    if (bytes == CHAR_BYTES) {
+      memset(output + iEle, *pValue, nRun);
+      iEle += nRun;
+    } else {
+      for (uint32_t k = 0; k < nRun; k++, iEle++) {
+        memcpy(output + (int64_t)iEle * bytes, pValue, bytes);
+      }
+    }
+  }
+  return (iEle == nEle) ? nEle * bytes : -1;
+}
+
+static int32_t tsCompressDefault(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                                 uint8_t cmprAlg, void *pBuf, int32_t nBuf) {
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+      return tsCompressBool(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+      return tsCompressTinyint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+      return tsCompressSmallint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+      return tsCompressInt(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+      return tsCompressBigint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      return tsCompressTimestamp(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_FLOAT:
+      return tsCompressFloat(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_DOUBLE:
+      return tsCompressDouble(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    default:
+      return tsCompressString(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+  }
+}
+
+static int32_t tsDecompressDefault(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                                   uint8_t cmprAlg, void *pBuf, int32_t nBuf) {
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+      return tsDecompressBool(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+      return tsDecompressTinyint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+      return tsDecompressSmallint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+      return tsDecompressInt(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+      return tsDecompressBigint(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      return tsDecompressTimestamp(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_FLOAT:
+      return tsDecompressFloat(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    case TSDB_DATA_TYPE_DOUBLE:
+      return tsDecompressDouble(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+    default:
+      return tsDecompressString(pIn, nIn, nEle, pOut, nOut, cmprAlg, pBuf, nBuf);
+  }
+}
+
+// encode with the first stage of a codec, the output is never larger than the raw data
+static int32_t tsCompressCodecStage1(int8_t type, int8_t codec, const char *pIn, int32_t nIn, int32_t nEle,
+                                     char *pOut, int32_t nOut) {
+  int32_t bytes;
+  bool    isSigned, isFloat;
+  if (tCodecTypeInfo(type, &bytes, &isSigned, &isFloat) < 0 || nIn != nEle * bytes) return -1;
+
+  nOut = TMIN(nOut, nIn);
+  switch (CODEC_BASE(codec)) {
+    case CODEC_RAW:
+      if (nIn > nOut) return -1;
+      memcpy(pOut, pIn, nIn);
+      return nIn;
+    case CODEC_FOR:
+      return isFloat ? -1 : tsCompressFORImp(pIn, nEle, pOut, nOut, bytes, isSigned);
+    case CODEC_RLE:
+      return tsCompressRLEImp(pIn, nEle, pOut, nOut, bytes);
+    case CODEC_CHIMP:
+      return isFloat ? tsCompressChimpImp(pIn, nEle, pOut, nOut, bytes) : -1;
+    case CODEC_DELTA:
+      return isFloat ? -1 : tsCompressDeltaImp(pIn, nEle, pOut, nOut, bytes, isSigned);
+    default:
+      return -1;
+  }
+}
+
+static int32_t tsDecompressCodecStage1(int8_t type, int8_t codec, const char *pIn, int32_t nIn, int32_t nEle,
+                                       char *pOut, int32_t nOut) {
+  int32_t bytes;
+  bool    isSigned, isFloat;
+  if (tCodecTypeInfo(type, &bytes, &isSigned, &isFloat) < 0 || nOut < nEle * bytes) return -1;
+
+  switch (CODEC_BASE(codec)) {
+    case CODEC_RAW:
+      if (nIn != nEle * bytes) return -1;
+      memcpy(pOut, pIn, nIn);
+      return nIn;
+    case CODEC_FOR:
+      return tsDecompressFORImp(pIn, nIn, nEle, pOut, bytes, isSigned);
+    case CODEC_RLE:
+      return tsDecompressRLEImp(pIn, nIn, nEle, pOut, bytes);
+    case CODEC_CHIMP:
+      return isFloat ? tsDecompressChimpImp(pIn, nIn, nEle, pOut, bytes) : -1;
+    case CODEC_DELTA:
+      return tsDecompressDeltaImp(pIn, nIn, nEle, pOut, bytes, isSigned);
+    default:
+      return -1;
+  }
+}
+
+int32_t tsCompressCodec(int8_t type, int8_t codec, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                        void *pBuf, int32_t nBuf) {
+  if (CODEC_BASE(codec) == CODEC_DEFAULT) {
+    return tsCompressDefault(type, pIn, nIn, nEle, pOut, nOut, (codec & CODEC_LZ4) ? TWO_STAGE_COMP : ONE_STAGE_COMP,
+                             pBuf, nBuf);
+  }
+
+  if ((codec & CODEC_LZ4) == 0) {
+    return tsCompressCodecStage1(type, codec, pIn, nIn, nEle, pOut, nOut);
+  }
+
+  int32_t len = tsCompressCodecStage1(type, codec, pIn, nIn, nEle, pBuf, nBuf);
+  if (len < 0 || len + 1 > nOut) return -1;
+  return tsCompressStringImp(pBuf, len, pOut, nOut);
+}
+
+int32_t tsDecompressCodec(int8_t type, int8_t codec, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut,
+                          void *pBuf, int32_t nBuf) {
+  if (CODEC_BASE(codec) == CODEC_DEFAULT) {
+    return tsDecompressDefault(type, pIn, nIn, nEle, pOut, nOut,
+                               (codec & CODEC_LZ4) ? TWO_STAGE_COMP : ONE_STAGE_COMP, pBuf, nBuf);
+  }
+
+  if ((codec & CODEC_LZ4) == 0) {
+    return tsDecompressCodecStage1(type, codec, pIn, nIn, nEle, pOut, nOut);
+  }
+
+  int32_t len = tsDecompressStringImp(pIn, nIn, pBuf, nBuf);
+  if (len < 0) return -1;
+  return tsDecompressCodecStage1(type, codec, pBuf, len, nEle, pOut, nOut);
+}
+
+// Candidates ordered by decode cost, a later one replaces the current choice only if it saves enough. The xor
+// codec stays the float default, chimp decodes no faster and has to save clearly more.
+static const int8_t tCodecIntCandidates[] = {CODEC_RAW,
+                                             CODEC_RLE,
+                                             CODEC_FOR,
+                                             CODEC_DELTA,
+                                             CODEC_DEFAULT,
+                                             CODEC_RLE | CODEC_LZ4,
+                                             CODEC_FOR | CODEC_LZ4,
+                                             CODEC_DELTA | CODEC_LZ4,
+                                             CODEC_DEFAULT | CODEC_LZ4,
+                                             CODEC_RAW | CODEC_LZ4};
+static const int8_t tCodecFloatCandidates[] = {CODEC_RAW,
+                                               CODEC_RLE,
+                                               CODEC_DEFAULT,
+                                               CODEC_CHIMP,
+                                               CODEC_RLE | CODEC_LZ4,
+                                               CODEC_DEFAULT | CODEC_LZ4,
+                                               CODEC_CHIMP | CODEC_LZ4,
+                                               CODEC_RAW | CODEC_LZ4};
+
+// pOut and pBuf are scratch of the trial compressions, large enough for a sampled chunk plus COMP_OVERFLOW_BYTES.
+int8_t tsChooseCodec(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, void *pBuf,
+                     int32_t nBuf) {
+  int32_t bytes;
+  bool    isSigned, isFloat;
+  if (tCodecTypeInfo(type, &bytes, &isSigned, &isFloat) < 0 || nEle <= 0 || nIn != nEle * bytes) {
+    return CODEC_NONE;
+  }
+
+  // A large column is sampled as evenly spaced chunks, each compressed on its own so that the gaps
+  // between them do not hurt the delta based codecs.
+  int32_t nChunk = 1;
+  int32_t nChunkEle = nEle;
+  int64_t step = 0;
+  if (nEle > CODEC_SAMPLE_ROWS) {
+    nChunk = CODEC_SAMPLE_ROWS / CODEC_SAMPLE_CHUNK;
+    nChunkEle = CODEC_SAMPLE_CHUNK;
+    step = (int64_t)(nEle - CODEC_SAMPLE_CHUNK) / (nChunk - 1);
+  }
+
+  int32_t szChunk = nChunkEle * bytes;
+
+  const int8_t *aCodec = isFloat ? tCodecFloatCandidates : tCodecIntCandidates;
+  int32_t       nCodec = isFloat ? tListLen(tCodecFloatCandidates) : tListLen(tCodecIntCandidates);
+  int8_t        codec = CODEC_RAW;
+  int64_t       szBest = (int64_t)szChunk * nChunk;
+  for (int32_t iCodec = 1; iCodec < nCodec; iCodec++) {
+    int64_t size = 0;
+    for (int32_t iChunk = 0; iChunk < nChunk; iChunk++) {
+      int32_t n = tsCompressCodec(type, aCodec[iCodec], (char *)pIn + step * iChunk * bytes, szChunk, nChunkEle, pOut,
+                                  nOut, pBuf, nBuf);
+      if (n < 0) {
+        size = -1;
+        break;
+      }
+      size += n;
+    }
+
+    int32_t gain = (CODEC_BASE(aCodec[iCodec]) == CODEC_CHIMP) ? CODEC_CHIMP_MIN_GAIN : CODEC_MIN_GAIN;
+    if (size > 0 && size * 100 < szBest * gain) {
+      codec = aCodec[iCodec];
+      szBest = size;
+    }
+  }
+
+  return codec;
+}
+
+// *pCodec is the codec to use on input, CODEC_NONE to choose one by sampling, and the codec used on output. A given
+// codec that does not shrink the data any more is replaced by sampling.
+int32_t tsCompressAdaptive(int8_t type, void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, void *pBuf,
+                           int32_t nBuf, int8_t *pCodec) {
+  int8_t  codec = *pCodec;
+  int32_t size = -1;
+
+  if (codec != CODEC_NONE && codec != CODEC_RAW) {
+    size = tsCompressCodec(type, codec, pIn, nIn, nEle, pOut, nOut, pBuf, nBuf);
+    if (size < 0 || size >= nIn) codec = CODEC_NONE;
+  }
+
+  if (codec == CODEC_NONE) {
+    codec = tsChooseCodec(type, pIn, nIn, nEle, pOut, nOut, pBuf, nBuf);
+    if (codec != CODEC_NONE && codec != CODEC_RAW) {
+      size = tsCompressCodec(type, codec, pIn, nIn, nEle, pOut, nOut, pBuf, nBuf);
+    }
+  }
+
+  // the sample lied, keep the raw data
+  if (size < 0 || size >= nIn) {
+    if (codec == CODEC_NONE || nIn > nOut) return -1;
+    codec = CODEC_RAW;
+    memcpy(pOut, pIn, nIn);
+    size = nIn;
+  }
+
+  *pCodec = codec;
+  return size;
+}
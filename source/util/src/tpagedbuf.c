@@ -8,6 +8,10 @@
 #define GET_DATA_PAYLOAD(_p)          ((char*)(_p)->pData + POINTER_BYTES)
 #define NO_IN_MEM_AVAILABLE_PAGES(_b) (listNEles((_b)->lruList) >= (_b)->inMemPages)
 
+// number of pages that are kept in the write-back buffer and loaded by one read-ahead
+#define DBUF_IO_BATCH_PAGES 8
+#define GET_DBUF_IO_SIZE(_b) (((_b)->pageSize + 2) * DBUF_IO_BATCH_PAGES)
+
 typedef struct SPageDiskInfo {
   int64_t offset;
   int32_t length;
@@ -42,6 +46,15 @@ struct SDiskbasedBuf {
   bool      comp;              // compressed before flushed to disk
   uint64_t  nextPos;           // next page flush position
 
+  // pages appended to the end of file are collected in the write-back buffer, and written with one I/O
+  char*   pWriteBuf;
+  int64_t writeBufOffset;  // file offset of the first byte in pWriteBuf, data in [writeBufOffset, nextPos) is in it
+  // pages that are loaded sequentially are read ahead in one I/O
+  char*   pReadBuf;
+  int64_t readBufOffset;
+  int32_t readBufLen;
+  int64_t lastLoadEnd;  // end position of the last loaded page
+
   char*               id;           // for debug purpose
   bool                printStatis;  // Print statistics info when closing this buffer.
   SDiskbasedBufStatis statis;
@@ -54,19 +67,24 @@ static int32_t createDiskFile(SDiskbasedBuf* pBuf) {
     return TAOS_SYSTEM_ERROR(errno);
   }
 
+  pBuf->pWriteBuf = taosMemoryMalloc(GET_DBUF_IO_SIZE(pBuf));
+  if (pBuf->pWriteBuf == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
   return TSDB_CODE_SUCCESS;
 }
 
-static char* doCompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
+// the compressed data is kept in the assistant buffer, and the page payload is untouched.
+static char* doCompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {
   if (!pBuf->comp) {
     *dst = srcSize;
     return data;
   }
 
-  *dst = tsCompressString(data, srcSize, 1, pBuf->assistBuf, srcSize, ONE_STAGE_COMP, NULL, 0);
-
-  memcpy(data, pBuf->assistBuf, *dst);
-  return data;
+  // one more byte than the source is required for the incompressible data
+  *dst = tsCompressString(data, srcSize, 1, pBuf->assistBuf, srcSize + 1, ONE_STAGE_COMP, NULL, 0);
+  return pBuf->assistBuf;
 }
 
 static char* doDecompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
@@ -82,27 +100,131 @@ static char* doDecompressData(void* data, int32_t srcSize, int32_t* dst, SDiskba
   return data;
 }
 
-static uint64_t allocatePositionInFile(SDiskbasedBuf* pBuf, size_t size) {
-  if (pBuf->pFree == NULL) {
-    return pBuf->nextPos;
+static int32_t flushWriteBackBuf(SDiskbasedBuf* pBuf) {
+  int64_t len = pBuf->nextPos - pBuf->writeBufOffset;
+  if (len == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t ret = taosLSeekFile(pBuf->pFile, pBuf->writeBufOffset, SEEK_SET);
+  if (ret == -1) {
+    return TAOS_SYSTEM_ERROR(errno);
+  }
+
+  if (taosWriteFile(pBuf->pFile, pBuf->pWriteBuf, len) != len) {
+    return TAOS_SYSTEM_ERROR(errno);
+  }
+
+  pBuf->writeBufOffset = pBuf->nextPos;
+  return TSDB_CODE_SUCCESS;
+}
+
+static void addFreeArea(SDiskbasedBuf* pBuf, int64_t offset, int32_t length) {
+  if (length > 0) {
+    SFreeListItem item = {.offset = offset, .length = length};
+    taosArrayPush(pBuf->pFree, &item);
+  }
+}
+
+static int64_t allocatePositionInFile(SDiskbasedBuf* pBuf, size_t size) {
+  // reuse the area released by the pages that have grown or shrunk first
+  size_t num = taosArrayGetSize(pBuf->pFree);
+  for (int32_t i = 0; i < num; ++i) {
+    SFreeListItem* pi = taosArrayGet(pBuf->pFree, i);
+    if (pi->length >= size) {
+      int64_t offset = pi->offset;
+      pi->offset += (int32_t)size;
+      pi->length -= (int32_t)size;
+      if (pi->length == 0) {
+        taosArrayRemove(pBuf->pFree, i);
+      }
+
+      return offset;
+    }
+  }
+
+  // no available recycle space, append at the end of file through the write-back buffer
+  if (pBuf->nextPos + size - pBuf->writeBufOffset > GET_DBUF_IO_SIZE(pBuf)) {
+    int32_t code = flushWriteBackBuf(pBuf);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return -1;
+    }
+  }
+
+  int64_t offset = pBuf->nextPos;
+  pBuf->nextPos += size;
+  return offset;
+}
+
+static int32_t writePageData(SDiskbasedBuf* pBuf, int64_t offset, const char* data, int32_t size) {
+  if (offset >= pBuf->writeBufOffset) {
+    memcpy(pBuf->pWriteBuf + (offset - pBuf->writeBufOffset), data, size);
   } else {
-    int32_t offset = -1;
+    // the read-ahead data is out of date
+    if (pBuf->readBufLen > 0 && offset < pBuf->readBufOffset + pBuf->readBufLen &&
+        offset + size > pBuf->readBufOffset) {
+      pBuf->readBufLen = 0;
+    }
+
+    int32_t ret = taosLSeekFile(pBuf->pFile, offset, SEEK_SET);
+    if (ret == -1) {
+      return TAOS_SYSTEM_ERROR(errno);
+    }
+
+    if (taosWriteFile(pBuf->pFile, data, size) != size) {
+      return TAOS_SYSTEM_ERROR(errno);
+    }
+  }
+
+  if (pBuf->fileSize < offset + size) {
+    pBuf->fileSize = offset + size;
+  }
+
+  pBuf->statis.flushBytes += size;
+  pBuf->statis.flushPages += 1;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t readPageData(SDiskbasedBuf* pBuf, int64_t offset, char* data, int32_t size) {
+  if (offset >= pBuf->writeBufOffset) {  // not written to disk yet
+    memcpy(data, pBuf->pWriteBuf + (offset - pBuf->writeBufOffset), size);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  bool sequential = (offset == pBuf->lastLoadEnd);
+  pBuf->lastLoadEnd = offset + size;
+
+  if (pBuf->readBufLen > 0 && offset >= pBuf->readBufOffset &&
+      offset + size <= pBuf->readBufOffset + pBuf->readBufLen) {
+    memcpy(data, pBuf->pReadBuf + (offset - pBuf->readBufOffset), size);
+    return TSDB_CODE_SUCCESS;
+  }
 
-    size_t num = taosArrayGetSize(pBuf->pFree);
-    for (int32_t i = 0; i < num; ++i) {
-      SFreeListItem* pi = taosArrayGet(pBuf->pFree, i);
-      if (pi->length >= size) {
-        offset = pi->offset;
-        pi->offset += (int32_t)size;
-        pi->length -= (int32_t)size;
+  if (sequential) {
+    if (pBuf->pReadBuf == NULL) {
+      pBuf->pReadBuf = taosMemoryMalloc(GET_DBUF_IO_SIZE(pBuf));
+    }
 
-        return offset;
+    int64_t len = TMIN(GET_DBUF_IO_SIZE(pBuf), pBuf->writeBufOffset - offset);
+    if (pBuf->pReadBuf != NULL && len > size) {
+      if (taosPReadFile(pBuf->pFile, pBuf->pReadBuf, len, offset) != len) {
+        pBuf->readBufLen = 0;
+        return TAOS_SYSTEM_ERROR(errno);
       }
+
+      pBuf->readBufOffset = offset;
+      pBuf->readBufLen = (int32_t)len;
+      memcpy(data, pBuf->pReadBuf, size);
+      return TSDB_CODE_SUCCESS;
     }
+  }
 
-    // no available recycle space, allocate new area in file
-    return pBuf->nextPos;
+  if (taosPReadFile(pBuf->pFile, data, size, offset) != size) {
+    return TAOS_SYSTEM_ERROR(errno);
   }
+
+  return TSDB_CODE_SUCCESS;
 }
 
 static void setPageNotInBuf(SPageInfo* pPageInfo) { pPageInfo->pData = NULL; }
@@ -121,70 +243,34 @@ static char* doFlushPageToDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
   assert(!pg->used && pg->pData != NULL);
 
   int32_t size = pBuf->pageSize;
-  char*   t = NULL;
-  if (pg->offset == -1 || pg->dirty) {
-    void* payload = GET_DATA_PAYLOAD(pg);
-    t = doCompressData(payload, pBuf->pageSize, &size, pBuf);
-    assert(size >= 0);
-  }
-
-  // this page is flushed to disk for the first time
   if (pg->dirty) {
-    if (pg->offset == -1) {
-      assert(pg->dirty == true);
-
-      pg->offset = allocatePositionInFile(pBuf, size);
-      pBuf->nextPos += size;
-
-      int32_t ret = taosLSeekFile(pBuf->pFile, pg->offset, SEEK_SET);
-      if (ret == -1) {
-        terrno = TAOS_SYSTEM_ERROR(errno);
-        return NULL;
-      }
-
-      ret = (int32_t)taosWriteFile(pBuf->pFile, t, size);
-      if (ret != size) {
-        terrno = TAOS_SYSTEM_ERROR(errno);
-        return NULL;
-      }
-
-      if (pBuf->fileSize < pg->offset + size) {
-        pBuf->fileSize = pg->offset + size;
-      }
+    void* payload = GET_DATA_PAYLOAD(pg);
+    char* t = doCompressData(payload, pBuf->pageSize, &size, pBuf);
+    assert(size > 0);
 
-      pBuf->statis.flushBytes += size;
-      pBuf->statis.flushPages += 1;
-    } else {
-      // length becomes greater, current space is not enough, allocate new place, otherwise, do nothing
+    if (pg->offset != -1) {
       if (pg->length < size) {
-        // 1. add current space to free list
-        SPageDiskInfo dinfo = {.length = pg->length, .offset = pg->offset};
-        taosArrayPush(pBuf->pFree, &dinfo);
-
-        // 2. allocate new position, and update the info
-        pg->offset = allocatePositionInFile(pBuf, size);
-        pBuf->nextPos += size;
-      }
-
-      // 3. write to disk.
-      int32_t ret = taosLSeekFile(pBuf->pFile, pg->offset, SEEK_SET);
-      if (ret == -1) {
-        terrno = TAOS_SYSTEM_ERROR(errno);
-        return NULL;
+        // length becomes greater, current space is not enough, add it to free list and allocate new place
+        addFreeArea(pBuf, pg->offset, pg->length);
+        pg->offset = -1;
+      } else {
+        // the compressed page may become smaller, and the remain space is recycled
+        addFreeArea(pBuf, pg->offset + size, pg->length - size);
       }
+    }
 
-      ret = (int32_t)taosWriteFile(pBuf->pFile, t, size);
-      if (ret != size) {
-        terrno = TAOS_SYSTEM_ERROR(errno);
+    // this page is flushed to disk for the first time
+    if (pg->offset == -1) {
+      pg->offset = allocatePositionInFile(pBuf, size);
+      if (pg->offset == -1) {
         return NULL;
       }
+    }
 
-      if (pBuf->fileSize < pg->offset + size) {
-        pBuf->fileSize = pg->offset + size;
-      }
-
-      pBuf->statis.flushBytes += size;
-      pBuf->statis.flushPages += 1;
+    int32_t code = writePageData(pBuf, pg->offset, t, size);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
     }
   } else {  // NOTE: the size may be -1, the this recycle page has not been flushed to disk yet.
     size = pg->length;
@@ -221,16 +307,9 @@ static char* flushPageToDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
 
 // load file block data in disk
 static int32_t loadPageFromDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
-  int32_t ret = taosLSeekFile(pBuf->pFile, pg->offset, SEEK_SET);
-  if (ret == -1) {
-    ret = TAOS_SYSTEM_ERROR(errno);
-    return ret;
-  }
-
-  void* pPage = (void*)GET_DATA_PAYLOAD(pg);
-  ret = (int32_t)taosReadFile(pBuf->pFile, pPage, pg->length);
-  if (ret != pg->length) {
-    ret = TAOS_SYSTEM_ERROR(errno);
+  void*   pPage = (void*)GET_DATA_PAYLOAD(pg);
+  int32_t ret = readPageData(pBuf, pg->offset, pPage, pg->length);
+  if (ret != TSDB_CODE_SUCCESS) {
     return ret;
   }
 
@@ -239,6 +318,10 @@ static int32_t loadPageFromDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
 
   int32_t fullSize = 0;
   doDecompressData(pPage, pg->length, &fullSize, pBuf);
+  if (fullSize < 0) {
+    return TSDB_CODE_FILE_CORRUPTED;
+  }
+
   return 0;
 }
 
@@ -344,6 +427,8 @@ int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMem
   pPBuf->fileSize = 0;
   pPBuf->pFree = taosArrayInit(4, sizeof(SFreeListItem));
   pPBuf->freePgList = tdListNew(POINTER_BYTES);
+  pPBuf->comp = true;
+  pPBuf->lastLoadEnd = -1;
 
   // at least more than 2 pages must be in memory
   assert(inMemBufSize >= pagesize * 2);
@@ -556,6 +641,8 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
 
   taosMemoryFreeClear(pBuf->id);
   taosMemoryFreeClear(pBuf->assistBuf);
+  taosMemoryFreeClear(pBuf->pWriteBuf);
+  taosMemoryFreeClear(pBuf->pReadBuf);
   taosMemoryFreeClear(pBuf);
 }
 
@@ -648,4 +735,10 @@ void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
   pBuf->totalBufSize = 0;
   pBuf->allocateId = -1;
   pBuf->fileSize = 0;
+
+  // the space in file is reused from the beginning
+  pBuf->nextPos = 0;
+  pBuf->writeBufOffset = 0;
+  pBuf->readBufLen = 0;
+  pBuf->lastLoadEnd = -1;
 }
@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+
+#include <math.h>
+
+#include "tcompression.h"
+
+using namespace std;
+
+namespace {
+
+const int32_t nRow = 4096;  // rows of a data block
+const int32_t nLoop = 200;
+
+typedef struct {
+  const char *name;
+  int8_t      type;
+  int32_t     bytes;
+  void (*gen)(char *p, int32_t n);
+} SCodecData;
+
+typedef struct {
+  const char *name;
+  int8_t      codec;
+} SCodecCase;
+
+void genTimestamp(char *p, int32_t n) {
+  int64_t *a = (int64_t *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 1650803518000 + i * 1000 + (i % 7 == 0 ? 1 : 0);
+}
+
+void genRamp(char *p, int32_t n) {
+  int32_t *a = (int32_t *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 100000 + i * 3;
+}
+
+void genStatus(char *p, int32_t n) {
+  int8_t *a = (int8_t *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = (i / 300) % 4;
+}
+
+void genSmallRange(char *p, int32_t n) {
+  int64_t *a = (int64_t *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 5000000000LL + taosRand() % 200;
+}
+
+void genRandom(char *p, int32_t n) {
+  int64_t *a = (int64_t *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = ((int64_t)taosRand() << 33) ^ ((int64_t)taosRand() << 11) ^ taosRand();
+}
+
+void genSensor(char *p, int32_t n) {
+  double *a = (double *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 20.0 + 5.0 * sin(i / 100.0) + (taosRand() % 100) / 1000.0;
+}
+
+void genFloatSensor(char *p, int32_t n) {
+  float *a = (float *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 60.0f + (float)(taosRand() % 1000) / 100.0f;
+}
+
+void genDoubleSpecial(char *p, int32_t n) {
+  double special[] = {0.0, -0.0, NAN, INFINITY, -INFINITY, 4.9e-324, 1.7976931348623157e308, 1.0, 0.1};
+  double *a = (double *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = special[taosRand() % tListLen(special)];
+}
+
+void genConstFloat(char *p, int32_t n) {
+  float *a = (float *)p;
+  for (int32_t i = 0; i < n; i++) a[i] = 36.6f;
+}
+
+SCodecData aData[] = {
+    {"timestamp", TSDB_DATA_TYPE_TIMESTAMP, sizeof(int64_t), genTimestamp},
+    {"int ramp", TSDB_DATA_TYPE_INT, sizeof(int32_t), genRamp},
+    {"tinyint status", TSDB_DATA_TYPE_TINYINT, sizeof(int8_t), genStatus},
+    {"bigint small range", TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), genSmallRange},
+    {"bigint random", TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), genRandom},
+    {"double sensor", TSDB_DATA_TYPE_DOUBLE, sizeof(double), genSensor},
+    {"float sensor", TSDB_DATA_TYPE_FLOAT, sizeof(float), genFloatSensor},
+    {"double special", TSDB_DATA_TYPE_DOUBLE, sizeof(double), genDoubleSpecial},
+    {"float constant", TSDB_DATA_TYPE_FLOAT, sizeof(float), genConstFloat},
+};
+
+SCodecCase aCodec[] = {
+    {"default", CODEC_DEFAULT},
+    {"default+lz4", CODEC_DEFAULT | CODEC_LZ4},
+    {"raw", CODEC_RAW},
+    {"raw+lz4", CODEC_RAW | CODEC_LZ4},
+    {"for", CODEC_FOR},
+    {"for+lz4", CODEC_FOR | CODEC_LZ4},
+    {"rle", CODEC_RLE},
+    {"rle+lz4", CODEC_RLE | CODEC_LZ4},
+    {"delta", CODEC_DELTA},
+    {"delta+lz4", CODEC_DELTA | CODEC_LZ4},
+    {"chimp", CODEC_CHIMP},
+    {"chimp+lz4", CODEC_CHIMP | CODEC_LZ4},
+};
+
+}  // namespace
+
+TEST(TD_UTIL_COMPRESS_TEST, codec_round_trip) {
+  for (int32_t iData = 0; iData < tListLen(aData); iData++) {
+    SCodecData *pData = &aData[iData];
+    for (int32_t n = 1; n <= nRow; n = n * 3 + 1) {
+      int32_t nIn = n * pData->bytes;
+      int32_t nOut = nIn + COMP_OVERFLOW_BYTES;
+      char   *pIn = (char *)taosMemoryMalloc(nIn);
+      char   *pOut = (char *)taosMemoryMalloc(nOut);
+      char   *pBuf = (char *)taosMemoryMalloc(nOut);
+      char   *pDec = (char *)taosMemoryMalloc(nIn);
+      pData->gen(pIn, n);
+
+      for (int32_t iCodec = 0; iCodec < tListLen(aCodec); iCodec++) {
+        int32_t size = tsCompressCodec(pData->type, aCodec[iCodec].codec, pIn, nIn, n, pOut, nOut, pBuf, nOut);
+        if (size < 0) continue;  // the codec does not fit the data
+
+        memset(pDec, 0, nIn);
+        GTEST_ASSERT_EQ(tsDecompressCodec(pData->type, aCodec[iCodec].codec, pOut, size, n, pDec, nIn, pBuf, nOut),
+                        nIn);
+        GTEST_ASSERT_EQ(memcmp(pIn, pDec, nIn), 0);
+      }
+
+      int8_t  codec = CODEC_NONE;
+      int32_t size = tsCompressAdaptive(pData->type, pIn, nIn, n, pOut, nOut, pBuf, nOut, &codec);
+      GTEST_ASSERT_GT(size, 0);
+      GTEST_ASSERT_LE(size, nIn);
+      GTEST_ASSERT_NE(codec, CODEC_NONE);
+      memset(pDec, 0, nIn);
+      GTEST_ASSERT_EQ(tsDecompressCodec(pData->type, codec, pOut, size, n, pDec, nIn, pBuf, nOut), nIn);
+      GTEST_ASSERT_EQ(memcmp(pIn, pDec, nIn), 0);
+
+      taosMemoryFree(pIn);
+      taosMemoryFree(pOut);
+      taosMemoryFree(pBuf);
+      taosMemoryFree(pDec);
+    }
+  }
+}
+
+TEST(TD_UTIL_COMPRESS_TEST, adaptive_choice) {
+  int32_t nIn = nRow * sizeof(int32_t);
+  int32_t nOut = nIn + COMP_OVERFLOW_BYTES;
+  char   *pIn = (char *)taosMemoryMalloc(nIn);
+  char   *pOut = (char *)taosMemoryMalloc(nOut);
+  char   *pBuf = (char *)taosMemoryMalloc(nOut);
+
+  // a constant step compresses to the delta header alone
+  genRamp(pIn, nRow);
+  int8_t codec = CODEC_NONE;
+  GTEST_ASSERT_EQ(tsCompressAdaptive(TSDB_DATA_TYPE_INT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec), 17);
+  GTEST_ASSERT_EQ(codec, CODEC_DELTA);
+
+  // a given codec is used without sampling
+  codec = CODEC_DELTA | CODEC_LZ4;
+  GTEST_ASSERT_GT(tsCompressAdaptive(TSDB_DATA_TYPE_INT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec), 0);
+  GTEST_ASSERT_EQ(codec, CODEC_DELTA | CODEC_LZ4);
+  codec = CODEC_RAW;
+  GTEST_ASSERT_EQ(tsCompressAdaptive(TSDB_DATA_TYPE_INT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec), nIn);
+  GTEST_ASSERT_EQ(codec, CODEC_RAW);
+
+  // a given codec that does not fit the data is replaced by sampling
+  codec = CODEC_CHIMP;
+  GTEST_ASSERT_EQ(tsCompressAdaptive(TSDB_DATA_TYPE_INT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec), 17);
+  GTEST_ASSERT_EQ(codec, CODEC_DELTA);
+  genRandom(pIn, nRow / 2);
+  codec = CODEC_RLE;
+  GTEST_ASSERT_GT(tsCompressAdaptive(TSDB_DATA_TYPE_INT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec), 0);
+  GTEST_ASSERT_NE(codec, CODEC_RLE);
+
+  // variable length data is left to the block cmprAlg
+  GTEST_ASSERT_EQ(tsChooseCodec(TSDB_DATA_TYPE_BINARY, pIn, nIn, nIn, pOut, nOut, pBuf, nOut), CODEC_NONE);
+
+  taosMemoryFree(pIn);
+  taosMemoryFree(pOut);
+  taosMemoryFree(pBuf);
+}
+
+TEST(TD_UTIL_COMPRESS_TEST, chimp_ratio) {
+  // sensor data with noisy low bits compresses better than with the xor codec
+  for (int32_t iData = 0; iData < tListLen(aData); iData++) {
+    SCodecData *pData = &aData[iData];
+    if (pData->gen != genSensor && pData->gen != genFloatSensor) continue;
+
+    int32_t nIn = nRow * pData->bytes;
+    int32_t nOut = nIn + COMP_OVERFLOW_BYTES;
+    char   *pIn = (char *)taosMemoryMalloc(nIn);
+    char   *pOut = (char *)taosMemoryMalloc(nOut);
+    char   *pBuf = (char *)taosMemoryMalloc(nOut);
+    pData->gen(pIn, nRow);
+
+    int32_t szXor = tsCompressCodec(pData->type, CODEC_DEFAULT, pIn, nIn, nRow, pOut, nOut, pBuf, nOut);
+    int32_t szChimp = tsCompressCodec(pData->type, CODEC_CHIMP, pIn, nIn, nRow, pOut, nOut, pBuf, nOut);
+    printf("%-20s xor ratio %.2f, chimp ratio %.2f\n", pData->name, (double)nIn / szXor, (double)nIn / szChimp);
+    GTEST_ASSERT_GT(szXor, 0);
+    GTEST_ASSERT_GT(szChimp, 0);
+    GTEST_ASSERT_LT(szChimp, szXor);
+    if (szChimp * 10 < szXor * 9) {
+      GTEST_ASSERT_EQ(tsChooseCodec(pData->type, pIn, nIn, nRow, pOut, nOut, pBuf, nOut), CODEC_CHIMP);
+    }
+
+    // integers are not handled by chimp
+    GTEST_ASSERT_LT(tsCompressCodec(TSDB_DATA_TYPE_INT, CODEC_CHIMP, pIn, nIn / 4, nIn / 16, pOut, nOut, pBuf, nOut),
+                    0);
+
+    taosMemoryFree(pIn);
+    taosMemoryFree(pOut);
+    taosMemoryFree(pBuf);
+  }
+
+  // a smooth curve, chimp saves too little to be worth its slower decoding and the xor codec is kept
+  int32_t nIn = nRow * sizeof(double);
+  int32_t nOut = nIn + COMP_OVERFLOW_BYTES;
+  double *pIn = (double *)taosMemoryMalloc(nIn);
+  char   *pOut = (char *)taosMemoryMalloc(nOut);
+  char   *pBuf = (char *)taosMemoryMalloc(nOut);
+  for (int32_t i = 0; i < nRow; i++) pIn[i] = sin(i / 100.0);
+  GTEST_ASSERT_EQ(tsChooseCodec(TSDB_DATA_TYPE_DOUBLE, pIn, nIn, nRow, pOut, nOut, pBuf, nOut), CODEC_DEFAULT);
+  taosMemoryFree(pIn);
+  taosMemoryFree(pOut);
+  taosMemoryFree(pBuf);
+}
+
+TEST(TD_UTIL_COMPRESS_TEST, codec_benchmark) {
+  printf("%-20s %-12s %8s %12s %12s\n", "data", "codec", "ratio", "cmpr MB/s", "decmpr MB/s");
+
+  for (int32_t iData = 0; iData < tListLen(aData); iData++) {
+    SCodecData *pData = &aData[iData];
+    int32_t     nIn = nRow * pData->bytes;
+    int32_t     nOut = nIn + COMP_OVERFLOW_BYTES;
+    char       *pIn = (char *)taosMemoryMalloc(nIn);
+    char       *pOut = (char *)taosMemoryMalloc(nOut);
+    char       *pBuf = (char *)taosMemoryMalloc(nOut);
+    char       *pDec = (char *)taosMemoryMalloc(nIn);
+    pData->gen(pIn, nRow);
+
+    // adaptive samples every block, adaptive+hint reuses the codec of the previous block as the tsdb writer does
+    for (int32_t iCodec = 0; iCodec <= tListLen(aCodec) + 1; iCodec++) {
+      bool        adaptive = (iCodec >= tListLen(aCodec));
+      bool        hint = (iCodec > tListLen(aCodec));
+      int8_t      codec = adaptive ? CODEC_NONE : aCodec[iCodec].codec;
+      const char *name = adaptive ? (hint ? "adaptive+hint" : "adaptive") : aCodec[iCodec].name;
+      int32_t     size = 0;
+
+      int64_t start = taosGetTimestampUs();
+      for (int32_t i = 0; i < nLoop; i++) {
+        if (adaptive) {
+          if (!hint) codec = CODEC_NONE;
+          size = tsCompressAdaptive(pData->type, pIn, nIn, nRow, pOut, nOut, pBuf, nOut, &codec);
+        } else {
+          size = tsCompressCodec(pData->type, codec, pIn, nIn, nRow, pOut, nOut, pBuf, nOut);
+        }
+      }
+      int64_t cmprUs = taosGetTimestampUs() - start;
+      if (size < 0) {
+        printf("%-20s %-12s %8s\n", pData->name, name, "n/a");
+        continue;
+      }
+
+      start = taosGetTimestampUs();
+      for (int32_t i = 0; i < nLoop; i++) {
+        GTEST_ASSERT_EQ(tsDecompressCodec(pData->type, codec, pOut, size, nRow, pDec, nIn, pBuf, nOut), nIn);
+      }
+      int64_t decmprUs = taosGetTimestampUs() - start;
+      GTEST_ASSERT_EQ(memcmp(pIn, pDec, nIn), 0);
+
+      double mb = (double)nIn * nLoop / (1024 * 1024);
+      printf("%-20s %-12s %8.2f %12.1f %12.1f\n", pData->name, name, (double)nIn / size,
+             mb * 1000000 / TMAX(cmprUs, 1), mb * 1000000 / TMAX(decmprUs, 1));
+    }
+
+    taosMemoryFree(pIn);
+    taosMemoryFree(pOut);
+    taosMemoryFree(pBuf);
+    taosMemoryFree(pDec);
+  }
+}
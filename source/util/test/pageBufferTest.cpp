@@ -157,6 +157,67 @@ void recyclePageTest() {
 
   destroyDiskbasedBuf(pBuf);
 }
+
+// write more pages than the in-memory buffer, modify some of them and read all of them back
+void spillReloadTest() {
+  SDiskbasedBuf* pBuf = NULL;
+  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "2", TD_TMP_DIR_PATH);
+  ASSERT_EQ(ret, 0);
+
+  const int32_t numOfPages = 64;
+  for (int32_t i = 0; i < numOfPages; ++i) {
+    int32_t    pageId = 0;
+    SFilePage* pBufPage = static_cast<SFilePage*>(getNewBufPage(pBuf, &pageId));
+    ASSERT_TRUE(pBufPage != NULL);
+    ASSERT_EQ(pageId, i);
+
+    // the odd pages are incompressible
+    int32_t* p = (int32_t*)pBufPage;
+    for (int32_t j = 0; j < 1024 / sizeof(int32_t); ++j) {
+      p[j] = (i % 2 == 0) ? i : taosRand();
+    }
+    p[0] = i;
+
+    setBufPageDirty(pBufPage, true);
+    releaseBufPage(pBuf, pBufPage);
+  }
+
+  ASSERT_FALSE(isAllDataInMemBuf(pBuf));
+
+  // the rewritten pages become larger or smaller on disk
+  for (int32_t i = 0; i < numOfPages; i += 3) {
+    int32_t* p = static_cast<int32_t*>(getBufPage(pBuf, i));
+    ASSERT_TRUE(p != NULL);
+    ASSERT_EQ(p[0], i);
+
+    for (int32_t j = 1; j < 1024 / sizeof(int32_t); ++j) {
+      p[j] = (i % 2 == 0) ? taosRand() : i;
+    }
+    p[0] = i + numOfPages;
+
+    setBufPageDirty(p, true);
+    releaseBufPage(pBuf, p);
+  }
+
+  for (int32_t k = 0; k < 2; ++k) {
+    for (int32_t i = 0; i < numOfPages; ++i) {
+      int32_t* p = static_cast<int32_t*>(getBufPage(pBuf, i));
+      ASSERT_TRUE(p != NULL);
+      ASSERT_EQ(p[0], (i % 3 == 0) ? i + numOfPages : i);
+      if (i % 3 != 0 && i % 2 == 0) {
+        ASSERT_EQ(p[1024 / sizeof(int32_t) - 1], i);
+      }
+
+      releaseBufPage(pBuf, p);
+    }
+  }
+
+  SDiskbasedBufStatis statis = getDBufStatis(pBuf);
+  ASSERT_GT(statis.loadPages, 0);
+  ASSERT_LT(statis.flushBytes, (int64_t)statis.flushPages * 1024);
+
+  destroyDiskbasedBuf(pBuf);
+}
 }  // namespace
 
 TEST(testCase, resultBufferTest) {
@@ -164,6 +225,7 @@ TEST(testCase, resultBufferTest) {
   simpleTest();
   writeDownTest();
   recyclePageTest();
+  spillReloadTest();
 }
 
 #pragma GCC diagnostic pop
\ No newline at end of file
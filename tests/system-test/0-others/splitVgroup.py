@@ -0,0 +1,107 @@
+import time
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+
+
+class TDTestCase:
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+        self.dbname = "split_db"
+        self.ctbNum = 20
+        self.ntbNum = 4
+        self.rowNum = 100
+
+    def prepare_data(self):
+        tdSql.execute(f"drop database if exists {self.dbname}")
+        tdSql.execute(f"create database {self.dbname} vgroups 1")
+        tdSql.execute(f"use {self.dbname}")
+        tdSql.execute("create stable stb (ts timestamp, c1 int, c2 binary(16)) tags (t1 int)")
+        for i in range(self.ctbNum):
+            tdSql.execute(f"create table ct{i} using stb tags ({i})")
+        for i in range(self.ntbNum):
+            tdSql.execute(f"create table nt{i} (ts timestamp, c1 int, c2 binary(16))")
+        self.insert_rows(0)
+
+        # leave part of the rows in data files and part in the memtable
+        tdSql.execute(f"flush database {self.dbname}")
+        self.insert_rows(self.rowNum)
+
+    def insert_rows(self, start):
+        ts = 1640000000000
+        for i in range(self.ctbNum):
+            values = " ".join(f"({ts + j}, {j}, 'ct{i}')" for j in range(start, start + self.rowNum))
+            tdSql.execute(f"insert into ct{i} values {values}")
+        for i in range(self.ntbNum):
+            values = " ".join(f"({ts + j}, {j}, 'nt{i}')" for j in range(start, start + self.rowNum))
+            tdSql.execute(f"insert into nt{i} values {values}")
+
+    def vgroup_ids(self):
+        tdSql.query(f"select vgroup_id from information_schema.ins_vgroups where db_name = '{self.dbname}'")
+        return [row[0] for row in tdSql.queryResult]
+
+    def wait_vgroups(self, num):
+        for _ in range(60):
+            if len(self.vgroup_ids()) == num:
+                return
+            time.sleep(1)
+        tdLog.exit(f"{self.dbname} does not have {num} vgroups after split")
+
+    def check_rows(self, rowsPerTable):
+        tdSql.query(f"select count(*) from {self.dbname}.stb")
+        tdSql.checkData(0, 0, self.ctbNum * rowsPerTable)
+        for i in range(self.ntbNum):
+            tdSql.query(f"select count(*), last(c2) from {self.dbname}.nt{i}")
+            tdSql.checkData(0, 0, rowsPerTable)
+            tdSql.checkData(0, 1, f"nt{i}")
+
+        # every table is served by exactly one vgroup after the split
+        tdSql.query(f"select count(*) from information_schema.ins_tables where db_name = '{self.dbname}'")
+        tdSql.checkData(0, 0, self.ctbNum + self.ntbNum)
+        tdSql.query(f"select tbname, count(*) from {self.dbname}.stb partition by tbname")
+        tdSql.checkRows(self.ctbNum)
+
+    def split_test(self):
+        self.prepare_data()
+        self.check_rows(self.rowNum * 2)
+
+        vgIds = self.vgroup_ids()
+        tdSql.checkEqual(len(vgIds), 1)
+        tdSql.execute(f"split vgroup {vgIds[0]}")
+
+        # the split runs on its own worker, create and drop are not blocked by it
+        tdSql.execute("create database if not exists split_other vgroups 1")
+        tdSql.execute("drop database split_other")
+
+        self.wait_vgroups(2)
+        self.check_rows(self.rowNum * 2)
+
+        # rows written after the cut-over land in the new layout and survive commits of both vgroups
+        self.insert_rows(self.rowNum * 2)
+        tdSql.execute(f"flush database {self.dbname}")
+        self.check_rows(self.rowNum * 3)
+
+    def run(self):
+        self.split_test()
+
+        tdDnodes.stop(1)
+        tdDnodes.start(1)
+
+        tdLog.printNoPrefix("==========step2: check again after restart")
+        self.wait_vgroups(2)
+        self.check_rows(self.rowNum * 3)
+
+        self.insert_rows(self.rowNum * 3)
+        tdSql.execute(f"flush database {self.dbname}")
+        self.check_rows(self.rowNum * 4)
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
@@ -0,0 +1,93 @@
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+
+
+class TDTestCase:
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+        self.dbname = "schema_cache_db"
+        self.ctbNum = 4
+        self.ts = 1640000000000
+
+    def check_cols(self, tb, cols):
+        tdSql.query(f"describe {self.dbname}.{tb}")
+        names = [row[0] for row in tdSql.queryResult if row[3] != "TAG"]
+        tdSql.checkEqual(names, cols)
+
+    def insert_rows(self, tb, start, values):
+        rows = " ".join(f"({self.ts + start + i}, {values})" for i in range(10))
+        tdSql.execute(f"insert into {self.dbname}.{tb} values {rows}")
+
+    def run(self):
+        tdSql.execute(f"drop database if exists {self.dbname}")
+        tdSql.execute(f"create database {self.dbname} vgroups 1")
+        tdSql.execute(f"create stable {self.dbname}.stb (ts timestamp, c1 int) tags (t1 int)")
+        tdSql.execute(f"create table {self.dbname}.ntb (ts timestamp, c1 int)")
+        for i in range(self.ctbNum):
+            tdSql.execute(f"create table {self.dbname}.ct{i} using {self.dbname}.stb tags ({i})")
+            self.insert_rows(f"ct{i}", 0, "1")
+        self.insert_rows("ntb", 0, "1")
+
+        # the child tables are served the schema of the super table, each alter makes a new version of it
+        tdSql.execute(f"alter stable {self.dbname}.stb add column c2 binary(8)")
+        self.check_cols("ct0", ["ts", "c1", "c2"])
+        self.insert_rows("ct0", 100, "2, 'abc'")
+        tdSql.query(f"select count(c2) from {self.dbname}.stb")
+        tdSql.checkData(0, 0, 10)
+
+        tdSql.execute(f"alter stable {self.dbname}.stb modify column c2 binary(16)")
+        self.insert_rows("ct1", 200, "3, 'abcdefghijkl'")
+        tdSql.query(f"select c2 from {self.dbname}.ct1 where c1 = 3")
+        tdSql.checkRows(10)
+        tdSql.checkData(0, 0, "abcdefghijkl")
+
+        tdSql.execute(f"alter stable {self.dbname}.stb drop column c1")
+        self.check_cols("ct2", ["ts", "c2"])
+        tdSql.error(f"select c1 from {self.dbname}.ct2")
+        tdSql.query(f"select count(*) from {self.dbname}.stb")
+        tdSql.checkData(0, 0, self.ctbNum * 10 + 20)
+
+        # a normal table owns its schema
+        tdSql.execute(f"alter table {self.dbname}.ntb add column c2 double")
+        self.insert_rows("ntb", 100, "2, 2.5")
+        self.check_cols("ntb", ["ts", "c1", "c2"])
+        tdSql.query(f"select sum(c2) from {self.dbname}.ntb")
+        tdSql.checkData(0, 0, 25.0)
+
+        # the tables created again with the same names get other schemas
+        tdSql.execute(f"drop table {self.dbname}.ntb")
+        tdSql.execute(f"create table {self.dbname}.ntb (ts timestamp, d1 bigint, d2 nchar(4))")
+        self.insert_rows("ntb", 0, "7, 'x'")
+        self.check_cols("ntb", ["ts", "d1", "d2"])
+        tdSql.query(f"select sum(d1) from {self.dbname}.ntb")
+        tdSql.checkData(0, 0, 70)
+
+        tdSql.execute(f"drop stable {self.dbname}.stb")
+        tdSql.execute(f"create stable {self.dbname}.stb (ts timestamp, e1 float) tags (t1 int)")
+        tdSql.execute(f"create table {self.dbname}.ct0 using {self.dbname}.stb tags (0)")
+        self.insert_rows("ct0", 0, "1.5")
+        self.check_cols("ct0", ["ts", "e1"])
+        tdSql.query(f"select count(*), sum(e1) from {self.dbname}.stb")
+        tdSql.checkData(0, 0, 10)
+        tdSql.checkData(0, 1, 15.0)
+
+        # the schemas are loaded again from the meta after a restart
+        tdSql.execute(f"flush database {self.dbname}")
+        tdDnodes.stop(1)
+        tdDnodes.start(1)
+        self.check_cols("ct0", ["ts", "e1"])
+        tdSql.query(f"select count(*), sum(e1) from {self.dbname}.stb")
+        tdSql.checkData(0, 1, 15.0)
+        tdSql.query(f"select sum(d1) from {self.dbname}.ntb")
+        tdSql.checkData(0, 0, 70)
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
@@ -0,0 +1,106 @@
+import taos
+import threading
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+
+
+class TDTestCase:
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+        self.dbname = "del_skyline_db"
+        self.ctbNum = 20
+        self.rowNum = 1000
+        self.ts = 1640000000000
+        # rows deleted from each table, kept to compute the expected counts
+        self.deleted = [set() for _ in range(self.ctbNum)]
+
+    def prepare_data(self):
+        tdSql.execute(f"drop database if exists {self.dbname}")
+        tdSql.execute(f"create database {self.dbname} vgroups 1")
+        tdSql.execute(f"use {self.dbname}")
+        tdSql.execute("create stable stb (ts timestamp, c1 int) tags (t1 int)")
+        for i in range(self.ctbNum):
+            tdSql.execute(f"create table ct{i} using stb tags ({i})")
+            values = " ".join(f"({self.ts + j}, {j})" for j in range(self.rowNum))
+            tdSql.execute(f"insert into ct{i} values {values}")
+        tdSql.execute(f"flush database {self.dbname}")
+
+    def delete_rows(self, tb, start, end):
+        tdSql.execute(f"delete from {self.dbname}.ct{tb} where ts >= {self.ts + start} and ts < {self.ts + end}")
+        self.deleted[tb].update(range(max(start, 0), min(end, self.rowNum)))
+
+    def check_rows(self):
+        for i in range(self.ctbNum):
+            tdSql.query(f"select count(*), sum(c1) from {self.dbname}.ct{i}")
+            left = [j for j in range(self.rowNum) if j not in self.deleted[i]]
+            tdSql.checkData(0, 0, len(left))
+            if left:
+                tdSql.checkData(0, 1, sum(left))
+
+        tdSql.query(f"select count(*) from {self.dbname}.stb")
+        tdSql.checkData(0, 0, sum(self.rowNum - len(d) for d in self.deleted))
+
+    def query_loop(self, stop, errors):
+        cfg = "%s/taos.cfg" % tdDnodes.getSimCfgPath()
+        conn = taos.connect(config=cfg)
+        cursor = conn.cursor()
+        try:
+            while not stop.is_set():
+                for i in range(self.ctbNum):
+                    cursor.execute(f"select count(*) from {self.dbname}.ct{i}")
+                    cursor.fetchall()
+        except Exception as e:
+            errors.append(e)
+        finally:
+            cursor.close()
+            conn.close()
+
+    def run(self):
+        self.prepare_data()
+        self.check_rows()
+
+        # the tombstones of several commits, overlapping ones included, land in the del file of each version
+        for step in range(3):
+            for i in range(0, self.ctbNum, 2):
+                self.delete_rows(i, step * 100 + i, step * 100 + i + 150)
+            self.check_rows()
+            tdSql.execute(f"flush database {self.dbname}")
+            self.check_rows()
+
+        # the tables without tombstones are served from the cached del index as well
+        self.delete_rows(1, -10, 10)
+        tdSql.execute(f"flush database {self.dbname}")
+        self.check_rows()
+
+        # the readers share the cache while the commits replace the del file under them
+        stop = threading.Event()
+        errors = []
+        threads = [threading.Thread(target=self.query_loop, args=(stop, errors)) for _ in range(4)]
+        for t in threads:
+            t.start()
+        for step in range(5):
+            for i in range(1, self.ctbNum, 2):
+                self.delete_rows(i, 500 + step * 20 + i, 500 + step * 20 + i + 30)
+            tdSql.execute(f"flush database {self.dbname}")
+            self.check_rows()
+        stop.set()
+        for t in threads:
+            t.join()
+        if errors:
+            tdLog.exit(f"concurrent query failed: {errors[0]}")
+
+        tdDnodes.stop(1)
+        tdDnodes.start(1)
+        self.check_rows()
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
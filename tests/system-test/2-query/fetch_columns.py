@@ -0,0 +1,38 @@
+
+import taos
+import sys
+import os
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+from util.common import *
+
+class TDTestCase:
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+
+    def checkFetchColumns(self, dbname="fc_db"):
+        buildPath = tdCom.getBuildPath()
+        cmdStr = '%s/build/bin/fetch_columns_test'%(buildPath)
+        tdLog.info(cmdStr)
+        ret = os.system(cmdStr)
+        if ret != 0:
+            tdLog.exit("fetch_columns_test failed")
+
+        tdSql.query(f"select count(*) from {dbname}.st")
+        tdSql.checkData(0, 0, 10000)
+
+    def run(self):
+        tdSql.prepare()
+        self.checkFetchColumns()
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
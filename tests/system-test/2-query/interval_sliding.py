@@ -0,0 +1,98 @@
+import math
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+
+
+class TDTestCase:
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+        self.dbname = "sliding_db"
+        self.ctbNum = 3
+        self.rowNum = 200
+        self.ts = 1640000000000
+
+    def prepare_data(self):
+        tdSql.execute(f"drop database if exists {self.dbname}")
+        tdSql.execute(f"create database {self.dbname} vgroups 2")
+        tdSql.execute(f"use {self.dbname}")
+        tdSql.execute("create stable stb (ts timestamp, c1 int, c2 double, c3 binary(16), c4 nchar(8)) tags (t1 int)")
+        for i in range(self.ctbNum):
+            tdSql.execute(f"create table ct{i} using stb tags ({i})")
+        self.insert_rows(0, self.rowNum // 2)
+
+        # part of the rows in data files and part in the memtable, so that the panes are filled from several blocks
+        tdSql.execute(f"flush database {self.dbname}")
+        self.insert_rows(self.rowNum // 2, self.rowNum)
+
+    def insert_rows(self, start, end):
+        for i in range(self.ctbNum):
+            values = []
+            for j in range(start, end):
+                c1 = "null" if j % 7 == 3 else str((j * 13 + i) % 50 - 20)
+                c2 = "null" if j % 11 == 5 else str((j % 17) * 1.5 - i)
+                c3 = "null" if j % 5 == 0 else f"'b{j % 23}'"
+                c4 = f"'n{j % 19}'"
+                # irregular timestamps, so the rows do not line up with the panes
+                values.append(f"({self.ts + j * 1300 + i * 100}, {c1}, {c2}, {c3}, {c4})")
+            tdSql.execute(f"insert into ct{i} values {' '.join(values)}")
+
+    def check_same(self, sql, ref):
+        tdSql.query(sql)
+        res = tdSql.queryResult
+        tdSql.query(ref)
+        expect = tdSql.queryResult
+        if len(res) != len(expect):
+            tdLog.exit(f"{sql} returns {len(res)} rows, {ref} returns {len(expect)} rows")
+
+        for r in range(len(res)):
+            for c in range(len(res[r])):
+                v1, v2 = res[r][c], expect[r][c]
+                if isinstance(v1, float) and isinstance(v2, float):
+                    if not math.isclose(v1, v2, rel_tol=1e-9, abs_tol=1e-9):
+                        tdLog.exit(f"row {r} col {c} of {sql}: {v1} != {v2}")
+                elif v1 != v2:
+                    tdLog.exit(f"row {r} col {c} of {sql}: {v1} != {v2}")
+
+    def check_sliding(self, interval, sliding):
+        funcs = "first(c1), last(c1), first(c3), last(c3), last(c4), avg(c1), avg(c2), spread(c1), spread(c2), " \
+                "leastsquares(c1, 1, 1), count(*)"
+
+        # twa needs the interpolation of the window edges, so the query with it is not computed from panes
+        for tb in [f"{self.dbname}.ct0", f"{self.dbname}.ct{self.ctbNum - 1}"]:
+            sql = f"select _wstart, _wend, {funcs} from {tb} interval({interval}) sliding({sliding})"
+            ref = f"select _wstart, _wend, {funcs}, twa(c1) from {tb} interval({interval}) sliding({sliding})"
+            self.check_same(f"{sql} order by _wstart", f"select * from ({ref}) order by _wstart")
+
+        # several groups are merged from their own panes
+        sql = f"select tbname, _wstart, {funcs} from {self.dbname}.stb partition by tbname " \
+              f"interval({interval}) sliding({sliding})"
+        ref = f"select tbname, _wstart, {funcs}, twa(c1) from {self.dbname}.stb partition by tbname " \
+              f"interval({interval}) sliding({sliding})"
+        self.check_same(f"select * from ({sql}) order by tbname, _wstart",
+                        f"select * from ({ref}) order by tbname, _wstart")
+
+        # only a few rows, most panes of the windows are empty
+        cond = f"where ts >= {self.ts + 4000} and ts < {self.ts + 9000}"
+        sql = f"select _wstart, {funcs} from {self.dbname}.ct1 {cond} interval({interval}) sliding({sliding})"
+        ref = f"select _wstart, {funcs}, twa(c1) from {self.dbname}.ct1 {cond} interval({interval}) sliding({sliding})"
+        self.check_same(f"{sql} order by _wstart", f"select * from ({ref}) order by _wstart")
+
+    def run(self):
+        self.prepare_data()
+
+        self.check_sliding("10s", "5s")
+        self.check_sliding("10s", "4s")
+        self.check_sliding("9s", "2s")
+        self.check_sliding("20s", "3s")
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
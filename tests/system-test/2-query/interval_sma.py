@@ -0,0 +1,99 @@
+import math
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+
+
+class TDTestCase:
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor())
+        self.dbname = "interval_sma_db"
+        self.ctbNum = 2
+        self.rowNum = 3000
+        self.ts = 1640000000000
+
+    def prepare_data(self):
+        tdSql.execute(f"drop database if exists {self.dbname}")
+        # small blocks, so that some of them lie in one window and others span a window boundary
+        tdSql.execute(f"create database {self.dbname} vgroups 1 minrows 10 maxrows 200")
+        tdSql.execute(f"use {self.dbname}")
+        tdSql.execute("create stable stb (ts timestamp, c1 int, c2 double, c3 bigint) tags (t1 int)")
+        for i in range(self.ctbNum):
+            tdSql.execute(f"create table ct{i} using stb tags ({i})")
+
+        for i in range(self.ctbNum):
+            for start in range(0, self.rowNum, 500):
+                values = []
+                for j in range(start, start + 500):
+                    c1 = "null" if j % 13 == 7 else str((j * 7 + i) % 101 - 50)
+                    c2 = "null" if j % 29 == 3 else str((j % 37) * 0.25)
+                    values.append(f"({self.ts + j * 1000}, {c1}, {c2}, {j})")
+                tdSql.execute(f"insert into ct{i} values {' '.join(values)}")
+
+        # the block SMA only exists for the blocks in data files
+        tdSql.execute(f"flush database {self.dbname}")
+
+    def check_same(self, sql, ref):
+        tdSql.query(sql)
+        res = tdSql.queryResult
+        tdSql.query(ref)
+        expect = tdSql.queryResult
+        if len(res) != len(expect):
+            tdLog.exit(f"{sql} returns {len(res)} rows, {ref} returns {len(expect)} rows")
+
+        for r in range(len(res)):
+            for c in range(len(res[r])):
+                v1, v2 = res[r][c], expect[r][c]
+                if isinstance(v1, float) and isinstance(v2, float):
+                    if not math.isclose(v1, v2, rel_tol=1e-9, abs_tol=1e-9):
+                        tdLog.exit(f"row {r} col {c} of {sql}: {v1} != {v2}")
+                elif v1 != v2:
+                    tdLog.exit(f"row {r} col {c} of {sql}: {v1} != {v2}")
+
+    def check_interval(self, window, partition=""):
+        funcs = "_wstart, _wend, _wduration, count(*), count(c1), sum(c1), min(c1), max(c2), avg(c2), sum(c3)"
+        order = "_wstart"
+        if partition:
+            funcs = f"tbname, {funcs}"
+            order = f"tbname, {order}"
+
+        # a filter on a column makes the scan load the rows of every block, which is the reference
+        cond = "where c3 >= 0"
+        for tb in [f"{self.dbname}.ct0", f"{self.dbname}.stb"]:
+            sql = f"select {funcs} from {tb} {partition} {window}"
+            ref = f"select {funcs} from {tb} {cond} {partition} {window}"
+            self.check_same(f"select * from ({sql}) order by {order}", f"select * from ({ref}) order by {order}")
+
+    def run(self):
+        self.prepare_data()
+
+        # every block of 200 rows lies in one window
+        self.check_interval("interval(1h)")
+        self.check_interval("interval(10m)")
+        # the blocks span the window boundaries
+        self.check_interval("interval(1m)")
+        self.check_interval("interval(17s)")
+        # sliding windows, the blocks lie in one pane or span the pane boundaries
+        self.check_interval("interval(1h) sliding(20m)")
+        self.check_interval("interval(10m) sliding(4m)")
+        self.check_interval("interval(1m) sliding(20s)")
+        # the partition operator needs the rows of every block
+        self.check_interval("interval(10m)", "partition by tbname")
+        self.check_interval("interval(1m) sliding(30s)", "partition by tbname")
+
+        # the rows in the memtable have no SMA and are merged with the blocks in the files
+        tdSql.execute(f"insert into {self.dbname}.ct0 values ({self.ts + 10 * 1000}, 1000, 1000, 10) "
+                      f"({self.ts + self.rowNum * 1000}, 2000, 2000, {self.rowNum})")
+        self.check_interval("interval(10m)")
+        self.check_interval("interval(1m) sliding(20s)")
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
@@ -0,0 +1,139 @@
+
+import taos
+import sys
+import time
+import socket
+import os
+import threading
+
+from util.log import *
+from util.sql import *
+from util.cases import *
+from util.dnodes import *
+from util.common import *
+sys.path.append("./7-tmq")
+from tmqCommon import *
+
+class TDTestCase:
+    def __init__(self):
+        self.vgroups    = 4
+        self.ctbNum     = 10
+        self.rowsPerTbl = 2000
+
+    def init(self, conn, logSql):
+        tdLog.debug(f"start to excute {__file__}")
+        tdSql.init(conn.cursor(), False)
+
+    def prepareTestEnv(self, paraDict):
+        tdLog.printNoPrefix("======== prepare test env include database, stable, ctables, and insert data: ")
+        tmqCom.initConsumerTable()
+        tdCom.create_database(tdSql, paraDict["dbName"],paraDict["dropFlag"], vgroups=paraDict["vgroups"],replica=1)
+        tdLog.info("create stb")
+        tmqCom.create_stable(tdSql, dbName=paraDict["dbName"],stbName=paraDict["stbName"])
+        # the submits of the other stable land in the same wal, the polls of the topic find no data in them
+        tmqCom.create_stable(tdSql, dbName=paraDict["dbName"],stbName="stb_other")
+        tdLog.info("create ctb")
+        tmqCom.create_ctable(tdSql, dbName=paraDict["dbName"],stbName=paraDict["stbName"],ctbPrefix=paraDict['ctbPrefix'],
+                             ctbNum=paraDict["ctbNum"],ctbStartIdx=paraDict['ctbStartIdx'])
+        tmqCom.create_ctable(tdSql, dbName=paraDict["dbName"],stbName="stb_other",ctbPrefix="other",
+                             ctbNum=paraDict["ctbNum"],ctbStartIdx=paraDict['ctbStartIdx'])
+        self.insertData(paraDict, paraDict["startTs"])
+        return
+
+    def insertData(self, paraDict, startTs):
+        tdLog.info("insert data")
+        for ctbPrefix in [paraDict['ctbPrefix'], "other", paraDict['ctbPrefix']]:
+            tmqCom.insert_data_interlaceByMultiTbl(tsql=tdSql,dbName=paraDict["dbName"],ctbPrefix=ctbPrefix,
+                                                   ctbNum=paraDict["ctbNum"],rowsPerTbl=paraDict["rowsPerTbl"],batchNum=paraDict["batchNum"],
+                                                   startTs=startTs,ctbStartIdx=paraDict['ctbStartIdx'])
+            startTs += paraDict["rowsPerTbl"]
+
+    def consumeAndCheck(self, paraDict, consumerNum, keyList, totalRows, insertWhileConsuming=False):
+        tmqCom.initConsumerTable()
+        topicList = 'topic1'
+        ifcheckdata = 1
+        ifManualCommit = 1
+        for consumerId in range(consumerNum):
+            tmqCom.insertConsumerInfo(consumerId, totalRows, topicList, keyList, ifcheckdata, ifManualCommit)
+
+        tdLog.info("start consume processor")
+        tmqCom.startTmqSimProcess(pollDelay=paraDict['pollDelay'],dbName=paraDict["dbName"],showMsg=paraDict['showMsg'], showRow=paraDict['showRow'],snapshot=paraDict['snapshot'])
+
+        if insertWhileConsuming:
+            # the rows written while the consumers have polls in flight
+            self.insertData(paraDict, paraDict["startTs"] + paraDict["rowsPerTbl"] * 3)
+
+        tdLog.info("wait the consume result")
+        resultList = tmqCom.selectConsumeResult(consumerNum)
+        totalConsumeRows = 0
+        for i in range(consumerNum):
+            totalConsumeRows += resultList[i]
+
+        # a rebalance may deliver the uncommitted rows again, but no vgroup may be left behind
+        if totalConsumeRows < totalRows:
+            tdLog.info("act consume rows: %d, expect consume rows: %d"%(totalConsumeRows, totalRows))
+            tdLog.exit("tmq consume rows error!")
+        return resultList
+
+    def tmqCase1(self, paraDict):
+        tdLog.printNoPrefix("======== test case 1: one consumer, polls prefetched from the wal")
+        self.prepareTestEnv(paraDict)
+
+        queryString = "select * from %s.%s"%(paraDict['dbName'], paraDict['stbName'])
+        sqlString = "create topic %s as %s" %('topic1', queryString)
+        tdLog.info("create topic sql: %s"%sqlString)
+        tdSql.execute(sqlString)
+        tdSql.query(queryString)
+        totalRows = tdSql.getRows()
+
+        for prefetchNum in [1, 8]:
+            keyList = 'group.id:cgrp%d, enable.auto.commit:true, auto.commit.interval.ms:1000, auto.offset.reset:earliest, msg.prefetch.num:%d'%(prefetchNum, prefetchNum)
+            resultList = self.consumeAndCheck(paraDict, 1, keyList, totalRows)
+            if resultList[0] != totalRows:
+                tdLog.info("act consume rows: %d, expect consume rows: %d"%(resultList[0], totalRows))
+                tdLog.exit("tmq consume rows error with msg.prefetch.num %d!"%prefetchNum)
+
+        tdLog.printNoPrefix("======== test case 1 end ...... ")
+
+    def tmqCase2(self, paraDict):
+        tdLog.printNoPrefix("======== test case 2: consumers of one group rebalanced with prefetched polls buffered")
+        queryString = "select * from %s.%s"%(paraDict['dbName'], paraDict['stbName'])
+        tdSql.query(queryString)
+        totalRows = tdSql.getRows() * 2
+
+        keyList = 'group.id:cgrp_rebalance, enable.auto.commit:true, auto.commit.interval.ms:1000, auto.offset.reset:earliest, msg.prefetch.num:4'
+        self.consumeAndCheck(paraDict, 2, keyList, totalRows, insertWhileConsuming=True)
+
+        tmqCom.waitSubscriptionExit(tdSql, 'topic1')
+        tdSql.query("drop topic %s"%'topic1')
+        tdLog.printNoPrefix("======== test case 2 end ...... ")
+
+    def run(self):
+        paraDict = {'dbName':     'dbt',
+                    'dropFlag':   1,
+                    'event':      '',
+                    'vgroups':    self.vgroups,
+                    'stbName':    'stb',
+                    'ctbPrefix':  'ctb',
+                    'ctbStartIdx': 0,
+                    'ctbNum':     self.ctbNum,
+                    'rowsPerTbl': self.rowsPerTbl,
+                    'batchNum':   100,
+                    'startTs':    1640966400000,  # 2022-01-01 00:00:00.000
+                    'pollDelay':  10,
+                    'showMsg':    1,
+                    'showRow':    1,
+                    'snapshot':   0}
+
+        tdSql.prepare()
+        self.tmqCase1(paraDict)
+        self.tmqCase2(paraDict)
+
+    def stop(self):
+        tdSql.close()
+        tdLog.success(f"{__file__} successfully executed")
+
+event = threading.Event()
+
+tdCases.addLinux(__file__, TDTestCase())
+tdCases.addWindows(__file__, TDTestCase())
@@ -38,6 +38,7 @@ python3 ./test.py -f 1-insert/update_data_muti_rows.py
 python3 ./test.py -f 1-insert/db_tb_name_check.py
 python3 ./test.py -f 1-insert/database_pre_suf.py
 python3 ./test.py -f 0-others/show.py
+python3 ./test.py -f 0-others/splitVgroup.py
 python3 ./test.py -f 2-query/abs.py
 python3 ./test.py -f 2-query/abs.py -R
 python3 ./test.py -f 2-query/and_or_for_byte.py
@@ -160,6 +161,9 @@ python3 ./test.py -f 2-query/smaTest.py
 python3 ./test.py -f 2-query/smaTest.py -R
 python3 ./test.py -f 2-query/sml.py
 python3 ./test.py -f 2-query/sml.py -R
+python3 ./test.py -f 2-query/fetch_columns.py
+python3 ./test.py -f 2-query/interval_sliding.py
+python3 ./test.py -f 2-query/interval_sma.py
 python3 ./test.py -f 2-query/spread.py
 python3 ./test.py -f 2-query/spread.py -R
 python3 ./test.py -f 2-query/sqrt.py
@@ -209,6 +213,8 @@ python3 ./test.py -f 2-query/varchar.py -R
 python3 ./test.py -f 1-insert/update_data.py
 
 python3 ./test.py -f 1-insert/delete_data.py
+python3 ./test.py -f 1-insert/delete_skyline.py
+python3 ./test.py -f 1-insert/alter_schema_cache.py
 
 python3 ./test.py -f 2-query/join2.py
 python3 ./test.py -f 2-query/union1.py
@@ -302,6 +308,7 @@ python3 ./test.py -f 7-tmq/tmqCheckData.py
 python3 ./test.py -f 7-tmq/tmqCheckData1.py
 #python3 ./test.py -f 7-tmq/tmq3mnodeSwitch.py -N 5
 python3 ./test.py -f 7-tmq/tmqConsumerGroup.py
+python3 ./test.py -f 7-tmq/tmqPrefetch.py
 #python3 ./test.py -f 7-tmq/tmqShow.py
 python3 ./test.py -f 7-tmq/tmqAlterSchema.py
 python3 ./test.py -f 7-tmq/tmqConsFromTsdb.py
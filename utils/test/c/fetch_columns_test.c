@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// check the columns returned by taos_fetch_columns against the rows returned by taos_fetch_row for the same query
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "taos.h"
+
+#define FC_NUM_OF_ROWS 10000
+
+static int32_t executeSql(TAOS *taos, const char *sql) {
+  TAOS_RES *pRes = taos_query(taos, sql);
+  int32_t   code = taos_errno(pRes);
+  if (code != 0) {
+    printf("failed to execute sql:%s, reason:%s\n", sql, taos_errstr(pRes));
+  }
+  taos_free_result(pRes);
+  return code;
+}
+
+static void formatValue(char *buf, int32_t size, bool isNull, const char *format, ...) {
+  if (isNull) {
+    snprintf(buf, size, "null");
+    return;
+  }
+
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buf, size, format, args);
+  va_end(args);
+}
+
+static int32_t prepareData(TAOS *taos) {
+  if (executeSql(taos, "drop database if exists fc_db") != 0) return -1;
+  if (executeSql(taos, "create database if not exists fc_db vgroups 2") != 0) return -1;
+  if (executeSql(taos, "use fc_db") != 0) return -1;
+  if (executeSql(taos,
+                 "create stable st (ts timestamp, c1 int, c2 bool, c3 double, c4 binary(32), c5 nchar(16), c6 tinyint) "
+                 "tags (t1 int, t2 nchar(8))") != 0) {
+    return -1;
+  }
+
+  char    sql[65536];
+  int64_t ts = 1640966400000;
+  for (int32_t t = 0; t < 4; ++t) {
+    int32_t rows = 0;
+    while (rows < FC_NUM_OF_ROWS / 4) {
+      int32_t len = snprintf(sql, sizeof(sql), "insert into ct%d using st tags(%d, 'tag%d') values", t, t, t);
+      for (int32_t i = 0; i < 200 && rows < FC_NUM_OF_ROWS / 4; ++i, ++rows) {
+        int64_t k = ts + rows;
+        // sprinkle nulls with different periods so that every bitmap byte pattern shows up
+        char c1[16], c2[8], c3[32], c4[48], c5[32], c6[8];
+        formatValue(c1, sizeof(c1), rows % 3 == 0, "%d", rows * (t + 1) - 5000);
+        formatValue(c2, sizeof(c2), rows % 5 == 1, "%s", (rows % 2) ? "true" : "false");
+        formatValue(c3, sizeof(c3), rows % 7 == 2, "%f", rows * 0.25);
+        formatValue(c4, sizeof(c4), rows % 4 == 3, "'b%d_%.*s'", rows, rows % 20, "xxxxxxxxxxxxxxxxxxxx");
+        formatValue(c5, sizeof(c5), rows % 6 == 4, "'涛思%d'", rows % 1000);
+        formatValue(c6, sizeof(c6), rows % 9 == 5, "%d", rows % 100);
+        len += snprintf(sql + len, sizeof(sql) - len, " (%" PRId64 ", %s, %s, %s, %s, %s, %s)", k, c1, c2, c3, c4, c5,
+                        c6);
+      }
+      if (executeSql(taos, sql) != 0) return -1;
+    }
+  }
+
+  return 0;
+}
+
+static int32_t compareValue(const TAOS_COLUMN *pColumn, int32_t row, const void *pRowVal, int32_t rowLen) {
+  bool isValid = (pColumn->validity[row >> 3] >> (row & 7)) & 1;
+  if (pRowVal == NULL) {
+    return isValid ? -1 : 0;
+  }
+
+  if (!isValid) {
+    return -1;
+  }
+
+  if (pColumn->offsets != NULL) {
+    int32_t len = pColumn->offsets[row + 1] - pColumn->offsets[row];
+    if (len != rowLen) return -1;
+    return memcmp((const char *)pColumn->data + pColumn->offsets[row], pRowVal, len) == 0 ? 0 : -1;
+  }
+
+  if (pColumn->type == TSDB_DATA_TYPE_BOOL) {
+    bool val = (((const uint8_t *)pColumn->data)[row >> 3] >> (row & 7)) & 1;
+    return val == (*(const int8_t *)pRowVal != 0) ? 0 : -1;
+  }
+
+  return memcmp((const char *)pColumn->data + (int64_t)row * pColumn->bytes, pRowVal, pColumn->bytes) == 0 ? 0 : -1;
+}
+
+static int32_t checkQuery(TAOS *taos, const char *sql) {
+  TAOS_RES *pRowRes = taos_query(taos, sql);
+  TAOS_RES *pColRes = taos_query(taos, sql);
+  int32_t   code = -1;
+  int64_t   total = 0;
+
+  if (taos_errno(pRowRes) != 0 || taos_errno(pColRes) != 0) {
+    printf("failed to query sql:%s, reason:%s\n", sql, taos_errstr(pRowRes));
+    goto _OVER;
+  }
+
+  int32_t numOfFields = taos_num_fields(pRowRes);
+  while (1) {
+    TAOS_COLUMN *columns = NULL;
+    int          numOfRows = 0;
+    if (taos_fetch_columns(pColRes, &numOfRows, &columns) != 0) {
+      printf("failed to fetch columns, reason:%s\n", taos_errstr(pColRes));
+      goto _OVER;
+    }
+
+    if (numOfRows == 0) {
+      if (taos_fetch_row(pRowRes) != NULL) {
+        printf("taos_fetch_columns finished early at row %" PRId64 "\n", total);
+        goto _OVER;
+      }
+      break;
+    }
+
+    for (int32_t i = 0; i < numOfFields; ++i) {
+      int32_t nullCount = 0;
+      for (int32_t j = 0; j < numOfRows; ++j) {
+        nullCount += ((columns[i].validity[j >> 3] >> (j & 7)) & 1) ? 0 : 1;
+      }
+      if (columns[i].length != numOfRows || nullCount != columns[i].nullCount) {
+        printf("column %d mismatch length:%d nullCount:%d, expect %d %d\n", i, columns[i].length,
+               columns[i].nullCount, numOfRows, nullCount);
+        goto _OVER;
+      }
+    }
+
+    for (int32_t j = 0; j < numOfRows; ++j) {
+      TAOS_ROW row = taos_fetch_row(pRowRes);
+      if (row == NULL) {
+        printf("taos_fetch_row finished early at row %" PRId64 "\n", total);
+        goto _OVER;
+      }
+
+      int *lengths = taos_fetch_lengths(pRowRes);
+      for (int32_t i = 0; i < numOfFields; ++i) {
+        if (compareValue(&columns[i], j, row[i], lengths[i]) != 0) {
+          printf("value mismatch at row %" PRId64 " column %d\n", total, i);
+          goto _OVER;
+        }
+      }
+      total += 1;
+    }
+  }
+
+  printf("%s: %" PRId64 " rows checked\n", sql, total);
+  code = 0;
+
+_OVER:
+  taos_free_result(pRowRes);
+  taos_free_result(pColRes);
+  return code;
+}
+
+int main(int argc, char *argv[]) {
+  TAOS *taos = taos_connect("localhost", "root", "taosdata", NULL, 0);
+  if (taos == NULL) {
+    printf("failed to connect to server, reason:%s\n", taos_errstr(NULL));
+    return -1;
+  }
+
+  const char *sqls[] = {
+      "select * from fc_db.st order by ts, t1",
+      "select ts, c4, c5, t2, tbname from fc_db.ct2",
+      "select c1, c2, c3 from fc_db.ct1 where c1 is null",
+      "select count(*), last(c4), avg(c3) from fc_db.ct0 interval(1s)",
+      "select * from fc_db.st where c1 > 1000000",
+  };
+
+  int32_t code = prepareData(taos);
+  for (int32_t i = 0; i < sizeof(sqls) / sizeof(sqls[0]) && code == 0; ++i) {
+    code = checkQuery(taos, sqls[i]);
+  }
+
+  taos_close(taos);
+  taos_cleanup();
+
+  if (code != 0) {
+    printf("fetch columns test failed\n");
+    return -1;
+  }
+
+  printf("fetch columns test passed\n");
+  return 0;
+}